@@ -18,10 +18,21 @@ function(COMPILE_SPIRV_SHADER SHADER_FILE SHADER_INCLUDE_DIRS)
     list(TRANSFORM SHADER_INCLUDE_DIRS PREPEND "-i;" OUTPUT_VARIABLE  SHADER_INCLUDE_DIRS_PARAMETER)
     string (REPLACE ";" " " SHADER_INCLUDE_DIRS_STRING "${SHADER_INCLUDE_DIRS_PARAMETER}")
 
+    # the preprocessor lists the included files in a depfile, so changing a header rebuilds the shaders using it.
+    set(PREPROCESSOR_DEPFILE_PARAMETER "")
+    set(PREPROCESSOR_DEPFILE_OPTION "")
+    if(CMAKE_GENERATOR MATCHES "Ninja" OR (CMAKE_GENERATOR MATCHES "Makefiles" AND NOT CMAKE_VERSION VERSION_LESS 3.20)
+       OR NOT CMAKE_VERSION VERSION_LESS 3.21)
+        set(PREPROCESSOR_DEPFILE "${PREPROCESSOR_OUTPUT}.d")
+        set(PREPROCESSOR_DEPFILE_PARAMETER -d ${PREPROCESSOR_DEPFILE})
+        set(PREPROCESSOR_DEPFILE_OPTION DEPFILE ${PREPROCESSOR_DEPFILE})
+    endif()
+
     add_custom_command(
         OUTPUT ${PREPROCESSOR_OUTPUT} 
         COMMAND vkfw_glsl_preprocessor ${SHADER_FILE} ${SHADER_INCLUDE_DIRS_PARAMETER} -o ${PREPROCESSOR_OUTPUT}
-        DEPENDS ${SHADER_FILE} COMMAND_EXPAND_LISTS)
+                ${PREPROCESSOR_DEPFILE_PARAMETER}
+        DEPENDS ${SHADER_FILE} ${PREPROCESSOR_DEPFILE_OPTION} COMMAND_EXPAND_LISTS)
     add_custom_command(
         OUTPUT ${COMPILE_OUTPUT} 
         COMMAND ${GLSLANG_EXECUTABLE} -V ${PREPROCESSOR_OUTPUT} --target-env vulkan1.2 -o ${COMPILE_OUTPUT} 
@@ -24,11 +24,15 @@ namespace vkfw_core::cfg {
 
 namespace vkfw_core::gfx {
     class LogicalDevice;
+    class RuntimeShaderCompiler;
 }
 
 namespace vkfw_core {
 
     class VKWindow;
+    class FileWatcher;
+    class ResourcePathIndex;
+    class ShaderCache;
 
     class ApplicationBase
     {
@@ -70,6 +74,15 @@ namespace vkfw_core {
         virtual void Resize(const glm::uvec2& screenSize, VKWindow* window);
 
         [[nodiscard]] const cfg::Configuration& GetConfig() const { return m_config; };
+        /** Returns the index resolving files in the resource directories. */
+        [[nodiscard]] ResourcePathIndex& GetResourcePathIndex() const { return *m_resourcePathIndex; }
+        /** Returns the compiler for shaders without a build step, e.g., shader variants. */
+        [[nodiscard]] const gfx::RuntimeShaderCompiler& GetRuntimeShaderCompiler() const
+        {
+            return *m_runtimeShaderCompiler;
+        }
+        /** Returns the cache of shaders compiled at runtime or nullptr if it is disabled. */
+        [[nodiscard]] ShaderCache* GetShaderCache() const { return m_shaderCache.get(); }
         [[nodiscard]] const std::vector<const char*>& GetVKValidationLayers() const { return m_vkValidationLayers; }
         [[nodiscard]] vk::Instance GetVKInstance() const { return *m_vkInstance; }
         [[nodiscard]] std::unique_ptr<gfx::LogicalDevice>
@@ -87,6 +100,12 @@ namespace vkfw_core {
             const GLFWInitObject& operator=(const GLFWInitObject&) = delete;
             const GLFWInitObject& operator=(GLFWInitObject&&) = delete;
             ~GLFWInitObject();
+
+            [[nodiscard]] bool IsInitialized() const { return m_initialized; }
+
+        private:
+            /** Holds whether GLFW could be initialized (fails without a display). */
+            bool m_initialized;
         };
 
         GLFWInitObject m_forceGLFWInit;
@@ -100,6 +119,14 @@ namespace vkfw_core {
         cfg::Configuration m_config;
         /** Holds the windows. */
         std::vector<VKWindow> m_windows;
+        /** Holds the index of the resource directories. */
+        std::unique_ptr<ResourcePathIndex> m_resourcePathIndex;
+        /** Holds the cache of shaders compiled at runtime. */
+        std::unique_ptr<ShaderCache> m_shaderCache;
+        /** Holds the compiler for shaders without a build step. */
+        std::unique_ptr<gfx::RuntimeShaderCompiler> m_runtimeShaderCompiler;
+        /** Holds the watcher of the resource directories if hot reloading is enabled. */
+        std::unique_ptr<FileWatcher> m_fileWatcher;
 
         // application status
         /** <c>true</c> if application is paused. */
@@ -141,6 +168,8 @@ namespace vkfw_core {
                                                                 const std::string& extensionName,
                                                                 bool mandatory = false) const;
 
+        /** Returns the application time in seconds, also if GLFW is not available (headless). */
+        [[nodiscard]] double GetTime() const;
         static void CheckVKInstanceExtensions(const std::vector<const char*>& enabledExtensions);
         void CheckVKInstanceLayers();
 
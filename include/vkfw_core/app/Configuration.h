@@ -139,6 +139,20 @@ namespace vkfw_core::cfg {
         bool m_useRayTracing = false;
         /** Holds the queues needed. */
         std::vector<QueueCfg> m_queues = {QueueCfg{}};
+        /** Holds whether device memory is sub-allocated from pooled memory blocks. */
+        bool m_useMemoryPool = true;
+        /** Holds the size of memory blocks for device local memory. */
+        std::size_t m_deviceMemoryBlockSize = 256ULL * 1024ULL * 1024ULL;
+        /** Holds the size of memory blocks for host visible memory. */
+        std::size_t m_hostMemoryBlockSize = 64ULL * 1024ULL * 1024ULL;
+        /** Holds the size of the ring buffer used for staging uploads. */
+        std::size_t m_stagingBufferSize = 32ULL * 1024ULL * 1024ULL;
+        /** Holds whether the window renders offscreen without a surface (no GLFW window, swapchain or GUI). */
+        bool m_headless = false;
+        /** Holds the number of frames the CPU may record ahead of the GPU (independent of the swapchain images). */
+        std::size_t m_framesInFlight = 2;
+        /** Holds whether headless frames wait for the data available semaphore, the application then signals it. */
+        bool m_headlessWaitsForData = false;
 
         /**
         * Saving method for boost serialization.
@@ -160,7 +174,14 @@ namespace vkfw_core::cfg {
                 cereal::make_nvp("useSRGB", m_useSRGB),
                 cereal::make_nvp("swapOptions", m_swapOptions),
                 cereal::make_nvp("useRayTracing", m_useRayTracing),
-                cereal::make_nvp("queues", m_queues));
+                cereal::make_nvp("queues", m_queues),
+                cereal::make_nvp("useMemoryPool", m_useMemoryPool),
+                cereal::make_nvp("deviceMemoryBlockSize", m_deviceMemoryBlockSize),
+                cereal::make_nvp("hostMemoryBlockSize", m_hostMemoryBlockSize),
+                cereal::make_nvp("stagingBufferSize", m_stagingBufferSize),
+                cereal::make_nvp("headless", m_headless),
+                cereal::make_nvp("framesInFlight", m_framesInFlight),
+                cereal::make_nvp("headlessWaitsForData", m_headlessWaitsForData));
         }
 
         /**
@@ -180,6 +201,15 @@ namespace vkfw_core::cfg {
                cereal::make_nvp("swapOptions", m_swapOptions));
             if (version >= 2) ar(cereal::make_nvp("useRayTracing", m_useRayTracing));
             ar(cereal::make_nvp("queues", m_queues));
+            if (version >= 3) {
+                ar(cereal::make_nvp("useMemoryPool", m_useMemoryPool),
+                   cereal::make_nvp("deviceMemoryBlockSize", m_deviceMemoryBlockSize),
+                   cereal::make_nvp("hostMemoryBlockSize", m_hostMemoryBlockSize));
+            }
+            if (version >= 4) ar(cereal::make_nvp("stagingBufferSize", m_stagingBufferSize));
+            if (version >= 5) ar(cereal::make_nvp("headless", m_headless));
+            if (version >= 6) ar(cereal::make_nvp("framesInFlight", m_framesInFlight));
+            if (version >= 7) ar(cereal::make_nvp("headlessWaitsForData", m_headlessWaitsForData));
         }
     };
 
@@ -206,6 +236,16 @@ namespace vkfw_core::cfg {
         std::vector<std::string> m_resourceDirs;
         /** Holds the directory for evaluation results. */
         std::string m_evalDirectory = "evaluation";
+        /** Holds the number of threads recording secondary command buffers per window (1 records on the main thread). */
+        std::size_t m_recordingThreads = 1;
+        /** Holds whether changed shaders and textures in the resource directories are reloaded while running. */
+        bool m_hotReload = false;
+        /** Holds the time in milliseconds a changed file needs to stay unchanged before it is reloaded. */
+        std::size_t m_hotReloadDebounceMs = 200;
+        /** Holds the directory caching shaders compiled at runtime (empty disables the cache). */
+        std::string m_shaderCacheDirectory = "shader_cache";
+        /** Holds the maximum size of the shader cache in MiB. */
+        std::size_t m_shaderCacheBudgetMB = 256;
 
         /**
          * Saving method for boost serialization.
@@ -220,7 +260,12 @@ namespace vkfw_core::cfg {
                 cereal::make_nvp("pauseOnKillFocus", m_pauseOnKillFocus),
                 cereal::make_nvp("resourceBase", m_resourceBase),
                 cereal::make_nvp("resourceDirectories", m_resourceDirs),
-                cereal::make_nvp("evalDirectory", m_evalDirectory));
+                cereal::make_nvp("evalDirectory", m_evalDirectory),
+                cereal::make_nvp("recordingThreads", m_recordingThreads),
+                cereal::make_nvp("hotReload", m_hotReload),
+                cereal::make_nvp("hotReloadDebounceMs", m_hotReloadDebounceMs),
+                cereal::make_nvp("shaderCacheDirectory", m_shaderCacheDirectory),
+                cereal::make_nvp("shaderCacheBudgetMB", m_shaderCacheBudgetMB));
         }
 
         /**
@@ -229,7 +274,7 @@ namespace vkfw_core::cfg {
          * @param version the archives version.
          */
         template<class Archive>
-        void load(Archive & ar, std::uint32_t const)
+        void load(Archive & ar, std::uint32_t const version)
         {
             ar(cereal::make_nvp("windows", m_windows),
                 cereal::make_nvp("useValidationLayers", m_useValidationLayers),
@@ -237,6 +282,15 @@ namespace vkfw_core::cfg {
                 cereal::make_nvp("resourceBase", m_resourceBase),
                 cereal::make_nvp("resourceDirectories", m_resourceDirs),
                 cereal::make_nvp("evalDirectory", m_evalDirectory));
+            if (version >= 2) ar(cereal::make_nvp("recordingThreads", m_recordingThreads));
+            if (version >= 3) {
+                ar(cereal::make_nvp("hotReload", m_hotReload),
+                   cereal::make_nvp("hotReloadDebounceMs", m_hotReloadDebounceMs));
+            }
+            if (version >= 4) {
+                ar(cereal::make_nvp("shaderCacheDirectory", m_shaderCacheDirectory),
+                   cereal::make_nvp("shaderCacheBudgetMB", m_shaderCacheBudgetMB));
+            }
         }
     };
 }
@@ -244,6 +298,6 @@ namespace vkfw_core::cfg {
 // NOLINTNEXTLINE(cert-err58-cpp,misc-definitions-in-headers)
 CEREAL_CLASS_VERSION(vkfw_core::cfg::QueueCfg, 1)
 // NOLINTNEXTLINE(cert-err58-cpp,misc-definitions-in-headers)
-CEREAL_CLASS_VERSION(vkfw_core::cfg::WindowCfg, 2)
+CEREAL_CLASS_VERSION(vkfw_core::cfg::WindowCfg, 7)
 // NOLINTNEXTLINE(cert-err58-cpp,misc-definitions-in-headers)
-CEREAL_CLASS_VERSION(vkfw_core::cfg::Configuration, 1)
+CEREAL_CLASS_VERSION(vkfw_core::cfg::Configuration, 4)
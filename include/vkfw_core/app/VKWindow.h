@@ -14,7 +14,9 @@
 #include "gfx/vk/wrappers/VulkanSyncResources.h"
 #include "gfx/vk/wrappers/CommandBuffer.h"
 #include "gfx/vk/wrappers/DescriptorPool.h"
+#include "core/frame_statistics.h"
 
+#include <chrono>
 #include <glm/vec2.hpp>
 
 #include <core/function_view.h>
@@ -26,6 +28,7 @@ namespace vkfw_core::gfx {
     class LogicalDevice;
     class DescriptorSet;
     class VertexInputResources;
+    class ParallelCommandRecorder;
 }
 
 struct ImGui_ImplVulkanH_Window;
@@ -47,6 +50,8 @@ namespace vkfw_core {
         ~VKWindow() noexcept;
 
         [[nodiscard]] bool IsFocused() const { return m_focused; }
+        /** Returns whether the window renders offscreen without a surface and presentation. */
+        [[nodiscard]] bool IsHeadless() const { return m_config->m_headless; }
         [[nodiscard]] bool IsClosing() const;
         void ShowWindow() const;
         void CloseWindow() const;
@@ -75,21 +80,55 @@ namespace vkfw_core {
 
 
         void ForceResizeEvent() { m_frameBufferResize = true; }
+        /** Waits until the current frame slot is processed by the GPU, recycles its resources and acquires an image. */
         void PrepareFrame();
         // TODO: submit other command buffers to queue. [10/26/2016 Sebastian Maisch]
         void DrawCurrentCommandBuffer();
         void SubmitFrame();
 
-        // for primary cmd buffer: dirty bit, update if needed. (start cmd buffer, end cmd buffer; render pass needs to be started and ended with BeginSwapchainRenderPass and EndSwapchainRenderpass.)
-        void UpdatePrimaryCommandBuffers(const function_view<void(gfx::CommandBuffer& commandBuffer,
-                                                                  std::size_t cmdBufferIndex)>& fillFunc);
-        void BeginSwapchainRenderPass(std::size_t cmdBufferIndex, std::span<gfx::DescriptorSet*> descriptorSets,
-                                      std::span<gfx::VertexInputResources*> vertexInputs);
-        void EndSwapchainRenderPass(std::size_t cmdBufferIndex) const;
+        /**
+         *  Records the primary command buffer of the current frame (one time submit, call once per frame between
+         *  PrepareFrame and DrawCurrentCommandBuffer). The render pass needs to be started and ended with
+         *  BeginSwapchainRenderPass and EndSwapchainRenderPass. If it is not called, the image is only cleared.
+         *  @param fillFunc records the commands, gets the command buffer and the index of the image rendered to.
+         */
+        void RecordCommandBuffer(const function_view<void(gfx::CommandBuffer& commandBuffer,
+                                                          std::size_t imageIndex)>& fillFunc);
+        void BeginSwapchainRenderPass(std::size_t imageIndex, std::span<gfx::DescriptorSet*> descriptorSets,
+                                      std::span<gfx::VertexInputResources*> vertexInputs,
+                                      vk::SubpassContents subpassContents = vk::SubpassContents::eInline);
+        void EndSwapchainRenderPass(std::size_t imageIndex) const;
+        /** Returns the inheritance info for secondary command buffers continuing the swap chain render pass. */
+        [[nodiscard]] vk::CommandBufferInheritanceInfo GetSwapchainInheritanceInfo(std::size_t imageIndex) const;
+        /**
+         *  Returns the recorder for secondary command buffers with cfg::Configuration::m_recordingThreads threads or
+         *  nullptr if commands are recorded on the main thread only. Use GetCurrentFrameIndex() as its frame slot.
+         */
+        [[nodiscard]] gfx::ParallelCommandRecorder* GetCommandRecorder() const { return m_commandRecorder.get(); }
+        /** Keeps a resource alive until the GPU finished the current frame. */
+        void AddFrameResource(std::shared_ptr<void> resource);
 
         [[nodiscard]] std::uint32_t GetCurrentlyRenderedImageIndex() const { return m_currentlyRenderedImage; }
+        /** Returns the number of frames the CPU may record ahead of the GPU. */
+        [[nodiscard]] std::size_t GetFramesInFlight() const { return m_frames.size(); }
+        /** Returns the frame slot in [0, GetFramesInFlight()) used by the current frame, e.g., for per frame buffers. */
+        [[nodiscard]] std::size_t GetCurrentFrameIndex() const { return m_currentFrame; }
+        /** Returns the frame pacing and latency statistics. */
+        [[nodiscard]] const FrameStatistics& GetFrameStatistics() const { return m_frameStatistics; }
+        /** Returns the semaphore frames wait for, headless windows only wait if m_headlessWaitsForData is set. */
         [[nodiscard]] const gfx::Semaphore& GetDataAvailableSemaphore() const { return m_dataAvailableSemaphore; }
-        [[nodiscard]] const gfx::Semaphore& GetRenderingFinishedSemaphore() const { return m_renderingFinishedSemaphore; }
+        [[nodiscard]] const gfx::Semaphore& GetRenderingFinishedSemaphore() const
+        {
+            return m_renderingFinishedSemaphores[m_currentlyRenderedImage];
+        }
+
+        /**
+         *  Copies the color attachment of a frame buffer of a headless window to host memory.
+         *  Waits until the last frame rendered to this frame buffer is finished.
+         *  @param imageIndex the index of the frame buffer (e.g., GetCurrentlyRenderedImageIndex() after SubmitFrame).
+         *  @return the pixels row by row without padding in the format of the color attachment.
+         */
+        [[nodiscard]] std::vector<std::uint8_t> ReadbackImage(std::size_t imageIndex);
 
     private:
         void WindowPosCallback(int xpos, int ypos) const;
@@ -110,6 +149,31 @@ namespace vkfw_core {
 
         void SetMousePosition(double xpos, double ypos);
 
+        /** The resources used by a single frame in flight. */
+        struct FrameResources
+        {
+            /** Holds the command pool for all command buffers of the frame (reset when the frame slot is reused). */
+            gfx::CommandPool m_commandPool;
+            /** Holds the primary command buffer. */
+            gfx::CommandBuffer m_commandBuffer;
+            /** Holds the command buffer for ImGui. */
+            gfx::CommandBuffer m_imGuiCommandBuffer;
+            /** Holds the semaphore to notify when the swap chain image of this frame is available. */
+            gfx::Semaphore m_imageAvailableSemaphore;
+            /** Holds the timeline point of the graphics queue reached when the GPU finished the frame. */
+            gfx::TimelinePoint m_finishPoint;
+            /** Holds resources that need to be kept alive until the GPU finished the frame. */
+            std::vector<std::shared_ptr<void>> m_frameResources;
+            /** Holds whether the command buffer was recorded for the current frame. */
+            bool m_recorded = false;
+            /** Holds whether the frame was submitted and its timings are not yet in the statistics. */
+            bool m_pendingTiming = false;
+            /** Holds the time the frame began on the CPU. */
+            std::chrono::steady_clock::time_point m_beginTime;
+            /** Holds the CPU time since the previous frame began in milliseconds. */
+            double m_frameTime = 0.0;
+        };
+
         /** Holds the GLFW window. */
         GLFWwindow* m_window;
         /** Holds the configuration for this window. */
@@ -131,24 +195,24 @@ namespace vkfw_core {
         gfx::RenderPass m_imGuiRenderPass;
         /** Holds the swap chain frame buffers. */
         std::vector<gfx::Framebuffer> m_swapchainFramebuffers;
-        /** Command pools for the swap chain cmd buffers (later: not only primary). */
-        std::vector<gfx::CommandPool> m_commandPools;
-        /** Holds the swap chain command buffers. */
-        std::vector<gfx::CommandBuffer> m_commandBuffers;
-        /** Command pools for the ImGui cmd buffers. */
-        std::vector<gfx::CommandPool> m_imGuiCommandPools;
-        /** Holds the command buffers for ImGui. */
-        std::vector<gfx::CommandBuffer> m_imGuiCommandBuffers;
-        /** Hold a fence for each command buffer to signal it is processed. */
-        std::vector<gfx::Fence> m_cmdBufferFences;
-        /** Holds the semaphore to notify when a new swap image is available. */
-        gfx::Semaphore m_imageAvailableSemaphore;
+        /** Holds the resources of each frame in flight. */
+        std::vector<FrameResources> m_frames;
+        /** Holds the recorder for secondary command buffers (nullptr if recording is single threaded). */
+        std::unique_ptr<gfx::ParallelCommandRecorder> m_commandRecorder;
         /** Holds the semaphore to notify when the data for that frame is uploaded to the GPU. */
         gfx::Semaphore m_dataAvailableSemaphore;
-        /** Holds the semaphore to notify when rendering is finished. */
-        gfx::Semaphore m_renderingFinishedSemaphore;
+        /** Holds a semaphore for each swap chain image to notify when rendering to it is finished. */
+        std::vector<gfx::Semaphore> m_renderingFinishedSemaphores;
         /** Holds the currently rendered image. */
         std::uint32_t m_currentlyRenderedImage = 0;
+        /** Holds the frame slot of the current frame. */
+        std::size_t m_currentFrame = 0;
+        /** Holds whether an image was acquired for the current frame (false if the swap chain was out of date). */
+        bool m_imageAcquired = false;
+        /** Holds the time the last frame began. */
+        std::chrono::steady_clock::time_point m_lastFrameBegin;
+        /** Holds the frame pacing and latency statistics. */
+        FrameStatistics m_frameStatistics;
 
         /** The descriptor pool for ImGUI. */
         gfx::DescriptorPool m_imguiDescPool;
@@ -186,6 +250,11 @@ namespace vkfw_core {
         void InitVulkan(const std::vector<std::string>& requiredDeviceExtensions, void* featuresNextChain);
         void InitGUI();
         void RecreateSwapChain();
+        void RecreateOffscreenImages();
+        void CreateFrameResources();
+        void CreateRenderingFinishedSemaphores(std::size_t numImages);
+        void WaitForFrame(const FrameResources& frame);
+        [[nodiscard]] gfx::FramebufferDescriptor CreateMainRenderingDescriptor(vk::Format colorFormat) const;
         void DestroySwapchainImages();
         void ReleaseWindow();
         void ReleaseVulkan();
@@ -0,0 +1,106 @@
+/**
+ * @file   block_compression.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  CPU encoding and decoding of BC1 to BC7 block compressed textures.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The block compression formats, all of them store blocks of 4x4 texels. */
+    enum class BlockFormat {
+        /** RGB with 4 bits per texel, punch through texels decode to opaque black. */
+        BC1,
+        /** RGB with 1 bit alpha and 4 bits per texel. */
+        BC1A,
+        /** RGBA with explicit 4 bit alpha and 8 bits per texel. */
+        BC2,
+        /** RGBA with interpolated alpha and 8 bits per texel. */
+        BC3,
+        /** Single channel with 4 bits per texel. */
+        BC4,
+        /** Two channels with 8 bits per texel. */
+        BC5,
+        /** RGB half float with 8 bits per texel, neither encoded nor decoded on the CPU. */
+        BC6H,
+        /** High quality RGBA with 8 bits per texel. */
+        BC7
+    };
+
+    /** The width and height of a block in texels. */
+    constexpr std::uint32_t BLOCK_EXTENT = 4;
+
+    /** Returns the size of a single block in bytes. */
+    [[nodiscard]] constexpr std::size_t GetBlockSize(BlockFormat format)
+    {
+        return format == BlockFormat::BC1 || format == BlockFormat::BC1A || format == BlockFormat::BC4 ? 8 : 16;
+    }
+    /** Returns the number of 8 bit channels of the uncompressed texels (the input of encoding, output of decoding). */
+    [[nodiscard]] constexpr std::uint32_t GetBlockChannels(BlockFormat format)
+    {
+        if (format == BlockFormat::BC4) { return 1; }
+        if (format == BlockFormat::BC5) { return 2; }
+        return 4;
+    }
+    /** Returns the number of blocks needed to cover a number of texels in one dimension. */
+    [[nodiscard]] constexpr std::uint32_t GetBlockCount(std::uint32_t size)
+    {
+        return (size + BLOCK_EXTENT - 1) / BLOCK_EXTENT;
+    }
+    /** Returns the size of a compressed image in bytes. */
+    [[nodiscard]] constexpr std::size_t GetCompressedSize(BlockFormat format, std::uint32_t width, std::uint32_t height)
+    {
+        return std::size_t{GetBlockCount(width)} * GetBlockCount(height) * GetBlockSize(format);
+    }
+    /** Checks if the blocks of a format can be decoded on the CPU (all but BC6H). */
+    [[nodiscard]] constexpr bool CanDecompressBlocks(BlockFormat format) { return format != BlockFormat::BC6H; }
+    /** Checks if the blocks of a format can be encoded on the CPU (all but BC6H, BC7 only uses mode 6). */
+    [[nodiscard]] constexpr bool CanCompressBlocks(BlockFormat format) { return format != BlockFormat::BC6H; }
+
+    /**
+     *  Decodes a block compressed image.
+     *  Throws std::runtime_error if the format cannot be decoded or the data is too small.
+     *  @param format the block format.
+     *  @param blocks the blocks in row major order.
+     *  @param width the width of the image in texels.
+     *  @param height the height of the image in texels.
+     *  @return the tightly packed texels with GetBlockChannels(format) channels.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> DecompressBlocks(BlockFormat format, std::span<const std::uint8_t> blocks,
+                                                             std::uint32_t width, std::uint32_t height);
+    /**
+     *  Encodes an image to blocks, partial blocks at the borders repeat the border texels.
+     *  The encoder fits endpoints along the principal axis of each block and refines them by least squares; it is
+     *  meant for offline texture caches and not for real time use. sRGB data is encoded as it is.
+     *  Throws std::runtime_error if the format cannot be encoded or the data is too small.
+     *  @param format the block format.
+     *  @param texels the tightly packed texels with GetBlockChannels(format) channels.
+     *  @param width the width of the image in texels.
+     *  @param height the height of the image in texels.
+     *  @return the blocks in row major order.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> CompressBlocks(BlockFormat format, std::span<const std::uint8_t> texels,
+                                                           std::uint32_t width, std::uint32_t height);
+
+    struct CompressionError
+    {
+        /** Holds the root mean square error over all channels. */
+        double m_rmse = 0.0;
+        /** Holds the peak signal to noise ratio in dB (infinite for identical images). */
+        double m_psnr = 0.0;
+        /** Holds the largest absolute difference of a single channel. */
+        std::uint32_t m_maxError = 0;
+    };
+
+    /** Compares a decoded image to the original one, both need the same size and channel layout. */
+    [[nodiscard]] CompressionError ComputeCompressionError(std::span<const std::uint8_t> reference,
+                                                           std::span<const std::uint8_t> decoded);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file   file_watcher.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Watches directories for changed files, e.g., for hot reloading resources.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace vkfw_core {
+
+    /**
+     *  Watches directories and their sub directories for files that were written, created, moved or deleted.
+     *  Uses inotify on Linux and scans the directories periodically on a background thread otherwise or if inotify is
+     *  not available. Changes are debounced: a file is reported once no further change happened for the debounce
+     *  interval, so editors writing a file in several steps trigger a single reload.
+     */
+    class FileWatcher final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         *  Constructor.
+         *  @param directories the directories to watch, directories that do not exist are skipped.
+         *  @param debounce the time without changes before a changed file is reported.
+         *  @param forcePolling whether to scan the directories even if inotify is available.
+         *  @param pollInterval the time between two scans when polling.
+         */
+        FileWatcher(const std::vector<std::filesystem::path>& directories, std::chrono::milliseconds debounce,
+                    bool forcePolling = false, std::chrono::milliseconds pollInterval = std::chrono::milliseconds{500});
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+        FileWatcher(FileWatcher&&) = delete;
+        FileWatcher& operator=(FileWatcher&&) = delete;
+        ~FileWatcher();
+
+        /** Returns the files changed at least the debounce interval ago (each change is reported once). */
+        [[nodiscard]] std::vector<std::filesystem::path> GetChangedFiles();
+        /** Checks if the watcher uses inotify instead of polling. */
+        [[nodiscard]] bool IsUsingInotify() const { return m_inotifyFd >= 0; }
+
+    private:
+        /** Adds inotify watches for a directory and all its sub directories. */
+        void AddInotifyWatches(const std::filesystem::path& directory);
+        /** Reads all pending inotify events without blocking. */
+        void ReadInotifyEvents();
+        /** Scans all watched directories and records files whose write time changed or that were deleted. */
+        void ScanDirectories(bool recordChanges);
+        void PollingLoop(const std::stop_token& stopToken);
+        /** Records a change of a file, needs the lock. */
+        void RecordChange(const std::filesystem::path& file, Clock::time_point time);
+
+        /** Holds the watched directories. */
+        std::vector<std::filesystem::path> m_directories;
+        /** Holds the debounce interval. */
+        std::chrono::milliseconds m_debounce;
+        /** Holds the time between two scans when polling. */
+        std::chrono::milliseconds m_pollInterval;
+        /** Holds the inotify file descriptor (-1 if polling). */
+        int m_inotifyFd = -1;
+        /** Holds the watched directory of each inotify watch descriptor. */
+        std::map<int, std::filesystem::path> m_inotifyWatches;
+        /** Holds the last write time of each file when polling. */
+        std::map<std::filesystem::path, std::filesystem::file_time_type> m_writeTimes;
+
+        /** Protects the pending changes. */
+        std::mutex m_mutex;
+        /** Wakes the polling thread when the watcher is destroyed. */
+        std::condition_variable_any m_pollWakeup;
+        /** Holds the changed files and the time of their last change. */
+        std::map<std::filesystem::path, Clock::time_point> m_pendingChanges;
+        /** Holds the thread scanning the directories if inotify is not used. */
+        std::jthread m_pollingThread;
+    };
+}
@@ -0,0 +1,64 @@
+/**
+ * @file   frame_statistics.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Frame pacing and latency statistics over a window of recent frames.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The timings of a single frame in milliseconds. */
+    struct FrameTiming
+    {
+        /** Holds the CPU time from the beginning of the previous frame to the beginning of this frame. */
+        double m_frameTime = 0.0;
+        /** Holds the time the CPU was blocked waiting for the GPU to finish this frame. */
+        double m_waitTime = 0.0;
+        /** Holds the time from the beginning of the frame on the CPU until the GPU was seen to have finished it. */
+        double m_latency = 0.0;
+    };
+
+    /** Keeps the timings of the most recent frames and computes averages, maxima and percentiles of them. */
+    class FrameStatistics final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param windowSize the number of recent frames the statistics are computed over.
+         */
+        explicit FrameStatistics(std::size_t windowSize = 120);
+
+        /** Adds a frame, replacing the oldest one if the window is full. */
+        void AddFrame(const FrameTiming& timing);
+        /** Removes all frames. */
+        void Clear();
+
+        /** Returns the number of frames in the window. */
+        [[nodiscard]] std::size_t GetNumFrames() const { return m_numFrames; }
+        /** Returns the average timings of the frames in the window. */
+        [[nodiscard]] FrameTiming GetAverage() const;
+        /** Returns the maximum timings of the frames in the window. */
+        [[nodiscard]] FrameTiming GetMaximum() const;
+        /** Returns the average number of frames per second. */
+        [[nodiscard]] double GetFramesPerSecond() const;
+        /**
+         *  Returns a percentile of the frame times, e.g., 0.99 to find stutter that the average hides.
+         *  @param percentile the percentile in [0, 1].
+         */
+        [[nodiscard]] double GetFrameTimePercentile(double percentile) const;
+
+    private:
+        /** Holds the ring buffer of frame timings. */
+        std::vector<FrameTiming> m_frames;
+        /** Holds the index the next frame is written to. */
+        std::size_t m_nextFrame = 0;
+        /** Holds the number of valid frames. */
+        std::size_t m_numFrames = 0;
+    };
+}
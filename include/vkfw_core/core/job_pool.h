@@ -0,0 +1,115 @@
+/**
+ * @file   job_pool.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  A pool of persistent threads running independent jobs by priority.
+ */
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The priority of a job, jobs of higher priority start first. */
+    enum class JobPriority {
+        /** Jobs that may wait, e.g., prefetching. */
+        LOW,
+        /** The default priority. */
+        NORMAL,
+        /** Jobs needed as soon as possible, e.g., resources something already waits for. */
+        HIGH
+    };
+
+    /**
+     *  Runs jobs on a fixed number of worker threads, e.g., for loading resources in the background. Unlike the
+     *  WorkerGroup the calling thread never takes part, each job runs once on any of the workers.
+     *  Jobs start by priority and in submission order within a priority.
+     *  Jobs that did not start when the pool is destroyed or their stop token is triggered are dropped, their futures
+     *  report a broken promise.
+     */
+    class JobPool final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param numThreads the number of worker threads (at least 1).
+         */
+        explicit JobPool(std::size_t numThreads);
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+        JobPool(JobPool&&) = delete;
+        JobPool& operator=(JobPool&&) = delete;
+        ~JobPool();
+
+        /**
+         *  Queues a job.
+         *  @param job the job, exceptions it throws are stored in the returned future.
+         *  @param priority the priority of the job.
+         *  @param stopToken drops the job if stop is requested before it starts, running jobs need to check it.
+         *  @return the future of the jobs result.
+         */
+        template<typename Job>
+        std::future<std::invoke_result_t<Job>> Submit(Job&& job, JobPriority priority = JobPriority::NORMAL,
+                                                      std::stop_token stopToken = {});
+        /** Blocks until the queue is empty and no job is running. */
+        void WaitIdle();
+
+        [[nodiscard]] std::size_t GetNumThreads() const { return m_threads.size(); }
+        /** Returns the number of queued jobs that did not start yet. */
+        [[nodiscard]] std::size_t GetNumQueuedJobs() const;
+        /** Returns the number of threads for loading, leaves one hardware thread for the main thread. */
+        [[nodiscard]] static std::size_t GetDefaultNumThreads();
+
+    private:
+        struct QueuedJob
+        {
+            /** Holds the job. */
+            std::function<void()> m_job;
+            /** Holds the stop token of the job. */
+            std::stop_token m_stopToken;
+        };
+
+        void Enqueue(QueuedJob job, JobPriority priority);
+        /** Removes the next job that is not stopped from the queues, needs the lock. */
+        [[nodiscard]] bool PopJob(QueuedJob& job);
+        void WorkerLoop();
+
+        /** Holds the worker threads. */
+        std::vector<std::thread> m_threads;
+        /** Protects the queue and the running job count. */
+        mutable std::mutex m_mutex;
+        /** Notifies the workers that a job was queued or the pool stops. */
+        std::condition_variable m_jobQueued;
+        /** Notifies waiting threads that a job finished. */
+        std::condition_variable m_jobFinished;
+        /** Holds the queued jobs for each priority. */
+        std::array<std::deque<QueuedJob>, 3> m_queues;
+        /** Holds the number of running jobs. */
+        std::size_t m_runningJobs = 0;
+        /** Holds whether the workers should exit. */
+        bool m_stop = false;
+    };
+
+    template<typename Job>
+    std::future<std::invoke_result_t<Job>> JobPool::Submit(Job&& job, JobPriority priority, std::stop_token stopToken)
+    {
+        // std::function needs a copyable callable, so the task is shared.
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Job>()>>(std::forward<Job>(job));
+        auto result = task->get_future();
+        Enqueue(QueuedJob{[task]() { (*task)(); }, std::move(stopToken)}, priority);
+        return result;
+    }
+}
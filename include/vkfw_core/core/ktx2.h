@@ -0,0 +1,66 @@
+/**
+ * @file   ktx2.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Reading and writing of KTX 2.0 texture containers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The image description of a KTX 2.0 header, formats are VkFormat values. */
+    struct Ktx2Header
+    {
+        /** Holds the VkFormat of the texels. */
+        std::uint32_t m_vkFormat = 0;
+        /** Holds the size of the data type for endianness conversion (1 for block compressed formats). */
+        std::uint32_t m_typeSize = 1;
+        /** Holds the width of level 0 in texels. */
+        std::uint32_t m_pixelWidth = 0;
+        /** Holds the height of level 0 in texels (0 for 1D textures). */
+        std::uint32_t m_pixelHeight = 0;
+        /** Holds the depth of level 0 in texels (0 for 1D and 2D textures). */
+        std::uint32_t m_pixelDepth = 0;
+        /** Holds the number of array layers (0 if the texture is not an array). */
+        std::uint32_t m_layerCount = 0;
+        /** Holds the number of cube map faces (1 or 6). */
+        std::uint32_t m_faceCount = 1;
+        /** Holds the number of MIP levels (0 requests generating them after loading). */
+        std::uint32_t m_levelCount = 1;
+        /** Holds the supercompression scheme of the level data (0 for none). */
+        std::uint32_t m_supercompressionScheme = 0;
+    };
+
+    /** A parsed KTX 2.0 file, the level data views the memory the file was parsed from. */
+    struct Ktx2Image
+    {
+        /** Holds the header. */
+        Ktx2Header m_header;
+        /** Holds the data of all layers, faces and slices of each level, level 0 first. */
+        std::vector<std::span<const std::byte>> m_levels;
+    };
+
+    /** Checks if the data starts with the KTX 2.0 file identifier. */
+    [[nodiscard]] bool IsKtx2(std::span<const std::byte> data);
+    /**
+     *  Parses a KTX 2.0 file. Supercompressed files are not supported.
+     *  Throws std::runtime_error if the data is not a valid KTX 2.0 file.
+     */
+    [[nodiscard]] Ktx2Image ParseKtx2(std::span<const std::byte> data);
+    /**
+     *  Writes a KTX 2.0 file without supercompression.
+     *  The data format descriptor is only known for the 8 bit UNORM and SRGB formats with 1, 2 or 4 channels and the
+     *  BC1 to BC7 formats; other formats throw std::runtime_error.
+     *  @param header the header, the level count is taken from the levels.
+     *  @param levels the data of each level, level 0 first.
+     */
+    [[nodiscard]] std::vector<std::byte> WriteKtx2(const Ktx2Header& header,
+                                                   std::span<const std::span<const std::byte>> levels);
+}
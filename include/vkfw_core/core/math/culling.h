@@ -0,0 +1,62 @@
+/**
+ * @file   culling.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Batch frustum culling of axis aligned bounding boxes.
+ */
+
+#pragma once
+
+#include "core/math/primitives.h"
+
+#include <cstdint>
+#include <span>
+
+namespace vkfw_core::math {
+
+    /** Boxes stored as center and half extent in structure of arrays layout for batch culling. */
+    class CullingBoxes
+    {
+    public:
+        void Reserve(std::size_t count);
+        void Clear();
+        /** Adds a box, invalid (empty) boxes get a negative extent and are always culled. */
+        void Add(const AABB3<float>& box);
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_center[0].size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_center[0].empty(); }
+        /** Returns the center coordinates of all boxes for one axis. */
+        [[nodiscard]] std::span<const float> GetCenter(std::size_t axis) const { return m_center[axis]; }
+        /** Returns the half extents of all boxes for one axis. */
+        [[nodiscard]] std::span<const float> GetExtent(std::size_t axis) const { return m_extent[axis]; }
+
+    private:
+        /** Holds the box centers per axis. */
+        std::array<std::vector<float>, 3> m_center;
+        /** Holds the box half extents per axis. */
+        std::array<std::vector<float>, 3> m_extent;
+    };
+
+    /** Returns the number of 64 bit words needed for the visibility mask of a number of boxes. */
+    [[nodiscard]] constexpr std::size_t CullingMaskSize(std::size_t boxCount) noexcept { return (boxCount + 63) / 64; }
+
+    /** Returns if a box was marked visible in a visibility mask. */
+    [[nodiscard]] inline bool IsVisible(std::span<const std::uint64_t> visibility, std::size_t index) noexcept
+    {
+        return (visibility[index / 64] & (std::uint64_t{1} << (index % 64))) != 0;
+    }
+
+    /**
+     *  Tests boxes against a frustum after transforming them. The transformed box is the same as the one of
+     *  AABB::NewFromTransform but is computed from the absolute matrix entries (Arvo) instead of all 8 corners.
+     *  Uses AVX or SSE when compiled for it and does not allocate.
+     *  @param frustum the frustum.
+     *  @param boxes the boxes to test.
+     *  @param worldMatrices either one matrix per box or a single matrix used for all boxes.
+     *  @param visibility the result mask of at least CullingMaskSize(boxes.size()) words, bit i is set if box i is
+     *                    inside or intersected by the frustum.
+     */
+    void CullAABBs(const Frustum<float>& frustum, const CullingBoxes& boxes, std::span<const glm::mat4> worldMatrices,
+                   std::span<std::uint64_t> visibility);
+}
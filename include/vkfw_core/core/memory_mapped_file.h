@@ -0,0 +1,42 @@
+/**
+ * @file   memory_mapped_file.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a read-only memory mapped file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace vkfw_core {
+
+    /** Maps a whole file read-only into memory. Throws std::runtime_error if the file cannot be mapped. */
+    class MemoryMappedFile final
+    {
+    public:
+        explicit MemoryMappedFile(const std::filesystem::path& filename);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&&) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+        ~MemoryMappedFile();
+
+        /** Returns the contents of the file. */
+        [[nodiscard]] std::span<const std::byte> GetData() const noexcept { return {m_data, m_size}; }
+        [[nodiscard]] std::size_t GetSize() const noexcept { return m_size; }
+
+    private:
+        /** Holds the mapped memory. */
+        const std::byte* m_data = nullptr;
+        /** Holds the size of the mapping. */
+        std::size_t m_size = 0;
+#ifdef _WIN32
+        /** Holds the file mapping handle. */
+        void* m_mappingHandle = nullptr;
+#endif
+    };
+}
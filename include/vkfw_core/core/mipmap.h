@@ -0,0 +1,96 @@
+/**
+ * @file   mipmap.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  CPU generation of mipmap chains with box and Kaiser filters.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The filter used to reduce a mip level to the next one. */
+    enum class MipmapFilter {
+        /** Averages the texels covered by the destination texel (fast, slightly blurry). */
+        BOX,
+        /** Windowed sinc filter, keeps the images sharper but may ring at hard edges. */
+        KAISER
+    };
+
+    /** How the values of the image are interpreted while filtering. */
+    enum class MipmapContent {
+        /** The values are filtered as they are. */
+        LINEAR,
+        /** The color channels are sRGB encoded and filtered in linear space, alpha (4th channel) is linear. */
+        SRGB,
+        /** The first three channels are a normal encoded to [0, 1] that is renormalized after filtering. */
+        NORMAL_MAP
+    };
+
+    struct MipmapOptions
+    {
+        /** Holds the filter used. */
+        MipmapFilter m_filter = MipmapFilter::BOX;
+        /** Holds how the image values are interpreted. */
+        MipmapContent m_content = MipmapContent::LINEAR;
+        /** Holds whether the image wraps around at its borders (tiling textures) or is clamped. */
+        bool m_wrap = false;
+        /** Holds the radius of the Kaiser filter in destination texels. */
+        float m_kaiserWidth = 3.0f;
+        /** Holds the alpha parameter of the Kaiser window (larger values blur more but ring less). */
+        float m_kaiserAlpha = 4.0f;
+    };
+
+    /** A single level of a mip chain. */
+    template<class T> struct MipLevel
+    {
+        /** Holds the width of the level in texels. */
+        std::uint32_t m_width = 0;
+        /** Holds the height of the level in texels. */
+        std::uint32_t m_height = 0;
+        /** Holds the tightly packed texels of the level. */
+        std::vector<T> m_data;
+    };
+
+    /** Returns the number of levels of a full mip chain, including the base level. */
+    [[nodiscard]] std::uint32_t GetMipLevelCount(std::uint32_t width, std::uint32_t height);
+    /** Returns the size of a mip level in one dimension the same way Vulkan computes it. */
+    [[nodiscard]] constexpr std::uint32_t GetMipLevelSize(std::uint32_t baseSize, std::uint32_t level)
+    {
+        const auto size = level < 32 ? (baseSize >> level) : 0U;
+        return size > 0 ? size : 1U;
+    }
+
+    [[nodiscard]] float SRGBToLinear(float value);
+    [[nodiscard]] float LinearToSRGB(float value);
+
+    /**
+     *  Generates the mip levels below a base level of 8 bit unsigned normalized texels.
+     *  @param baseLevel the tightly packed texels of the base level.
+     *  @param width the width of the base level.
+     *  @param height the height of the base level.
+     *  @param channels the number of channels per texel (1 to 4, at least 3 for normal maps).
+     *  @param options the filter options.
+     *  @return the levels 1 to GetMipLevelCount(width, height) - 1.
+     */
+    [[nodiscard]] std::vector<MipLevel<std::uint8_t>> GenerateMipmaps(std::span<const std::uint8_t> baseLevel,
+                                                                      std::uint32_t width, std::uint32_t height,
+                                                                      std::uint32_t channels,
+                                                                      const MipmapOptions& options);
+    /**
+     *  Generates the mip levels below a base level of floating point texels.
+     *  Other than the 8 bit version the results are not clamped, so the Kaiser filter may create values outside of
+     *  the range of the base level.
+     *  @see GenerateMipmaps(std::span<const std::uint8_t>, std::uint32_t, std::uint32_t, std::uint32_t,
+     *                       const MipmapOptions&)
+     */
+    [[nodiscard]] std::vector<MipLevel<float>> GenerateMipmaps(std::span<const float> baseLevel, std::uint32_t width,
+                                                               std::uint32_t height, std::uint32_t channels,
+                                                               const MipmapOptions& options);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file   profiler_statistics.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Aggregation of profiler samples per named region.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vkfw_core {
+
+    /** The aggregated samples of a single profiler region. */
+    struct ProfilerRegionStatistics
+    {
+        /** Holds the name of the region including the names of its parents ("Frame/Shadows"). */
+        std::string m_name;
+        /** Holds the nesting depth of the region. */
+        std::uint32_t m_depth = 0;
+        /** Holds the number of samples. */
+        std::size_t m_samples = 0;
+        /** Holds the minimal time in milliseconds. */
+        double m_minTime = 0.0;
+        /** Holds the maximal time in milliseconds. */
+        double m_maxTime = 0.0;
+        /** Holds the sum of all times in milliseconds. */
+        double m_sumTime = 0.0;
+        /** Holds the number of samples with counter values. */
+        std::size_t m_counterSamples = 0;
+        /** Holds the sum of all samples for each counter. */
+        std::vector<double> m_counterSums;
+
+        /** Returns the average time in milliseconds. */
+        [[nodiscard]] double GetAverageTime() const
+        {
+            return m_samples == 0 ? 0.0 : m_sumTime / static_cast<double>(m_samples);
+        }
+        /** Returns the average value of a counter. */
+        [[nodiscard]] double GetAverageCounter(std::size_t counter) const
+        {
+            return m_counterSamples == 0 ? 0.0 : m_counterSums[counter] / static_cast<double>(m_counterSamples);
+        }
+    };
+
+    /**
+     *  Aggregates the min/avg/max time and optional counters (e.g., pipeline statistics) of named regions.
+     *  Regions are kept in the order they were first sampled, so nested regions follow their parents.
+     */
+    class ProfilerStatistics final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param counterNames the names of the counters that can be added to each sample.
+         */
+        explicit ProfilerStatistics(std::vector<std::string> counterNames = {});
+
+        /**
+         *  Adds a sample to a region.
+         *  @param name the name of the region including its parents.
+         *  @param depth the nesting depth of the region.
+         *  @param time the time of the sample in milliseconds.
+         *  @param counters the counter values of the sample (empty or one value per counter).
+         */
+        void AddSample(std::string_view name, std::uint32_t depth, double time,
+                       std::span<const std::uint64_t> counters = {});
+        /** Removes all samples. */
+        void Clear();
+
+        [[nodiscard]] const std::vector<std::string>& GetCounterNames() const { return m_counterNames; }
+        [[nodiscard]] const std::vector<ProfilerRegionStatistics>& GetRegions() const { return m_regions; }
+        /** Returns the statistics of a region or nullptr if it was never sampled. */
+        [[nodiscard]] const ProfilerRegionStatistics* FindRegion(std::string_view name) const;
+
+        /** Writes one line per region with samples, min/avg/max time and the average counters as CSV. */
+        void WriteCSV(std::ostream& out) const;
+
+    private:
+        /** Holds the names of the counters. */
+        std::vector<std::string> m_counterNames;
+        /** Holds the statistics of all regions. */
+        std::vector<ProfilerRegionStatistics> m_regions;
+        /** Holds the index of each region by name. */
+        std::unordered_map<std::string, std::size_t> m_regionIndices;
+    };
+}
@@ -0,0 +1,66 @@
+/**
+ * @file   radix_sort.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  LSD radix sort of 64 bit keys together with 32 bit values.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace vkfw_core {
+
+    /**
+     *  Sorts keys (and the values attached to them) ascending and stable using 8 bit digits.
+     *  Passes in which all keys have the same digit are skipped, so keys using only few bits sort fast.
+     *  @param keys the keys to sort.
+     *  @param values the values that are permuted with the keys.
+     *  @param keysScratch scratch memory for keys (resized if needed, can be reused between calls).
+     *  @param valuesScratch scratch memory for values (resized if needed, can be reused between calls).
+     */
+    inline void RadixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values,
+                          std::vector<std::uint64_t>& keysScratch, std::vector<std::uint32_t>& valuesScratch)
+    {
+        constexpr std::size_t digitBits = 8;
+        constexpr std::size_t digitCount = sizeof(std::uint64_t) * 8 / digitBits;
+        constexpr std::size_t bucketCount = std::size_t{1} << digitBits;
+        constexpr std::uint64_t digitMask = bucketCount - 1;
+
+        assert(keys.size() == values.size());
+        const auto n = keys.size();
+        if (n < 2) { return; }
+        keysScratch.resize(n);
+        valuesScratch.resize(n);
+
+        std::array<std::array<std::size_t, bucketCount>, digitCount> histograms = {};
+        for (auto key : keys) {
+            for (std::size_t d = 0; d < digitCount; ++d) { histograms[d][(key >> (d * digitBits)) & digitMask] += 1; }
+        }
+
+        for (std::size_t d = 0; d < digitCount; ++d) {
+            auto& histogram = histograms[d];
+            const auto shift = d * digitBits;
+            if (histogram[(keys[0] >> shift) & digitMask] == n) { continue; }
+
+            std::size_t offset = 0;
+            for (auto& bucket : histogram) {
+                auto count = bucket;
+                bucket = offset;
+                offset += count;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                auto& target = histogram[(keys[i] >> shift) & digitMask];
+                keysScratch[target] = keys[i];
+                valuesScratch[target] = values[i];
+                target += 1;
+            }
+            keys.swap(keysScratch);
+            values.swap(valuesScratch);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file   HotReloader.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Reloads resources and rebuilds pipelines when their files change.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vkfw_core::gfx {
+    class LogicalDevice;
+    class ReloadablePipeline;
+    class Shader;
+}
+
+namespace vkfw_core {
+
+    /**
+     *  Reloads the resources of a device when their files change.
+     *  Changed shader sources are compiled on the resource job pool, changed SPIR-V files are loaded there and
+     *  replace the shader modules in Update, which also rebuilds the pipelines using them. If compiling, loading or
+     *  rebuilding fails the old version stays in use. Changed textures are removed from the texture manager, so the
+     *  next request loads them again.
+     */
+    class HotReloader final
+    {
+    public:
+        explicit HotReloader(const gfx::LogicalDevice* device);
+        HotReloader(const HotReloader&) = delete;
+        HotReloader& operator=(const HotReloader&) = delete;
+        HotReloader(HotReloader&&) = delete;
+        HotReloader& operator=(HotReloader&&) = delete;
+        ~HotReloader();
+
+        /** Registers a pipeline to rebuild after its shaders were reloaded. */
+        void RegisterPipeline(gfx::ReloadablePipeline* pipeline);
+        void UnregisterPipeline(gfx::ReloadablePipeline* pipeline);
+        /** Replaces a registered pipeline, e.g., when it was moved (does nothing if it is not registered). */
+        void ReplacePipeline(gfx::ReloadablePipeline* oldPipeline, gfx::ReloadablePipeline* newPipeline);
+
+        /** Starts compiling or loading the resources using the changed files. */
+        void OnFilesChanged(const std::vector<std::filesystem::path>& changedFiles);
+        /**
+         *  Replaces the shaders that finished loading and rebuilds the pipelines using them.
+         *  Needs to be called while no command buffers are recorded, e.g., at the start of a frame.
+         *  @return whether any pipeline was rebuilt, command buffers recorded before need to be recorded again.
+         */
+        bool Update();
+
+    private:
+        struct PendingCompile
+        {
+            /** Holds the shader source. */
+            std::string m_sourceFilename;
+            /** Holds the compiled SPIR-V file. */
+            std::string m_spirvFilename;
+            /** Holds whether compilation succeeded. */
+            std::future<bool> m_result;
+            /** Holds whether the source changed again during compilation. */
+            bool m_recompile = false;
+        };
+
+        struct PendingLoad
+        {
+            /** Holds the shader to reload. */
+            std::weak_ptr<gfx::Shader> m_shader;
+            /** Holds the loaded SPIR-V code. */
+            std::future<std::vector<std::uint32_t>> m_code;
+        };
+
+        void CompileShader(const std::string& sourceFilename, const std::string& spirvFilename);
+        void LoadShader(const std::shared_ptr<gfx::Shader>& shader);
+        void UpdateCompiles();
+        [[nodiscard]] bool ApplyLoadedShaders();
+        [[nodiscard]] bool RebuildOutdatedPipelines();
+
+        /** Holds the device. */
+        const gfx::LogicalDevice* m_device;
+        /** Holds the shaders being compiled. */
+        std::vector<PendingCompile> m_compiles;
+        /** Holds the shaders being loaded. */
+        std::vector<PendingLoad> m_loads;
+
+        /** Protects the pipelines, as they may be created on any thread. */
+        std::mutex m_pipelineMutex;
+        /** Holds the registered pipelines. */
+        std::vector<gfx::ReloadablePipeline*> m_pipelines;
+    };
+}
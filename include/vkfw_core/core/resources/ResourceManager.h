@@ -8,8 +8,23 @@
 
 #pragma once
 
+#include "core/job_pool.h"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <stop_token>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace vkfw_core::gfx {
     class LogicalDevice;
 }
@@ -18,9 +33,57 @@ namespace vkfw_core {
 
     class ApplicationBase;
 
+    /** Describes how a resource is loaded asynchronously. */
+    struct ResourceLoadDesc
+    {
+        /** Holds the priority of the load, e.g., HIGH for resources needed in the next frame. */
+        JobPriority m_priority = JobPriority::NORMAL;
+        /** Holds the token cancelling the request if the load did not start yet. */
+        std::stop_token m_stopToken;
+    };
+
+    /** The memory used by a resource. */
+    struct ResourceFootprint
+    {
+        /** Holds the bytes of host memory. */
+        std::size_t m_cpuBytes = 0;
+        /** Holds the bytes of device memory. */
+        std::size_t m_deviceBytes = 0;
+
+        [[nodiscard]] std::size_t GetTotalBytes() const { return m_cpuBytes + m_deviceBytes; }
+    };
+
+    /** A resource type reporting its memory, other types count with their object size. */
+    template<typename T> concept FootprintReporting = requires(const T& resource)
+    {
+        { resource.GetFootprint() } -> std::convertible_to<ResourceFootprint>;
+    };
+
+    /** Counters of the resource lookups and the retention cache of a resource manager, e.g., to tune the budget. */
+    struct ResourceCacheStatistics
+    {
+        /** Holds the number of requests served without a new load. */
+        std::size_t m_hits = 0;
+        /** Holds the number of hits only the retention cache kept alive. */
+        std::size_t m_retainedHits = 0;
+        /** Holds the number of requests starting a load. */
+        std::size_t m_misses = 0;
+        /** Holds the number of resources evicted from the retention cache. */
+        std::size_t m_evictions = 0;
+        /** Holds the number of retained resources. */
+        std::size_t m_numRetained = 0;
+        /** Holds the memory of the retained resources. */
+        ResourceFootprint m_retainedFootprint;
+    };
+
     /**
      * @brief  Base class for all resource managers.
      *
+     * All lookups are thread-safe. Concurrent requests for the same id share one load, asynchronous loads run on the
+     * job pool of the manager.
+     * With a retention budget the manager keeps the most recently used resources alive after their last user released
+     * them, until their memory exceeds the budget.
+     *
      * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
      * @date   2014.01.03
      */
@@ -36,12 +99,28 @@ namespace vkfw_core {
         using ResourceManagerBase = ResourceManager<rType, reloadLoop>;
 
     public:
-        /** Constructor for resource managers. */
-        explicit ResourceManager(const gfx::LogicalDevice* device) : m_device{ device } {}
+        /** The future of an asynchronously loaded resource, shared by all requests for the same id. */
+        using ResourceFuture = std::shared_future<std::shared_ptr<rType>>;
+        /** A callback receiving the resources evicted from the retention cache. */
+        using EvictionCallback = std::function<void(const std::string& resId, std::shared_ptr<rType> resource)>;
+
+        /**
+         *  Constructor for resource managers.
+         *  @param device the device to create resources in this manager.
+         *  @param jobPool the job pool for asynchronous loads, the manager creates its own on first use if nullptr.
+         */
+        explicit ResourceManager(const gfx::LogicalDevice* device, JobPool* jobPool = nullptr)
+            : m_device{device}, m_jobPool{jobPool}
+        {
+        }
 
         /** Copy constructor. */
         ResourceManager(const ResourceManager& rhs) : m_device{rhs.m_device}
         {
+            const std::scoped_lock lock{rhs.m_mutex};
+            m_jobPool = rhs.GetSharedJobPoolUnlocked();
+            m_retentionBudget = rhs.m_retentionBudget;
+            m_evictionCallback = rhs.m_evictionCallback;
             for (const auto& res : rhs.m_resources) {
                 m_resources.emplace(res.first, std::weak_ptr<ResourceType>());
             }
@@ -53,55 +132,144 @@ namespace vkfw_core {
         {
             if (this == &rhs) { return *this; }
 
+            const std::scoped_lock lock{m_mutex, rhs.m_mutex};
             m_resources = rhs.m_resources;
             m_device = rhs.m_device;
+            m_retentionBudget = rhs.m_retentionBudget;
+            m_evictionCallback = rhs.m_evictionCallback;
             return *this;
         }
 
-        /** Move constructor. */
-        ResourceManager(ResourceManager&& rhs) noexcept
-            : m_resources{std::move(rhs.m_resources)}, m_device{rhs.m_device}
+        /** Move constructor, waits for the loads of rhs as they register their resources there. */
+        ResourceManager(ResourceManager&& rhs) noexcept : m_device{rhs.m_device}
         {
+            rhs.WaitForLoads();
+            const std::scoped_lock lock{rhs.m_mutex};
+            m_resources = std::move(rhs.m_resources);
+            m_jobPool = rhs.GetSharedJobPoolUnlocked();
+            MoveRetainedUnlocked(rhs);
         }
-        /** Move assignment operator. */
+        /** Move assignment operator, waits for the loads of rhs. */
         ResourceManager& operator=(ResourceManager&& rhs) noexcept
         {
             if (this != &rhs) {
-                this->~ResourceManager();
+                rhs.WaitForLoads();
+                const std::scoped_lock lock{m_mutex, rhs.m_mutex};
                 m_resources = std::move(rhs.m_resources);
                 m_device = rhs.m_device;
+                MoveRetainedUnlocked(rhs);
             }
             return *this;
         }
-        /** Default destructor. */
-        virtual ~ResourceManager() = default;
+        /** Destructor, cancels loads that did not start and waits for the running ones. */
+        virtual ~ResourceManager()
+        {
+            std::vector<std::shared_ptr<LoadTask>> unstartedLoads;
+            {
+                const std::scoped_lock lock{m_mutex};
+                for (auto& [resId, load] : m_inFlightLoads) {
+                    auto task = load.m_task.lock();
+                    if (task && !task->m_claimed.exchange(true)) { unstartedLoads.push_back(std::move(task)); }
+                }
+            }
+            for (auto& task : unstartedLoads) {
+                task->m_promise.set_exception(
+                    std::make_exception_ptr(std::runtime_error{"Resource manager destroyed before loading."}));
+            }
+            WaitForLoads();
+        }
 
         /**
          * Gets a resource from the manager.
+         * If the resource is loading asynchronously and the load did not start, it is loaded on the calling thread.
          * @param resId the resources id
          * @return the resource as a shared pointer
          */
         template<typename... Args>
         std::shared_ptr<ResourceType> GetResource(const std::string& resId, Args&&... args)
         {
-            std::weak_ptr<ResourceType> wpResource;
-            try {
-                wpResource = m_resources.at(resId);
-            }
-            catch (std::out_of_range&) {
+            std::shared_ptr<LoadTask> task;
+            {
+                std::unique_lock lock{m_mutex};
+                if (auto resource = FindResourceUnlocked(resId)) {
+                    auto evicted = RetainUnlocked(resId, resource);
+                    lock.unlock();
+                    NotifyEvicted(std::move(evicted));
+                    return resource;
+                }
+                if (auto* load = FindInFlightLoadUnlocked(resId)) { task = load->m_task.lock(); }
+                if (task) {
+                    m_statistics.m_hits += 1;
+                    lock.unlock();
+                    // a load waiting in the queue would block this thread until all jobs before it finished.
+                    if (!task->m_claimed.exchange(true)) { task->Run(); }
+                    return task->m_future.get();
+                }
+
                 spdlog::info("No resource with id \"{}\" found. Creating new one.", resId);
+                m_statistics.m_misses += 1;
+                task = std::make_shared<LoadTask>(this, resId);
+                task->m_claimed = true;
+                m_inFlightLoads.insert_or_assign(resId, InFlightLoad{task->m_future, task, {}});
+            }
+
+            task->m_load = [this, &resId, &args...]() { return LoadWithRetry(resId, std::forward<Args>(args)...); };
+            task->Run();
+            return task->m_future.get();
+        }
+
+        /**
+         *  Gets a resource from the manager without blocking, loaded resources are returned as a ready future.
+         *  Concurrent requests for the same id share one load, a request with a higher priority or a different stop
+         *  token than the ones before queues the load again and the first job to start loads it.
+         *  The arguments are copied to the job, use std::ref for arguments that outlive the load.
+         *  @param resId the resources id.
+         *  @param loadDesc the priority of the load and the token to cancel it with.
+         *  @return the future of the resource, holds a std::future_error if all requests were cancelled before the
+         *          load started.
+         */
+        template<typename... Args>
+        [[nodiscard]] ResourceFuture GetResourceAsync(const std::string& resId, const ResourceLoadDesc& loadDesc,
+                                                      Args&&... args)
+        {
+            std::unique_lock lock{m_mutex};
+            if (auto resource = FindResourceUnlocked(resId)) {
+                auto evicted = RetainUnlocked(resId, resource);
+                lock.unlock();
+                NotifyEvicted(std::move(evicted));
+                std::promise<std::shared_ptr<ResourceType>> loaded;
+                loaded.set_value(std::move(resource));
+                return loaded.get_future().share();
             }
-            if (wpResource.expired()) {
-                std::shared_ptr<ResourceType> spResource(nullptr);
-                LoadResource(resId, spResource, std::forward<Args>(args)...);
-                if constexpr (reloadLoop) { // NOLINT
-                    while (!spResource) { LoadResource(resId, spResource, std::forward<Args>(args)...); }
+
+            auto* load = FindInFlightLoadUnlocked(resId);
+            auto task = load != nullptr ? load->m_task.lock() : nullptr;
+            if (task) {
+                const auto isCovered = [&loadDesc](const ResourceLoadDesc& request) {
+                    return request.m_priority >= loadDesc.m_priority
+                           && (!request.m_stopToken.stop_possible() || request.m_stopToken == loadDesc.m_stopToken);
+                };
+                m_statistics.m_hits += 1;
+                if (task->m_claimed || std::any_of(load->m_requests.begin(), load->m_requests.end(), isCovered)) {
+                    return load->m_future;
                 }
-                wpResource = spResource;
-                m_resources.insert(std::move(std::make_pair(resId, wpResource)));
-                return spResource;
+            } else {
+                m_statistics.m_misses += 1;
+                task = std::make_shared<LoadTask>(this, resId);
+                task->m_load = [this, resId, ... loadArgs = std::forward<Args>(args)]() {
+                    return LoadWithRetry(resId, loadArgs...);
+                };
+                load = &m_inFlightLoads.insert_or_assign(resId, InFlightLoad{task->m_future, task, {}}).first->second;
             }
-            return wpResource.lock();
+
+            load->m_requests.push_back(loadDesc);
+            // the job owns the task, if all jobs of a task are cancelled the promise is broken.
+            GetJobPoolUnlocked().Submit(
+                [task]() {
+                    if (!task->m_claimed.exchange(true)) { task->Run(); }
+                },
+                loadDesc.m_priority, loadDesc.m_stopToken);
+            return load->m_future;
         }
 
         /**
@@ -111,8 +279,115 @@ namespace vkfw_core {
          */
         [[nodiscard]] bool HasResource(const std::string& resId) const
         {
+            const std::scoped_lock lock{m_mutex};
             auto rit = m_resources.find(resId);
-            return (rit != m_resources.end()) && !rit->expired();
+            return (rit != m_resources.end()) && !rit->second.expired();
+        }
+
+        /** Checks if a resource is loading, e.g., to show progress. */
+        [[nodiscard]] bool IsLoading(const std::string& resId) const
+        {
+            const std::scoped_lock lock{m_mutex};
+            auto load = m_inFlightLoads.find(resId);
+            return load != m_inFlightLoads.end() && !load->second.m_task.expired();
+        }
+
+        /** Returns all loaded resources with their ids, e.g., to find the ones using a changed file. */
+        [[nodiscard]] std::vector<std::pair<std::string, std::shared_ptr<ResourceType>>> GetLoadedResources() const
+        {
+            std::vector<std::pair<std::string, std::shared_ptr<ResourceType>>> resources;
+            const std::scoped_lock lock{m_mutex};
+            for (const auto& [resId, weakResource] : m_resources) {
+                if (auto resource = weakResource.lock()) { resources.emplace_back(resId, std::move(resource)); }
+            }
+            return resources;
+        }
+
+        /**
+         *  Removes a resource from the manager, so the next request loads it again, e.g., after its file changed.
+         *  Current users keep the old resource, if it was retained it is handed to the eviction callback.
+         *  @param resId the resources id.
+         */
+        void InvalidateResource(const std::string& resId)
+        {
+            std::vector<RetainedResource> evicted;
+            {
+                const std::scoped_lock lock{m_mutex};
+                m_resources.erase(resId);
+                if (auto retained = m_retainedIndex.find(resId); retained != m_retainedIndex.end()) {
+                    evicted.push_back(RemoveRetainedUnlocked(retained));
+                    m_statistics.m_evictions += 1;
+                }
+            }
+            NotifyEvicted(std::move(evicted));
+        }
+
+        /**
+         *  Sets the memory budget of the retention cache, which keeps the most recently used resources alive.
+         *  @param budgetBytes the budget for host and device memory of the retained resources, 0 disables the cache.
+         */
+        void SetRetentionBudget(std::size_t budgetBytes)
+        {
+            std::vector<RetainedResource> evicted;
+            {
+                const std::scoped_lock lock{m_mutex};
+                m_retentionBudget = budgetBytes;
+                evicted = EvictUnlocked();
+            }
+            NotifyEvicted(std::move(evicted));
+        }
+
+        /**
+         *  Sets the callback receiving evicted resources, e.g., to release them only after the device stopped using
+         *  them. It is called on the thread causing the eviction without holding any lock of the manager.
+         */
+        void SetEvictionCallback(EvictionCallback callback)
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_evictionCallback = std::move(callback);
+        }
+
+        /** Evicts all resources from the retention cache. */
+        void ClearRetained()
+        {
+            std::vector<RetainedResource> evicted;
+            {
+                const std::scoped_lock lock{m_mutex};
+                for (auto& retained : m_retained) { evicted.push_back(std::move(retained)); }
+                m_retained.clear();
+                m_retainedIndex.clear();
+                m_statistics.m_evictions += evicted.size();
+                m_statistics.m_numRetained = 0;
+                m_statistics.m_retainedFootprint = ResourceFootprint{};
+            }
+            NotifyEvicted(std::move(evicted));
+        }
+
+        [[nodiscard]] ResourceCacheStatistics GetCacheStatistics() const
+        {
+            const std::scoped_lock lock{m_mutex};
+            return m_statistics;
+        }
+
+        /** Resets the hit, miss and eviction counters. */
+        void ResetCacheStatistics()
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_statistics.m_hits = 0;
+            m_statistics.m_retainedHits = 0;
+            m_statistics.m_misses = 0;
+            m_statistics.m_evictions = 0;
+        }
+
+        /** Waits until all loads started before the call finished or were cancelled. */
+        void WaitForLoads() const
+        {
+            std::vector<ResourceFuture> loads;
+            {
+                const std::scoped_lock lock{m_mutex};
+                for (const auto& [resId, load] : m_inFlightLoads) { loads.push_back(load.m_future); }
+            }
+            for (const auto& load : loads) { load.wait(); }
         }
 
 
@@ -139,6 +414,25 @@ namespace vkfw_core {
             }*/
         }
 
+        /**
+         *  Looks up a resource without loading it.
+         *  @param resId the resource id.
+         *  @return the resource or nullptr if it is not loaded.
+         */
+        [[nodiscard]] std::shared_ptr<ResourceType> FindResource(const std::string& resId) const
+        {
+            const std::scoped_lock lock{m_mutex};
+            return FindResourceUnlocked(resId);
+        }
+
+        [[nodiscard]] const gfx::LogicalDevice* GetDevice() const { return m_device; }
+        /** Returns the job pool for asynchronous loads. */
+        [[nodiscard]] JobPool& GetJobPool()
+        {
+            const std::scoped_lock lock{m_mutex};
+            return GetJobPoolUnlocked();
+        }
+
         /**
          *  Sets the resource with a given name to a new value.
          *  @param resourceName the name of the resource.
@@ -147,14 +441,240 @@ namespace vkfw_core {
          */
         std::shared_ptr<ResourceType> SetResource(const std::string& resourceName, std::shared_ptr<ResourceType>&& resource)
         {
-            m_resources[resourceName] = std::move(resource);
-            return m_resources[resourceName].lock();
+            std::vector<RetainedResource> evicted;
+            {
+                const std::scoped_lock lock{m_mutex};
+                m_resources[resourceName] = resource;
+                // the footprint of the new resource may differ, so it is retained again.
+                if (auto retained = m_retainedIndex.find(resourceName); retained != m_retainedIndex.end()) {
+                    evicted.push_back(RemoveRetainedUnlocked(retained));
+                }
+                auto newlyEvicted = RetainUnlocked(resourceName, resource, false);
+                std::move(newlyEvicted.begin(), newlyEvicted.end(), std::back_inserter(evicted));
+            }
+            NotifyEvicted(std::move(evicted));
+            return std::move(resource);
         }
 
     private:
+        /** A load shared by all requests for a resource, run by the first job or blocking request claiming it. */
+        struct LoadTask
+        {
+            LoadTask(ResourceManager* manager, std::string resId) : m_manager{manager}, m_resId{std::move(resId)} {}
+
+            /** Loads the resource, registers it with the manager and fulfills the promise. */
+            void Run()
+            {
+                try {
+                    auto resource = m_load();
+                    m_manager->FinishLoad(m_resId, resource);
+                    m_promise.set_value(std::move(resource));
+                } catch (...) {
+                    m_manager->FinishLoad(m_resId, nullptr);
+                    m_promise.set_exception(std::current_exception());
+                }
+            }
+
+            /** Holds the manager to register the resource with. */
+            ResourceManager* m_manager;
+            /** Holds the resource id. */
+            std::string m_resId;
+            /** Holds the function loading the resource. */
+            std::function<std::shared_ptr<ResourceType>()> m_load;
+            /** Holds the promise of the resource. */
+            std::promise<std::shared_ptr<ResourceType>> m_promise;
+            /** Holds the future of the promise for blocking requests. */
+            ResourceFuture m_future = m_promise.get_future().share();
+            /** Holds whether a thread started the load. */
+            std::atomic_bool m_claimed = false;
+        };
+
+        struct RetainedResource
+        {
+            /** Holds the resource id. */
+            std::string m_resId;
+            /** Holds the resource. */
+            std::shared_ptr<ResourceType> m_resource;
+            /** Holds the memory of the resource when it was retained. */
+            ResourceFootprint m_footprint;
+        };
+        using RetainedList = std::list<RetainedResource>;
+        using RetainedIndex = std::unordered_map<std::string, typename RetainedList::iterator>;
+
+        struct InFlightLoad
+        {
+            /** Holds the future shared by all requests. */
+            ResourceFuture m_future;
+            /** Holds the load, expires if it finished or all its jobs were cancelled. */
+            std::weak_ptr<LoadTask> m_task;
+            /** Holds the requests that queued a job for the load. */
+            std::vector<ResourceLoadDesc> m_requests;
+        };
+
+        template<typename... Args> std::shared_ptr<ResourceType> LoadWithRetry(const std::string& resId, Args&&... args)
+        {
+            std::shared_ptr<ResourceType> spResource(nullptr);
+            LoadResource(resId, spResource, std::forward<Args>(args)...);
+            if constexpr (reloadLoop) { // NOLINT
+                while (!spResource) { LoadResource(resId, spResource, std::forward<Args>(args)...); }
+            }
+            return spResource;
+        }
+
+        /** Registers a loaded resource (or a failed load if nullptr) and removes the in-flight load. */
+        void FinishLoad(const std::string& resId, const std::shared_ptr<ResourceType>& resource)
+        {
+            std::vector<RetainedResource> evicted;
+            {
+                const std::scoped_lock lock{m_mutex};
+                if (resource) {
+                    m_resources.insert_or_assign(resId, resource);
+                    evicted = RetainUnlocked(resId, resource, false);
+                }
+                m_inFlightLoads.erase(resId);
+            }
+            NotifyEvicted(std::move(evicted));
+        }
+
+        [[nodiscard]] static ResourceFootprint GetFootprint(const ResourceType& resource)
+        {
+            if constexpr (FootprintReporting<ResourceType>) { // NOLINT
+                return resource.GetFootprint();
+            } else {
+                return ResourceFootprint{sizeof(ResourceType), 0};
+            }
+        }
+
+        /**
+         *  Marks a resource as most recently used and counts the request as a hit if it is loaded already.
+         *  @return the resources evicted to stay within the budget.
+         */
+        [[nodiscard]] std::vector<RetainedResource> RetainUnlocked(const std::string& resId,
+                                                                   const std::shared_ptr<ResourceType>& resource,
+                                                                   bool isHit = true)
+        {
+            auto retained = m_retainedIndex.find(resId);
+            if (isHit) {
+                m_statistics.m_hits += 1;
+                // only the cache and the caller hold the resource.
+                if (retained != m_retainedIndex.end() && resource.use_count() <= 2) {
+                    m_statistics.m_retainedHits += 1;
+                }
+            }
+            if (m_retentionBudget == 0) { return {}; }
+
+            if (retained != m_retainedIndex.end()) {
+                m_retained.splice(m_retained.begin(), m_retained, retained->second);
+                return {};
+            }
+            auto footprint = GetFootprint(*resource);
+            m_retained.push_front(RetainedResource{resId, resource, footprint});
+            m_retainedIndex.emplace(resId, m_retained.begin());
+            m_statistics.m_numRetained += 1;
+            m_statistics.m_retainedFootprint.m_cpuBytes += footprint.m_cpuBytes;
+            m_statistics.m_retainedFootprint.m_deviceBytes += footprint.m_deviceBytes;
+            return EvictUnlocked();
+        }
+
+        /** Evicts the least recently used resources until the retained memory is within the budget. */
+        [[nodiscard]] std::vector<RetainedResource> EvictUnlocked()
+        {
+            std::vector<RetainedResource> evicted;
+            while (!m_retained.empty() && m_statistics.m_retainedFootprint.GetTotalBytes() > m_retentionBudget) {
+                evicted.push_back(RemoveRetainedUnlocked(m_retainedIndex.find(m_retained.back().m_resId)));
+                m_statistics.m_evictions += 1;
+            }
+            return evicted;
+        }
+
+        [[nodiscard]] RetainedResource RemoveRetainedUnlocked(typename RetainedIndex::iterator index)
+        {
+            auto retained = std::move(*index->second);
+            m_retained.erase(index->second);
+            m_retainedIndex.erase(index);
+            m_statistics.m_numRetained -= 1;
+            m_statistics.m_retainedFootprint.m_cpuBytes -= retained.m_footprint.m_cpuBytes;
+            m_statistics.m_retainedFootprint.m_deviceBytes -= retained.m_footprint.m_deviceBytes;
+            return retained;
+        }
+
+        /** Hands evicted resources to the eviction callback, needs to be called without the lock. */
+        void NotifyEvicted(std::vector<RetainedResource> evicted) const
+        {
+            if (evicted.empty()) { return; }
+            EvictionCallback callback;
+            {
+                const std::scoped_lock lock{m_mutex};
+                callback = m_evictionCallback;
+            }
+            if (!callback) { return; }
+            for (auto& retained : evicted) { callback(retained.m_resId, std::move(retained.m_resource)); }
+        }
+
+        /** Takes over the retention cache of another manager, needs both locks. */
+        void MoveRetainedUnlocked(ResourceManager& rhs)
+        {
+            m_retained = std::move(rhs.m_retained);
+            m_retainedIndex = std::move(rhs.m_retainedIndex);
+            m_retentionBudget = rhs.m_retentionBudget;
+            m_evictionCallback = std::move(rhs.m_evictionCallback);
+            m_statistics = rhs.m_statistics;
+            rhs.m_retained.clear();
+            rhs.m_retainedIndex.clear();
+            rhs.m_statistics = ResourceCacheStatistics{};
+        }
+
+        [[nodiscard]] std::shared_ptr<ResourceType> FindResourceUnlocked(const std::string& resId) const
+        {
+            auto rit = m_resources.find(resId);
+            return rit == m_resources.end() ? nullptr : rit->second.lock();
+        }
+
+        /** Finds a load that did not finish, removes loads whose jobs were all cancelled. */
+        [[nodiscard]] InFlightLoad* FindInFlightLoadUnlocked(const std::string& resId)
+        {
+            auto load = m_inFlightLoads.find(resId);
+            if (load == m_inFlightLoads.end()) { return nullptr; }
+            if (load->second.m_task.expired()) {
+                m_inFlightLoads.erase(load);
+                return nullptr;
+            }
+            return &load->second;
+        }
+
+        /** Returns the job pool if another manager may use it, i.e., it is not owned by this manager. */
+        [[nodiscard]] JobPool* GetSharedJobPoolUnlocked() const { return m_ownedJobPool ? nullptr : m_jobPool; }
+
+        [[nodiscard]] JobPool& GetJobPoolUnlocked()
+        {
+            if (m_jobPool == nullptr) {
+                m_ownedJobPool = std::make_unique<JobPool>(JobPool::GetDefaultNumThreads());
+                m_jobPool = m_ownedJobPool.get();
+            }
+            return *m_jobPool;
+        }
+
+        /** Protects the resources and in-flight loads. */
+        mutable std::mutex m_mutex;
         /** Holds the resources managed. */
         ResourceMap m_resources;
+        /** Holds the loads that did not finish. */
+        std::unordered_map<std::string, InFlightLoad> m_inFlightLoads;
+        /** Holds the retained resources, the most recently used first. */
+        RetainedList m_retained;
+        /** Holds the position of each retained resource in the list. */
+        RetainedIndex m_retainedIndex;
+        /** Holds the budget of the retention cache in bytes (0 if disabled). */
+        std::size_t m_retentionBudget = 0;
+        /** Holds the callback receiving evicted resources. */
+        EvictionCallback m_evictionCallback;
+        /** Holds the lookup and cache counters. */
+        ResourceCacheStatistics m_statistics;
         /** Holds the device for this resource. */
         const gfx::LogicalDevice* m_device;
+        /** Holds the job pool if the manager created it (destroyed first, as its jobs may use the manager). */
+        std::unique_ptr<JobPool> m_ownedJobPool;
+        /** Holds the job pool for asynchronous loads. */
+        JobPool* m_jobPool = nullptr;
     };
 }
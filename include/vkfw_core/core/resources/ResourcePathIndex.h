@@ -0,0 +1,81 @@
+/**
+ * @file   ResourcePathIndex.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Index of the files in the resource directories for resolving resource locations.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vkfw_core {
+
+    /**
+     *  Resolves local file names to their location in a list of search directories without checking each directory
+     *  for every lookup. The directories are scanned once on the first lookup, a file found in several directories
+     *  resolves to the first one like a search in order would. Empty directory names stand for the working directory,
+     *  which is not scanned but checked on each lookup. Symbolic links to directories are followed and keys are case
+     *  insensitive on Windows.
+     *  The index is only rebuilt by Rebuild or on the next lookup after Invalidate, e.g., when the file watcher
+     *  reports changes. Files missing from the index are checked in each directory, so files created later are found
+     *  as well. All lookups are thread-safe.
+     */
+    class ResourcePathIndex final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param searchDirectories the directories to search in order.
+         */
+        explicit ResourcePathIndex(std::vector<std::string> searchDirectories);
+
+        /**
+         *  Returns the location of a file or directory.
+         *  @param localFilename the file name local to any of the search directories.
+         *  @return the search directory and the local file name joined with "/" or std::nullopt if it does not exist.
+         */
+        [[nodiscard]] std::optional<std::string> FindLocation(const std::string& localFilename);
+        /** Marks the index as outdated, it is rebuilt on the next lookup. */
+        void Invalidate();
+        /** Rebuilds the index right away. */
+        void Rebuild();
+
+        /** Returns the number of indexed files and directories (builds the index if needed). */
+        [[nodiscard]] std::size_t GetNumIndexedEntries();
+
+    private:
+        struct IndexedEntry
+        {
+            /** Holds the index of the first search directory containing the entry. */
+            std::size_t m_directory = 0;
+        };
+
+        /** Scans all search directories, needs the lock. */
+        void BuildUnlocked();
+        /** Looks up a location, needs the lock. */
+        [[nodiscard]] std::optional<std::string> FindLocationUnlocked(const std::string& localFilename,
+                                                                      const std::optional<std::string>& key) const;
+        [[nodiscard]] std::string MakeLocation(std::size_t directory, const std::string& localFilename) const;
+        /** Returns the index key of a local file name or std::nullopt if it may point outside of the directories. */
+        [[nodiscard]] static std::optional<std::string> MakeKey(const std::string& localFilename);
+
+        /** Holds the search directories. */
+        std::vector<std::string> m_searchDirectories;
+        /** Protects the index. */
+        std::mutex m_mutex;
+        /** Holds whether the index is up to date. */
+        bool m_isBuilt = false;
+        /** Holds for each search directory whether it was scanned. */
+        std::vector<bool> m_isScanned;
+        /** Holds the indexed files and directories by their normalized local name. */
+        std::unordered_map<std::string, IndexedEntry> m_entries;
+    };
+}
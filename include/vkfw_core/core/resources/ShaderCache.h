@@ -0,0 +1,90 @@
+/**
+ * @file   ShaderCache.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Disk cache for SPIR-V code addressed by the content it was compiled from.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vkfw_core {
+
+    /**
+     *  Stores compiled SPIR-V code on disk in files named by a hash of everything the code depends on: the
+     *  preprocessed source, which contains all includes and defines, and the compile options like the compiler and its
+     *  version or the target environment. Changed sources get a new key, so entries never need to be invalidated. The least recently used
+     *  entries are removed once the cache exceeds its budget, the last use is kept in the file times between runs.
+     *  All methods are thread-safe.
+     */
+    class ShaderCache final
+    {
+    public:
+        /**
+         *  Constructor. Removes the temporary files of stores that did not finish, e.g., because a process crashed.
+         *  @param directory the directory to store the cache entries in (created on the first store).
+         *  @param budget the maximum size of all entries in bytes.
+         */
+        ShaderCache(std::filesystem::path directory, std::uintmax_t budget);
+
+        /** Returns the key of the code compiled from a preprocessed source with the given compile options. */
+        [[nodiscard]] static std::string ComputeKey(std::string_view preprocessedSource,
+                                                    std::string_view compileOptions);
+
+        /** Returns the code stored for a key and marks it as used or std::nullopt if there is none. */
+        [[nodiscard]] std::optional<std::vector<std::uint32_t>> Load(const std::string& key);
+        /** Stores code for a key and removes the least recently used entries exceeding the budget. */
+        void Store(const std::string& key, const std::vector<std::uint32_t>& code);
+
+        /** Sets the maximum size of all entries in bytes and removes entries exceeding it. */
+        void SetBudget(std::uintmax_t budget);
+        [[nodiscard]] std::uintmax_t GetBudget() const;
+        /** Returns the size of all entries in bytes. */
+        [[nodiscard]] std::uintmax_t GetSize() const;
+        [[nodiscard]] std::size_t GetNumEntries() const;
+        [[nodiscard]] std::size_t GetNumHits() const;
+        [[nodiscard]] std::size_t GetNumMisses() const;
+
+    private:
+        struct CacheEntry
+        {
+            /** Holds the size of the entry in bytes. */
+            std::uintmax_t m_size = 0;
+            /** Holds the order of the last use, smaller values were used longer ago. */
+            std::uint64_t m_lastUse = 0;
+        };
+
+        [[nodiscard]] std::filesystem::path GetFilename(const std::string& key) const;
+        /** Removes an entry and its file, needs the lock. */
+        void RemoveUnlocked(std::map<std::string, CacheEntry>::iterator entry);
+        /** Removes the least recently used entries until the cache fits its budget, needs the lock. */
+        void EvictUnlocked();
+
+        /** Holds the cache directory. */
+        std::filesystem::path m_directory;
+        /** Protects the entries and statistics. */
+        mutable std::mutex m_mutex;
+        /** Holds the maximum size of all entries in bytes. */
+        std::uintmax_t m_budget;
+        /** Holds the entries by their key. */
+        std::map<std::string, CacheEntry> m_entries;
+        /** Holds the size of all entries in bytes. */
+        std::uintmax_t m_size = 0;
+        /** Holds the order of the next use. */
+        std::uint64_t m_nextUse = 0;
+        /** Holds the number of loads that found an entry. */
+        std::size_t m_numHits = 0;
+        /** Holds the number of loads that found no entry. */
+        std::size_t m_numMisses = 0;
+    };
+}
@@ -10,17 +10,40 @@
 
 #include "gfx/vk/Shader.h"
 
+#include <functional>
+
 namespace vkfw_core {
 
     class ShaderManager final : public ResourceManager<gfx::Shader>
     {
     public:
-        explicit ShaderManager(const gfx::LogicalDevice* device);
+        /** Compiles a GLSL source to a SPIR-V file, returns false if compilation failed. */
+        using ShaderCompiler = std::function<bool(const std::string& sourceFilename, const std::string& spirvFilename)>;
+
+        explicit ShaderManager(const gfx::LogicalDevice* device, JobPool* jobPool = nullptr);
         ShaderManager(const ShaderManager&);
         ShaderManager& operator=(const ShaderManager&);
         ShaderManager(ShaderManager&&) noexcept;
         ShaderManager& operator=(ShaderManager&&) noexcept;
         ~ShaderManager() override;
 
+        /** Sets the compiler used for reloading changed shaders. */
+        void SetShaderCompiler(ShaderCompiler compiler) { m_shaderCompiler = std::move(compiler); }
+        [[nodiscard]] const ShaderCompiler& GetShaderCompiler() const { return m_shaderCompiler; }
+
+        /**
+         *  Compiles a shader with the runtime shader compiler if available and with the external tools otherwise.
+         *  The SPIR-V file is replaced only if compilation succeeds.
+         */
+        static bool CompileShader(const std::string& sourceFilename, const std::string& spirvFilename);
+        /**
+         *  Compiles a shader with the preprocessor and glslangValidator found by the build, like the build does.
+         *  The SPIR-V file is replaced only if compilation succeeds.
+         */
+        static bool CompileWithExternalTools(const std::string& sourceFilename, const std::string& spirvFilename);
+
+    private:
+        /** Holds the compiler used for reloading changed shaders. */
+        ShaderCompiler m_shaderCompiler = &ShaderManager::CompileShader;
     };
 }
@@ -0,0 +1,154 @@
+/**
+ * @file   TextureManager.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Contains the definition of TextureManager.
+ */
+
+#pragma once
+
+#include "gfx/Texture2D.h"
+#include "gfx/vk/wrappers/VulkanSyncResources.h"
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stop_token>
+
+namespace vkfw_core::gfx {
+    class Queue;
+}
+
+namespace vkfw_core {
+
+    /**
+     *  A handle to an asynchronously loaded texture, similar to a shared future.
+     *  Until the texture is uploaded the handle resolves to the dummy texture of the device.
+     */
+    class TextureHandle final
+    {
+    public:
+        TextureHandle() = default;
+
+        /** Checks if the texture is uploaded and can be used. */
+        [[nodiscard]] bool IsReady() const { return m_state && m_state->m_ready.load(std::memory_order_acquire); }
+        /** Checks if loading the texture failed, the handle resolves to the dummy texture then. */
+        [[nodiscard]] bool HasFailed() const { return m_state && m_state->m_failed.load(std::memory_order_acquire); }
+        /** Returns the texture if it is uploaded or the dummy texture otherwise (nullptr for empty handles). */
+        [[nodiscard]] gfx::Texture2D* Get() const
+        {
+            if (!m_state) { return nullptr; }
+            return IsReady() ? m_state->m_texture.get() : m_state->m_placeholder;
+        }
+        /** Returns the texture if it is uploaded or nullptr otherwise. */
+        [[nodiscard]] std::shared_ptr<gfx::Texture2D> GetResource() const
+        {
+            return IsReady() ? m_state->m_texture : nullptr;
+        }
+
+    private:
+        friend class TextureManager;
+
+        struct State
+        {
+            /** Holds the texture once it is uploaded. */
+            std::shared_ptr<gfx::Texture2D> m_texture;
+            /** Holds the texture used until the texture is uploaded. */
+            gfx::Texture2D* m_placeholder = nullptr;
+            /** Holds whether the texture is uploaded. */
+            std::atomic_bool m_ready = false;
+            /** Holds whether loading failed. */
+            std::atomic_bool m_failed = false;
+        };
+
+        explicit TextureHandle(std::shared_ptr<State> state) : m_state{std::move(state)} {}
+
+        /** Holds the state shared by all handles to the same texture. */
+        std::shared_ptr<State> m_state;
+    };
+
+    /**
+     *  Manages textures. Besides the synchronous GetResource of all resource managers, textures can be decoded on a
+     *  job pool and are uploaded once per frame by the window of the device.
+     */
+    class TextureManager final : public ResourceManager<gfx::Texture2D>
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param device the device to create resources in this manager.
+         *  @param jobPool the job pool decoding textures.
+         */
+        explicit TextureManager(const gfx::LogicalDevice* device, JobPool* jobPool = nullptr);
+        TextureManager(const TextureManager&) = delete;
+        TextureManager& operator=(const TextureManager&) = delete;
+        TextureManager(TextureManager&&) = delete;
+        TextureManager& operator=(TextureManager&&) = delete;
+        ~TextureManager() override;
+
+        /**
+         *  Gets a texture without blocking. Loaded textures are returned right away, other textures are decoded on the
+         *  job pool, uploaded by the next call of UploadLoadedTextures and ready once a later call finds the upload
+         *  finished. Concurrent requests for the same id share the load, which is cancelled only after the stop
+         *  tokens of all of them are triggered. Can be called from any thread.
+         *  Unlike ResourceManager::GetResourceAsync the texture is registered only after it is uploaded.
+         *  @param resId the resources id.
+         *  @param loadDesc the priority of decoding (only the first request counts) and the token to stop the request.
+         *  @return a handle resolving to the dummy texture until the texture is uploaded.
+         */
+        [[nodiscard]] TextureHandle
+        GetResourceAsync(const std::string& resId, bool useSRGB, bool flipTexture,
+                         const gfx::TextureMipmapDesc& mipmaps = gfx::TextureMipmapDesc{},
+                         const gfx::TextureCompressionDesc& compression = gfx::TextureCompressionDesc{},
+                         const ResourceLoadDesc& loadDesc = ResourceLoadDesc{});
+        /**
+         *  Makes the textures whose uploads are finished ready, then adds all textures decoded since the last call to
+         *  a new memory group and submits its upload without waiting for it.
+         *  @param queue the queue to upload with, MIP levels are generated on the CPU if it does not support graphics.
+         *  @return the number of textures that became ready.
+         */
+        std::size_t UploadLoadedTextures(const gfx::Queue& queue);
+        /** Waits until all requested textures are decoded and uploaded, e.g., for tools and benchmarks. */
+        void WaitForLoads(const gfx::Queue& queue);
+
+        /** Returns the number of textures requested asynchronously that are not uploaded yet. */
+        [[nodiscard]] std::size_t GetNumPendingLoads() const;
+
+    private:
+        struct PendingLoad
+        {
+            /** Holds the resource id. */
+            std::string m_id;
+            /** Holds the decoded texture (invalid once the upload is started). */
+            std::future<std::shared_ptr<gfx::Texture2D>> m_texture;
+            /** Holds the state shared with the handles. */
+            std::shared_ptr<TextureHandle::State> m_state;
+            /** Holds the stop source cancelling the decoding job. */
+            std::stop_source m_stopSource;
+            /** Holds the number of requests that did not stop, shared with the stop callbacks. */
+            std::shared_ptr<std::atomic_size_t> m_numActiveRequests;
+            /** Holds the callbacks counting down the active requests when their tokens are triggered. */
+            std::vector<std::unique_ptr<std::stop_callback<std::function<void()>>>> m_stopCallbacks;
+            /** Holds the texture while it is uploaded. */
+            std::shared_ptr<gfx::Texture2D> m_uploadedTexture;
+            /** Holds the timeline point reached when the upload is finished. */
+            gfx::TimelinePoint m_uploadPoint;
+        };
+
+        /** Adds a request to a load, the load is cancelled when the tokens of all its requests are triggered. */
+        static void AddRequest(PendingLoad& load, const std::stop_token& stopToken);
+        /** Adds the decoded textures to a memory group and submits its upload. */
+        void StartUploads(const gfx::Queue& queue);
+        /** Makes the textures whose uploads are finished ready, returns their number. */
+        std::size_t FinishUploads();
+
+        /** Protects the pending loads, so no load is started for a texture registered concurrently. */
+        mutable std::mutex m_pendingMutex;
+        /** Holds the textures that are decoded or uploaded. */
+        std::vector<PendingLoad> m_pendingLoads;
+        /** Holds the number of uploads for naming their memory groups. */
+        std::size_t m_uploadCount = 0;
+    };
+}
@@ -12,6 +12,7 @@
 
 #include <vector>
 #include <array>
+#include <span>
 #include <concepts>
 #include <type_traits>
 
@@ -41,6 +42,9 @@ namespace vkfw_core {
     template<typename T>
     struct has_contiguous_memory<aligned_vector<T>> : std::true_type {};
 
+    template<typename T, std::size_t N>
+    struct has_contiguous_memory<std::span<T, N>> : std::true_type {};
+
 
     template<typename T> concept contiguous_memory = requires
     {
@@ -0,0 +1,72 @@
+/**
+ * @file   worker_group.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  A group of persistent threads that run the same task in fork-join fashion.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <core/function_view.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vkfw_core {
+
+    /**
+     *  Runs a task on a fixed number of threads and waits for all of them, e.g., once per frame. The threads are
+     *  kept alive between runs so starting a run only costs a wake up. The calling thread takes part as thread 0.
+     */
+    class WorkerGroup final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param numThreads the number of threads including the calling thread (at least 1).
+         */
+        explicit WorkerGroup(std::size_t numThreads);
+        WorkerGroup(const WorkerGroup&) = delete;
+        WorkerGroup& operator=(const WorkerGroup&) = delete;
+        WorkerGroup(WorkerGroup&&) = delete;
+        WorkerGroup& operator=(WorkerGroup&&) = delete;
+        ~WorkerGroup();
+
+        /**
+         *  Calls the task once on each thread and returns when all calls returned.
+         *  The first exception thrown by a call is rethrown after all calls finished.
+         *  @param task the task, gets the index of the thread in [0, GetNumThreads()).
+         */
+        void Run(function_view<void(std::size_t threadIndex)> task);
+
+        [[nodiscard]] std::size_t GetNumThreads() const { return m_threads.size() + 1; }
+
+    private:
+        void WorkerLoop(std::size_t threadIndex);
+
+        /** Holds the worker threads (without the calling thread). */
+        std::vector<std::thread> m_threads;
+        /** Protects the run state. */
+        std::mutex m_mutex;
+        /** Notifies the workers that a run started or the group stops. */
+        std::condition_variable m_runStarted;
+        /** Notifies the calling thread that a worker finished its part of the run. */
+        std::condition_variable m_workerFinished;
+        /** Holds the task of the current run. */
+        function_view<void(std::size_t)> m_task;
+        /** Holds the number of the current run, workers compare it to the last one they ran. */
+        std::size_t m_run = 0;
+        /** Holds the number of workers still running the current run. */
+        std::size_t m_runningWorkers = 0;
+        /** Holds the first exception of the current run. */
+        std::exception_ptr m_exception;
+        /** Holds whether the workers should exit. */
+        bool m_stop = false;
+    };
+}
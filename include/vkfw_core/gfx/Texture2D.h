@@ -13,6 +13,7 @@
 #include <glm/gtc/type_precision.hpp>
 
 #include <core/function_view.h>
+#include "core/mipmap.h"
 
 namespace vkfw_core::gfx {
 
@@ -29,20 +30,91 @@ namespace vkfw_core::gfx {
         int m_imgChannels;
     };
 
+    /** Where the MIP levels of a texture are generated. */
+    enum class MipmapGeneration {
+        /** The texture only has a single level. */
+        NONE,
+        /**
+         *  The levels are blitted on the GPU when the memory group transfers its data, which needs a graphics queue.
+         *  Falls back to the CPU if the format cannot be blitted linearly, for normal maps and for textures uploaded
+         *  by the TextureManager with a queue without graphics support.
+         */
+        GPU,
+        /** The levels are filtered on the CPU when loading the texture. */
+        CPU
+    };
+
+    struct TextureMipmapDesc
+    {
+        /** Holds where the MIP levels are generated. */
+        MipmapGeneration m_generation = MipmapGeneration::GPU;
+        /** Holds the filter options on the CPU (sRGB formats are filtered as sRGB unless this is a normal map). */
+        MipmapOptions m_options;
+    };
+
+    /**
+     *  How block compressed caches next to the source image are used.
+     *  Caches are named <file>.<hash>.ktx2, the hash covers the sRGB, flip, quality and MIP options.
+     */
+    enum class TextureCache {
+        /** The source image is always decoded. */
+        NONE,
+        /** A cache newer than the source image is loaded instead of the source image. */
+        READ,
+        /** Like READ, but a missing or outdated cache is encoded on the CPU and written first (LDR images only). */
+        READ_WRITE
+    };
+
+    struct TextureCompressionDesc
+    {
+        /** Holds how the texture cache is used, a cache keeps the format and levels it was written with. */
+        TextureCache m_cache = TextureCache::NONE;
+        /** Holds if color images are encoded as BC7 instead of the faster BC1 (opaque) or BC3 formats. */
+        bool m_highQuality = true;
+    };
+
+    /**
+     *  A 2D texture loaded with stb_image or from a KTX 2.0 file (.ktx2).
+     *  KTX 2.0 files keep their format and MIP levels, block compressed levels are decoded on the CPU if the device
+     *  cannot sample the format.
+     *  Loading is split in decoding the file, which uses no global state and can run on any thread, and adding the
+     *  decoded data to a memory group.
+     */
     class Texture2D final : public Resource
     {
     public:
         Texture2D(const std::string& textureFilename, const LogicalDevice* device,
                   bool useSRGB, bool flipTexture, MemoryGroup& memGroup,
-                  const std::vector<std::uint32_t>& queueFamilyIndices = std::vector<std::uint32_t>{});
+                  const std::vector<std::uint32_t>& queueFamilyIndices = std::vector<std::uint32_t>{},
+                  const TextureMipmapDesc& mipmaps = TextureMipmapDesc{},
+                  const TextureCompressionDesc& compression = TextureCompressionDesc{});
+        /** Only decodes the texture, it needs to be added to a memory group before it can be used. */
+        Texture2D(const std::string& textureFilename, const LogicalDevice* device, bool useSRGB, bool flipTexture,
+                  const TextureMipmapDesc& mipmaps, const TextureCompressionDesc& compression = TextureCompressionDesc{});
         Texture2D(const Texture2D&) = delete;
         Texture2D(Texture2D&&) = delete;
         Texture2D& operator=(const Texture2D&) = delete;
         Texture2D& operator=(Texture2D&&) = delete;
         ~Texture2D() override;
 
+        /**
+         *  Generates the MIP levels of a decoded texture on the CPU if they would be generated on the GPU, e.g., if
+         *  it is uploaded with a transfer only queue. Needs to be called before adding the texture to a memory group.
+         */
+        void GenerateMipmapsOnCPU();
+        /** Adds a decoded texture to a memory group, which releases the decoded data after transferring it. */
+        void AddToMemoryGroup(MemoryGroup& memGroup,
+                              const std::vector<std::uint32_t>& queueFamilyIndices = std::vector<std::uint32_t>{});
+        /** Adds a decoded texture to a memory group that is kept alive as long as the texture. */
+        void AddToMemoryGroup(std::shared_ptr<MemoryGroup> memGroup,
+                              const std::vector<std::uint32_t>& queueFamilyIndices = std::vector<std::uint32_t>{});
+
         [[nodiscard]] const DeviceTexture& GetTexture() const;
         [[nodiscard]] DeviceTexture& GetTexture();
+        /** Returns the memory of the decoded data and of the texture once it is added to a memory group. */
+        [[nodiscard]] ResourceFootprint GetFootprint() const;
+        /** Returns the path of the texture file. */
+        [[nodiscard]] const std::string& GetFilename() const { return m_textureFilename; }
 
     private:
         enum class FormatProperties {
@@ -51,12 +123,50 @@ namespace vkfw_core::gfx {
             USE_HDR
         };
 
+        /** The data of a decoded MIP level. */
+        struct DecodedLevel
+        {
+            /** Holds the MIP level. */
+            std::uint32_t m_mipLevel = 0;
+            /** Holds the size of the data (x: bytes of line, y: #lines, z: #depth slices). */
+            glm::u32vec3 m_dataSize = glm::u32vec3{0};
+            /** Holds the data. */
+            void* m_data = nullptr;
+            /** Holds the owner of the data. */
+            std::shared_ptr<const void> m_owner;
+        };
+
+        /** The decoded texture until it is added to a memory group. */
+        struct DecodedTexture
+        {
+            /** Holds the size of level 0 in pixels. */
+            glm::u32vec4 m_size = glm::u32vec4{0};
+            /** Holds the texture format. */
+            vk::Format m_format = vk::Format::eUndefined;
+            /** Holds the bytes per pixel (per block for block compressed formats). */
+            std::size_t m_bytesPP = 0;
+            /** Holds the number of MIP levels. */
+            std::uint32_t m_mipLevels = 1;
+            /** Holds whether the MIP levels are generated on the GPU after the transfer. */
+            bool m_generateMipmaps = false;
+            /** Holds the filter options if the MIP levels are generated on the CPU after all. */
+            MipmapOptions m_mipmapOptions;
+            /** Holds the decoded levels. */
+            std::vector<DecodedLevel> m_levels;
+        };
+
         Texture2D(const std::string& textureFilename, bool flipTexture, const LogicalDevice* device);
         void LoadTextureLDR(const std::string& filename, bool useSRGB,
             const function_view<void(const glm::u32vec4& size, const TextureDescriptor& desc, void* data)>& loadFn);
         void LoadTextureHDR(const std::string& filename,
             const function_view<void(const glm::u32vec4& size, const TextureDescriptor& desc, void* data)>& loadFn);
+        void LoadTextureKTX2(const std::string& filename);
+        void WriteTextureCache(const std::string& filename, const std::string& cacheFilename, bool useSRGB,
+                               const TextureMipmapDesc& mipmaps, const TextureCompressionDesc& compression) const;
         std::pair<unsigned int, vk::Format> FindFormat(const std::string& filename, int& imgChannels, FormatProperties fmtProps) const;
+        [[nodiscard]] MipmapGeneration GetMipmapGeneration(const TextureMipmapDesc& mipmaps, vk::Format format) const;
+        void AddMipmapLevels(const glm::u32vec4& size, const TextureDescriptor& desc, const void* data,
+                             const MipmapOptions& options);
 
         /** Holds the texture file name. */
         std::string m_textureFilename;
@@ -64,5 +174,9 @@ namespace vkfw_core::gfx {
         unsigned int m_textureIdx;
         /** Holds the memory group containing the texture. */
         MemoryGroup* m_memoryGroup;
+        /** Holds the memory group if it is owned by the texture. */
+        std::shared_ptr<MemoryGroup> m_ownedMemoryGroup;
+        /** Holds the decoded data until the texture is added to a memory group. */
+        DecodedTexture m_decoded;
     };
 }
@@ -119,6 +119,8 @@ namespace vkfw_core::gfx {
         float m_endTime = 1.0f;
         /** Playback speed of the animation. */
         float m_playbackSpeed = 1.0f;
+        /** Number of uniform samples per time unit of the key frames the animation is resampled to (0 samples them). */
+        float m_resampleRate = 0.0f;
     };
 
     /**
@@ -132,6 +134,7 @@ namespace vkfw_core::gfx {
     public:
         Animation();
         explicit Animation(aiAnimation* aiAnimation);
+        Animation(std::string name, std::vector<Channel> channels, float framesPerSecond, float duration);
 
         void FlattenHierarchy(std::size_t numNodes, const std::map<std::string, std::size_t>& nodeNamesMap);
 
@@ -141,11 +144,8 @@ namespace vkfw_core::gfx {
         [[nodiscard]] float GetDuration() const;
         /** Returns the animations name. */
         [[nodiscard]] const std::string& GetName() const { return m_name; }
-        /**
-         *  Returns the channel of one bone.
-         *  @param id id of the bone.
-         */
-        // const Channel& GetChannel(std::size_t id) const;
+        /** Returns the channels of all nodes (after the hierarchy was flattened). */
+        [[nodiscard]] const std::vector<Channel>& GetChannels() const noexcept { return m_channels; }
 
         [[nodiscard]] Animation GetSubSequence(const std::string& name, Time start, Time end) const;
 
@@ -187,10 +187,6 @@ namespace vkfw_core::gfx {
 
     inline float Animation::GetDuration() const { return m_duration; }
 
-    // inline const std::vector<Channel>& Animation::GetChannels() const { return channels_; }
-    //
-    // inline const Channel& Animation::GetChannel(std::size_t id) const { return channels_.at(id); }
-
 }
 
 // NOLINTNEXTLINE
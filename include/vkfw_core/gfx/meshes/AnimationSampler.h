@@ -0,0 +1,113 @@
+/**
+ * @file   AnimationSampler.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a sampler for animation key frames.
+ */
+
+#pragma once
+
+#include "gfx/meshes/Animation.h"
+
+#include <cstdint>
+#include <span>
+#include <glm/mat4x4.hpp>
+
+namespace vkfw_core::gfx {
+
+    /** Key frames of a single channel component with times and values in separate arrays. */
+    template<typename T> struct AnimationTrack
+    {
+        /** Holds the key times (empty if the track is uniformly resampled). */
+        std::vector<Time> m_times;
+        /** Holds the key values. */
+        std::vector<T> m_values;
+    };
+
+    /** The keys last used for each component of a channel, used to speed up monotonic playback. */
+    struct AnimationCursor
+    {
+        /** Holds the last position key. */
+        std::uint32_t m_position = 0;
+        /** Holds the last rotation key. */
+        std::uint32_t m_rotation = 0;
+        /** Holds the last scaling key. */
+        std::uint32_t m_scaling = 0;
+    };
+
+    /**
+     *  Samples the channels of an animation. Keys are found by binary search or, if a cursor is given, by checking
+     *  the keys after the last used one first, which makes monotonic playback O(1) per channel.
+     *  Optionally all tracks are resampled uniformly, so keys are found by a single multiplication.
+     *  Sampling the key frames gives the same poses as Animation::ComputePoseAtTime.
+     */
+    class AnimationSampler
+    {
+    public:
+        AnimationSampler() = default;
+        /**
+         *  Constructor.
+         *  @param channels the channels of the animation.
+         *  @param duration the duration of the animation.
+         *  @param resampleRate the number of uniform samples per time unit, 0 uses the key frames directly.
+         */
+        AnimationSampler(std::span<const Channel> channels, Time duration, float resampleRate = 0.0f);
+        explicit AnimationSampler(const Animation& animation, float resampleRate = 0.0f);
+
+        /** Returns the number of channels. */
+        [[nodiscard]] std::size_t GetNumberOfChannels() const noexcept { return m_channels.size(); }
+        /** Returns if the tracks are uniformly resampled. */
+        [[nodiscard]] bool IsResampled() const noexcept { return m_resampleRate > 0.0f; }
+
+        /**
+         *  Computes the transformation of a channel at a given time.
+         *  @param channel the index of the channel (bone/node).
+         *  @param time the animation time.
+         *  @param pose the resulting transformation.
+         *  @return true if the channel is animated.
+         */
+        bool SamplePose(std::size_t channel, Time time, glm::mat4& pose) const;
+        /**
+         *  Computes the transformation of a channel at a given time using and updating a cursor.
+         *  @param channel the index of the channel (bone/node).
+         *  @param time the animation time.
+         *  @param cursor the keys used last for this channel.
+         *  @param pose the resulting transformation.
+         *  @return true if the channel is animated.
+         */
+        bool SamplePose(std::size_t channel, Time time, AnimationCursor& cursor, glm::mat4& pose) const;
+
+        /**
+         *  Returns the last key with a time not after the given time (or 0 if the time is before all keys).
+         *  @param times the key times in ascending order (not empty).
+         *  @param time the time to look for.
+         *  @param cursor the key found last, this and the next key are checked before searching.
+         */
+        [[nodiscard]] static std::uint32_t FindKey(std::span<const Time> times, Time time, std::uint32_t cursor);
+
+    private:
+        /** The tracks of a single channel. */
+        struct ChannelTracks
+        {
+            /** Holds the positions. */
+            AnimationTrack<glm::vec3> m_positions;
+            /** Holds the rotations. */
+            AnimationTrack<glm::quat> m_rotations;
+            /** Holds the scalings. */
+            AnimationTrack<glm::vec3> m_scalings;
+        };
+
+        template<typename T> T SampleTrack(const AnimationTrack<T>& track, Time time, std::uint32_t& cursor) const;
+        template<typename T>
+        [[nodiscard]] AnimationTrack<T> ResampleTrack(const AnimationTrack<T>& track, float resampleRate,
+                                                      std::size_t numSamples) const;
+
+        /** Holds the tracks for each channel. */
+        std::vector<ChannelTracks> m_channels;
+        /** Holds the duration of the animation. */
+        Time m_duration = 0.0f;
+        /** Holds the number of uniform samples per time unit (0 if the key frames are used directly). */
+        float m_resampleRate = 0.0f;
+    };
+}
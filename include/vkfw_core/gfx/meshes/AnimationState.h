@@ -11,6 +11,7 @@
 #include <vector>
 #include <glm/mat4x4.hpp>
 #include "gfx/meshes/Animation.h"
+#include "gfx/meshes/AnimationSampler.h"
 
 namespace vkfw_core::gfx {
 
@@ -101,6 +102,10 @@ namespace vkfw_core::gfx {
         std::vector<float> m_animationPlaybackSpeed;
         /** Holds the actual animation for each AnimationState. */
         std::vector<Animation> m_animations;
+        /** Holds the sampler for each animation. */
+        std::vector<AnimationSampler> m_samplers;
+        /** Holds the last used keys for each node (these are only hints and stay valid when switching animations). */
+        std::vector<AnimationCursor> m_cursors;
 
 
         /** Is the animation playing. */
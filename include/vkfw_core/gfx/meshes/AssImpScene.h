@@ -13,12 +13,17 @@
 #include "MeshInfo.h"
 #include <core/serialization_helper.h>
 #include <core/enum_flags.h>
+#include <filesystem>
+
+struct aiMesh;
 
 namespace vkfw_core::gfx {
 
     enum class MeshCreateFlagBits : unsigned int {
         NO_SMOOTH_NORMALS = 0x1,
-        CREATE_TANGENTSPACE = 0x2
+        CREATE_TANGENTSPACE = 0x2,
+        /** Imports the meshes of a scene in parallel, the result is the same as the serial import. */
+        PARALLEL_IMPORT = 0x4
     };
 }
 
@@ -42,6 +47,8 @@ namespace vkfw_core::gfx {
     public:
         AssImpScene(std::string resourceId, const LogicalDevice* device,
                     MeshCreateFlags flags = MeshCreateFlags());
+        /** Imports a mesh file directly, without resource lookup and without using or writing a binary file. */
+        AssImpScene(const std::filesystem::path& filename, MeshCreateFlags flags);
         AssImpScene(const AssImpScene&);
         AssImpScene& operator=(const AssImpScene&);
         AssImpScene(AssImpScene&&) noexcept;
@@ -50,7 +57,10 @@ namespace vkfw_core::gfx {
 
     private:
         void createNewMesh(const std::string& filename, MeshCreateFlags flags);
-        void ParseBoneHierarchy(const std::map<std::string, unsigned int>& bones, const aiNode* node,
+        /** Copies the vertex data, indices and bone weights of a single mesh to its ranges in the mesh arrays. */
+        void ImportMeshData(const aiMesh* mesh, unsigned int vertexOffset, unsigned int indexOffset,
+                            const std::vector<unsigned int>& boneIndices);
+        void ParseBoneHierarchy(const std::unordered_map<std::string, unsigned int>& bones, const aiNode* node,
             std::size_t parent, glm::mat4 parentMatrix);
 
         void saveBinary(const std::string& filename) const;
@@ -17,6 +17,7 @@
 #include "gfx/vk/wrappers/DescriptorSet.h"
 #include "gfx/vk/wrappers/PipelineLayout.h"
 #include "core/concepts.h"
+#include "core/math/culling.h"
 #include "mesh/mesh_host_interface.h"
 #include <tuple>
 
@@ -78,6 +79,7 @@ namespace vkfw_core::gfx {
         void UpdateWorldMatrices(std::size_t backbufferIndex, const glm::mat4& worldMatrix) const;
         void UpdateWorldMatricesNode(std::size_t backbufferIndex, const SceneMeshNode* node, const glm::mat4& worldMatrix) const;
 
+        /** Records the mesh on the calling thread, use GetDrawElements with RenderList to record in parallel. */
         void Draw(CommandBuffer& cmdBuffer, std::size_t backbufferIdx,
                   const PipelineLayout& pipelineLayout);
         void DrawNode(CommandBuffer& cmdBuffer, std::size_t backbufferIdx, const PipelineLayout& pipelineLayout,
@@ -106,6 +108,7 @@ namespace vkfw_core::gfx {
         template<Vertex VertexType, class MaterialType>
         void CreateBuffersInMemoryGroup(std::size_t offset, std::size_t numBackbuffers, const std::vector<std::uint32_t>& queueFamilyIndices);
         void CreateMaterials(const std::vector<std::uint32_t>& queueFamilyIndices);
+        void CreateCullingBoxes();
 
         void SetVertexInput(DeviceBuffer* vtxBuffer, std::size_t vtxOffset, DeviceBuffer* idxBuffer, std::size_t idxOffset);
 
@@ -142,6 +145,11 @@ namespace vkfw_core::gfx {
         /** Holds the material descriptor sets. */
         std::vector<DescriptorSet> m_materialDescriptorSets;
 
+        /** Holds the boxes for culling per node, the nodes box is followed by the boxes of its sub meshes. */
+        std::vector<math::CullingBoxes> m_nodeCullingBoxes;
+        /** Holds the visibility mask of the node currently culled (reused to avoid allocations). */
+        std::vector<std::uint64_t> m_cullingVisibility;
+
         /** Holds the vertex and material data while the mesh is constructed. */
         std::vector<uint8_t> m_vertexMaterialData;
     };
@@ -186,9 +194,6 @@ namespace vkfw_core::gfx {
         const std::vector<std::uint32_t>& queueFamilyIndices)
     {
         // TODO: possible bug? numBackbuffers is not used currently. [3/28/2020 Sebastian Maisch]
-        std::vector<VertexType> vertices;
-        m_meshInfo->GetVertices(vertices);
-
         auto materialAlignment = m_device->CalculateUniformBufferAlignment(sizeof(MaterialType));
         aligned_vector<MaterialType> materialUBOContent{ materialAlignment }; materialUBOContent.reserve(m_materials.size());
         for (const auto& material : m_materials) materialUBOContent.emplace_back(material);
@@ -197,12 +202,13 @@ namespace vkfw_core::gfx {
         worldMatrices.model = glm::mat4{ 1.0f };
         worldMatrices.normalMatrix = glm::mat4{ 1.0f };
 
-        auto vertexBufferSize = vkfw_core::byteSizeOf(vertices);
+        auto vertexBufferSize = m_meshInfo->GetVertices().size() * sizeof(VertexType);
         auto indexBufferSize = vkfw_core::byteSizeOf(m_meshInfo->GetIndices());
         auto materialBufferSize = m_device->CalculateUniformBufferAlignment(byteSizeOf(materialUBOContent));
 
+        // vertices are built directly in the upload data, indices are uploaded from the mesh info (possibly mapped).
         m_vertexMaterialData.resize(vertexBufferSize + materialBufferSize + sizeof(mesh::WorldUniformBufferObject));
-        memcpy(m_vertexMaterialData.data(), vertices.data(), vertexBufferSize);
+        m_meshInfo->ConstructVertices<VertexType>(m_vertexMaterialData.data());
         memcpy(m_vertexMaterialData.data() + vertexBufferSize, materialUBOContent.data(), materialBufferSize);
         memcpy(m_vertexMaterialData.data() + vertexBufferSize + materialBufferSize, &worldMatrices,
                sizeof(mesh::WorldUniformBufferObject));
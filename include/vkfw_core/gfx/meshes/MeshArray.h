@@ -0,0 +1,90 @@
+/**
+ * @file   MeshArray.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of an array of mesh data that is either owned or a view into a mapped file.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <cereal/cereal.hpp>
+
+namespace vkfw_core::gfx {
+
+    /**
+     *  Mesh data is owned while a mesh is imported and can be a view into a memory mapped file after loading it from a
+     *  binary file. The owner of the mapping has to keep it alive as long as the array is used.
+     */
+    template<typename T> class MeshArray
+    {
+    public:
+        using value_type = T;
+
+        MeshArray() = default;
+
+        /** Returns a view of the data. */
+        [[nodiscard]] std::span<const T> View() const noexcept
+        {
+            return m_isMapped ? m_mapped : std::span<const T>{m_data};
+        }
+        /** Returns the owned data for modification (mapped data cannot be modified). */
+        std::vector<T>& Modify() noexcept
+        {
+            assert(!m_isMapped);
+            return m_data;
+        }
+        /** Sets the array to a view into mapped memory. */
+        void Map(std::span<const T> mapped) noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            m_data.clear();
+            m_mapped = mapped;
+            m_isMapped = true;
+        }
+        [[nodiscard]] bool IsMapped() const noexcept { return m_isMapped; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return View().size(); }
+        [[nodiscard]] bool empty() const noexcept { return View().empty(); }
+        [[nodiscard]] const T* data() const noexcept { return View().data(); }
+        [[nodiscard]] auto begin() const noexcept { return View().begin(); }
+        [[nodiscard]] auto end() const noexcept { return View().end(); }
+        const T& operator[](std::size_t index) const noexcept { return View()[index]; }
+        T& operator[](std::size_t index) noexcept { return Modify()[index]; }
+        void resize(std::size_t size) { Modify().resize(size); }
+        void clear() noexcept { Modify().clear(); }
+        void push_back(const T& value) { Modify().push_back(value); }
+
+    private:
+        /** Needed for serialization */
+        friend class cereal::access;
+
+        // the layout is the same as serializing a std::vector.
+        template<class Archive> void save(Archive& ar) const // NOLINT
+        {
+            ar(cereal::make_size_tag(static_cast<cereal::size_type>(size())));
+            for (const auto& value : View()) { ar(value); }
+        }
+
+        template<class Archive> void load(Archive& ar) // NOLINT
+        {
+            cereal::size_type size = 0;
+            ar(cereal::make_size_tag(size));
+            m_mapped = {};
+            m_isMapped = false;
+            m_data.resize(size);
+            for (auto& value : m_data) { ar(value); }
+        }
+
+        /** Holds the owned data. */
+        std::vector<T> m_data;
+        /** Holds the mapped data. */
+        std::span<const T> m_mapped;
+        /** Holds whether the array is a view of mapped data. */
+        bool m_isMapped = false;
+    };
+}
@@ -0,0 +1,53 @@
+/**
+ * @file   MeshBinaryFile.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of the memory mappable binary file format (.vkbin) for meshes.
+ */
+
+#pragma once
+
+#include "main.h"
+
+#include <filesystem>
+
+namespace vkfw_core::gfx {
+
+    class MeshInfo;
+
+    /**
+     *  Binary cache of a MeshInfo that is memory mapped when loaded.
+     *
+     *  Layout (little endian): a header, a section table and the sections. Each section is aligned to
+     *  SECTION_ALIGNMENT and holds a raw array (vertices, indices, bone data, ...) that the loaded MeshInfo views
+     *  directly without copying. Materials, sub meshes, animations and the node tree are stored with cereal in a single
+     *  metadata section.
+     *  The header is protected by a checksum and stores the modification time, size and a content hash of the source
+     *  file. A changed time with an unchanged hash (e.g., after a checkout) still accepts the file and the new time is
+     *  stored, so the source is only hashed once.
+     */
+    class MeshBinaryFile
+    {
+    public:
+        static constexpr std::uint32_t FORMAT_VERSION = 1;
+        static constexpr std::size_t SECTION_ALIGNMENT = 64;
+
+        /** Returns the binary file name for a mesh source file. */
+        [[nodiscard]] static std::filesystem::path GetBinaryFilename(const std::filesystem::path& sourceFilename);
+
+        /**
+         *  Writes the mesh to the binary file belonging to the source file.
+         *  @param mesh the mesh to write.
+         *  @param sourceFilename the file the mesh was imported from.
+         */
+        static void Write(const MeshInfo& mesh, const std::filesystem::path& sourceFilename);
+        /**
+         *  Maps the binary file belonging to the source file and loads the mesh from it.
+         *  @param mesh the mesh to load into (the node hierarchy is not flattened).
+         *  @param sourceFilename the file the mesh was imported from.
+         *  @return whether a valid and up to date binary file was loaded.
+         */
+        static bool Read(MeshInfo& mesh, const std::filesystem::path& sourceFilename);
+    };
+}
@@ -11,6 +11,7 @@
 #include "main.h"
 #include <typeindex>
 #include "Animation.h"
+#include "MeshArray.h"
 #include "SubMesh.h"
 #include "SceneMeshNode.h"
 #include "gfx/Material.h"
@@ -20,6 +21,10 @@
 
 struct aiNode;
 
+namespace vkfw_core {
+    class MemoryMappedFile;
+}
+
 namespace vkfw_core::gfx {
 
     class DeviceBuffer;
@@ -52,27 +57,32 @@ namespace vkfw_core::gfx {
         /** Returns the root node of the mesh. */
         [[nodiscard]] const SceneMeshNode* GetRootNode() const noexcept { return m_rootNode.get(); }
 
-        [[nodiscard]] const std::vector<glm::vec3>& GetVertices() const { return m_vertices; }
-        [[nodiscard]] const std::vector<glm::vec3>& GetNormals() const { return m_normals; }
-        [[nodiscard]] const std::vector<std::vector<glm::vec3>>& GetTexCoords() const { return m_texCoords; }
-        [[nodiscard]] const std::vector<glm::vec3>& GetTangents() const { return m_tangents; }
-        [[nodiscard]] const std::vector<glm::vec3>& GetBinormals() const { return m_binormals; }
-        [[nodiscard]] const std::vector<std::vector<glm::vec4>>& GetColors() const { return m_colors; }
-        [[nodiscard]] const std::vector<std::vector<glm::uvec4>>& GetIndexVectors() const { return m_indexVectors; }
+        [[nodiscard]] std::span<const glm::vec3> GetVertices() const { return m_vertices.View(); }
+        [[nodiscard]] std::span<const glm::vec3> GetNormals() const { return m_normals.View(); }
+        [[nodiscard]] const std::vector<MeshArray<glm::vec3>>& GetTexCoords() const { return m_texCoords; }
+        [[nodiscard]] std::span<const glm::vec3> GetTangents() const { return m_tangents.View(); }
+        [[nodiscard]] std::span<const glm::vec3> GetBinormals() const { return m_binormals.View(); }
+        [[nodiscard]] const std::vector<MeshArray<glm::vec4>>& GetColors() const { return m_colors; }
+        [[nodiscard]] const std::vector<MeshArray<glm::uvec4>>& GetIndexVectors() const { return m_indexVectors; }
+        [[nodiscard]] std::span<const glm::uvec4> GetBoneOffsetMatrixIndices() const noexcept
+        {
+            return m_boneOffsetMatrixIndices.View();
+        }
+        [[nodiscard]] std::span<const glm::vec4> GetBoneWeights() const noexcept { return m_boneWeights.View(); }
 
-        [[nodiscard]] const std::vector<std::uint32_t>& GetIndices() const noexcept { return m_indices; }
+        [[nodiscard]] std::span<const std::uint32_t> GetIndices() const noexcept { return m_indices.View(); }
 
         [[nodiscard]] const std::vector<Animation>& GetAnimations() const noexcept { return m_animations; }
 
         /** Returns the offset matrices for all bones. */
-        [[nodiscard]] const std::vector<glm::mat4>& GetInverseBindPoseMatrices() const noexcept
+        [[nodiscard]] std::span<const glm::mat4> GetInverseBindPoseMatrices() const noexcept
         {
-            return m_inverseBindPoseMatrices;
+            return m_inverseBindPoseMatrices.View();
         }
         /** Returns the AABB for all bones. */
-        [[nodiscard]] const std::vector<math::AABB3<float>>& GetBoneBoundingBoxes() const noexcept
+        [[nodiscard]] std::span<const math::AABB3<float>> GetBoneBoundingBoxes() const noexcept
         {
-            return m_boneBoundingBoxes;
+            return m_boneBoundingBoxes.View();
         }
         /**
          *  Returns the parent bone of any given bone.
@@ -90,24 +100,27 @@ namespace vkfw_core::gfx {
 
         template<class VertexType>
         void GetVertices(std::vector<VertexType>& vertices) const;
+        /** Constructs all vertices in place, the memory has to be large enough for GetVertices().size() vertices. */
+        template<class VertexType>
+        void ConstructVertices(void* vertices) const;
 
     protected:
-        std::vector<glm::vec3>& GetVertices() { return m_vertices; }
-        std::vector<glm::vec3>& GetNormals() { return m_normals; }
-        std::vector<std::vector<glm::vec3>>& GetTexCoords() { return m_texCoords; }
-        std::vector<glm::vec3>& GetTangents() { return m_tangents; }
-        std::vector<glm::vec3>& GetBinormals() { return m_binormals; }
-        std::vector<std::vector<glm::vec4>>& GetColors() { return m_colors; }
-        std::vector<std::vector<glm::uvec4>>& GetIndexVectors() { return m_indexVectors; }
-        std::vector<std::uint32_t>& GetIndices() { return m_indices; }
-        std::vector<glm::uvec4>& GetBoneOffsetMatrixIndices() noexcept { return m_boneOffsetMatrixIndices; }
-        std::vector<glm::vec4>& GetBoneWeigths() noexcept { return m_boneWeights; }
-
-        std::vector<glm::mat4>& GetInverseBindPoseMatrices() noexcept { return m_inverseBindPoseMatrices; }
-        std::vector<std::size_t>& GetBoneParents() noexcept { return m_boneParent; }
+        std::vector<glm::vec3>& GetVertices() { return m_vertices.Modify(); }
+        std::vector<glm::vec3>& GetNormals() { return m_normals.Modify(); }
+        std::vector<MeshArray<glm::vec3>>& GetTexCoords() { return m_texCoords; }
+        std::vector<glm::vec3>& GetTangents() { return m_tangents.Modify(); }
+        std::vector<glm::vec3>& GetBinormals() { return m_binormals.Modify(); }
+        std::vector<MeshArray<glm::vec4>>& GetColors() { return m_colors; }
+        std::vector<MeshArray<glm::uvec4>>& GetIndexVectors() { return m_indexVectors; }
+        std::vector<std::uint32_t>& GetIndices() { return m_indices.Modify(); }
+        std::vector<glm::uvec4>& GetBoneOffsetMatrixIndices() noexcept { return m_boneOffsetMatrixIndices.Modify(); }
+        std::vector<glm::vec4>& GetBoneWeigths() noexcept { return m_boneWeights.Modify(); }
+
+        std::vector<glm::mat4>& GetInverseBindPoseMatrices() noexcept { return m_inverseBindPoseMatrices.Modify(); }
+        std::vector<std::size_t>& GetBoneParents() noexcept { return m_boneParent.Modify(); }
         std::vector<Animation>& GetAnimations() noexcept { return m_animations; }
         /** Returns the AABB for all bones. */
-        std::vector<math::AABB3<float>>& GetBoneBoundingBoxes() noexcept { return m_boneBoundingBoxes; }
+        std::vector<math::AABB3<float>>& GetBoneBoundingBoxes() noexcept { return m_boneBoundingBoxes.Modify(); }
 
         template<vkfw_core::Material MaterialType>
         void ReserveMesh(unsigned int maxUVChannels, unsigned int maxColorChannels, bool hasTangentSpace,
@@ -117,7 +130,7 @@ namespace vkfw_core::gfx {
         void AddSubMesh(const std::string& name, unsigned int idxOffset, unsigned int numIndices, unsigned int materialID);
         // void CreateIndexBuffer();
 
-        void CreateSceneNodes(aiNode* rootNode, const std::map<std::string, unsigned int>& boneMap);
+        void CreateSceneNodes(aiNode* rootNode, const std::unordered_map<std::string, unsigned int>& boneMap);
         /** Flattens all hierarchies. */
         void FlattenHierarchies();
 
@@ -127,6 +140,8 @@ namespace vkfw_core::gfx {
 
         /** Needed for serialization */
         friend class cereal::access;
+        /** Needed for loading and saving memory mapped binary files. */
+        friend class MeshBinaryFile;
 
         template<class Archive> void save(Archive& ar, const std::uint32_t) const // NOLINT
         {
@@ -163,35 +178,38 @@ namespace vkfw_core::gfx {
                cereal::make_nvp("animations", m_animations), cereal::make_nvp("rootNode", m_rootNode),
                cereal::make_nvp("globalInverse", m_globalInverse),
                cereal::make_nvp("boneBoundingBoxes", m_boneBoundingBoxes));
-            m_rootNode->FlattenNodeTree(m_nodes);
+            if (m_rootNode) { m_rootNode->FlattenNodeTree(m_nodes); }
         }
 
+        /** Holds the memory mapped file the mesh data is loaded from (if any). */
+        std::shared_ptr<const MemoryMappedFile> m_mappedFile;
+
         /** Holds all the single points used by the mesh (and its sub-meshes) as points or in vertices. */
-        std::vector<glm::vec3> m_vertices;
+        MeshArray<glm::vec3> m_vertices;
         /** Holds all the single normals used by the mesh (and its sub-meshes). */
-        std::vector<glm::vec3> m_normals;
+        MeshArray<glm::vec3> m_normals;
         /** Holds all the single texture coordinates used by the mesh (and its sub-meshes). */
-        std::vector<std::vector<glm::vec3>> m_texCoords;
+        std::vector<MeshArray<glm::vec3>> m_texCoords;
         /** Holds all the single tangents used by the mesh (and its sub-meshes). */
-        std::vector<glm::vec3> m_tangents;
+        MeshArray<glm::vec3> m_tangents;
         /** Holds all the single bi-normals used by the mesh (and its sub-meshes). */
-        std::vector<glm::vec3> m_binormals;
+        MeshArray<glm::vec3> m_binormals;
         /** Holds all the single colors used by the mesh (and its sub-meshes). */
-        std::vector<std::vector<glm::vec4>> m_colors;
+        std::vector<MeshArray<glm::vec4>> m_colors;
         /** The indices to bones influencing this vertex (corresponds to m_boneWeights). */
-        std::vector<glm::uvec4> m_boneOffsetMatrixIndices;
+        MeshArray<glm::uvec4> m_boneOffsetMatrixIndices;
         /** Weights, how strong a vertex is influenced by the matrix of the bone. */
-        std::vector<glm::vec4> m_boneWeights;
+        MeshArray<glm::vec4> m_boneWeights;
         /** Holds integer vectors to be used as indices (similar to m_boneOffsetMatrixIndices but more general). */
-        std::vector<std::vector<glm::uvec4>> m_indexVectors;
+        std::vector<MeshArray<glm::uvec4>> m_indexVectors;
 
         /** Offset matrices for each bone. */
-        std::vector<glm::mat4> m_inverseBindPoseMatrices;
+        MeshArray<glm::mat4> m_inverseBindPoseMatrices;
         /** Parent of a bone. Stores the parent for each bone in m_boneOffsetMatrices. */
-        std::vector<std::size_t> m_boneParent;
+        MeshArray<std::size_t> m_boneParent;
 
         /** Holds all the indices used by the sub-meshes. */
-        std::vector<std::uint32_t> m_indices;
+        MeshArray<std::uint32_t> m_indices;
 
         /** The meshes materials. */
         std::vector<std::unique_ptr<MaterialInfo>> m_materials;
@@ -207,7 +225,7 @@ namespace vkfw_core::gfx {
         /** The global inverse of this mesh. */
         glm::mat4 m_globalInverse = glm::mat4{1.0f};
         /** AABB for all bones */
-        std::vector<math::AABB3<float>> m_boneBoundingBoxes;
+        MeshArray<math::AABB3<float>> m_boneBoundingBoxes;
     };
 
     template <class VertexType>
@@ -218,6 +236,14 @@ namespace vkfw_core::gfx {
         for (std::size_t i = 0; i < m_vertices.size(); ++i) vertices.emplace_back(this, i);
     }
 
+    template<class VertexType>
+    void MeshInfo::ConstructVertices(void* vertices) const
+    {
+        static_assert(std::is_trivially_destructible_v<VertexType>);
+        auto* vertexMemory = static_cast<VertexType*>(vertices);
+        for (std::size_t i = 0; i < m_vertices.size(); ++i) { new (&vertexMemory[i]) VertexType(this, i); } // NOLINT
+    }
+
     /**
      *  Reserves memory to create the mesh.
      *  @param maxUVChannels the maximum number of texture coordinates in a single sub-mesh vertex.
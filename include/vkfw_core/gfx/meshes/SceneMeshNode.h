@@ -24,7 +24,8 @@ namespace vkfw_core::gfx {
     {
     public:
         SceneMeshNode();
-        SceneMeshNode(aiNode* node, const SceneMeshNode* parent, const std::map<std::string, unsigned int>& boneMap);
+        SceneMeshNode(aiNode* node, const SceneMeshNode* parent,
+                      const std::unordered_map<std::string, unsigned int>& boneMap);
         SceneMeshNode(const SceneMeshNode& rhs);
         SceneMeshNode& operator=(const SceneMeshNode& rhs);
         SceneMeshNode(SceneMeshNode&& rhs) noexcept;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <optional>
 #include <tuple>
 #include <glm/mat4x4.hpp>
 
@@ -25,6 +26,83 @@ namespace vkfw_core::gfx {
     class UniformBufferObject;
     class GraphicsPipeline;
 
+    struct RenderListStatistics
+    {
+        /** The number of draw calls. */
+        std::size_t m_drawCalls = 0;
+        /** The number of pipeline binds issued. */
+        std::size_t m_pipelineBinds = 0;
+        /** The number of pipeline binds skipped because the pipeline was already bound. */
+        std::size_t m_skippedPipelineBinds = 0;
+        /** The number of descriptor set binds issued. */
+        std::size_t m_descriptorSetBinds = 0;
+        /** The number of descriptor set binds skipped because the set was already bound. */
+        std::size_t m_skippedDescriptorSetBinds = 0;
+        /** The number of vertex/index buffer binds issued. */
+        std::size_t m_vertexInputBinds = 0;
+        /** The number of vertex/index buffer binds skipped because the buffers were already bound. */
+        std::size_t m_skippedVertexInputBinds = 0;
+
+        /** Adds the statistics of another command buffer, e.g., when recording on multiple threads. */
+        RenderListStatistics& operator+=(const RenderListStatistics& rhs)
+        {
+            m_drawCalls += rhs.m_drawCalls;
+            m_pipelineBinds += rhs.m_pipelineBinds;
+            m_skippedPipelineBinds += rhs.m_skippedPipelineBinds;
+            m_descriptorSetBinds += rhs.m_descriptorSetBinds;
+            m_skippedDescriptorSetBinds += rhs.m_skippedDescriptorSetBinds;
+            m_vertexInputBinds += rhs.m_vertexInputBinds;
+            m_skippedVertexInputBinds += rhs.m_skippedVertexInputBinds;
+            return *this;
+        }
+    };
+
+    /**
+     *  Tracks the state bound to a command buffer to skip redundant binds. Each thread recording a command buffer has
+     *  its own bind state. With deferred bind barriers, binds do not touch the barrier state of the bound resources
+     *  (which is not thread safe) but remember them for ConsumeBindBarriers, called on the main thread afterwards.
+     */
+    class RenderBindState final
+    {
+    public:
+        explicit RenderBindState(RenderListStatistics* statistics = nullptr, bool deferBindBarriers = false)
+            : m_statistics{statistics}, m_deferBindBarriers{deferBindBarriers}
+        {
+        }
+
+        [[nodiscard]] inline bool SetPipeline(const GraphicsPipeline* pipeline, const PipelineLayout* pipelineLayout);
+        [[nodiscard]] inline bool SetVertexInput(VertexInputResources* vertexInput);
+        [[nodiscard]] inline bool SetDescriptorSet(DescriptorSet* descriptorSet, std::uint32_t set,
+                                                   std::optional<std::uint32_t> dynamicOffset);
+
+        inline void BindVertexInput(CommandBuffer& cmdBuffer, VertexInputResources* vertexInput);
+        inline void BindDescriptorSet(CommandBuffer& cmdBuffer, DescriptorSet* descriptorSet, std::uint32_t set,
+                                      std::optional<std::uint32_t> dynamicOffset);
+        /** Consumes the bind barriers of all resources bound with deferred bind barriers. */
+        inline void ConsumeBindBarriers();
+
+    private:
+        inline bool Count(bool needsBind, std::size_t RenderListStatistics::*issued,
+                          std::size_t RenderListStatistics::*skipped);
+
+        /** Holds the currently bound pipeline. */
+        const GraphicsPipeline* m_pipeline = nullptr;
+        /** Holds the layout of the currently bound pipeline. */
+        const PipelineLayout* m_pipelineLayout = nullptr;
+        /** Holds the currently bound vertex input. */
+        VertexInputResources* m_vertexInput = nullptr;
+        /** Holds the currently bound descriptor sets (and dynamic offsets) per set index. */
+        std::vector<std::pair<DescriptorSet*, std::optional<std::uint32_t>>> m_descriptorSets;
+        /** Holds the statistics to update (can be nullptr). */
+        RenderListStatistics* m_statistics;
+        /** Holds whether bind barriers are consumed later by ConsumeBindBarriers. */
+        bool m_deferBindBarriers;
+        /** Holds the descriptor sets bound with deferred bind barriers. */
+        std::vector<DescriptorSet*> m_deferredDescriptorSets;
+        /** Holds the vertex inputs bound with deferred bind barriers. */
+        std::vector<VertexInputResources*> m_deferredVertexInputs;
+    };
+
     class RenderElement final
     {
     public:
@@ -44,25 +122,19 @@ namespace vkfw_core::gfx {
             const math::AABB3<float>& boundingBox);
 
         inline void AccessBarriers(std::vector<DescriptorSet*>& descriptorSets,
-                                   std::vector<VertexInputResources*>& vertexInputs) const;
-        inline const RenderElement& DrawElement(CommandBuffer& cmdBuffer, const RenderElement* lastElement = nullptr) const;
-
-        friend bool operator<(const RenderElement& l, const RenderElement& r)
+                                   std::vector<VertexInputResources*>& vertexInputs,
+                                   RenderBindState& bindState) const;
+        inline void DrawElement(CommandBuffer& cmdBuffer, RenderBindState& bindState) const;
+
+        [[nodiscard]] bool IsTransparent() const { return m_isTransparent; }
+        [[nodiscard]] const GraphicsPipeline* GetPipeline() const { return m_pipeline; }
+        [[nodiscard]] const VertexInputResources* GetVertexInput() const { return m_vertexInput; }
+        /** Returns the first general descriptor set (usually the material) or nullptr. */
+        [[nodiscard]] const DescriptorSet* GetMaterialDescriptorSet() const
         {
-            if (l.m_isTransparent && !r.m_isTransparent) {
-                return false;
-            }
-            if (r.m_isTransparent && !l.m_isTransparent) {
-                return true;
-            }
-            if (l.m_isTransparent && r.m_isTransparent) {
-                return l.m_cameraDistance < r.m_cameraDistance;
-            }
-
-            if (l.m_pipeline < r.m_pipeline) { return true; }
-            if (l.m_vertexInput < r.m_vertexInput) { return true; }
-            return l.m_cameraDistance > r.m_cameraDistance;
+            return m_generalDescSets.empty() ? nullptr : m_generalDescSets.front().first;
         }
+        [[nodiscard]] float GetCameraDistance() const { return m_cameraDistance; }
 
     private:
         bool m_isTransparent;
@@ -147,51 +219,126 @@ namespace vkfw_core::gfx {
         return *this;
     }
 
+    bool RenderBindState::SetPipeline(const GraphicsPipeline* pipeline, const PipelineLayout* pipelineLayout)
+    {
+        // descriptor sets may be disturbed by a different layout, so they are bound again.
+        if (m_pipelineLayout != pipelineLayout) { m_descriptorSets.clear(); }
+        m_pipelineLayout = pipelineLayout;
+
+        auto needsBind = m_pipeline != pipeline;
+        m_pipeline = pipeline;
+        return Count(needsBind, &RenderListStatistics::m_pipelineBinds, &RenderListStatistics::m_skippedPipelineBinds);
+    }
+
+    bool RenderBindState::SetVertexInput(VertexInputResources* vertexInput)
+    {
+        auto needsBind = m_vertexInput != vertexInput;
+        m_vertexInput = vertexInput;
+        return Count(needsBind, &RenderListStatistics::m_vertexInputBinds,
+                     &RenderListStatistics::m_skippedVertexInputBinds);
+    }
+
+    bool RenderBindState::SetDescriptorSet(DescriptorSet* descriptorSet, std::uint32_t set,
+                                           std::optional<std::uint32_t> dynamicOffset)
+    {
+        if (m_descriptorSets.size() <= set) { m_descriptorSets.resize(static_cast<std::size_t>(set) + 1); }
+        auto binding = std::make_pair(descriptorSet, dynamicOffset);
+        auto needsBind = m_descriptorSets[set] != binding;
+        m_descriptorSets[set] = binding;
+        return Count(needsBind, &RenderListStatistics::m_descriptorSetBinds,
+                     &RenderListStatistics::m_skippedDescriptorSetBinds);
+    }
+
+    void RenderBindState::BindVertexInput(CommandBuffer& cmdBuffer, VertexInputResources* vertexInput)
+    {
+        if (!m_deferBindBarriers) {
+            vertexInput->Bind(cmdBuffer);
+            return;
+        }
+        vertexInput->BindWithoutBarrier(cmdBuffer);
+        m_deferredVertexInputs.push_back(vertexInput);
+    }
+
+    void RenderBindState::BindDescriptorSet(CommandBuffer& cmdBuffer, DescriptorSet* descriptorSet, std::uint32_t set,
+                                            std::optional<std::uint32_t> dynamicOffset)
+    {
+        auto dynamicOffsets = dynamicOffset.has_value() ? vk::ArrayProxy<const std::uint32_t>(*dynamicOffset)
+                                                        : vk::ArrayProxy<const std::uint32_t>{};
+        if (!m_deferBindBarriers) {
+            descriptorSet->Bind(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout, set, dynamicOffsets);
+            return;
+        }
+        descriptorSet->BindWithoutBarrier(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout, set,
+                                          dynamicOffsets);
+        m_deferredDescriptorSets.push_back(descriptorSet);
+    }
+
+    void RenderBindState::ConsumeBindBarriers()
+    {
+        for (auto descriptorSet : m_deferredDescriptorSets) { descriptorSet->ConsumeBindBarrier(); }
+        for (auto vertexInput : m_deferredVertexInputs) { vertexInput->ConsumeBindBarrier(); }
+        m_deferredDescriptorSets.clear();
+        m_deferredVertexInputs.clear();
+    }
+
+    bool RenderBindState::Count(bool needsBind, std::size_t RenderListStatistics::*issued,
+                                std::size_t RenderListStatistics::*skipped)
+    {
+        if (m_statistics != nullptr) { (*m_statistics).*(needsBind ? issued : skipped) += 1; }
+        return needsBind;
+    }
+
     inline void RenderElement::AccessBarriers(std::vector<DescriptorSet*>& descriptorSets,
-                                              std::vector<VertexInputResources*>& vertexInputs) const
+                                              std::vector<VertexInputResources*>& vertexInputs,
+                                              RenderBindState& bindState) const
     {
-        descriptorSets.push_back(std::get<0>(m_cameraMatricesUBO));
-        descriptorSets.push_back(std::get<0>(m_worldMatricesUBO));
-        vertexInputs.emplace_back(m_vertexInput);
+        // only resources that are actually bound get a barrier, matching the binds in DrawElement.
+        (void)bindState.SetPipeline(m_pipeline, m_pipelineLayout);
+        if (bindState.SetVertexInput(m_vertexInput)) { vertexInputs.emplace_back(m_vertexInput); }
+
+        for (const auto& ubo : {m_cameraMatricesUBO, m_worldMatricesUBO}) {
+            if (bindState.SetDescriptorSet(std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo))) {
+                descriptorSets.push_back(std::get<0>(ubo));
+            }
+        }
 
         for (const auto& ubo : m_generalUBOs) {
-            descriptorSets.push_back(std::get<0>(ubo));
+            if (bindState.SetDescriptorSet(std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo))) {
+                descriptorSets.push_back(std::get<0>(ubo));
+            }
         }
 
         for (const auto& ds : m_generalDescSets) {
-            descriptorSets.push_back(ds.first);
+            if (bindState.SetDescriptorSet(ds.first, ds.second, {})) { descriptorSets.push_back(ds.first); }
         }
     }
 
-    const RenderElement& RenderElement::DrawElement(CommandBuffer& cmdBuffer,
-                                                    const RenderElement* lastElement /*= nullptr*/) const
+    void RenderElement::DrawElement(CommandBuffer& cmdBuffer, RenderBindState& bindState) const
     {
-        if (lastElement == nullptr || lastElement->m_pipeline != m_pipeline) {
+        if (bindState.SetPipeline(m_pipeline, m_pipelineLayout)) {
             cmdBuffer.GetHandle().bindPipeline(vk::PipelineBindPoint::eGraphics, m_pipeline->GetHandle());
         }
-        if (lastElement == nullptr || lastElement->m_vertexInput != m_vertexInput) {
-            m_vertexInput->Bind(cmdBuffer);
-        }
-
-        std::get<0>(m_cameraMatricesUBO)
-            ->Bind(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout,
-                   std::get<1>(m_cameraMatricesUBO), std::get<2>(m_cameraMatricesUBO));
+        if (bindState.SetVertexInput(m_vertexInput)) { bindState.BindVertexInput(cmdBuffer, m_vertexInput); }
 
-        std::get<0>(m_worldMatricesUBO)
-            ->Bind(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout,
-                   std::get<1>(m_worldMatricesUBO), std::get<2>(m_worldMatricesUBO));
+        for (const auto& ubo : {m_cameraMatricesUBO, m_worldMatricesUBO}) {
+            if (bindState.SetDescriptorSet(std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo))) {
+                bindState.BindDescriptorSet(cmdBuffer, std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo));
+            }
+        }
 
         for (const auto& ubo : m_generalUBOs) {
-            std::get<0>(ubo)->Bind(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout,
-                                   std::get<1>(ubo), std::get<2>(ubo));
+            if (bindState.SetDescriptorSet(std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo))) {
+                bindState.BindDescriptorSet(cmdBuffer, std::get<0>(ubo), std::get<1>(ubo), std::get<2>(ubo));
+            }
         }
 
         for (const auto& ds : m_generalDescSets) {
-            ds.first->Bind(cmdBuffer, vk::PipelineBindPoint::eGraphics, *m_pipelineLayout, ds.second);
+            if (bindState.SetDescriptorSet(ds.first, ds.second, {})) {
+                bindState.BindDescriptorSet(cmdBuffer, ds.first, ds.second, {});
+            }
         }
 
         cmdBuffer.GetHandle().drawIndexed(m_indexCount, m_instanceCount, m_firstIndex, m_vertexOffset, m_firstInstance);
-        return *this;
     }
 
 }
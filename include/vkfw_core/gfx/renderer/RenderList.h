@@ -9,7 +9,13 @@
 #pragma once
 
 #include "gfx/renderer/RenderElement.h"
+#include "gfx/renderer/RenderSortKey.h"
 #include "gfx/camera/CameraBase.h"
+#include "gfx/vk/ParallelCommandRecorder.h"
+#include "core/radix_sort.h"
+
+#include <span>
+#include <unordered_map>
 
 namespace vkfw_core::gfx {
 
@@ -34,11 +40,33 @@ namespace vkfw_core::gfx {
             std::uint32_t vertexOffset, std::uint32_t firstInstance, const glm::mat4& viewMatrix,
             const math::AABB3<float>& boundingBox);
 
+        /**
+         *  Collects the resources that need a barrier before the render pass.
+         *  @param numChunks the number of chunks the elements are recorded in (recorder threads for parallel Render).
+         */
         inline void AccessBarriers(std::vector<DescriptorSet*>& descriptorSets,
-                                   std::vector<VertexInputResources*>& vertexInputs);
+                                   std::vector<VertexInputResources*>& vertexInputs, std::size_t numChunks = 1);
         inline void Render(CommandBuffer& cmdBuffer);
+        /**
+         *  Splits the sorted elements into one chunk per thread of the recorder and records each chunk into its own
+         *  secondary command buffer that are executed in draw order. AccessBarriers needs to be called with
+         *  recorder.GetNumThreads() chunks and the render pass begun with vk::SubpassContents::eSecondaryCommandBuffers.
+         *  @param cmdBuffer the primary command buffer.
+         *  @param recorder the recorder to record the chunks with.
+         *  @param frameIndex the frame slot of the recorder to use.
+         *  @param inheritance the render pass and framebuffer the secondary command buffers continue.
+         */
+        inline void Render(CommandBuffer& cmdBuffer, ParallelCommandRecorder& recorder, std::size_t frameIndex,
+                           const vk::CommandBufferInheritanceInfo& inheritance);
+
+        /** Returns the statistics of the last call to Render. */
+        [[nodiscard]] const RenderListStatistics& GetStatistics() const { return m_statistics; }
 
     private:
+        inline void SortElements();
+        [[nodiscard]] inline const RenderElement& GetElement(std::uint32_t index) const;
+        [[nodiscard]] inline std::span<const std::uint32_t> GetChunk(std::size_t chunk, std::size_t numChunks) const;
+
         std::vector<RenderElement> m_opaqueElements;
         std::vector<RenderElement> m_transparentElements;
 
@@ -51,6 +79,21 @@ namespace vkfw_core::gfx {
         VertexInputResources* m_currentVertexInput = nullptr;
 
         UBOBinding m_currentWorldMatrices = UBOBinding(nullptr, 0, 0);
+
+        /** Holds whether m_drawOrder is valid for the current elements. */
+        bool m_sorted = false;
+        /** Holds the sort keys (reused between frames). */
+        std::vector<std::uint64_t> m_keys;
+        /** Holds the element indices in draw order, transparent elements start after the opaque ones. */
+        std::vector<std::uint32_t> m_drawOrder;
+        /** Holds scratch memory for sorting the keys. */
+        std::vector<std::uint64_t> m_keysScratch;
+        /** Holds scratch memory for sorting the indices. */
+        std::vector<std::uint32_t> m_drawOrderScratch;
+        /** Holds the statistics of the last rendered frame. */
+        RenderListStatistics m_statistics;
+        /** Holds the statistics of each chunk when recording in parallel. */
+        std::vector<RenderListStatistics> m_chunkStatistics;
     };
 
     RenderList::RenderList(const CameraBase* camera, const UBOBinding& cameraUBO)
@@ -83,6 +126,7 @@ namespace vkfw_core::gfx {
         std::uint32_t firstIndex, std::uint32_t vertexOffset, std::uint32_t firstInstance, const glm::mat4& viewMatrix,
         const math::AABB3<float>& boundingBox)
     {
+        m_sorted = false;
         auto& result = m_opaqueElements.emplace_back(false, *m_currentOpaquePipeline, *m_currentPipelineLayout);
         result.BindVertexInput(m_currentVertexInput);
         result.BindCameraMatricesUBO(m_cameraMatricesUBO);
@@ -93,6 +137,7 @@ namespace vkfw_core::gfx {
 
     vkfw_core::gfx::RenderElement& RenderList::AddTransparentElement(std::uint32_t indexCount, std::uint32_t instanceCount, std::uint32_t firstIndex, std::uint32_t vertexOffset, std::uint32_t firstInstance, const glm::mat4& viewMatrix, const math::AABB3<float>& boundingBox)
     {
+        m_sorted = false;
         auto& result =
             m_transparentElements.emplace_back(true, *m_currentTransparentPipeline, *m_currentPipelineLayout);
         result.BindVertexInput(m_currentVertexInput);
@@ -103,22 +148,97 @@ namespace vkfw_core::gfx {
     }
 
     inline void RenderList::AccessBarriers(std::vector<DescriptorSet*>& descriptorSets,
-                                           std::vector<VertexInputResources*>& vertexInputs)
+                                           std::vector<VertexInputResources*>& vertexInputs, std::size_t numChunks)
     {
-        for (const auto& re : m_opaqueElements) { re.AccessBarriers(descriptorSets, vertexInputs); }
-        for (const auto& re : m_transparentElements) { re.AccessBarriers(descriptorSets, vertexInputs); }
+        // the barriers have to match the binds done in Render, so the same order and bind state (one per chunk).
+        SortElements();
+        for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+            RenderBindState bindState;
+            for (auto index : GetChunk(chunk, numChunks)) {
+                GetElement(index).AccessBarriers(descriptorSets, vertexInputs, bindState);
+            }
+        }
     }
 
     void RenderList::Render(CommandBuffer& cmdBuffer)
     {
-        std::sort(m_opaqueElements.begin(), m_opaqueElements.end());
-        std::sort(m_transparentElements.begin(), m_transparentElements.end());
+        SortElements();
+        m_statistics = RenderListStatistics{};
+        RenderBindState bindState{&m_statistics};
+        for (auto index : m_drawOrder) {
+            GetElement(index).DrawElement(cmdBuffer, bindState);
+            m_statistics.m_drawCalls += 1;
+        }
+    }
 
-        const RenderElement* lastElement = nullptr;
-        for (const auto& re : m_opaqueElements) { lastElement = &re.DrawElement(cmdBuffer, lastElement); }
+    void RenderList::Render(CommandBuffer& cmdBuffer, ParallelCommandRecorder& recorder, std::size_t frameIndex,
+                            const vk::CommandBufferInheritanceInfo& inheritance)
+    {
+        SortElements();
+        const auto numChunks = recorder.GetNumThreads();
+        m_chunkStatistics.assign(numChunks, RenderListStatistics{});
+        std::vector<RenderBindState> bindStates;
+        bindStates.reserve(numChunks);
+        for (auto& chunkStatistics : m_chunkStatistics) { bindStates.emplace_back(&chunkStatistics, true); }
+
+        recorder.Record(frameIndex, cmdBuffer, inheritance,
+                        [this, numChunks, &bindStates](CommandBuffer& chunkCmdBuffer, std::size_t chunk) {
+                            for (auto index : GetChunk(chunk, numChunks)) {
+                                GetElement(index).DrawElement(chunkCmdBuffer, bindStates[chunk]);
+                                m_chunkStatistics[chunk].m_drawCalls += 1;
+                            }
+                        });
+
+        m_statistics = RenderListStatistics{};
+        for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+            bindStates[chunk].ConsumeBindBarriers();
+            m_statistics += m_chunkStatistics[chunk];
+        }
+    }
 
-        lastElement = nullptr;
-        for (const auto& re : m_transparentElements) { lastElement = &re.DrawElement(cmdBuffer, lastElement); }
+    /**
+     *  Sorts the elements by their RenderSortKey. The state ids are assigned in order of first appearance.
+     */
+    void RenderList::SortElements()
+    {
+        if (m_sorted) { return; }
+
+        std::unordered_map<const void*, std::uint64_t> pipelineIds;
+        std::unordered_map<const void*, std::uint64_t> vertexInputIds;
+        std::unordered_map<const void*, std::uint64_t> materialIds;
+        auto getId = [](std::unordered_map<const void*, std::uint64_t>& ids, const void* object) {
+            return ids.try_emplace(object, ids.size()).first->second;
+        };
+
+        const auto elementCount = m_opaqueElements.size() + m_transparentElements.size();
+        m_keys.resize(elementCount);
+        m_drawOrder.resize(elementCount);
+        for (std::size_t i = 0; i < elementCount; ++i) {
+            const auto& element = GetElement(static_cast<std::uint32_t>(i));
+            const auto stateKey = RenderSortKey::MakeStateKey(getId(pipelineIds, element.GetPipeline()),
+                                                              getId(vertexInputIds, element.GetVertexInput()),
+                                                              getId(materialIds, element.GetMaterialDescriptorSet()));
+            m_keys[i] = element.IsTransparent()
+                            ? RenderSortKey::MakeTransparentKey(stateKey, element.GetCameraDistance())
+                            : RenderSortKey::MakeOpaqueKey(stateKey, element.GetCameraDistance());
+            m_drawOrder[i] = static_cast<std::uint32_t>(i);
+        }
+
+        RadixSort(m_keys, m_drawOrder, m_keysScratch, m_drawOrderScratch);
+        m_sorted = true;
+    }
+
+    const RenderElement& RenderList::GetElement(std::uint32_t index) const
+    {
+        if (index < m_opaqueElements.size()) { return m_opaqueElements[index]; }
+        return m_transparentElements[index - m_opaqueElements.size()];
+    }
+
+    std::span<const std::uint32_t> RenderList::GetChunk(std::size_t chunk, std::size_t numChunks) const
+    {
+        const auto begin = m_drawOrder.size() * chunk / numChunks;
+        const auto end = m_drawOrder.size() * (chunk + 1) / numChunks;
+        return std::span{m_drawOrder}.subspan(begin, end - begin);
     }
 
 }
@@ -0,0 +1,66 @@
+/**
+ * @file   RenderSortKey.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Packing of render element state and depth into 64 bit sort keys.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace vkfw_core::gfx {
+
+    /**
+     *  Key layout (most significant first), opaque elements:
+     *  layer (1 bit) | pipeline (10 bits) | vertex input (12 bits) | material (16 bits) | inverted depth (25 bits)
+     *  Transparent elements are sorted back to front first:
+     *  layer (1 bit) | depth (25 bits) | pipeline (10 bits) | vertex input (12 bits) | material (16 bits)
+     *  The depth is the view space z coordinate of an element (larger values are closer to the camera), so ascending
+     *  keys draw opaque elements front to back and transparent elements back to front.
+     *  State ids exceeding their bit range are wrapped around which only costs some redundant binds.
+     */
+    struct RenderSortKey
+    {
+        static constexpr std::uint64_t PIPELINE_BITS = 10;
+        static constexpr std::uint64_t VERTEX_INPUT_BITS = 12;
+        static constexpr std::uint64_t MATERIAL_BITS = 16;
+        static constexpr std::uint64_t DEPTH_BITS = 25;
+        static constexpr std::uint64_t STATE_BITS = PIPELINE_BITS + VERTEX_INPUT_BITS + MATERIAL_BITS;
+
+        /** Packs the state ids, each id is wrapped around to its bit range. */
+        [[nodiscard]] static constexpr std::uint64_t MakeStateKey(std::uint64_t pipelineId, std::uint64_t vertexInputId,
+                                                                  std::uint64_t materialId)
+        {
+            auto stateKey = Wrap(pipelineId, PIPELINE_BITS);
+            stateKey = (stateKey << VERTEX_INPUT_BITS) | Wrap(vertexInputId, VERTEX_INPUT_BITS);
+            return (stateKey << MATERIAL_BITS) | Wrap(materialId, MATERIAL_BITS);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t MakeOpaqueKey(std::uint64_t stateKey, float cameraDistance)
+        {
+            return (stateKey << DEPTH_BITS) | Wrap(~QuantizeDepth(cameraDistance), DEPTH_BITS);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t MakeTransparentKey(std::uint64_t stateKey, float cameraDistance)
+        {
+            return (std::uint64_t{1} << 63) | (QuantizeDepth(cameraDistance) << STATE_BITS) | stateKey;
+        }
+
+        /** Maps the distance to an unsigned integer with the same order and keeps the 25 most significant bits. */
+        [[nodiscard]] static constexpr std::uint64_t QuantizeDepth(float cameraDistance)
+        {
+            auto bits = std::bit_cast<std::uint32_t>(cameraDistance);
+            bits = (bits & 0x80000000u) != 0 ? ~bits : (bits | 0x80000000u);
+            return static_cast<std::uint64_t>(bits >> (32 - DEPTH_BITS));
+        }
+
+    private:
+        [[nodiscard]] static constexpr std::uint64_t Wrap(std::uint64_t value, std::uint64_t bits)
+        {
+            return value & ((std::uint64_t{1} << bits) - 1);
+        }
+    };
+}
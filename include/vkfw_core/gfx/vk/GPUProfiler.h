@@ -0,0 +1,166 @@
+/**
+ * @file   GPUProfiler.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a profiler for GPU timestamps and pipeline statistics.
+ */
+
+#pragma once
+
+#include "main.h"
+#include "core/profiler_statistics.h"
+#include "gfx/vk/wrappers/QueryPool.h"
+
+#include <filesystem>
+#include <glm/vec4.hpp>
+
+namespace vkfw_core::gfx {
+
+    class LogicalDevice;
+    class CommandBuffer;
+
+    /**
+     *  Measures named, nested regions of command buffers with timestamp queries and, for top-level regions,
+     *  pipeline statistics queries. Each frame in flight has its own range of queries, so results are read without
+     *  stalling when the frame slot is reused, i.e., after its fence was waited for.
+     *
+     *  Usage: call BeginRecording(slot) before recording the command buffers of a slot, put regions in them with
+     *  GPU_PROFILER_REGION and call Resolve(slot) every frame after the fence of the slot was waited for and before it
+     *  is submitted again. Command buffers that are recorded once and resubmitted only need BeginRecording once.
+     */
+    class GPUProfiler final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param device the device to create the query pools on.
+         *  @param name the name of the profiler.
+         *  @param framesInFlight the number of frame slots.
+         *  @param queueFamily the queue family the command buffers are submitted to.
+         *  @param maxRegionsPerFrame the maximum number of regions per frame slot.
+         *  @param pipelineStatistics whether pipeline statistics are queried for top-level regions (if supported).
+         */
+        GPUProfiler(const LogicalDevice* device, std::string_view name, std::size_t framesInFlight,
+                    unsigned int queueFamily, std::uint32_t maxRegionsPerFrame = 256, bool pipelineStatistics = false);
+        GPUProfiler(const GPUProfiler&) = delete;
+        GPUProfiler& operator=(const GPUProfiler&) = delete;
+        GPUProfiler(GPUProfiler&&) noexcept = default;
+        GPUProfiler& operator=(GPUProfiler&&) noexcept = default;
+        ~GPUProfiler();
+
+        /** Starts recording regions for a frame slot, discarding its previous regions and unresolved results. */
+        void BeginRecording(std::size_t frameIndex);
+        /**
+         *  Begins a region in a command buffer of the slot currently recorded. Regions nest like debug labels.
+         *  @param cmdBuffer the command buffer to record to.
+         *  @param regionName the name of the region.
+         *  @param stage the pipeline stage the begin timestamp is written at.
+         *  @param color the color of the debug label.
+         */
+        void BeginRegion(const CommandBuffer& cmdBuffer, std::string_view regionName,
+                         vk::PipelineStageFlags2KHR stage = vk::PipelineStageFlagBits2KHR::eAllCommands,
+                         const glm::vec4& color = glm::vec4{1.0f});
+        /**
+         *  Ends the innermost open region.
+         *  @param cmdBuffer the command buffer to record to (same as the one the region began in).
+         *  @param stage the pipeline stage the end timestamp is written at.
+         */
+        void EndRegion(const CommandBuffer& cmdBuffer,
+                       vk::PipelineStageFlags2KHR stage = vk::PipelineStageFlagBits2KHR::eAllCommands);
+
+        /**
+         *  Reads the results of a frame slot if they are available and adds them to the statistics.
+         *  Never waits for the GPU.
+         *  @param frameIndex the frame slot whose fence was waited for.
+         *  @return whether results were read.
+         */
+        bool Resolve(std::size_t frameIndex);
+
+        /** Returns whether timestamps are measured (the queue family supports timestamps). */
+        [[nodiscard]] bool HasTimestamps() const { return m_timestampValidBits != 0; }
+        /** Returns whether pipeline statistics are measured. */
+        [[nodiscard]] bool HasPipelineStatistics() const { return static_cast<bool>(m_statisticsPool); }
+        [[nodiscard]] const ProfilerStatistics& GetStatistics() const { return m_statistics; }
+        /** Removes all aggregated results. */
+        void ClearStatistics() { m_statistics.Clear(); }
+
+        /** Draws a table of min/avg/max times per region into the current ImGui window. */
+        void DrawGUI() const;
+        /** Writes the aggregated results to a CSV file. */
+        void WriteCSV(const std::filesystem::path& filename) const;
+
+    private:
+        /** A region recorded into a frame slot. */
+        struct Region
+        {
+            /** Holds the name of the region including its parents. */
+            std::string m_name;
+            /** Holds the nesting depth. */
+            std::uint32_t m_depth = 0;
+            /** Holds the index of the pipeline statistics query in the slot or -1 if there is none. */
+            std::uint32_t m_statisticsQuery = static_cast<std::uint32_t>(-1);
+        };
+
+        /** The regions and query state of a frame slot. */
+        struct FrameSlot
+        {
+            /** Holds the regions in the order they began. */
+            std::vector<Region> m_regions;
+            /** Holds the number of pipeline statistics queries used. */
+            std::uint32_t m_numStatisticsQueries = 0;
+        };
+
+        [[nodiscard]] std::uint32_t GetFirstTimestampQuery(std::size_t frameIndex) const;
+        [[nodiscard]] std::uint32_t GetFirstStatisticsQuery(std::size_t frameIndex) const;
+        void ResetQueries(std::size_t frameIndex);
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the name of the profiler. */
+        std::string m_name;
+        /** Holds the maximum number of regions per frame slot. */
+        std::uint32_t m_maxRegionsPerFrame;
+        /** Holds the number of valid bits of timestamps on the queue family (0 if not supported). */
+        std::uint32_t m_timestampValidBits = 0;
+        /** Holds the number of nanoseconds per timestamp tick. */
+        double m_timestampPeriod = 1.0;
+        /** Holds the timestamp query pool (two queries per region and frame slot). */
+        QueryPool m_timestampPool;
+        /** Holds the pipeline statistics query pool (one query per region and frame slot). */
+        QueryPool m_statisticsPool;
+        /** Holds the frame slots. */
+        std::vector<FrameSlot> m_frameSlots;
+        /** Holds the slot currently recorded. */
+        std::size_t m_recordingSlot = 0;
+        /** Holds the indices of the open regions. */
+        std::vector<std::size_t> m_openRegions;
+        /** Holds the buffer query results are read to. */
+        std::vector<std::uint64_t> m_queryResults;
+        /** Holds the aggregated results. */
+        ProfilerStatistics m_statistics;
+    };
+
+    class GPUProfilerRegion
+    {
+    public:
+        GPUProfilerRegion(GPUProfiler& profiler, const CommandBuffer& cmdBuffer, std::string_view regionName,
+                          vk::PipelineStageFlags2KHR stage = vk::PipelineStageFlagBits2KHR::eAllCommands,
+                          const glm::vec4& color = glm::vec4{1.0f})
+            : m_profiler{profiler}, m_cmdBuffer{cmdBuffer}
+        {
+            m_profiler.BeginRegion(m_cmdBuffer, regionName, stage, color);
+        }
+        GPUProfilerRegion(const GPUProfilerRegion&) = delete;
+        GPUProfilerRegion& operator=(const GPUProfilerRegion&) = delete;
+
+        ~GPUProfilerRegion() { m_profiler.EndRegion(m_cmdBuffer); }
+
+    private:
+        GPUProfiler& m_profiler;
+        const CommandBuffer& m_cmdBuffer;
+    };
+}
+
+#define GPU_PROFILER_REGION(profiler, cmdBuffer, ...) \
+const vkfw_core::gfx::GPUProfilerRegion UNIQUENAME(gpu_profiler_region_) { profiler, cmdBuffer, __VA_ARGS__ }
@@ -22,8 +22,10 @@ namespace vkfw_core::gfx {
 }
 
 namespace vkfw_core {
+    class HotReloader;
+    class JobPool;
     class ShaderManager;
-    using TextureManager = ResourceManager<gfx::Texture2D>;
+    class TextureManager;
 }
 
 namespace vkfw_core::cfg {
@@ -36,6 +38,9 @@ namespace vkfw_core::gfx {
     class Buffer;      // NOLINT
     class Texture;
     class MemoryGroup;
+    class DeviceMemoryAllocator;
+    class StagingRingBuffer;
+    class PipelineCache;
 
     struct DeviceQueueDesc
     {
@@ -67,6 +72,8 @@ namespace vkfw_core::gfx {
         {
             return m_queuesByRequestedFamily[familyIndex][queueIndex];
         }
+        /** Returns the timeline point of the last submit to each queue. */
+        [[nodiscard]] std::vector<TimelinePoint> GetLastSubmits() const;
         [[nodiscard]] const DeviceQueueDesc& GetQueueInfo(unsigned int familyIndex) const
         {
             return m_queueDescriptions[familyIndex];
@@ -91,10 +98,20 @@ namespace vkfw_core::gfx {
         [[nodiscard]] const vk::PhysicalDeviceFeatures& GetDeviceFeatures() const { return m_deviceFeatures; }
         [[nodiscard]] const vk::PhysicalDeviceRayTracingPipelineFeaturesKHR& GetDeviceRayTracingPipelineFeatures() const { assert(m_windowCfg.m_useRayTracing); return m_raytracingPipelineFeatures; }
         [[nodiscard]] const vk::PhysicalDeviceAccelerationStructureFeaturesKHR& GetDeviceAccelerationStructureFeatures() const { assert(m_windowCfg.m_useRayTracing); return m_accelerationStructureFeatures; }
+        /** Returns the job pool shared by all resource managers of this device for asynchronous loads. */
+        [[nodiscard]] JobPool& GetResourceJobPool() const { return *m_resourceJobPool; }
         [[nodiscard]] ShaderManager* GetShaderManager() const { return m_shaderManager.get(); }
         [[nodiscard]] TextureManager* GetTextureManager() const { return m_textureManager.get(); }
+        /** Enables reloading changed resources and rebuilding the pipelines created afterwards that use them. */
+        void EnableHotReload();
+        /** Returns the hot reloader (nullptr if hot reloading is not enabled). */
+        [[nodiscard]] HotReloader* GetHotReloader() const { return m_hotReloader.get(); }
         [[nodiscard]] Texture2D* GetDummyTexture() const { return m_dummyTexture.get(); }
         [[nodiscard]] ResourceReleaser& GetResourceReleaser() const { return *m_resourceReleaser; }
+        /** Returns the pooled memory allocator (nullptr if memory pools are disabled in the configuration). */
+        [[nodiscard]] DeviceMemoryAllocator* GetMemoryAllocator() const { return m_memoryAllocator.get(); }
+        [[nodiscard]] StagingRingBuffer& GetStagingRingBuffer() const { return *m_stagingRingBuffer; }
+        [[nodiscard]] const PipelineCache& GetPipelineCache() const { return *m_pipelineCache; }
 
         [[nodiscard]] std::size_t CalculateUniformBufferAlignment(std::size_t size) const;
         [[nodiscard]] std::size_t CalculateStorageBufferAlignment(std::size_t size) const;
@@ -141,10 +158,21 @@ namespace vkfw_core::gfx {
         /** Holds a command pool for each requested queue family. */
         std::vector<CommandPool*> m_cmdPoolsByRequestedQFamily;
 
+        /** Holds the pipeline cache used for all pipelines created on this device. */
+        std::unique_ptr<PipelineCache> m_pipelineCache;
+        /** Holds the memory allocator (needs to outlive all objects allocating memory). */
+        std::unique_ptr<DeviceMemoryAllocator> m_memoryAllocator;
+        /** Holds the ring buffer used for staging uploads. */
+        std::unique_ptr<StagingRingBuffer> m_stagingRingBuffer;
+
+        /** Holds the job pool for loading resources (needs to outlive the resource managers). */
+        std::unique_ptr<JobPool> m_resourceJobPool;
         /** Holds the shader manager. */
         std::unique_ptr<ShaderManager> m_shaderManager;
         /** Holds the texture manager. */
         std::unique_ptr<TextureManager> m_textureManager;
+        /** Holds the hot reloader. */
+        std::unique_ptr<HotReloader> m_hotReloader;
 
         /** The memory group holding all dummy objects. */
         std::unique_ptr<MemoryGroup> m_dummyMemGroup;
@@ -155,5 +183,7 @@ namespace vkfw_core::gfx {
         std::unique_ptr<ResourceReleaser> m_resourceReleaser;
 
         bool m_singleQueueOnly = false;
+        /** Holds whether VK_EXT_pipeline_creation_feedback is enabled. */
+        bool m_pipelineCreationFeedback = false;
     };
 }
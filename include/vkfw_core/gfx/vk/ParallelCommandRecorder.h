@@ -0,0 +1,78 @@
+/**
+ * @file   ParallelCommandRecorder.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Declaration of a recorder for secondary command buffers on multiple threads.
+ */
+
+#pragma once
+
+#include "main.h"
+#include "core/worker_group.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+#include "gfx/vk/wrappers/CommandPool.h"
+
+namespace vkfw_core::gfx {
+
+    class LogicalDevice;
+
+    /**
+     *  Records secondary command buffers on a group of threads and executes them in a primary command buffer in
+     *  the order of the threads. Each thread has its own command pool per frame in flight, so no pool is shared
+     *  between threads and a pool is only reset once the GPU finished the frame slot it belongs to.
+     */
+    class ParallelCommandRecorder final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param device the device to create the command pools on.
+         *  @param name the name of the recorder.
+         *  @param queueFamily the queue family the primary command buffers are submitted to.
+         *  @param numThreads the number of recording threads (including the calling thread).
+         *  @param framesInFlight the number of frame slots.
+         */
+        ParallelCommandRecorder(const LogicalDevice* device, std::string_view name, unsigned int queueFamily,
+                                std::size_t numThreads, std::size_t framesInFlight);
+        ParallelCommandRecorder(const ParallelCommandRecorder&) = delete;
+        ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+        ParallelCommandRecorder(ParallelCommandRecorder&&) = delete;
+        ParallelCommandRecorder& operator=(ParallelCommandRecorder&&) = delete;
+        ~ParallelCommandRecorder();
+
+        /**
+         *  Records one secondary command buffer per thread and executes them in the primary command buffer.
+         *  If the inheritance info contains a render pass, the secondary command buffers continue it and the
+         *  primary command buffer has to be in a render pass begun with vk::SubpassContents::eSecondaryCommandBuffers.
+         *  @param frameIndex the frame slot whose previous submission the GPU has finished.
+         *  @param primaryCmdBuffer the primary command buffer.
+         *  @param inheritance the state inherited by the secondary command buffers.
+         *  @param recordFunc records the commands of a thread, gets the secondary command buffer and thread index.
+         */
+        void Record(std::size_t frameIndex, CommandBuffer& primaryCmdBuffer,
+                    const vk::CommandBufferInheritanceInfo& inheritance,
+                    function_view<void(CommandBuffer& cmdBuffer, std::size_t threadIndex)> recordFunc);
+
+        [[nodiscard]] std::size_t GetNumThreads() const { return m_workers.GetNumThreads(); }
+
+    private:
+        /** The command pool and secondary command buffer of a thread in a frame slot. */
+        struct ThreadResources
+        {
+            /** Holds the command pool (reset every time the frame slot is recorded). */
+            CommandPool m_commandPool;
+            /** Holds the secondary command buffer. */
+            CommandBuffer m_commandBuffer;
+        };
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the resources of all threads for each frame slot. */
+        std::vector<std::vector<ThreadResources>> m_frameResources;
+        /** Holds the handles of the secondary command buffers executed by the primary one. */
+        std::vector<vk::CommandBuffer> m_secondaryHandles;
+        /** Holds the recording threads. */
+        WorkerGroup m_workers;
+    };
+}
@@ -24,6 +24,7 @@ namespace vkfw_core::gfx {
     class HostTexture;
     class Texture;
     struct TextureDescriptor;
+    class PipelineBarrier;
     class Queue;
 
     class QueuedDeviceTransfer final
@@ -58,11 +59,34 @@ namespace vkfw_core::gfx {
                                     const glm::u32vec4& size, std::uint32_t mipLevels, const void* data);
 
         void TransferDataToBuffer(std::size_t dataSize, const void* data, Buffer& dst, std::size_t dstOffset);
+        /**
+         *  Copies tightly packed texels to a MIP level and array layer of a texture (size.x is in bytes per line).
+         *  Lines of block compressed formats are rows of blocks.
+         */
+        void TransferDataToTexture(const glm::u32vec3& dataSize, const void* data, Texture& dst, std::uint32_t mipLevel,
+                                   std::uint32_t arrayLayer);
 
         void AddTransferToQueue(Buffer& src, std::size_t srcOffset, Buffer& dst, std::size_t dstOffset, std::size_t copySize);
         void AddTransferToQueue(Buffer& src, Buffer& dst);
         void AddTransferToQueue(Texture& src, Texture& dst);
-
+        /** Fills the MIP levels of a texture from level 0 after all transfers queued before, needs a graphics queue. */
+        void GenerateMipmaps(Texture& texture);
+        /** Checks if MIP levels can be generated with a queue, the blits need graphics support. */
+        [[nodiscard]] static bool CanGenerateMipmaps(const LogicalDevice* device, const Queue& queue);
+
+        /** Records a barrier after all transfers queued before, e.g., to prepare the destinations for their use. */
+        void RecordBarrier(PipelineBarrier& barrier);
+
+        /** Submits all transfers queued since the last flush with a single submit. */
+        void Flush();
+        /**
+         *  Flushes without waiting and hands the command buffers and staging buffers of all submitted transfers to
+         *  the resource releaser of the device.
+         *  @return the timeline point reached when all transfers are finished.
+         */
+        TimelinePoint FlushAndRelease();
+        /** Checks without blocking if all flushed transfers are finished. */
+        [[nodiscard]] bool IsFinished();
         void FinishTransfer();
 
         template<class T> std::enable_if_t<vkfw_core::has_contiguous_memory<T>::value, std::unique_ptr<DeviceBuffer>> CreateDeviceBufferWithData(
@@ -75,20 +99,35 @@ namespace vkfw_core::gfx {
         template<class T> std::enable_if_t<vkfw_core::has_contiguous_memory<T>::value> TransferDataToBuffer(const T& data, const Buffer& dst, std::size_t dstOffset);
 
     private:
-        void AddStagingBuffer(std::string_view name, std::size_t dataSize, const void* data);
-        void AddStagingTexture(std::string_view name, const glm::u32vec4& size, std::uint32_t mipLevels,
-            const TextureDescriptor& textureDesc, const void* data);
+        struct TransferBatch
+        {
+            /** The timeline point reached when the batch is finished. */
+            TimelinePoint m_finishPoint;
+            /** The command buffer the batch was recorded to. */
+            CommandBuffer m_cmdBuffer;
+            /** Staging buffers for data that did not fit into the staging ring. */
+            std::vector<HostBuffer> m_stagingBuffers;
+        };
+
+        [[nodiscard]] CommandBuffer& GetTransferCmdBuffer();
+        [[nodiscard]] std::pair<vk::Buffer, std::size_t> StageData(std::string_view name, std::size_t dataSize,
+                                                                   const void* data, std::size_t alignment);
+        void RetireFinishedBatches();
 
         /** Holds the device. */
         const LogicalDevice* m_device;
         /** Holds the transfer queue used. */
         Queue m_transferQueue;
-        /** Holds all staging buffers. */
+        /** Holds the command buffer currently recorded to. */
+        CommandBuffer m_transferCmdBuffer;
+        /** Holds whether transfers were recorded since the last flush. */
+        bool m_recording = false;
+        /** Holds the staging ring regions used since the last flush. */
+        std::vector<std::uint64_t> m_stagingRegions;
+        /** Holds the staging buffers used since the last flush. */
         std::vector<HostBuffer> m_stagingBuffers;
-        /** Holds all staging textures. */
-        std::vector<HostTexture> m_stagingTextures;
-        /** Holds all command buffers for transfer. */
-        std::vector<std::pair<std::shared_ptr<const Fence>, CommandBuffer>> m_transferCmdBuffers;
+        /** Holds all flushed batches not known to be finished. */
+        std::vector<TransferBatch> m_submittedBatches;
     };
 
     template <class T> std::enable_if_t<vkfw_core::has_contiguous_memory<T>::value, std::unique_ptr<DeviceBuffer>> QueuedDeviceTransfer::CreateDeviceBufferWithData(
@@ -0,0 +1,59 @@
+/**
+ * @file   RuntimeShaderCompiler.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Compiles GLSL shaders to SPIR-V while the application runs.
+ */
+
+#pragma once
+
+#include "main.h"
+
+#include <filesystem>
+
+namespace vkfw_core {
+    class ShaderCache;
+}
+
+namespace vkfw_core::gfx {
+
+    /**
+     *  Compiles GLSL shaders to SPIR-V without a build step, e.g., for shader variants with defines. Sources are
+     *  preprocessed like the build does with vkfw_glsl_preprocessor and compiled with shaderc if the framework was
+     *  built with it. Compiled code is looked up in and added to a shader cache whose keys contain the compiler and
+     *  its version, so code compiled by another compiler is never used. Compiling is thread-safe.
+     */
+    class RuntimeShaderCompiler final
+    {
+    public:
+        /**
+         *  Constructor.
+         *  @param includeDirectories the directories to search for include files.
+         *  @param cache the cache for compiled code or nullptr to always compile.
+         */
+        RuntimeShaderCompiler(std::vector<std::filesystem::path> includeDirectories, ShaderCache* cache);
+
+        /** Checks if shaders can be compiled, otherwise only cached shaders are found. */
+        [[nodiscard]] static bool IsAvailable();
+        /** Returns the name and version of the compiler ("none" if shaders cannot be compiled). */
+        [[nodiscard]] static std::string GetCompilerIdentity();
+
+        /**
+         *  Compiles a shader, throws if it is not cached and cannot be compiled.
+         *  @param sourceFilename the GLSL source file.
+         *  @param stage the stage of the shader.
+         *  @param defines the defines added after the version directive (e.g., "NAME VALUE").
+         *  @return the SPIR-V code.
+         */
+        [[nodiscard]] std::vector<std::uint32_t> Compile(const std::string& sourceFilename,
+                                                         vk::ShaderStageFlagBits stage,
+                                                         const std::vector<std::string>& defines) const;
+
+    private:
+        /** Holds the directories to search for include files. */
+        std::vector<std::filesystem::path> m_includeDirectories;
+        /** Holds the cache for compiled code. */
+        ShaderCache* m_cache;
+    };
+}
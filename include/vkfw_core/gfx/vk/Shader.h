@@ -10,6 +10,8 @@
 
 #include "main.h"
 #include "gfx/vk/wrappers/VulkanObjectWrapper.h"
+#include "gfx/vk/pipeline/ShaderReflection.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
 
 namespace vkfw_core::gfx {
 
@@ -18,6 +20,15 @@ namespace vkfw_core::gfx {
     public:
         Shader(const std::string& shaderFilename, const LogicalDevice* device);
         Shader(const std::string& resourceId, const LogicalDevice* device, std::string shaderFilename);
+        /**
+         *  Constructor for shader variants, which are compiled at runtime.
+         *  @param resourceId the resource id, needs to differ for each variant of a shader.
+         *  @param device the device to create the shader module on.
+         *  @param shaderFilename the GLSL source of the shader.
+         *  @param defines the defines of the variant (e.g., "NAME VALUE").
+         */
+        Shader(const std::string& resourceId, const LogicalDevice* device, std::string shaderFilename,
+               std::vector<std::string> defines);
         Shader(const Shader&);
         Shader& operator=(const Shader&);
         Shader(Shader&&) noexcept;
@@ -26,14 +37,71 @@ namespace vkfw_core::gfx {
 
         void FillShaderStageInfo(vk::PipelineShaderStageCreateInfo& shaderStageCreateInfo) const;
 
+        /**
+         *  Sets the default value of a specialization constant for all pipelines using the shader, pipelines can
+         *  override it per stage. Pipelines created before only use it after a rebuild.
+         */
+        template<SpecializationConstantType T> void SetSpecializationConstant(std::uint32_t constantId, T value)
+        {
+            m_specializationConstants.Set(constantId, value);
+        }
+        /** Sets the default value of a specialization constant by its name, throws if the code has no such constant. */
+        template<SpecializationConstantType T> void SetSpecializationConstant(std::string_view name, T value)
+        {
+            m_specializationConstants.Set(m_reflection, name, value);
+        }
+        /** Returns the default values of the specialization constants. */
+        [[nodiscard]] const SpecializationConstants& GetSpecializationConstants() const
+        {
+            return m_specializationConstants;
+        }
+        /** Returns the size of the SPIR-V code as host memory, the driver keeps a copy for pipeline creation. */
+        [[nodiscard]] ResourceFootprint GetFootprint() const { return ResourceFootprint{m_codeSize, 0}; }
+
+        /** Replaces the shader module with new SPIR-V code, throws and keeps the old module on failure. */
+        void Reload(const std::vector<std::uint32_t>& code);
+        /** Returns the number of reloads, pipelines compare it to find out if they need to be rebuilt. */
+        [[nodiscard]] std::uint64_t GetGeneration() const { return m_generation; }
+        /** Returns the path of the GLSL source. */
+        [[nodiscard]] const std::string& GetSourceFilename() const { return m_sourceFilename; }
+        /** Returns the path of the compiled SPIR-V code. */
+        [[nodiscard]] std::string GetSpirvFilename() const { return m_sourceFilename + ".spv"; }
+        /** Returns the defines of a shader variant (empty for shaders compiled by the build). */
+        [[nodiscard]] const std::vector<std::string>& GetDefines() const { return m_defines; }
+        /** Returns the reflection of the current SPIR-V code. */
+        [[nodiscard]] const ShaderReflection& GetReflection() const { return m_reflection; }
+        /** Compiles the source with the runtime shader compiler, throws on failure. */
+        [[nodiscard]] std::vector<std::uint32_t> CompileSource() const;
+
+        /** Returns the shader stage of a file by its extension. */
+        [[nodiscard]] static vk::ShaderStageFlagBits GetShaderStage(const std::string& shaderFilename);
+
+        /** Reads a SPIR-V file, throws if it cannot be read or is no SPIR-V code. */
+        [[nodiscard]] static std::vector<std::uint32_t> LoadSpirvFile(const std::string& filename);
+
     private:
         void LoadCompiledShaderFromFile();
+        /** Reflects the SPIR-V code, warns and returns an empty reflection if the code cannot be reflected. */
+        [[nodiscard]] ShaderReflection Reflect(const std::vector<std::uint32_t>& code) const;
+        [[nodiscard]] vk::UniqueShaderModule CreateShaderModule(const std::vector<std::uint32_t>& code) const;
 
         /** Holds the shader filename. */
         std::string m_shaderFilename;
+        /** Holds the path of the GLSL source. */
+        std::string m_sourceFilename;
+        /** Holds the defines of a shader variant. */
+        std::vector<std::string> m_defines;
         /** Holds the shaders type. */
-        vk::ShaderStageFlagBits m_type;
+        vk::ShaderStageFlagBits m_type = vk::ShaderStageFlagBits::eVertex;
         /** Holds the shaders type as a string. */
         std::string m_strType;
+        /** Holds the size of the SPIR-V code in bytes. */
+        std::size_t m_codeSize = 0;
+        /** Holds the reflection of the SPIR-V code. */
+        ShaderReflection m_reflection;
+        /** Holds the default values of the specialization constants. */
+        SpecializationConstants m_specializationConstants;
+        /** Holds the number of reloads. */
+        std::uint64_t m_generation = 0;
     };
 }
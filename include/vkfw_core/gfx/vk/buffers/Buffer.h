@@ -66,13 +66,16 @@ namespace vkfw_core::gfx {
             std::size_t srcOffset, Buffer& dstBuffer, std::size_t dstOffset, std::size_t size, const Queue& queue,
             std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
             std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
-            std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence = {});
+            std::optional<std::reference_wrapper<TimelinePoint>> submitPoint = {});
         [[nodiscard]] CommandBuffer CopyBufferAsync(
             Buffer& dstBuffer, const Queue& queue,
             std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
             std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
-            std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence = {});
+            std::optional<std::reference_wrapper<TimelinePoint>> submitPoint = {});
         void CopyBufferSync(Buffer& dstBuffer, const Queue& copyQueue);
+        /** Copies from a host written staging buffer whose writes are made available by the submission itself. */
+        void CopyFromStagingAsync(vk::Buffer stagingBuffer, std::size_t stagingOffset, std::size_t dstOffset,
+                                  std::size_t size, CommandBuffer& cmdBuffer);
 
         void AccessBarrier(bool isDynamic, vk::AccessFlags2KHR access, vk::PipelineStageFlags2KHR pipelineStages,
                            PipelineBarrier& barrier);
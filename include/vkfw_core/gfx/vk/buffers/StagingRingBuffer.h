@@ -0,0 +1,86 @@
+/**
+ * @file   StagingRingBuffer.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a persistently mapped ring buffer used for staging uploads.
+ */
+
+#pragma once
+
+#include "main.h"
+#include "gfx/vk/wrappers/VulkanObjectWrapper.h"
+#include "gfx/vk/memory/DeviceMemory.h"
+#include "gfx/vk/wrappers/VulkanSyncResources.h"
+
+#include <deque>
+#include <mutex>
+
+namespace vkfw_core::gfx {
+
+    class LogicalDevice;
+
+    struct StagingRegion
+    {
+        /** The id used to submit the region. */
+        std::uint64_t m_id = 0;
+        /** The offset of the staged data in the ring buffer. */
+        std::size_t m_offset = 0;
+    };
+
+    /**
+     *  Staging memory is handed out in FIFO order. Regions become free again when the timeline point of the submission
+     *  using them is reached, which is checked without blocking whenever new data is staged.
+     */
+    class StagingRingBuffer final : public VulkanObjectWrapper<vk::UniqueBuffer>
+    {
+    public:
+        StagingRingBuffer(const LogicalDevice* device, std::string_view name, std::size_t size);
+        StagingRingBuffer(const StagingRingBuffer&) = delete;
+        StagingRingBuffer& operator=(const StagingRingBuffer&) = delete;
+        StagingRingBuffer(StagingRingBuffer&&) = delete;
+        StagingRingBuffer& operator=(StagingRingBuffer&&) = delete;
+        ~StagingRingBuffer() override;
+
+        /** Copies data to a free region. Returns nothing if the data does not fit before unsubmitted regions. */
+        [[nodiscard]] std::optional<StagingRegion> Stage(std::size_t dataSize, const void* data,
+                                                         std::size_t alignment);
+        void Submit(std::span<const std::uint64_t> regions, const TimelinePoint& releasePoint);
+        void Retire();
+
+        [[nodiscard]] std::size_t GetSize() const { return m_size; }
+
+    private:
+        struct Region
+        {
+            /** The id of the region. */
+            std::uint64_t m_id = 0;
+            /** The start of the region in the ring. */
+            std::size_t m_offset = 0;
+            /** The end of the region in the ring. */
+            std::size_t m_end = 0;
+            /** The timeline point of the submission using this region (empty if not submitted yet). */
+            std::optional<TimelinePoint> m_releasePoint;
+        };
+
+        [[nodiscard]] std::optional<std::size_t> FindFreeOffset(std::size_t size, std::size_t alignment) const;
+        void RetireReachedRegions();
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the size of the ring. */
+        std::size_t m_size;
+        /** Holds the memory of the ring. */
+        DeviceMemory m_memory;
+        /** Holds the mapped memory of the ring. */
+        std::uint8_t* m_mappedMemory = nullptr;
+        /** Holds whether the ring mapped its memory itself (and needs to unmap it). */
+        bool m_ownsMapping = false;
+        /** Holds all regions in use ordered from oldest to newest. */
+        std::deque<Region> m_regions;
+        /** Holds the id of the next region. */
+        std::uint64_t m_nextRegionId = 0;
+        /** Protects the regions. */
+        std::mutex m_mutex;
+    };
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "gfx/vk/wrappers/VulkanObjectWrapper.h"
+#include "gfx/vk/memory/DeviceMemoryAllocator.h"
 #include "main.h"
 
 #include <glm/gtc/type_precision.hpp>
@@ -32,7 +33,8 @@ namespace vkfw_core::gfx {
         DeviceMemory& operator=(DeviceMemory&&) noexcept;
         ~DeviceMemory();
 
-        void InitializeMemory(const vk::MemoryRequirements& memRequirements, bool shaderDeviceAddress = false);
+        void InitializeMemory(const vk::MemoryRequirements& memRequirements, bool shaderDeviceAddress = false,
+                              RangeAllocationType allocationType = RangeAllocationType::Linear);
         void InitializeMemory(const vk::MemoryAllocateInfo& memAllocateInfo);
 
         void CopyToHostMemory(std::size_t offset, std::size_t size, const void* data) const;
@@ -44,6 +46,16 @@ namespace vkfw_core::gfx {
             const vk::SubresourceLayout& layout, const glm::u32vec3& dataSize, void* data) const;
 
         [[nodiscard]] vk::MemoryPropertyFlags GetMemoryProperties() const { return m_memoryProperties; }
+        /** Returns the Vulkan memory to bind to (the pool block for sub-allocated memory). */
+        [[nodiscard]] vk::DeviceMemory GetMemoryHandle() const
+        {
+            return m_allocation ? m_allocation.GetMemory() : GetHandle();
+        }
+        /** Returns the offset of this memory inside the memory returned by GetMemoryHandle(). */
+        [[nodiscard]] std::size_t GetOffset() const { return m_allocation ? m_allocation.GetOffset() : 0; }
+        [[nodiscard]] bool IsSubAllocated() const { return static_cast<bool>(m_allocation); }
+        /** Returns the persistently mapped pointer of sub-allocated host visible memory (nullptr otherwise). */
+        [[nodiscard]] void* GetMappedPointer() const { return m_allocation.GetMappedPointer(); }
 
         static std::uint32_t FindMemoryType(const LogicalDevice* device, std::uint32_t typeFilter,
                                             const vk::MemoryPropertyFlags& properties);
@@ -65,5 +77,7 @@ namespace vkfw_core::gfx {
         std::size_t m_size;
         /** Holds the memory properties. */
         vk::MemoryPropertyFlags m_memoryProperties;
+        /** Holds the pool allocation if the memory is sub-allocated from the devices memory allocator. */
+        DeviceMemoryAllocation m_allocation;
     };
 }
@@ -0,0 +1,123 @@
+/**
+ * @file   DeviceMemoryAllocator.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a pooled allocator that sub-allocates device memory blocks per memory type.
+ */
+
+#pragma once
+
+#include "main.h"
+#include "gfx/vk/memory/RangeAllocator.h"
+
+#include <mutex>
+
+namespace vkfw_core::gfx {
+
+    class LogicalDevice;
+    class DeviceMemoryAllocator;
+    struct DeviceMemoryBlock;
+
+    class DeviceMemoryAllocation final
+    {
+    public:
+        DeviceMemoryAllocation() = default;
+        DeviceMemoryAllocation(DeviceMemoryAllocator* allocator, DeviceMemoryBlock* block, std::size_t offset,
+                               std::size_t size);
+        DeviceMemoryAllocation(const DeviceMemoryAllocation&) = delete;
+        DeviceMemoryAllocation& operator=(const DeviceMemoryAllocation&) = delete;
+        DeviceMemoryAllocation(DeviceMemoryAllocation&&) noexcept;
+        DeviceMemoryAllocation& operator=(DeviceMemoryAllocation&&) noexcept;
+        ~DeviceMemoryAllocation();
+
+        void Free();
+
+        [[nodiscard]] vk::DeviceMemory GetMemory() const;
+        [[nodiscard]] std::size_t GetOffset() const { return m_offset; }
+        [[nodiscard]] std::size_t GetSize() const { return m_size; }
+        /** Returns the persistently mapped pointer to the start of the allocation (nullptr for non host visible memory). */
+        [[nodiscard]] void* GetMappedPointer() const;
+        explicit operator bool() const { return m_block != nullptr; }
+
+    private:
+        /** Holds the allocator this allocation belongs to. */
+        DeviceMemoryAllocator* m_allocator = nullptr;
+        /** Holds the memory block of the allocation. */
+        DeviceMemoryBlock* m_block = nullptr;
+        /** Holds the offset of the allocation in the memory block. */
+        std::size_t m_offset = 0;
+        /** Holds the size of the allocation. */
+        std::size_t m_size = 0;
+    };
+
+    struct DeviceMemoryStatistics
+    {
+        /** The number of vkAllocateMemory blocks. */
+        std::size_t m_blockCount = 0;
+        /** The number of sub-allocations. */
+        std::size_t m_allocationCount = 0;
+        /** The number of bytes allocated from the driver. */
+        std::size_t m_blockBytes = 0;
+        /** The number of bytes handed out to resources. */
+        std::size_t m_usedBytes = 0;
+        /** The number of bytes still free inside the blocks. */
+        std::size_t m_freeBytes = 0;
+        /** The size of the largest free range in any block. */
+        std::size_t m_largestFreeRange = 0;
+    };
+
+    class DeviceMemoryAllocator final
+    {
+    public:
+        DeviceMemoryAllocator(const LogicalDevice* device, std::size_t deviceBlockSize, std::size_t hostBlockSize);
+        DeviceMemoryAllocator(const DeviceMemoryAllocator&) = delete;
+        DeviceMemoryAllocator& operator=(const DeviceMemoryAllocator&) = delete;
+        DeviceMemoryAllocator(DeviceMemoryAllocator&&) = delete;
+        DeviceMemoryAllocator& operator=(DeviceMemoryAllocator&&) = delete;
+        ~DeviceMemoryAllocator();
+
+        [[nodiscard]] DeviceMemoryAllocation Allocate(const vk::MemoryRequirements& memRequirements,
+                                                      const vk::MemoryPropertyFlags& properties,
+                                                      RangeAllocationType type, bool shaderDeviceAddress = false);
+
+        [[nodiscard]] DeviceMemoryStatistics GetStatistics() const;
+        [[nodiscard]] DeviceMemoryStatistics GetStatistics(std::uint32_t memoryType) const;
+        void LogStatistics() const;
+
+    private:
+        friend class DeviceMemoryAllocation;
+
+        struct MemoryPool
+        {
+            /** The memory blocks of this pool. */
+            std::vector<std::unique_ptr<DeviceMemoryBlock>> m_blocks;
+        };
+
+        void Free(DeviceMemoryBlock* block, std::size_t offset);
+        [[nodiscard]] std::size_t GetPreferredBlockSize(std::uint32_t memoryType) const;
+        [[nodiscard]] DeviceMemoryBlock* CreateBlock(std::uint32_t memoryType, std::size_t size,
+                                                     std::size_t requiredSize, bool dedicated,
+                                                     bool shaderDeviceAddress);
+        [[nodiscard]] static std::size_t GetPoolIndex(std::uint32_t memoryType, bool shaderDeviceAddress)
+        {
+            return 2 * static_cast<std::size_t>(memoryType) + (shaderDeviceAddress ? 1 : 0);
+        }
+        static void AddStatistics(const DeviceMemoryBlock& block, DeviceMemoryStatistics& stats);
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the memory properties of the physical device. */
+        vk::PhysicalDeviceMemoryProperties m_memoryProperties;
+        /** Holds the buffer image granularity of the device. */
+        std::size_t m_bufferImageGranularity;
+        /** Holds the block size used for device local memory. */
+        std::size_t m_deviceBlockSize;
+        /** Holds the block size used for host visible memory. */
+        std::size_t m_hostBlockSize;
+        /** Holds the pools (one per memory type and device address flag). */
+        std::vector<MemoryPool> m_pools;
+        /** Protects the pools. */
+        mutable std::mutex m_mutex;
+    };
+}
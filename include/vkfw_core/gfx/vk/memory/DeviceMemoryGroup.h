@@ -76,6 +76,8 @@ namespace vkfw_core::gfx {
             const std::vector<T>& images, DeviceMemory& memory);
         template<class B, class T> static void BindObjects(const std::vector<std::size_t>& offsets,
             std::vector<B>& buffers, std::vector<T>& images, DeviceMemory& memory);
+        template<class T>
+        static RangeAllocationType GetGroupAllocationType(bool noBuffers, const std::vector<T>& images);
 
         /** Holds the device. */
         const LogicalDevice* m_device;
@@ -52,6 +52,8 @@ namespace vkfw_core::gfx {
                                      std::uint32_t arrayLayer, const glm::u32vec3& size,
                                      std::variant<void*, const void*> data,
                                      const std::function<void(void*)>& deleter = nullptr);
+        /** Fills all MIP levels of the texture from level 0 on the GPU after its data is transferred. */
+        void AddMipmapGenerationToTextureInGroup(unsigned int textureIdx);
         void FinalizeDeviceGroup() override;
         void TransferData(QueuedDeviceTransfer& transfer);
         void RemoveHostMemory();
@@ -60,10 +62,18 @@ namespace vkfw_core::gfx {
             std::size_t offset, std::size_t dataSize);
 
         HostBuffer* GetHostBuffer(unsigned int bufferIdx) { return &m_hostBuffers[bufferIdx]; }
-        HostTexture* GetHostTexture(unsigned int textureIdx) { return &m_hostImages[textureIdx]; }
+        /** Returns the host image of a texture or nullptr for block compressed textures, which are always staged. */
+        HostTexture* GetHostTexture(unsigned int textureIdx)
+        {
+            return m_hostImageIndices[textureIdx] == INVALID_INDEX ? nullptr
+                                                                   : &m_hostImages[m_hostImageIndices[textureIdx]];
+        }
         DeviceMemory* GetHostMemory() { return &m_hostMemory; }
         std::size_t GetHostBufferOffset(unsigned int bufferIdx) { return m_hostOffsets[bufferIdx]; }
-        std::size_t GetHostTextureOffset(unsigned int textureIdx) { return m_hostOffsets[textureIdx + m_hostBuffers.size()]; }
+        std::size_t GetHostTextureOffset(unsigned int textureIdx)
+        {
+            return m_hostOffsets[m_hostImageIndices[textureIdx] + m_hostBuffers.size()];
+        }
 
         template<contiguous_memory T>
         unsigned int
@@ -79,6 +89,8 @@ namespace vkfw_core::gfx {
         std::vector<HostBuffer> m_hostBuffers;
         /** Holds the host images. */
         std::vector<HostTexture> m_hostImages;
+        /** Holds the host image index of each texture (INVALID_INDEX if the texture has none). */
+        std::vector<unsigned int> m_hostImageIndices;
 
         struct BufferContentsDesc
         {
@@ -119,6 +131,8 @@ namespace vkfw_core::gfx {
         std::vector<BufferContentsDesc> m_bufferContents;
         /** Holds the image contents that need to be transfered. */
         std::vector<ImageContentsDesc> m_imageContents;
+        /** Holds the images whose MIP levels are generated after the transfer. */
+        std::vector<unsigned int> m_mipmapImages;
     };
 
     template<contiguous_memory T>
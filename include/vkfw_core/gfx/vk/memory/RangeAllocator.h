@@ -0,0 +1,98 @@
+/**
+ * @file   RangeAllocator.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a best-fit free-list allocator for ranges inside a memory block.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+namespace vkfw_core::gfx {
+
+    /** The kind of resource an allocated range holds (needed to honor bufferImageGranularity). */
+    enum class RangeAllocationType : std::uint8_t
+    {
+        /** The range is not in use. */
+        Free,
+        /** The range holds a buffer or a linear tiled image. */
+        Linear,
+        /** The range holds an optimal tiled image. */
+        Optimal,
+        /** The range holds linear and optimal resources (e.g., a whole memory group). */
+        Unknown
+    };
+
+    struct RangeAllocatorStatistics
+    {
+        /** The number of allocated ranges. */
+        std::size_t m_allocationCount = 0;
+        /** The number of free ranges. */
+        std::size_t m_freeRangeCount = 0;
+        /** The number of allocated bytes (including alignment padding handed out with an allocation). */
+        std::size_t m_usedBytes = 0;
+        /** The number of free bytes. */
+        std::size_t m_freeBytes = 0;
+        /** The size of the largest free range. */
+        std::size_t m_largestFreeRange = 0;
+    };
+
+    /**
+     *  Manages the ranges of a single memory block without touching any memory itself.
+     *  Free ranges are indexed by size and the smallest fitting one is used. Neighboring linear and optimal resources
+     *  are kept on different pages of size bufferImageGranularity.
+     */
+    class RangeAllocator
+    {
+    public:
+        RangeAllocator(std::size_t size, std::size_t bufferImageGranularity);
+
+        [[nodiscard]] std::optional<std::size_t> Allocate(std::size_t size, std::size_t alignment,
+                                                          RangeAllocationType type);
+        void Free(std::size_t offset);
+
+        [[nodiscard]] std::size_t GetSize() const { return m_size; }
+        [[nodiscard]] std::size_t GetUsedBytes() const { return m_usedBytes; }
+        [[nodiscard]] std::size_t GetLargestFreeRange() const;
+        [[nodiscard]] bool IsEmpty() const { return m_usedBytes == 0; }
+        [[nodiscard]] RangeAllocatorStatistics GetStatistics() const;
+        [[nodiscard]] bool CheckConsistency() const;
+
+        static constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment)
+        {
+            return alignment * ((value + alignment - 1) / alignment);
+        }
+
+    private:
+        struct Range
+        {
+            /** The size of the range in bytes. */
+            std::size_t m_size = 0;
+            /** The type of the resource in this range. */
+            RangeAllocationType m_type = RangeAllocationType::Free;
+        };
+        using RangeMap = std::map<std::size_t, Range>;
+
+        [[nodiscard]] std::optional<std::size_t> FindPlacement(RangeMap::const_iterator freeRange, std::size_t size,
+                                                               std::size_t alignment, RangeAllocationType type) const;
+        [[nodiscard]] bool OnSamePage(std::size_t firstEnd, std::size_t secondStart) const;
+        static bool HasGranularityConflict(RangeAllocationType first, RangeAllocationType second);
+        void AddFreeRange(std::size_t offset, std::size_t size);
+        void RemoveFreeRangeIndex(std::size_t offset, std::size_t size);
+
+        /** The size of the managed block. */
+        std::size_t m_size;
+        /** The buffer image granularity (power of two). */
+        std::size_t m_granularity;
+        /** The currently allocated bytes. */
+        std::size_t m_usedBytes = 0;
+        /** All ranges (free and allocated) ordered by their offset. */
+        RangeMap m_ranges;
+        /** The offsets of all free ranges ordered by their size. */
+        std::multimap<std::size_t, std::size_t> m_freeRangesBySize;
+    };
+}
@@ -3,30 +3,86 @@
  * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
  * @date   2016.10.30
  *
- * @brief  Declaration of a pipeline shader stage.
+ * @brief  Declaration of a Vulkan compute pipeline object.
  */
 
 #pragma once
 
 #include "main.h"
+#include "gfx/vk/wrappers/VulkanObjectWrapper.h"
+#include "gfx/vk/wrappers/PipelineBarriers.h"
+#include "gfx/vk/pipeline/ReloadablePipeline.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
+
+#include <glm/vec3.hpp>
 
 namespace vkfw_core::gfx {
 
+    class Buffer;
+    class CommandBuffer;
+    class PipelineLayout;
     class Shader;
 
-    class ComputePipeline final : public Resource
+    class ComputePipeline final : public VulkanObjectWrapper<vk::UniquePipeline>, public ReloadablePipeline
     {
     public:
-        ComputePipeline(const std::string& shaderStageId, gfx::LogicalDevice* device);
-        ComputePipeline(const ComputePipeline&);
-        ComputePipeline& operator=(const ComputePipeline&);
+        ComputePipeline(const LogicalDevice* device, std::string_view name, std::shared_ptr<Shader> shader);
+        ComputePipeline(const ComputePipeline&) = delete;
+        ComputePipeline& operator=(const ComputePipeline&) = delete;
         ComputePipeline(ComputePipeline&&) noexcept;
         ComputePipeline& operator=(ComputePipeline&&) noexcept;
         ~ComputePipeline() override;
 
+        void ResetShader(std::shared_ptr<Shader> shader);
+        /** Creates the pipeline, with hot reloading enabled the layout needs to live as long as the pipeline. */
+        void CreatePipeline(const PipelineLayout& pipelineLayout);
+        [[nodiscard]] bool IsOutdated() const override;
+        void Rebuild() override;
+        /** Returns the reflection of the compute shader. */
+        [[nodiscard]] const ShaderReflection& GetReflection() const;
+        /** Sets specialization constants, they override the defaults of the shader. */
+        void SetSpecializationConstants(const SpecializationConstants& constants)
+        {
+            m_specializations.Set(vk::ShaderStageFlagBits::eCompute, constants);
+        }
+        /** Removes the specialization constants set before, so the defaults of the shader are used. */
+        void ClearSpecializationConstants() { m_specializations.Clear(); }
+        /** Returns a hash of the specialization constants the pipeline was created with, e.g., for variant keys. */
+        [[nodiscard]] std::uint64_t GetSpecializationHash() const { return m_specializations.GetHash(); }
+        /** Returns the workgroup size the pipeline was created with (specialization constants are applied). */
+        [[nodiscard]] const glm::uvec3& GetLocalSize() const { return m_localSize; }
+        /** Returns the barrier recorded on binding, resources accessed without descriptors can add theirs. */
+        [[nodiscard]] PipelineBarrier& GetBarrier() { return m_barrier; }
+
+        void BindPipeline(CommandBuffer& cmdBuffer);
+        /** Returns the number of workgroups needed to cover a number of invocations in each dimension. */
+        [[nodiscard]] glm::uvec3 GetGroupCount(const glm::uvec3& numInvocations) const;
+        /** Dispatches enough workgroups to cover the invocations, the shader needs to skip the ones out of range. */
+        void Dispatch(CommandBuffer& cmdBuffer, const glm::uvec3& numInvocations) const;
+        /** Dispatches with the workgroup counts read from a vk::DispatchIndirectCommand in a buffer. */
+        void DispatchIndirect(CommandBuffer& cmdBuffer, Buffer& buffer, std::size_t offset) const;
+
+        /** Returns the number of workgroups of a size needed to cover a number of invocations in each dimension. */
+        [[nodiscard]] static glm::uvec3 GetGroupCount(const glm::uvec3& numInvocations, const glm::uvec3& localSize);
+
     private:
-        /** Holds all shaders in the program. */
-        std::vector<std::shared_ptr<Shader>> shaders;
+        [[nodiscard]] vk::UniquePipeline CreatePipelineHandle();
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the compute shader. */
+        std::shared_ptr<Shader> m_shader;
+        /** Holds the shader stage for pipeline creation. */
+        vk::PipelineShaderStageCreateInfo m_shaderStage;
+        /** Holds the pipeline layout. */
+        vk::PipelineLayout m_pipelineLayout;
+        /** Holds the generation of the shader the pipeline was created with. */
+        std::optional<std::uint64_t> m_shaderGeneration;
+        /** Holds the specialization constants. */
+        PipelineSpecializations m_specializations;
+        /** Holds the workgroup size the pipeline was created with. */
+        glm::uvec3 m_localSize = glm::uvec3{1};
+        /** Holds the barrier recorded on binding. */
+        PipelineBarrier m_barrier;
     };
 }
-
@@ -17,6 +17,7 @@ namespace vkfw_core::gfx {
     class LogicalDevice;
     class Texture;
     class Buffer;
+    class ShaderReflection;
 }
 
 namespace vkfw_core::gfx {
@@ -32,6 +33,13 @@ namespace vkfw_core::gfx {
 
         void AddBinding(std::uint32_t binding, vk::DescriptorType type, std::uint32_t count,
                         vk::ShaderStageFlags stageFlags, const vk::Sampler* sampler = nullptr);
+        /**
+         *  Adds all bindings a descriptor set has in the reflection of a shader or pipeline.
+         *  @param reflection the shader reflection.
+         *  @param set the descriptor set.
+         *  @param runtimeArrayCount the number of descriptors of runtime sized arrays.
+         */
+        void AddBindings(const ShaderReflection& reflection, std::uint32_t set, std::uint32_t runtimeArrayCount = 1);
 
         vk::DescriptorSetLayout CreateDescriptorLayout(const LogicalDevice* device);
         [[nodiscard]] DescriptorPool CreateDescriptorPool(const LogicalDevice* device, std::string_view name);
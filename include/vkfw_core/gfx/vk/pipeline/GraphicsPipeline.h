@@ -11,6 +11,8 @@
 #include "main.h"
 #include "gfx/vk/wrappers/RenderPass.h"
 #include "gfx/vk/wrappers/PipelineLayout.h"
+#include "gfx/vk/pipeline/ReloadablePipeline.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
 
 #include <glm/vec2.hpp>
 
@@ -18,8 +20,9 @@ namespace vkfw_core::gfx {
 
     class Framebuffer; // NOLINT
     class Shader;
+    class ShaderReflection;
 
-    class GraphicsPipeline final : public VulkanObjectWrapper<vk::UniquePipeline>
+    class GraphicsPipeline final : public VulkanObjectWrapper<vk::UniquePipeline>, public ReloadablePipeline
     {
     public:
         GraphicsPipeline(const LogicalDevice* device, std::string_view name,
@@ -29,13 +32,30 @@ namespace vkfw_core::gfx {
         GraphicsPipeline& operator=(const GraphicsPipeline&) = delete;
         GraphicsPipeline(GraphicsPipeline&&) noexcept;
         GraphicsPipeline& operator=(GraphicsPipeline&&) noexcept;
-        ~GraphicsPipeline();
+        ~GraphicsPipeline() override;
 
         void ResetShaders(std::vector<std::shared_ptr<Shader>>&& shaders);
         void ResetVertexInput() const;
         template<class Vertex> void ResetVertexInput() const;
         void ResetFramebuffer(const glm::uvec2& size, unsigned int numViewports, unsigned int numScissors) const;
+        /**
+         *  Creates the pipeline. With hot reloading enabled the state is kept to rebuild the pipeline, the render pass
+         *  and the layout need to live as long as the pipeline then.
+         */
         void CreatePipeline(bool keepState, const RenderPass& renderPass, unsigned int subpass, const PipelineLayout& pipelineLayout);
+        [[nodiscard]] bool IsOutdated() const override;
+        void Rebuild() override;
+        /** Returns the merged reflection of all shader stages, throws if the stages use bindings differently. */
+        [[nodiscard]] ShaderReflection GetReflection() const;
+        /** Sets specialization constants for the shaders of some stages, they override the defaults of the shaders. */
+        void SetSpecializationConstants(vk::ShaderStageFlags stages, const SpecializationConstants& constants)
+        {
+            m_specializations.Set(stages, constants);
+        }
+        /** Removes the specialization constants set before, so the defaults of the shaders are used. */
+        void ClearSpecializationConstants() { m_specializations.Clear(); }
+        /** Returns a hash of the specialization constants the pipeline was created with, e.g., for variant keys. */
+        [[nodiscard]] std::uint64_t GetSpecializationHash() const { return m_specializations.GetHash(); }
 
         [[nodiscard]] vk::Viewport& GetViewport(unsigned int idx) const
         {
@@ -84,6 +104,7 @@ namespace vkfw_core::gfx {
         }
 
     private:
+        [[nodiscard]] vk::UniquePipeline CreatePipelineHandle();
 
         struct State final
         {
@@ -121,6 +142,16 @@ namespace vkfw_core::gfx {
         std::vector<std::shared_ptr<Shader>> m_shaders;
         /** Holds the state. */
         std::unique_ptr<State> m_state;
+        /** Holds the render pass the pipeline was created for. */
+        vk::RenderPass m_renderPass;
+        /** Holds the subpass the pipeline was created for. */
+        unsigned int m_subpass = 0;
+        /** Holds the pipeline layout. */
+        vk::PipelineLayout m_pipelineLayout;
+        /** Holds the generations of the shaders the pipeline was created with. */
+        std::vector<std::uint64_t> m_shaderGenerations;
+        /** Holds the specialization constants of the stages. */
+        PipelineSpecializations m_specializations;
     };
 
     template <class Vertex>
@@ -0,0 +1,77 @@
+/**
+ * @file   PipelineCache.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a pipeline cache that is persisted on disk between runs.
+ */
+
+#pragma once
+
+#include "main.h"
+#include "gfx/vk/wrappers/VulkanObjectWrapper.h"
+
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+namespace vkfw_core::gfx {
+
+    class LogicalDevice;
+
+    class PipelineCache final : public VulkanObjectWrapper<vk::UniquePipelineCache>
+    {
+    public:
+        PipelineCache(const LogicalDevice* device, std::string_view name, std::filesystem::path cacheFile,
+                      bool useCreationFeedback);
+        PipelineCache(const PipelineCache&) = delete;
+        PipelineCache& operator=(const PipelineCache&) = delete;
+        PipelineCache(PipelineCache&&) = delete;
+        PipelineCache& operator=(PipelineCache&&) = delete;
+        ~PipelineCache() override;
+
+        void Save() const;
+
+        /**
+         *  Creates a pipeline using this cache and logs the creation time and whether the cache was hit (debug level).
+         *  @param pipelineName the name of the pipeline for logging.
+         *  @param createInfo the pipeline create info (the feedback struct is chained temporarily).
+         *  @param createFunc function (vk::PipelineCache, const CreateInfo&) creating the pipeline.
+         */
+        template<typename CreateInfo, typename CreateFunc>
+        auto CreatePipeline(std::string_view pipelineName, CreateInfo& createInfo, CreateFunc&& createFunc) const;
+
+    private:
+        [[nodiscard]] std::vector<std::uint8_t> LoadCacheData() const;
+        void LogPipelineCreation(std::string_view pipelineName, std::chrono::duration<double, std::milli> duration,
+                                 const vk::PipelineCreationFeedbackEXT& feedback) const;
+
+        /** Holds the device. */
+        const LogicalDevice* m_device;
+        /** Holds the file the cache is stored in. */
+        std::filesystem::path m_cacheFile;
+        /** Holds whether the device reports pipeline creation feedback. */
+        bool m_useCreationFeedback;
+    };
+
+    template<typename CreateInfo, typename CreateFunc>
+    auto PipelineCache::CreatePipeline(std::string_view pipelineName, CreateInfo& createInfo,
+                                       CreateFunc&& createFunc) const
+    {
+        vk::PipelineCreationFeedbackEXT pipelineFeedback;
+        vk::PipelineCreationFeedbackCreateInfoEXT feedbackInfo{&pipelineFeedback, 0, nullptr};
+        const void* originalNext = createInfo.pNext;
+        if (m_useCreationFeedback) {
+            feedbackInfo.pNext = originalNext;
+            createInfo.pNext = &feedbackInfo;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto result = createFunc(GetHandle(), std::as_const(createInfo));
+        std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+
+        createInfo.pNext = originalNext;
+        LogPipelineCreation(pipelineName, duration, pipelineFeedback);
+        return result;
+    }
+}
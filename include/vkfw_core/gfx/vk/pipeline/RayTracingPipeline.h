@@ -10,15 +10,18 @@
 
 #include "gfx/vk/wrappers/VulkanObjectWrapper.h"
 #include "gfx/vk/wrappers/PipelineBarriers.h"
+#include "gfx/vk/pipeline/ReloadablePipeline.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
 #include "main.h"
 
 namespace vkfw_core::gfx {
 
     class Shader;
+    class ShaderReflection;
     class HostBuffer;
     class PipelineLayout;
 
-    class RayTracingPipeline : public VulkanObjectPrivateWrapper<vk::UniquePipeline>
+    class RayTracingPipeline : public VulkanObjectPrivateWrapper<vk::UniquePipeline>, public ReloadablePipeline
     {
     public:
         struct RTShaderInfo
@@ -28,14 +31,34 @@ namespace vkfw_core::gfx {
         };
 
         RayTracingPipeline(const LogicalDevice* device, std::string_view name, std::vector<RTShaderInfo>&& shaders);
-        ~RayTracingPipeline();
+        RayTracingPipeline(const RayTracingPipeline&) = delete;
+        RayTracingPipeline& operator=(const RayTracingPipeline&) = delete;
+        RayTracingPipeline(RayTracingPipeline&&) = delete;
+        RayTracingPipeline& operator=(RayTracingPipeline&&) = delete;
+        ~RayTracingPipeline() override;
 
         void ResetShaders(std::vector<RTShaderInfo>&& shaders);
+        /** Creates the pipeline, with hot reloading enabled the layout needs to live as long as the pipeline. */
         void CreatePipeline(std::uint32_t maxRecursionDepth, const PipelineLayout& pipelineLayout);
+        /** Checks if any shader was reloaded, the shader binding table moves on rebuilds as well. */
+        [[nodiscard]] bool IsOutdated() const override;
+        void Rebuild() override;
+        /** Returns the merged reflection of all shader stages, throws if the stages use bindings differently. */
+        [[nodiscard]] ShaderReflection GetReflection() const;
+        /** Sets specialization constants for the shaders of some stages, they override the defaults of the shaders. */
+        void SetSpecializationConstants(vk::ShaderStageFlags stages, const SpecializationConstants& constants)
+        {
+            m_specializations.Set(stages, constants);
+        }
+        /** Removes the specialization constants set before, so the defaults of the shaders are used. */
+        void ClearSpecializationConstants() { m_specializations.Clear(); }
+        /** Returns a hash of the specialization constants the pipeline was created with, e.g., for variant keys. */
+        [[nodiscard]] std::uint64_t GetSpecializationHash() const { return m_specializations.GetHash(); }
         const std::array<vk::StridedDeviceAddressRegionKHR, 4>& GetSBTDeviceAddresses() const { return m_sbtDeviceAddressRegions; }
         void BindPipeline(CommandBuffer& cmdBuffer);
 
     private:
+        [[nodiscard]] vk::UniquePipeline CreatePipelineHandle();
         void InitializeShaderBindingTable();
         static void ValidateShaderGroup(const vk::RayTracingShaderGroupCreateInfoKHR& shaderGroup);
 
@@ -60,6 +83,14 @@ namespace vkfw_core::gfx {
         std::unique_ptr<vkfw_core::gfx::HostBuffer> m_shaderBindingTable;
         /** Holds the shader binding table barrier. */
         PipelineBarrier m_barrier;
+        /** Holds the maximum recursion depth. */
+        std::uint32_t m_maxRecursionDepth = 0;
+        /** Holds the pipeline layout. */
+        vk::PipelineLayout m_pipelineLayout;
+        /** Holds the generations of the shaders the pipeline was created with. */
+        std::vector<std::uint64_t> m_shaderGenerations;
+        /** Holds the specialization constants of the stages. */
+        PipelineSpecializations m_specializations;
     };
 
 }
@@ -0,0 +1,32 @@
+/**
+ * @file   ReloadablePipeline.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Interface of pipelines that can be rebuilt after their shaders were reloaded.
+ */
+
+#pragma once
+
+namespace vkfw_core::gfx {
+
+    /** A pipeline the hot reloader rebuilds once any of its shaders was reloaded. */
+    class ReloadablePipeline
+    {
+    public:
+        ReloadablePipeline() = default;
+        ReloadablePipeline(const ReloadablePipeline&) = default;
+        ReloadablePipeline& operator=(const ReloadablePipeline&) = default;
+        ReloadablePipeline(ReloadablePipeline&&) noexcept = default;
+        ReloadablePipeline& operator=(ReloadablePipeline&&) noexcept = default;
+        virtual ~ReloadablePipeline() = default;
+
+        /** Checks if any shader was reloaded since the pipeline was created. */
+        [[nodiscard]] virtual bool IsOutdated() const = 0;
+        /**
+         *  Creates the pipeline again with the current shaders, the old pipeline is released after the submitted work
+         *  finished. Throws and keeps the old pipeline if creation fails.
+         */
+        virtual void Rebuild() = 0;
+    };
+}
@@ -0,0 +1,151 @@
+/**
+ * @file   ShaderReflection.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Reflection of the resources used by SPIR-V shader code.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vkfw_core::gfx {
+
+    class SpecializationConstants;
+
+    /** A descriptor binding used by shader code. */
+    struct ReflectedDescriptorBinding
+    {
+        /** Holds the descriptor set. */
+        std::uint32_t m_set = 0;
+        /** Holds the binding in the descriptor set. */
+        std::uint32_t m_binding = 0;
+        /** Holds the descriptor type, dynamic buffers cannot be told apart and are reported as non-dynamic ones. */
+        vk::DescriptorType m_type = vk::DescriptorType::eUniformBuffer;
+        /** Holds the number of descriptors, 0 for runtime sized arrays and arrays sized by specialization constants. */
+        std::uint32_t m_count = 1;
+        /** Holds the stages using the binding. */
+        vk::ShaderStageFlags m_stages;
+        /** Holds the name of the variable or of its block if the variable has none. */
+        std::string m_name;
+        /** Holds whether the number of descriptors depends on specialization constants and is unknown. */
+        bool m_specializationDependentCount = false;
+    };
+
+    /** A specialization constant of shader code. */
+    struct ReflectedSpecializationConstant
+    {
+        /** Holds the constant id. */
+        std::uint32_t m_constantId = 0;
+        /** Holds the size of the constant in bytes (booleans are 4 bytes like VkBool32). */
+        std::uint32_t m_size = 0;
+        /** Holds the bits of the default value. */
+        std::uint64_t m_defaultValue = 0;
+        /** Holds the stages using the constant. */
+        vk::ShaderStageFlags m_stages;
+        /** Holds the name of the constant. */
+        std::string m_name;
+    };
+
+    /** A vertex input location of a vertex shader. */
+    struct ReflectedVertexInput
+    {
+        /** Holds the location, matrices and arrays use one entry per location. */
+        std::uint32_t m_location = 0;
+        /** Holds the format matching the input type (vk::Format::eUndefined for types without a matching format). */
+        vk::Format m_format = vk::Format::eUndefined;
+        /** Holds the name of the input. */
+        std::string m_name;
+    };
+
+    /**
+     *  Holds the descriptor bindings, push constant ranges, specialization constants, vertex inputs and the workgroup
+     *  size of SPIR-V code. Reflections of the stages of a pipeline can be merged to create or check the descriptor
+     *  set layouts and vertex input state of the pipeline, so mismatches between shaders and layouts are found when
+     *  the pipeline is created.
+     */
+    class ShaderReflection final
+    {
+    public:
+        ShaderReflection() = default;
+        /** Parses SPIR-V code, throws if it is no SPIR-V code (the first entry point is reflected). */
+        explicit ShaderReflection(std::span<const std::uint32_t> code);
+
+        /** Merges the reflection of another stage of the same pipeline, throws if the stages conflict. */
+        void Merge(const ShaderReflection& other);
+
+        [[nodiscard]] vk::ShaderStageFlags GetStages() const { return m_stages; }
+        [[nodiscard]] const std::string& GetEntryPoint() const { return m_entryPoint; }
+        /** Returns the descriptor bindings sorted by set and binding. */
+        [[nodiscard]] const std::vector<ReflectedDescriptorBinding>& GetDescriptorBindings() const
+        {
+            return m_descriptorBindings;
+        }
+        /** Returns the number of descriptor sets, i.e., the highest set used plus one. */
+        [[nodiscard]] std::uint32_t GetNumDescriptorSets() const;
+        [[nodiscard]] const std::vector<vk::PushConstantRange>& GetPushConstantRanges() const
+        {
+            return m_pushConstantRanges;
+        }
+        /** Returns the specialization constants sorted by their id. */
+        [[nodiscard]] const std::vector<ReflectedSpecializationConstant>& GetSpecializationConstants() const
+        {
+            return m_specializationConstants;
+        }
+        /** Returns the vertex inputs sorted by their location. */
+        [[nodiscard]] const std::vector<ReflectedVertexInput>& GetVertexInputs() const { return m_vertexInputs; }
+        /** Returns the workgroup size with the default values of specialization constants. */
+        [[nodiscard]] const std::array<std::uint32_t, 3>& GetLocalSize() const { return m_localSize; }
+        /** Returns the workgroup size with the values of specialization constants that are set. */
+        [[nodiscard]] std::array<std::uint32_t, 3> GetLocalSize(const SpecializationConstants& constants) const;
+        /** Returns the ids of the specialization constants setting the workgroup size in each dimension. */
+        [[nodiscard]] const std::array<std::optional<std::uint32_t>, 3>& GetLocalSizeSpecializationIds() const
+        {
+            return m_localSizeSpecializationIds;
+        }
+
+        /**
+         *  Returns the layout bindings of a descriptor set for creating its layout.
+         *  @param set the descriptor set.
+         *  @param runtimeArrayCount the number of descriptors of runtime sized arrays and of arrays sized by
+         *  specialization constants.
+         */
+        [[nodiscard]] std::vector<vk::DescriptorSetLayoutBinding>
+        GetLayoutBindings(std::uint32_t set, std::uint32_t runtimeArrayCount = 1) const;
+        /** Checks the bindings of a descriptor set layout, returns a message for each binding not matching the code. */
+        [[nodiscard]] std::vector<std::string>
+        ValidateLayoutBindings(std::uint32_t set, std::span<const vk::DescriptorSetLayoutBinding> bindings) const;
+        /** Returns the bindings of a descriptor set layout that are not used by the code and need no writes. */
+        [[nodiscard]] std::vector<std::uint32_t>
+        FindUnusedBindings(std::uint32_t set, std::span<const vk::DescriptorSetLayoutBinding> bindings) const;
+        /** Checks vertex attributes, returns a message for each vertex input without an attribute. */
+        [[nodiscard]] std::vector<std::string>
+        ValidateVertexInput(std::span<const vk::VertexInputAttributeDescription> attributes) const;
+
+    private:
+        /** Holds the stages of the code. */
+        vk::ShaderStageFlags m_stages;
+        /** Holds the name of the entry point. */
+        std::string m_entryPoint;
+        /** Holds the descriptor bindings. */
+        std::vector<ReflectedDescriptorBinding> m_descriptorBindings;
+        /** Holds the push constant ranges. */
+        std::vector<vk::PushConstantRange> m_pushConstantRanges;
+        /** Holds the specialization constants. */
+        std::vector<ReflectedSpecializationConstant> m_specializationConstants;
+        /** Holds the vertex inputs. */
+        std::vector<ReflectedVertexInput> m_vertexInputs;
+        /** Holds the workgroup size. */
+        std::array<std::uint32_t, 3> m_localSize = {1, 1, 1};
+        /** Holds the specialization constants setting the workgroup size. */
+        std::array<std::optional<std::uint32_t>, 3> m_localSizeSpecializationIds;
+    };
+}
@@ -0,0 +1,165 @@
+/**
+ * @file   SpecializationConstants.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Typed values for the specialization constants of a shader stage.
+ */
+
+#pragma once
+
+#include "gfx/vk/pipeline/ShaderReflection.h"
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vkfw_core::gfx {
+
+    /** The scalar types specialization constants can have in GLSL. */
+    template<typename T>
+    concept SpecializationConstantType =
+        std::same_as<T, bool> || std::same_as<T, std::int32_t> || std::same_as<T, std::uint32_t>
+        || std::same_as<T, std::int64_t> || std::same_as<T, std::uint64_t> || std::same_as<T, float>
+        || std::same_as<T, double>;
+
+    /**
+     *  Holds the values of specialization constants for a shader stage. Pipeline variants (e.g., light counts or
+     *  feature toggles) can share one SPIR-V module this way and still get code with the values folded in.
+     *  Booleans are stored as vk::Bool32 like Vulkan expects them.
+     */
+    class SpecializationConstants final
+    {
+    public:
+        /** Sets the value of a constant by its id (constant_id in GLSL). */
+        template<SpecializationConstantType T> SpecializationConstants& Set(std::uint32_t constantId, T value);
+        /** Sets the value of a constant by its name, throws if the code has no such constant of that size. */
+        template<SpecializationConstantType T>
+        SpecializationConstants& Set(const ShaderReflection& reflection, std::string_view name, T value);
+        /** Returns the value of a constant, if it is set with the size of the type. */
+        template<SpecializationConstantType T> [[nodiscard]] std::optional<T> Get(std::uint32_t constantId) const;
+        /** Sets all values of another object, replacing values with the same id. */
+        SpecializationConstants& Merge(const SpecializationConstants& other);
+
+        [[nodiscard]] bool IsEmpty() const { return m_entries.empty(); }
+        /** Returns the map entries sorted by constant id. */
+        [[nodiscard]] const std::vector<vk::SpecializationMapEntry>& GetEntries() const { return m_entries; }
+        /** Returns the specialization info, it points to this object and is invalidated by setting values. */
+        [[nodiscard]] vk::SpecializationInfo GetInfo() const;
+        /** Returns a hash of the ids and values, e.g., to use as part of a key for pipeline variants. */
+        [[nodiscard]] std::uint64_t GetHash() const;
+        /** Checks the values against the code, returns a message for each value whose size does not match. */
+        [[nodiscard]] std::vector<std::string> Validate(const ShaderReflection& reflection) const;
+
+        [[nodiscard]] bool operator==(const SpecializationConstants& rhs) const;
+
+    private:
+        void SetData(std::uint32_t constantId, std::span<const std::byte> data);
+
+        /** Holds the map entries sorted by constant id. */
+        std::vector<vk::SpecializationMapEntry> m_entries;
+        /** Holds the values. */
+        std::vector<std::byte> m_data;
+    };
+
+    /**
+     *  Holds the specialization constants a pipeline sets for its stages and the merged values each stage is created
+     *  with. Values set for a stage override the defaults of its shader.
+     */
+    class PipelineSpecializations final
+    {
+    public:
+        /**
+         *  Sets values for all stages in the flags, they replace the values set before for the same flags. Values set
+         *  for other flags that share stages are overridden by later calls.
+         */
+        void Set(vk::ShaderStageFlags stages, const SpecializationConstants& constants);
+        /** Removes the values of all stages, so only the defaults of the shaders are used. */
+        void Clear() { m_constants.clear(); }
+        /** Prepares the merged values for a number of stages, needs to be called before the stages are applied. */
+        void Reset(std::size_t numStages);
+        /**
+         *  Merges the values of a stage and points its create info to them, throws if a value does not match the code.
+         *  @param stageIndex the index of the stage in the pipeline.
+         *  @param stageInfo the create info of the stage.
+         *  @param shaderDefaults the values set on the shader.
+         *  @param reflection the reflection of the shader code.
+         */
+        void Apply(std::size_t stageIndex, vk::PipelineShaderStageCreateInfo& stageInfo,
+                   const SpecializationConstants& shaderDefaults, const ShaderReflection& reflection);
+        /** Returns the merged values of a stage the pipeline was created with. */
+        [[nodiscard]] const SpecializationConstants& GetStageConstants(std::size_t stageIndex) const
+        {
+            return m_stageConstants[stageIndex];
+        }
+        /** Returns a hash of the merged values of all stages the pipeline was created with. */
+        [[nodiscard]] std::uint64_t GetHash() const;
+
+    private:
+        /** Holds the values set by the pipeline and the stages they are set for. */
+        std::vector<std::pair<vk::ShaderStageFlags, SpecializationConstants>> m_constants;
+        /** Holds the merged values of each stage. */
+        std::vector<SpecializationConstants> m_stageConstants;
+        /** Holds the specialization info of each stage, the stage create infos point to them. */
+        std::vector<vk::SpecializationInfo> m_stageInfos;
+    };
+
+    template<SpecializationConstantType T>
+    SpecializationConstants& SpecializationConstants::Set(std::uint32_t constantId, T value)
+    {
+        if constexpr (std::same_as<T, bool>) {
+            const vk::Bool32 boolValue = value ? VK_TRUE : VK_FALSE;
+            SetData(constantId, std::as_bytes(std::span{&boolValue, 1}));
+        } else {
+            SetData(constantId, std::as_bytes(std::span{&value, 1}));
+        }
+        return *this;
+    }
+
+    template<SpecializationConstantType T>
+    std::optional<T> SpecializationConstants::Get(std::uint32_t constantId) const
+    {
+        using StoredType = std::conditional_t<std::same_as<T, bool>, vk::Bool32, T>;
+        for (const auto& entry : m_entries) {
+            if (entry.constantID != constantId || entry.size != sizeof(StoredType)) { continue; }
+            StoredType value{};
+            std::memcpy(&value, &m_data[entry.offset], sizeof(StoredType));
+            if constexpr (std::same_as<T, bool>) {
+                return value != VK_FALSE;
+            } else {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    template<SpecializationConstantType T>
+    SpecializationConstants& SpecializationConstants::Set(const ShaderReflection& reflection, std::string_view name,
+                                                          T value)
+    {
+        constexpr auto size = std::same_as<T, bool> ? sizeof(vk::Bool32) : sizeof(T);
+        for (const auto& constant : reflection.GetSpecializationConstants()) {
+            if (constant.m_name != name) { continue; }
+            if (constant.m_size != size) {
+                spdlog::error("Specialization constant {} has {} bytes but the value has {}.", name, constant.m_size,
+                              size);
+                throw std::runtime_error("Specialization constant value has the wrong size.");
+            }
+            return Set(constant.m_constantId, value);
+        }
+        spdlog::error("Shader code has no specialization constant {}.", name);
+        throw std::runtime_error("Shader code has no specialization constant with this name.");
+    }
+}
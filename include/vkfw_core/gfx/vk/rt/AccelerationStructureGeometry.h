@@ -175,7 +175,8 @@ namespace vkfw_core::gfx::rt {
             auto& meshInfo = m_meshGeometryInfos[i_mesh];
 
             meshInfo.mesh->GetVertices<VertexType>(vertices);
-            bufferInfo.indices[i_mesh] = meshInfo.mesh->GetIndices();
+            auto indices = meshInfo.mesh->GetIndices();
+            bufferInfo.indices[i_mesh].assign(indices.begin(), indices.end());
             bufferInfo.vertices[i_mesh].resize(byteSizeOf(vertices));
             memcpy(bufferInfo.vertices[i_mesh].data(), vertices.data(), bufferInfo.vertices[i_mesh].size());
 
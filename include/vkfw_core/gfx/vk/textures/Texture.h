@@ -110,13 +110,28 @@ namespace vkfw_core::gfx {
                        const Queue& copyQueue,
                        std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
                        std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
-                       std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence = {});
+                       std::optional<std::reference_wrapper<TimelinePoint>> submitPoint = {});
         [[nodiscard]] CommandBuffer
         CopyImageAsync(Texture& dstImage, const Queue& transitionQueue,
                        std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
                        std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
-                       std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence = {});
+                       std::optional<std::reference_wrapper<TimelinePoint>> submitPoint = {});
         void CopyImageSync(Texture& dstImage, const Queue& copyQueue);
+        /**
+         *  Copies tightly packed texels from a host written staging buffer (size.x is in bytes per line).
+         *  Lines of block compressed formats are rows of blocks.
+         */
+        void CopyFromStagingAsync(vk::Buffer stagingBuffer, std::size_t stagingOffset, std::uint32_t dstMipLevel,
+                                  const glm::u32vec4& dstOffset, const glm::u32vec4& size, CommandBuffer& cmdBuffer);
+        /**
+         *  Fills all MIP levels from level 0 with linear filtered blits, each level from the previous one.
+         *  Needs transfer source and destination usage and a command buffer of a graphics queue.
+         */
+        void GenerateMipmaps(CommandBuffer& cmdBuffer);
+        /** Checks if the format supports linear filtered blits needed by GenerateMipmaps. */
+        [[nodiscard]] static bool SupportsMipmapGeneration(const LogicalDevice* device, vk::Format format);
+        /** Checks if the format is one of the BC1 to BC7 formats (m_bytesPP is the size of a 4x4 block for those). */
+        [[nodiscard]] static bool IsBlockCompressed(vk::Format format);
 
         void AccessBarrier(vk::AccessFlags2KHR access, vk::PipelineStageFlags2KHR pipelineStages,
                            vk::ImageLayout imageLayout, PipelineBarrier& barrier);
@@ -133,6 +148,7 @@ namespace vkfw_core::gfx {
         [[nodiscard]] const TextureDescriptor& GetDescriptor() const { return m_desc; }
         [[nodiscard]] vk::ImageAspectFlags GetValidAspects() const;
         [[nodiscard]] vk::Image GetAccessNoBarrier() const;
+        [[nodiscard]] RangeAllocationType GetAllocationType() const;
         [[nodiscard]] vk::ImageLayout GetImageLayout() const { return m_imageLayout; }
         [[nodiscard]] vk::MemoryRequirements GetMemoryRequirements() const;
         [[nodiscard]] vk::SubresourceLayout GetSubresourceLayout(const vk::ImageSubresource& subresource) const;
@@ -155,7 +171,10 @@ namespace vkfw_core::gfx {
         ImageView m_imageView;
         /** Holds the Vulkan device memory for the image. */
         DeviceMemory m_imageDeviceMemory;
-        /** Holds the current size of the texture (x: bytes of line, y: #lines, z: #depth slices, w: #array slices). */
+        /**
+         *  Holds the current size of the texture (x: bytes of line, y: #lines, z: #depth slices, w: #array slices).
+         *  Lines of block compressed formats are rows of blocks.
+         */
         glm::u32vec4 m_size;
         /** Holds the current size of the texture in pixels. */
         glm::u32vec4 m_pixelSize;
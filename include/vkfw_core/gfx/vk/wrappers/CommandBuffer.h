@@ -40,9 +40,18 @@ namespace vkfw_core::gfx {
         void Begin(const vk::CommandBufferBeginInfo& beginInfo) const;
         void End() const;
 
-        [[nodiscard]] std::shared_ptr<Semaphore> AddWaitSemaphore(vk::PipelineStageFlags2KHR waitStages);
+        /**
+         *  Lets the next submit of this command buffer wait for a timeline point, e.g., a submit to another queue.
+         *  @param waitPoint the timeline point to wait for.
+         *  @param waitStages the stages that wait.
+         */
+        void AddWait(const TimelinePoint& waitPoint, vk::PipelineStageFlags2KHR waitStages);
 
-        std::shared_ptr<Fence>
+        /**
+         *  Submits the command buffer to a queue.
+         *  @return the timeline point of the queue that is reached when the command buffer finished execution.
+         */
+        TimelinePoint
         SubmitToQueue(const Queue& queue,
                       std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
                       std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{});
@@ -68,7 +77,7 @@ namespace vkfw_core::gfx {
                                                                  std::string_view cmdBufferName,
                                                                  std::string_view regionName,
                                                                  const CommandPool& commandPool);
-        [[nodiscard]] static std::shared_ptr<Fence> endSingleTimeSubmit(
+        [[nodiscard]] static TimelinePoint endSingleTimeSubmit(
             const Queue& queue, CommandBuffer& cmdBuffer,
             std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{},
             std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores = std::span<vk::SemaphoreSubmitInfoKHR>{});
@@ -80,9 +89,7 @@ namespace vkfw_core::gfx {
         const LogicalDevice* m_device = nullptr;
         /** Holds the queue family for this command buffer. */
         unsigned int m_queueFamily = static_cast<unsigned int>(-1);
-        /** Holds the wait semaphores used on submit. */
-        std::vector<std::shared_ptr<Semaphore>> m_waitSemaphores;
-        /** Holds the wait semaphore submit infos. */
+        /** Holds the wait semaphore submit infos for the next submit. */
         std::vector<vk::SemaphoreSubmitInfoKHR> m_waitSemaphoreSubmitInfos;
     };
 }
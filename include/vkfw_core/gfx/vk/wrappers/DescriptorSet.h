@@ -67,6 +67,12 @@ namespace vkfw_core::gfx {
         void Bind(CommandBuffer& cmdBuffer, vk::PipelineBindPoint bindingPoint,
                   const PipelineLayout& pipelineLayout, std::uint32_t firstSet,
                   const vk::ArrayProxy<const std::uint32_t>& dynamicOffsets = {});
+        /** Binds without recording a barrier, e.g., on a worker thread. Call ConsumeBindBarrier on the main thread. */
+        void BindWithoutBarrier(CommandBuffer& cmdBuffer, vk::PipelineBindPoint bindingPoint,
+                                const PipelineLayout& pipelineLayout, std::uint32_t firstSet,
+                                const vk::ArrayProxy<const std::uint32_t>& dynamicOffsets = {}) const;
+        /** Marks a barrier recorded by BindBarrier as used by a bind done with BindWithoutBarrier. */
+        void ConsumeBindBarrier();
 
     private:
         [[nodiscard]] std::pair<vk::WriteDescriptorSet&, vk::PipelineStageFlags2KHR>
@@ -0,0 +1,25 @@
+/**
+ * @file   QueryPool.h
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Declaration of a Vulkan query pool object.
+ */
+
+#pragma once
+
+#include "VulkanObjectWrapper.h"
+#include "main.h"
+
+namespace vkfw_core::gfx {
+
+    class QueryPool : public VulkanObjectWrapper<vk::UniqueQueryPool>
+    {
+    public:
+        QueryPool() : VulkanObjectWrapper{nullptr, "", vk::UniqueQueryPool{}} {}
+        QueryPool(vk::Device device, std::string_view name, vk::UniqueQueryPool queryPool)
+            : VulkanObjectWrapper{device, name, std::move(queryPool)}
+        {
+        }
+    };
+}
@@ -11,19 +11,22 @@
 #include "main.h"
 #include "VulkanObjectWrapper.h"
 #include "CommandPool.h"
+#include "VulkanSyncResources.h"
 #include <glm/vec4.hpp>
 
 namespace vkfw_core::gfx {
 
-    class Fence;
-
     class Queue : public VulkanObjectWrapper<vk::Queue>
     {
     public:
         Queue() : VulkanObjectWrapper{nullptr, "", nullptr} {}
         Queue(vk::Device device, std::string_view name, vk::Queue queue, const CommandPool& commandPool);
 
-        void Submit(const vk::SubmitInfo2KHR& submitInfo, const Fence* fence) const;
+        /**
+         *  Submits to the queue and additionally signals the next value of the queues timeline semaphore.
+         *  @return the timeline point reached when the submit is finished.
+         */
+        TimelinePoint Submit(const vk::SubmitInfo2KHR& submitInfo, const Fence* fence = nullptr) const;
         [[nodiscard]] vk::Result Present(const vk::PresentInfoKHR& presentInfo) const;
         void WaitIdle() const;
 
@@ -32,9 +35,16 @@ namespace vkfw_core::gfx {
         void EndLabel() const;
 
         const CommandPool& GetCommandPool() const { return *m_commandPool; }
+        /** Returns the timeline point of the last submit to this queue. */
+        [[nodiscard]] TimelinePoint GetLastSubmit() const
+        {
+            return TimelinePoint{m_timeline.get(), m_timeline->GetLastSignalValue()};
+        }
 
     private:
         const CommandPool* m_commandPool = nullptr;
+        /** Holds the timeline semaphore signaled by all submits (shared by copies of this queue). */
+        std::shared_ptr<TimelineSemaphore> m_timeline;
     };
 
     class QueueRegion
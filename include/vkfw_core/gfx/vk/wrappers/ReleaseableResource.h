@@ -18,4 +18,15 @@ namespace vkfw_core::gfx {
     public:
         virtual ~ReleaseableResource() = default;
     };
+
+    /** Keeps a shared object alive as a releaseable resource, e.g., a resource evicted from a resource manager. */
+    template<typename T> class SharedReleaseableResource final : public ReleaseableResource
+    {
+    public:
+        explicit SharedReleaseableResource(std::shared_ptr<const T> resource) : m_resource{std::move(resource)} {}
+
+    private:
+        /** Holds the resource. */
+        std::shared_ptr<const T> m_resource;
+    };
 }
@@ -9,28 +9,50 @@
 #pragma once
 
 #include "ReleaseableResource.h"
+#include "VulkanSyncResources.h"
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace vkfw_core::gfx {
 
     class LogicalDevice;
-    class Fence;
 
+    /** Keeps resources alive until the timeline point of the last submit using them is reached. */
     class ResourceReleaser
     {
     public:
         ResourceReleaser(const LogicalDevice* device) : m_device{device} {}
         ~ResourceReleaser();
 
-        std::shared_ptr<Fence> AddFence(std::string_view name);
-        void AddResource(const std::shared_ptr<Fence>& fence, std::shared_ptr<const ReleaseableResource> resource);
-        // void AddResources(const std::shared_ptr<const Fence>& fence, std::span<std::shared_ptr<const ReleaseableResource>> resources);
+        /**
+         *  Adds a resource to be released when a timeline point is reached.
+         *  @param releasePoint the timeline point after which the resource is not used anymore.
+         *  @param resource the resource to release.
+         */
+        void AddResource(const TimelinePoint& releasePoint, std::shared_ptr<const ReleaseableResource> resource);
+        /**
+         *  Adds a resource to be released after all work submitted so far, can be called from any thread.
+         *  The next TryRelease assigns the last submit of each queue, which is not before the call.
+         *  @param resource the resource to release.
+         */
+        void AddResourceAfterSubmittedWork(std::shared_ptr<const ReleaseableResource> resource);
+        /** Releases all resources whose timeline points were reached (one counter query per timeline). */
         void TryRelease();
 
     private:
+        /** Adds the resources waiting for submitted work at the last submit of each queue. */
+        void AddSubmittedWorkResources();
+
+        /** Holds the device. */
         const LogicalDevice* m_device;
-        std::unordered_map<std::shared_ptr<Fence>, std::vector<std::shared_ptr<const ReleaseableResource>>>
+        /** Holds the resources per timeline semaphore, sorted by the value they are released at. */
+        std::map<const TimelineSemaphore*, std::multimap<std::uint64_t, std::shared_ptr<const ReleaseableResource>>>
             m_releasableResources;
-        std::vector<std::shared_ptr<Fence>> m_availableFences;
+        /** Protects the resources waiting for submitted work. */
+        std::mutex m_submittedWorkMutex;
+        /** Holds the resources waiting for all work submitted before they were added. */
+        std::vector<std::shared_ptr<const ReleaseableResource>> m_submittedWorkResources;
     };
 }
@@ -30,6 +30,10 @@ namespace vkfw_core::gfx {
 
         void BindBarrier(CommandBuffer& cmdBuffer);
         void Bind(CommandBuffer& cmdBuffer);
+        /** Binds without recording a barrier, e.g., on a worker thread. Call ConsumeBindBarrier on the main thread. */
+        void BindWithoutBarrier(CommandBuffer& cmdBuffer) const;
+        /** Marks a barrier recorded by BindBarrier as used by a bind done with BindWithoutBarrier. */
+        void ConsumeBindBarrier();
 
     private:
         /** Pipeline barrier for using this vertex input resources. */
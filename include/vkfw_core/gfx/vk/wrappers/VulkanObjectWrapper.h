@@ -61,6 +61,14 @@ namespace vkfw_core::gfx {
             CheckSetName(device);
         }
 
+        /** Replaces the handle and returns the old one, e.g., to release it after the device stopped using it. */
+        [[nodiscard]] T ExchangeHandle(vk::Device device, T handle)
+        {
+            auto oldHandle = std::exchange(m_handle, std::move(handle));
+            CheckSetName(device);
+            return oldHandle;
+        }
+
         void SetHandle(vk::Device device, std::string_view name, T handle)
         {
             m_name = name;
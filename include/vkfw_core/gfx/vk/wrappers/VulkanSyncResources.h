@@ -39,4 +39,50 @@ namespace vkfw_core::gfx {
         {
         }
     };
+
+    /**
+     *  A timeline semaphore whose value only increases. Each queue owns one and signals the next value with every
+     *  submit, so the completion of any submit can be checked or waited for by comparing values.
+     */
+    class TimelineSemaphore : public VulkanObjectWrapper<vk::UniqueSemaphore>
+    {
+    public:
+        TimelineSemaphore(vk::Device device, std::string_view name);
+
+        /** Returns the next value to signal (submits to a queue need to be externally synchronized anyway). */
+        [[nodiscard]] std::uint64_t GetNextSignalValue() { return ++m_lastSignalValue; }
+        /** Returns the last value handed out for signaling. */
+        [[nodiscard]] std::uint64_t GetLastSignalValue() const { return m_lastSignalValue; }
+        /** Returns the value the GPU has reached. */
+        [[nodiscard]] std::uint64_t GetCompletedValue(const LogicalDevice* device) const;
+        void Wait(const LogicalDevice* device, std::uint64_t value, std::uint64_t timeout) const;
+
+    private:
+        /** Holds the last value handed out for signaling. */
+        std::uint64_t m_lastSignalValue = 0;
+    };
+
+    /** A value on a timeline semaphore, reached when the submit signaling it (and all before) is finished. */
+    struct TimelinePoint
+    {
+        /** Holds the timeline semaphore (nullptr for a point that is always reached). */
+        const TimelineSemaphore* m_semaphore = nullptr;
+        /** Holds the value. */
+        std::uint64_t m_value = 0;
+
+        [[nodiscard]] bool IsReached(const LogicalDevice* device) const
+        {
+            return m_semaphore == nullptr || m_semaphore->GetCompletedValue(device) >= m_value;
+        }
+        void Wait(const LogicalDevice* device, std::uint64_t timeout) const
+        {
+            if (m_semaphore != nullptr) { m_semaphore->Wait(device, m_value, timeout); }
+        }
+        /** Returns the info to wait for this point in a submit (e.g., to express a dependency on another queue). */
+        [[nodiscard]] vk::SemaphoreSubmitInfoKHR GetWaitInfo(vk::PipelineStageFlags2KHR waitStages) const
+        {
+            assert(m_semaphore != nullptr);
+            return vk::SemaphoreSubmitInfoKHR{m_semaphore->GetHandle(), m_value, waitStages};
+        }
+    };
 }
@@ -9,26 +9,72 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 #include <filesystem>
 
 namespace vkfw_glsl {
 
+    /** Returns the file name of lines like #include "file" or #include <file> and nothing for other lines. */
+    [[nodiscard]] std::optional<std::string> parse_include(std::string_view line);
+    /** Escapes a path for Makefile and Ninja dependency files. */
+    [[nodiscard]] std::string escape_dependency_path(const std::filesystem::path& path);
+    /**
+     *  Returns a Makefile rule making an output file depend on its input file and the files it includes.
+     *  @param output_filename the output file, it is used as given.
+     *  @param input_file the input file, it is made absolute.
+     *  @param dependencies the included files, they are made absolute.
+     */
+    [[nodiscard]] std::string make_dependency_rule(const std::string& output_filename,
+                                                   const std::filesystem::path& input_file,
+                                                   const std::vector<std::filesystem::path>& dependencies);
+
+    /**
+     *  Resolves the includes of GLSL shaders recursively. Each included file is read and processed only once, its
+     *  result is cached by its resolved path. Shaders may be processed from multiple threads at the same time.
+     */
     class shader_processor
     {
     public:
         explicit shader_processor(std::vector<std::filesystem::path> t_file_paths, std::vector<std::string> t_defines = {});
 
         [[nodiscard]] std::string process_shader(const std::filesystem::path& shader_file);
+        /**
+         *  Processes a shader and returns the files it includes directly or indirectly.
+         *  @param shader_file the shader to process.
+         *  @param dependencies the included files, each file is listed once.
+         *  @return the shader with all includes resolved.
+         */
+        [[nodiscard]] std::string process_shader(const std::filesystem::path& shader_file,
+                                                 std::vector<std::filesystem::path>& dependencies);
+
     private:
+        struct processed_file
+        {
+            /** Holds the file content with all includes resolved. */
+            std::string content;
+            /** Holds the files included directly or indirectly. */
+            std::vector<std::filesystem::path> includes;
+        };
+
         [[nodiscard]] std::filesystem::path find_file_location(const std::filesystem::path& parent_path,
                                                                const std::filesystem::path& relative_path);
-        [[nodiscard]] std::string process_shader_recursive(const std::filesystem::path& shader_file,
-                                                           std::size_t& file_id,
-                                             std::size_t recursion_depth);
+        [[nodiscard]] std::shared_ptr<const processed_file>
+        process_shader_recursive(const std::filesystem::path& shader_file, std::size_t recursion_depth);
 
         std::vector<std::filesystem::path> m_file_paths;
         std::vector<std::string> m_defines;
+
+        /** Protects the caches. */
+        std::mutex m_cache_mutex;
+        /** Holds the already resolved include files by their parent path and relative path. */
+        std::unordered_map<std::string, std::filesystem::path> m_file_locations;
+        /** Holds the already processed files by their resolved path. */
+        std::unordered_map<std::string, std::shared_ptr<const processed_file>> m_processed_files;
     };
 
 }
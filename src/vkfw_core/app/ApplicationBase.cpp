@@ -19,6 +19,7 @@
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
+#include <chrono>
 #include <fstream>
 #include <set>
 #include <string_view>
@@ -26,6 +27,11 @@
 #include <glm/common.hpp>
 
 #include "gfx/vk/LogicalDevice.h"
+#include "core/file_watcher.h"
+#include "core/resources/HotReloader.h"
+#include "core/resources/ResourcePathIndex.h"
+#include "core/resources/ShaderCache.h"
+#include "gfx/vk/RuntimeShaderCompiler.h"
 
 VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
 
@@ -88,8 +94,9 @@ namespace vkfw_core {
     }
 
 
-    ApplicationBase::GLFWInitObject::GLFWInitObject() {
-        glfwInit();
+    ApplicationBase::GLFWInitObject::GLFWInitObject() : m_initialized{glfwInit() == GLFW_TRUE}
+    {
+        if (!m_initialized) { spdlog::warn("Could not initialize GLFW, only headless windows can be used."); }
     }
 
     ApplicationBase::GLFWInitObject::~GLFWInitObject()
@@ -263,6 +270,22 @@ namespace vkfw_core {
             (*oa) << cereal::make_nvp("configuration", m_config);
         }
 
+        std::vector<std::string> resourceDirs{m_config.m_resourceBase};
+        resourceDirs.insert(resourceDirs.end(), m_config.m_resourceDirs.begin(), m_config.m_resourceDirs.end());
+        // includes are searched in the shader directories like the build does.
+        std::vector<std::filesystem::path> shaderIncludeDirs;
+        for (const auto& dir : resourceDirs) {
+            if (!dir.empty()) { shaderIncludeDirs.push_back(std::filesystem::path{dir} / "shader"); }
+        }
+        m_resourcePathIndex = std::make_unique<ResourcePathIndex>(std::move(resourceDirs));
+
+        if (!m_config.m_shaderCacheDirectory.empty()) {
+            m_shaderCache = std::make_unique<ShaderCache>(m_config.m_shaderCacheDirectory,
+                                                          m_config.m_shaderCacheBudgetMB * 1024ULL * 1024ULL);
+        }
+        m_runtimeShaderCompiler =
+            std::make_unique<gfx::RuntimeShaderCompiler>(std::move(shaderIncludeDirs), m_shaderCache.get());
+
         bool hasRayTracing = false;
         for (auto& wc : m_config.m_windows) {
             if (wc.m_useRayTracing) hasRayTracing = true;
@@ -278,6 +301,17 @@ namespace vkfw_core {
             m_windows.back().ShowWindow();
             first = false;
         }
+
+        if (m_config.m_hotReload) {
+            std::vector<std::filesystem::path> watchedDirs{m_config.m_resourceBase};
+            for (const auto& dir : m_config.m_resourceDirs) {
+                if (!dir.empty()) { watchedDirs.emplace_back(dir); }
+            }
+            const auto debounce = static_cast<std::chrono::milliseconds::rep>(m_config.m_hotReloadDebounceMs);
+            m_fileWatcher = std::make_unique<FileWatcher>(watchedDirs, std::chrono::milliseconds{debounce});
+            // pipelines register for rebuilds on creation, so this needs to happen before the application creates any.
+            for (auto& window : m_windows) { window.GetDevice().EnableHotReload(); }
+        }
     }
 
     ApplicationBase::~ApplicationBase() noexcept
@@ -392,7 +426,7 @@ namespace vkfw_core {
     {
         m_stopped = false;
         m_pause = false;
-        m_currentTime = glfwGetTime();
+        m_currentTime = GetTime();
     }
 
     bool ApplicationBase::IsRunning() const
@@ -413,10 +447,21 @@ namespace vkfw_core {
             return;
         }
 
-        auto currentTime = glfwGetTime();
+        auto currentTime = GetTime();
         m_elapsedTime = currentTime - m_currentTime;
         m_currentTime = currentTime;
-        glfwPollEvents();
+        if (m_forceGLFWInit.IsInitialized()) { glfwPollEvents(); }
+
+        // no command buffer is recorded here, so reloaded shaders and rebuilt pipelines can be swapped in.
+        if (m_fileWatcher) {
+            const auto changedFiles = m_fileWatcher->GetChangedFiles();
+            if (!changedFiles.empty()) { m_resourcePathIndex->Invalidate(); }
+            for (auto& window : m_windows) {
+                auto* hotReloader = window.GetDevice().GetHotReloader();
+                hotReloader->OnFilesChanged(changedFiles);
+                hotReloader->Update();
+            }
+        }
 
         for (auto& window : m_windows) {
             window.PrepareFrame();
@@ -426,12 +471,18 @@ namespace vkfw_core {
             }
 
             RenderScene(&window);
-            if (IsGUIMode()) { RenderGUI(&window); }
+            if (IsGUIMode() && !window.IsHeadless()) { RenderGUI(&window); }
             window.DrawCurrentCommandBuffer();
             window.SubmitFrame();
         }
     }
 
+    double ApplicationBase::GetTime() const
+    {
+        if (m_forceGLFWInit.IsInitialized()) { return glfwGetTime(); }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
     void ApplicationBase::CheckVKInstanceExtensions(const std::vector<const char*>& enabledExtensions)
     {
         auto extensions = vk::enumerateInstanceExtensionProperties();
@@ -615,6 +666,11 @@ namespace vkfw_core {
                                          const std::vector<std::string>& requiredDeviceExtensions,
                                          void* featuresNextChain, const gfx::Surface& surface) const
     {
+        if (!surface) {
+            return CreateLogicalDevice(windowCfg, requiredDeviceExtensions, featuresNextChain, surface,
+                                       [](const vk::PhysicalDevice&) { return true; });
+        }
+
         auto requestedFormats = cfg::GetVulkanSurfaceFormatsFromConfig(windowCfg);
         std::sort(requestedFormats.begin(), requestedFormats.end(), [](const vk::SurfaceFormatKHR& f0, const vk::SurfaceFormatKHR& f1) { return f0.format < f1.format; });
         auto requestedPresentMode = cfg::GetVulkanPresentModeFromConfig(windowCfg);
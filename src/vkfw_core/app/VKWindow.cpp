@@ -16,6 +16,10 @@
 #include <vulkan/vulkan.hpp>
 #include <gfx/vk/LogicalDevice.h>
 #include "gfx/vk/Framebuffer.h"
+#include "gfx/vk/ParallelCommandRecorder.h"
+#include "gfx/vk/textures/HostTexture.h"
+#include "gfx/vk/pipeline/PipelineCache.h"
+#include "core/resources/TextureManager.h"
 #include "imgui.h"
 #include "core/imgui/imgui_impl_glfw.h"
 #include "core/imgui/imgui_impl_vulkan.h"
@@ -54,6 +58,8 @@ namespace vkfw_core {
         enableVulkan12Features.setRuntimeDescriptorArray(true);
         enableVulkan12Features.setShaderStorageBufferArrayNonUniformIndexing(true);
         enableVulkan12Features.setShaderSampledImageArrayNonUniformIndexing(true);
+        enableVulkan12Features.setHostQueryReset(true);
+        enableVulkan12Features.setTimelineSemaphore(true);
         vk::PhysicalDeviceSynchronization2FeaturesKHR enableSynchronization2FeaturesKHR{true};
         vk::PhysicalDeviceRayTracingPipelineFeaturesKHR enabledRayTracingPipelineFeatures{VK_TRUE};
         vk::PhysicalDeviceAccelerationStructureFeaturesKHR enabledAccelerationStructureFeatures{VK_TRUE};
@@ -94,7 +100,7 @@ namespace vkfw_core {
         enableVulkan12Features.pNext = &enableSynchronization2FeaturesKHR;
 
         this->InitVulkan(reqDeviceExtensions, &enableVulkan12Features);
-        if (useGUI) { InitGUI(); }
+        if (useGUI && !conf.m_headless) { InitGUI(); }
     }
 
     VKWindow::VKWindow(VKWindow&& rhs) noexcept
@@ -108,13 +114,15 @@ namespace vkfw_core {
         , m_mainRenderingRenderPass{std::move(rhs.m_mainRenderingRenderPass)}
         , m_imGuiRenderPass{ std::move(rhs.m_imGuiRenderPass)}
         ,m_swapchainFramebuffers{ std::move(rhs.m_swapchainFramebuffers) },
-        m_commandPools{ std::move(rhs.m_commandPools) },
-        m_commandBuffers{ std::move(rhs.m_commandBuffers) },
-        m_imGuiCommandPools{ std::move(rhs.m_imGuiCommandPools) },
-        m_imGuiCommandBuffers{ std::move(rhs.m_imGuiCommandBuffers) },
-        m_imageAvailableSemaphore{ std::move(rhs.m_imageAvailableSemaphore) },
-        m_renderingFinishedSemaphore{ std::move(rhs.m_renderingFinishedSemaphore) },
+        m_frames{ std::move(rhs.m_frames) },
+        m_commandRecorder{ std::move(rhs.m_commandRecorder) },
+        m_dataAvailableSemaphore{ std::move(rhs.m_dataAvailableSemaphore) },
+        m_renderingFinishedSemaphores{ std::move(rhs.m_renderingFinishedSemaphores) },
         m_currentlyRenderedImage{ rhs.m_currentlyRenderedImage },
+        m_currentFrame{ rhs.m_currentFrame },
+        m_imageAcquired{ rhs.m_imageAcquired },
+        m_lastFrameBegin{ rhs.m_lastFrameBegin },
+        m_frameStatistics{ std::move(rhs.m_frameStatistics) },
         m_imguiDescPool{ std::move(rhs.m_imguiDescPool) },
         m_windowData{ std::move(rhs.m_windowData) },
         m_imguiVulkanData{ std::move(rhs.m_imguiVulkanData) },
@@ -144,13 +152,15 @@ namespace vkfw_core {
             m_mainRenderingRenderPass = std::move(rhs.m_mainRenderingRenderPass);
             m_imGuiRenderPass = std::move(rhs.m_imGuiRenderPass);
             m_swapchainFramebuffers = std::move(rhs.m_swapchainFramebuffers);
-            m_commandPools = std::move(rhs.m_commandPools);
-            m_commandBuffers = std::move(rhs.m_commandBuffers);
-            m_imGuiCommandPools = std::move(rhs.m_imGuiCommandPools);
-            m_imGuiCommandBuffers = std::move(rhs.m_imGuiCommandBuffers);
-            m_imageAvailableSemaphore = std::move(rhs.m_imageAvailableSemaphore);
-            m_renderingFinishedSemaphore = std::move(rhs.m_renderingFinishedSemaphore);
+            m_frames = std::move(rhs.m_frames);
+            m_commandRecorder = std::move(rhs.m_commandRecorder);
+            m_dataAvailableSemaphore = std::move(rhs.m_dataAvailableSemaphore);
+            m_renderingFinishedSemaphores = std::move(rhs.m_renderingFinishedSemaphores);
             m_currentlyRenderedImage = rhs.m_currentlyRenderedImage;
+            m_currentFrame = rhs.m_currentFrame;
+            m_imageAcquired = rhs.m_imageAcquired;
+            m_lastFrameBegin = rhs.m_lastFrameBegin;
+            m_frameStatistics = std::move(rhs.m_frameStatistics);
             m_imguiDescPool = std::move(rhs.m_imguiDescPool);
             m_windowData = std::move(rhs.m_windowData);
             m_imguiVulkanData = std::move(rhs.m_imguiVulkanData);
@@ -181,13 +191,23 @@ namespace vkfw_core {
         m_config->m_windowHeight = m_vkSurfaceExtent.height;
     }
 
-    bool VKWindow::IsClosing() const { return glfwWindowShouldClose(m_window) == GLFW_TRUE; }
+    bool VKWindow::IsClosing() const
+    {
+        // headless windows do not close, the application has to end the run.
+        if (m_window == nullptr) { return false; }
+        return glfwWindowShouldClose(m_window) == GLFW_TRUE;
+    }
 
     /**
      * Initializes the window.
      */
     void VKWindow::InitWindow()
     {
+        if (m_config->m_headless) {
+            spdlog::info("Creating headless window '{}'.", m_config->m_windowTitle);
+            return;
+        }
+
         spdlog::info("Creating window '{}'.", m_config->m_windowTitle);
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
         glfwSetErrorCallback(VKWindow::glfwErrorCallback);
@@ -255,14 +275,20 @@ namespace vkfw_core {
     {
         spdlog::info("Initializing Vulkan surface...");
 
-        // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
-        VkSurfaceKHR surfaceKHR = VK_NULL_HANDLE;
-        auto result = glfwCreateWindowSurface(ApplicationBase::instance().GetVKInstance(), m_window, nullptr, &surfaceKHR);
-        vk::ObjectDestroy<vk::Instance, vk::DispatchLoaderDynamic> deleter(ApplicationBase::instance().GetVKInstance());
-        m_surface = gfx::Surface{nullptr, fmt::format("Win-{} Surface", m_config->m_windowTitle), vk::UniqueSurfaceKHR(vk::SurfaceKHR(surfaceKHR), deleter)};
-        if (result != VK_SUCCESS) {
-            spdlog::critical("Could not create window surface ({}).", vk::to_string(vk::Result(result)));
-            throw std::runtime_error("Could not create window surface.");
+        // headless windows have no surface, so any device with the requested queues can be used.
+        if (!m_config->m_headless) {
+            // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+            VkSurfaceKHR surfaceKHR = VK_NULL_HANDLE;
+            auto result =
+                glfwCreateWindowSurface(ApplicationBase::instance().GetVKInstance(), m_window, nullptr, &surfaceKHR);
+            vk::ObjectDestroy<vk::Instance, vk::DispatchLoaderDynamic> deleter(
+                ApplicationBase::instance().GetVKInstance());
+            m_surface = gfx::Surface{nullptr, fmt::format("Win-{} Surface", m_config->m_windowTitle),
+                                     vk::UniqueSurfaceKHR(vk::SurfaceKHR(surfaceKHR), deleter)};
+            if (result != VK_SUCCESS) {
+                spdlog::critical("Could not create window surface ({}).", vk::to_string(vk::Result(result)));
+                throw std::runtime_error("Could not create window surface.");
+            }
         }
         m_logicalDevice = ApplicationBase::instance().CreateLogicalDevice(*m_config, requiredDeviceExtensions,
                                                                           featuresNextChain, m_surface);
@@ -275,15 +301,12 @@ namespace vkfw_core {
         }
 
         RecreateSwapChain();
+        CreateFrameResources();
 
         vk::SemaphoreCreateInfo semaphoreInfo{ };
-        m_imageAvailableSemaphore = gfx::Semaphore{m_logicalDevice->GetHandle(), "Win-{} ImgAvailSemaphore",
-                                                     m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo)};
-        m_dataAvailableSemaphore = gfx::Semaphore{m_logicalDevice->GetHandle(), "Win-{} DataAvailSemaphore",
-                                                  m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo)};
-        m_renderingFinishedSemaphore = gfx::Semaphore{
-            m_logicalDevice->GetHandle(), fmt::format("Win-{} RenderFinishedSemaphore", m_config->m_windowTitle),
-                           m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo)};
+        m_dataAvailableSemaphore = gfx::Semaphore{
+            m_logicalDevice->GetHandle(), fmt::format("Win-{} DataAvailSemaphore", m_config->m_windowTitle),
+            m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo)};
 
         spdlog::info("Initializing Vulkan surface... done.");
     }
@@ -325,12 +348,13 @@ namespace vkfw_core {
         m_imguiVulkanData->Device = m_logicalDevice->GetHandle();
         m_imguiVulkanData->QueueFamily = m_graphicsQueue;
         m_imguiVulkanData->Queue = m_logicalDevice->GetQueue(m_graphicsQueue, 0).GetHandle();
-        m_imguiVulkanData->PipelineCache = VK_NULL_HANDLE;
+        m_imguiVulkanData->PipelineCache = m_logicalDevice->GetPipelineCache().GetHandle();
         m_imguiVulkanData->DescriptorPool = m_imguiDescPool.GetHandle();
         m_imguiVulkanData->Allocator = nullptr;
         m_imguiVulkanData->CheckVkResultFn = nullptr;
-        m_imguiVulkanData->ImageCount = static_cast<std::uint32_t>(m_imGuiCommandBuffers.size());
-        m_imguiVulkanData->MinImageCount = static_cast<std::uint32_t>(m_imGuiCommandBuffers.size());
+        // ImGui keeps a vertex buffer per image and needs at least 2 of them, one per frame in flight is enough.
+        m_imguiVulkanData->ImageCount = std::max<std::uint32_t>(2, static_cast<std::uint32_t>(m_frames.size()));
+        m_imguiVulkanData->MinImageCount = m_imguiVulkanData->ImageCount;
         m_imguiVulkanData->MSAASamples = VK_SAMPLE_COUNT_1_BIT;
         m_imguiVulkanData->Subpass = 0;
         ImGui_ImplVulkan_Init(m_imguiVulkanData.get(), wd->RenderPass);
@@ -357,15 +381,17 @@ namespace vkfw_core {
         {
             // VkCommandBuffer command_buffer = *m_vkImGuiCommandBuffers[0];
 
-            m_logicalDevice->GetHandle().resetCommandPool(m_imGuiCommandPools[0].GetHandle(), vk::CommandPoolResetFlags());
+            auto& imGuiCommandBuffer = m_frames[0].m_imGuiCommandBuffer;
+            m_logicalDevice->GetHandle().resetCommandPool(m_frames[0].m_commandPool.GetHandle(),
+                                                          vk::CommandPoolResetFlags());
             vk::CommandBufferBeginInfo begin_info{ vk::CommandBufferUsageFlagBits::eOneTimeSubmit };
-            m_imGuiCommandBuffers[0].Begin(begin_info);
+            imGuiCommandBuffer.Begin(begin_info);
 
-            ImGui_ImplVulkan_CreateFontsTexture(m_imGuiCommandBuffers[0].GetHandle());
+            ImGui_ImplVulkan_CreateFontsTexture(imGuiCommandBuffer.GetHandle());
 
-            const vk::CommandBufferSubmitInfoKHR commandBufferSubmitInfo{m_imGuiCommandBuffers[0].GetHandle()};
+            const vk::CommandBufferSubmitInfoKHR commandBufferSubmitInfo{imGuiCommandBuffer.GetHandle()};
             vk::SubmitInfo2KHR end_info{vk::SubmitFlagsKHR{}, nullptr, commandBufferSubmitInfo};
-            m_imGuiCommandBuffers[0].End();
+            imGuiCommandBuffer.End();
 
             const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
             {
@@ -382,6 +408,11 @@ namespace vkfw_core {
 
     void VKWindow::RecreateSwapChain()
     {
+        if (m_config->m_headless) {
+            RecreateOffscreenImages();
+            return;
+        }
+
         int width = 0;
         int height = 0;
         while (width == 0 || height == 0) {
@@ -391,12 +422,6 @@ namespace vkfw_core {
 
         m_logicalDevice->GetHandle().waitIdle();
 
-        m_commandBuffers.clear();
-        m_imGuiCommandBuffers.clear();
-        m_commandPools.clear();
-        m_imGuiCommandPools.clear();
-        m_cmdBufferFences.clear();
-
         DestroySwapchainImages();
 
         // NOLINTNEXTLINE
@@ -477,26 +502,8 @@ namespace vkfw_core {
 
             auto swapchainImages = m_logicalDevice->GetHandle().getSwapchainImagesKHR(m_swapchain.GetHandle());
 
-            auto dsFormat = FindSupportedDepthFormat();
-            auto dsAttachementLayout = gfx::Framebuffer::GetFittingAttachmentLayout(dsFormat.second);
-
-            // TODO: set correct multisampling flags. [11/2/2016 Sebastian Maisch]
-            gfx::FramebufferDescriptor mainRenderingFbDesc;
-            mainRenderingFbDesc.m_attachments.emplace_back(
-                vk::AttachmentLoadOp::eClear, vk::AttachmentStoreOp::eStore, vk::AttachmentLoadOp::eDontCare,
-                vk::AttachmentStoreOp::eDontCare, vk::ImageLayout::eColorAttachmentOptimal,
-                vk::ImageLayout::eColorAttachmentOptimal,
-                m_config->m_backbufferBits / 8, surfaceFormat.format, vk::SampleCountFlagBits::e1);
-
-            if (m_config->m_useRayTracing) {
-                mainRenderingFbDesc.m_attachments.back().m_tex.m_imageUsage |= vk::ImageUsageFlagBits::eTransferDst;
-            }
-
-            mainRenderingFbDesc.m_attachments.emplace_back(
-                vk::AttachmentLoadOp::eClear, vk::AttachmentStoreOp::eDontCare, vk::AttachmentLoadOp::eClear,
-                vk::AttachmentStoreOp::eDontCare, dsAttachementLayout, dsAttachementLayout,
-                gfx::TextureDescriptor::DepthBufferTextureDesc(dsFormat.first, dsFormat.second,
-                                                               vk::SampleCountFlagBits::e1));
+            auto mainRenderingFbDesc = CreateMainRenderingDescriptor(surfaceFormat.format);
+            auto dsAttachementLayout = mainRenderingFbDesc.m_attachments[1].m_initialLayout;
             m_mainRenderingRenderPass.Create(m_logicalDevice->GetHandle(), mainRenderingFbDesc);
             m_swapchainFramebuffers.reserve(swapchainImages.size());
 
@@ -513,57 +520,141 @@ namespace vkfw_core {
             m_imGuiRenderPass.Create(m_logicalDevice->GetHandle(), imGuiFbDesc);
             m_windowData->RenderPass = m_imGuiRenderPass.GetHandle();
 
-            m_commandPools.resize(swapchainImages.size());
-            m_imGuiCommandPools.resize(swapchainImages.size());
-            m_commandBuffers.reserve(swapchainImages.size());
-            m_imGuiCommandBuffers.reserve(swapchainImages.size());
-            m_cmdBufferFences.resize(swapchainImages.size());
-
-            vk::CommandPoolCreateInfo poolInfo{vk::CommandPoolCreateFlags(),
-                                               m_logicalDevice->GetQueueInfo(m_graphicsQueue).m_familyIndex};
-            vk::FenceCreateInfo fenceCreateInfo{vk::FenceCreateFlagBits::eSignaled};
-
             for (std::size_t i = 0; i < swapchainImages.size(); ++i) {
                 std::vector<vk::Image> attachments{swapchainImages[i]};
                 m_swapchainFramebuffers.emplace_back(m_logicalDevice.get(),
                                                      fmt::format("Win-{} SwapchainFBO{}", m_config->m_windowTitle, i),
                                                      glm::uvec2(m_vkSurfaceExtent.width, m_vkSurfaceExtent.height),
                                                      attachments, m_mainRenderingRenderPass, mainRenderingFbDesc);
+            }
+
+            CreateRenderingFinishedSemaphores(swapchainImages.size());
+        }
+    }
+
+    void VKWindow::RecreateOffscreenImages()
+    {
+        m_logicalDevice->GetHandle().waitIdle();
+
+        DestroySwapchainImages();
+
+        // the first configured format is used as no surface restricts the choice.
+        auto colorFormat = cfg::GetVulkanSurfaceFormatsFromConfig(*m_config)[0].format;
+        m_vkSurfaceExtent = vk::Extent2D{static_cast<std::uint32_t>(m_config->m_windowWidth),
+                                         static_cast<std::uint32_t>(m_config->m_windowHeight)};
+        // use as many images as a swapchain would usually have to keep the frame structure, but at least one per frame
+        // in flight as the images are used round robin and may not be rendered to while an earlier frame uses them.
+        auto imageCount = std::max<std::size_t>(2 + cfg::GetVulkanAdditionalImageCountFromConfig(*m_config),
+                                                m_config->m_framesInFlight);
+
+        auto mainRenderingFbDesc = CreateMainRenderingDescriptor(colorFormat);
+        // the color images are owned by the frame buffers and can be copied for read back.
+        mainRenderingFbDesc.m_attachments[0].m_tex.m_imageUsage |=
+            vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc;
+        m_mainRenderingRenderPass.Create(m_logicalDevice->GetHandle(), mainRenderingFbDesc);
+
+        m_swapchainFramebuffers.reserve(imageCount);
+        for (std::size_t i = 0; i < imageCount; ++i) {
+            m_swapchainFramebuffers.emplace_back(m_logicalDevice.get(),
+                                                 fmt::format("Win-{} OffscreenFBO{}", m_config->m_windowTitle, i),
+                                                 glm::uvec2(m_vkSurfaceExtent.width, m_vkSurfaceExtent.height),
+                                                 m_mainRenderingRenderPass, mainRenderingFbDesc);
+        }
 
-                m_commandPools[i] = gfx::CommandPool{
-                    m_logicalDevice->GetHandle(), fmt::format("Win-{} CommandPool{}", m_config->m_windowTitle, i),
-                    m_graphicsQueue, m_logicalDevice->GetHandle().createCommandPoolUnique(poolInfo)};
-                m_imGuiCommandPools[i] = gfx::CommandPool{
-                    m_logicalDevice->GetHandle(), fmt::format("Win-{} ImGuiCommandPool{}", m_config->m_windowTitle, i),
-                    m_graphicsQueue, m_logicalDevice->GetHandle().createCommandPoolUnique(poolInfo)};
-
-                vk::CommandBufferAllocateInfo allocInfo{m_commandPools[i].GetHandle(), vk::CommandBufferLevel::ePrimary,
-                                                        1};
-                vk::CommandBufferAllocateInfo imgui_allocInfo{m_imGuiCommandPools[i].GetHandle(),
-                                                              vk::CommandBufferLevel::ePrimary, 1};
-
-                try {
-                    m_commandBuffers.emplace_back(
-                        m_logicalDevice.get(), fmt::format("Win-{} CommandBuffer{}", m_config->m_windowTitle, i),
-                        m_graphicsQueue,
-                        std::move(m_logicalDevice->GetHandle().allocateCommandBuffersUnique(allocInfo)[0]));
-                    m_imGuiCommandBuffers.emplace_back(
-                        m_logicalDevice.get(), fmt::format("Win-{} ImGuiCommandBuffer{}", m_config->m_windowTitle, i),
-                        m_graphicsQueue,
-                        std::move(m_logicalDevice->GetHandle().allocateCommandBuffersUnique(imgui_allocInfo)[0]));
-                } catch (vk::SystemError& e) {
-                    spdlog::critical("Could not allocate command buffers ({}).", e.what());
-                    throw std::runtime_error("Could not allocate command buffers.");
-                }
-
-                m_cmdBufferFences[i] =
-                    gfx::Fence{m_logicalDevice->GetHandle(),
-                               fmt::format("Win-{} CommandBufferFence{}", m_config->m_windowTitle, i),
-                               m_logicalDevice->GetHandle().createFenceUnique(fenceCreateInfo)};
+        CreateRenderingFinishedSemaphores(imageCount);
+    }
+
+    gfx::FramebufferDescriptor VKWindow::CreateMainRenderingDescriptor(vk::Format colorFormat) const
+    {
+        auto dsFormat = FindSupportedDepthFormat();
+        auto dsAttachementLayout = gfx::Framebuffer::GetFittingAttachmentLayout(dsFormat.second);
+
+        // TODO: set correct multisampling flags. [11/2/2016 Sebastian Maisch]
+        gfx::FramebufferDescriptor mainRenderingFbDesc;
+        mainRenderingFbDesc.m_attachments.emplace_back(
+            vk::AttachmentLoadOp::eClear, vk::AttachmentStoreOp::eStore, vk::AttachmentLoadOp::eDontCare,
+            vk::AttachmentStoreOp::eDontCare, vk::ImageLayout::eColorAttachmentOptimal,
+            vk::ImageLayout::eColorAttachmentOptimal,
+            m_config->m_backbufferBits / 8, colorFormat, vk::SampleCountFlagBits::e1);
+
+        if (m_config->m_useRayTracing) {
+            mainRenderingFbDesc.m_attachments.back().m_tex.m_imageUsage |= vk::ImageUsageFlagBits::eTransferDst;
+        }
+
+        mainRenderingFbDesc.m_attachments.emplace_back(
+            vk::AttachmentLoadOp::eClear, vk::AttachmentStoreOp::eDontCare, vk::AttachmentLoadOp::eClear,
+            vk::AttachmentStoreOp::eDontCare, dsAttachementLayout, dsAttachementLayout,
+            gfx::TextureDescriptor::DepthBufferTextureDesc(dsFormat.first, dsFormat.second,
+                                                           vk::SampleCountFlagBits::e1));
+        return mainRenderingFbDesc;
+    }
+
+    void VKWindow::CreateFrameResources()
+    {
+        const auto numFrames = std::max<std::size_t>(1, m_config->m_framesInFlight);
+        vk::CommandPoolCreateInfo poolInfo{vk::CommandPoolCreateFlags(),
+                                           m_logicalDevice->GetQueueInfo(m_graphicsQueue).m_familyIndex};
+        vk::SemaphoreCreateInfo semaphoreInfo{};
+
+        m_frames.clear();
+        m_frames.reserve(numFrames);
+        for (std::size_t i = 0; i < numFrames; ++i) {
+            gfx::CommandPool commandPool{
+                m_logicalDevice->GetHandle(), fmt::format("Win-{} CommandPool{}", m_config->m_windowTitle, i),
+                m_graphicsQueue, m_logicalDevice->GetHandle().createCommandPoolUnique(poolInfo)};
+
+            vk::CommandBufferAllocateInfo allocInfo{commandPool.GetHandle(), vk::CommandBufferLevel::ePrimary, 2};
+            std::vector<vk::UniqueCommandBuffer> commandBuffers;
+            try {
+                commandBuffers = m_logicalDevice->GetHandle().allocateCommandBuffersUnique(allocInfo);
+            } catch (vk::SystemError& e) {
+                spdlog::critical("Could not allocate command buffers ({}).", e.what());
+                throw std::runtime_error("Could not allocate command buffers.");
             }
+
+            m_frames.emplace_back(FrameResources{
+                std::move(commandPool),
+                gfx::CommandBuffer{m_logicalDevice.get(),
+                                   fmt::format("Win-{} CommandBuffer{}", m_config->m_windowTitle, i),
+                                   m_graphicsQueue, std::move(commandBuffers[0])},
+                gfx::CommandBuffer{m_logicalDevice.get(),
+                                   fmt::format("Win-{} ImGuiCommandBuffer{}", m_config->m_windowTitle, i),
+                                   m_graphicsQueue, std::move(commandBuffers[1])},
+                gfx::Semaphore{m_logicalDevice->GetHandle(),
+                               fmt::format("Win-{} ImgAvailSemaphore{}", m_config->m_windowTitle, i),
+                               m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo)}});
+        }
+        m_currentFrame = 0;
+
+        m_commandRecorder.reset();
+        if (auto numThreads = ApplicationBase::instance().GetConfig().m_recordingThreads; numThreads > 1) {
+            m_commandRecorder = std::make_unique<gfx::ParallelCommandRecorder>(
+                m_logicalDevice.get(), fmt::format("Win-{} Recorder", m_config->m_windowTitle), m_graphicsQueue,
+                numThreads, numFrames);
         }
     }
 
+    void VKWindow::CreateRenderingFinishedSemaphores(std::size_t numImages)
+    {
+        // presenting an image waits for its semaphore, so it may only be reused once the image is acquired again.
+        vk::SemaphoreCreateInfo semaphoreInfo{};
+        m_renderingFinishedSemaphores.clear();
+        m_renderingFinishedSemaphores.reserve(numImages);
+        for (std::size_t i = 0; i < numImages; ++i) {
+            m_renderingFinishedSemaphores.emplace_back(
+                m_logicalDevice->GetHandle(),
+                fmt::format("Win-{} RenderFinishedSemaphore{}", m_config->m_windowTitle, i),
+                m_logicalDevice->GetHandle().createSemaphoreUnique(semaphoreInfo));
+        }
+    }
+
+    void VKWindow::WaitForFrame(const FrameResources& frame)
+    {
+        // a frame slot that was never submitted has an empty timeline point which is always reached.
+        if (frame.m_finishPoint.IsReached(m_logicalDevice.get())) { return; }
+        frame.m_finishPoint.Wait(m_logicalDevice.get(), defaultFenceTimeout);
+    }
+
     void VKWindow::DestroySwapchainImages()
     {
         m_swapchainFramebuffers.clear();
@@ -573,22 +664,20 @@ namespace vkfw_core {
     {
         m_logicalDevice->GetHandle().waitIdle();
 
-        ImGui_ImplVulkan_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
-        ImGui::DestroyContext();
+        if (!m_config->m_headless) {
+            ImGui_ImplVulkan_Shutdown();
+            ImGui_ImplGlfw_Shutdown();
+            ImGui::DestroyContext();
+        }
 
-        m_cmdBufferFences.clear();
-        m_imageAvailableSemaphore = gfx::Semaphore{};
+        m_commandRecorder.reset();
+        m_frames.clear();
         m_dataAvailableSemaphore = gfx::Semaphore{};
-        m_renderingFinishedSemaphore = gfx::Semaphore{};
-        m_commandBuffers.clear();
-        m_imGuiCommandBuffers.clear();
-        m_commandPools.clear();
+        m_renderingFinishedSemaphores.clear();
 
         m_mainRenderingRenderPass = gfx::RenderPass{};
         m_imGuiRenderPass = gfx::RenderPass{};
         m_imguiDescPool = gfx::DescriptorPool{};
-        m_imGuiCommandPools.clear();
 
         DestroySwapchainImages();
         m_swapchain = gfx::Swapchain{};
@@ -630,13 +719,16 @@ namespace vkfw_core {
      */
     void VKWindow::ShowWindow() const
     {
-        glfwShowWindow(m_window);
+        if (m_window != nullptr) { glfwShowWindow(m_window); }
     }
 
     /**
      *  Closes the window.
      */
-    void VKWindow::CloseWindow() const { glfwSetWindowShouldClose(m_window, GLFW_TRUE); }
+    void VKWindow::CloseWindow() const
+    {
+        if (m_window != nullptr) { glfwSetWindowShouldClose(m_window, GLFW_TRUE); }
+    }
 
     void VKWindow::ReleaseWindow()
     {
@@ -646,17 +738,56 @@ namespace vkfw_core {
 
     void VKWindow::PrepareFrame()
     {
+        constexpr auto ToMilliseconds = [](std::chrono::steady_clock::duration duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        };
+
+        m_currentFrame = static_cast<std::size_t>(m_frameCount % m_frames.size());
+        auto& frame = m_frames[m_currentFrame];
+
+        // the CPU is at most m_frames.size() frames ahead of the GPU, the slot is free when its last frame finished.
+        const auto waitBegin = std::chrono::steady_clock::now();
+        WaitForFrame(frame);
+        const auto waitEnd = std::chrono::steady_clock::now();
+        if (frame.m_pendingTiming) {
+            m_frameStatistics.AddFrame(FrameTiming{frame.m_frameTime, ToMilliseconds(waitEnd - waitBegin),
+                                                   ToMilliseconds(waitEnd - frame.m_beginTime)});
+            frame.m_pendingTiming = false;
+        }
+
+        // textures decoded in the background are uploaded at the start of a frame, before it is recorded.
+        m_logicalDevice->GetTextureManager()->UploadLoadedTextures(m_logicalDevice->GetQueue(m_graphicsQueue, 0));
+
+        frame.m_frameResources.clear();
+        frame.m_recorded = false;
+        m_logicalDevice->GetHandle().resetCommandPool(frame.m_commandPool.GetHandle(), vk::CommandPoolResetFlags());
+        frame.m_frameTime = m_lastFrameBegin == std::chrono::steady_clock::time_point{}
+                                ? 0.0
+                                : ToMilliseconds(waitBegin - m_lastFrameBegin);
+        frame.m_beginTime = waitBegin;
+        m_lastFrameBegin = waitBegin;
+
+        if (m_config->m_headless) {
+            // no image to acquire, the frame buffers are used round robin.
+            m_currentlyRenderedImage = static_cast<std::uint32_t>(m_frameCount % m_swapchainFramebuffers.size());
+            m_imageAcquired = true;
+            return;
+        }
+
         auto result = m_logicalDevice->GetHandle().acquireNextImageKHR(
-            m_swapchain.GetHandle(), std::numeric_limits<std::uint64_t>::max(), m_imageAvailableSemaphore.GetHandle(), vk::Fence());
+            m_swapchain.GetHandle(), std::numeric_limits<std::uint64_t>::max(),
+            frame.m_imageAvailableSemaphore.GetHandle(), vk::Fence());
         m_currentlyRenderedImage = result.value;
+        m_imageAcquired = true;
 
         // NOLINTNEXTLINE
         if (result.result == vk::Result::eErrorOutOfDateKHR) {
             // NOLINTNEXTLINE
             RecreateSwapChain();
-            return;
-        }
-        if (result.result != vk::Result::eSuccess && result.result != vk::Result::eSuboptimalKHR) {
+            // the frame is dropped, its semaphore was not signaled.
+            m_currentlyRenderedImage = 0;
+            m_imageAcquired = false;
+        } else if (result.result != vk::Result::eSuccess && result.result != vk::Result::eSuboptimalKHR) {
             spdlog::critical("Could not acquire swap chain image ({}).", vk::to_string(result.result));
             throw std::runtime_error("Could not acquire swap chain image.");
         }
@@ -671,78 +802,120 @@ namespace vkfw_core {
 
     void VKWindow::DrawCurrentCommandBuffer()
     {
-        {
-            auto syncResult =
-                m_logicalDevice->GetHandle().getFenceStatus(m_cmdBufferFences[m_currentlyRenderedImage].GetHandle());
-            while (syncResult == vk::Result::eTimeout || syncResult == vk::Result::eNotReady) {
-                syncResult = m_logicalDevice->GetHandle().waitForFences(
-                    m_cmdBufferFences[m_currentlyRenderedImage].GetHandle(), VK_TRUE, defaultFenceTimeout);
-            }
-
-            if (syncResult != vk::Result::eSuccess) {
-                spdlog::critical("Error synchronizing command buffer. ({}).", vk::to_string(syncResult));
-                throw std::runtime_error("Error synchronizing command buffer.");
-            }
+        auto& frame = m_frames[m_currentFrame];
+        if (!m_imageAcquired) {
+            if (ApplicationBase::instance().IsGUIMode()) { ImGui::EndFrame(); }
+            return;
+        }
 
-            m_logicalDevice->GetHandle().resetFences(m_cmdBufferFences[m_currentlyRenderedImage].GetHandle());
+        if (!frame.m_recorded) {
+            RecordCommandBuffer([this](gfx::CommandBuffer&, std::size_t imageIndex) {
+                BeginSwapchainRenderPass(imageIndex, {}, {});
+                EndSwapchainRenderPass(imageIndex);
+            });
         }
 
         // Rendering
-        if (ApplicationBase::instance().IsGUIMode()) {
+        if (ApplicationBase::instance().IsGUIMode() && !m_config->m_headless) {
             ImGui::Render();
 
             {
-                m_logicalDevice->GetHandle().resetCommandPool(m_imGuiCommandPools[m_currentlyRenderedImage].GetHandle(),
-                                                              vk::CommandPoolResetFlags());
+                // the command pool of the frame was reset in PrepareFrame.
                 vk::CommandBufferBeginInfo cmdBufferBeginInfo{ vk::CommandBufferUsageFlagBits::eOneTimeSubmit };
-                m_imGuiCommandBuffers[m_currentlyRenderedImage].Begin(cmdBufferBeginInfo);
+                frame.m_imGuiCommandBuffer.Begin(cmdBufferBeginInfo);
             }
 
             m_swapchainFramebuffers[m_currentlyRenderedImage].BeginRenderPass(
-                m_imGuiCommandBuffers[m_currentlyRenderedImage], m_imGuiRenderPass, {}, {},
+                frame.m_imGuiCommandBuffer, m_imGuiRenderPass, {}, {},
                 vk::Rect2D(vk::Offset2D(0, 0), m_vkSurfaceExtent), {}, vk::SubpassContents::eInline);
 
             // Record ImGui Draw Data and draw funcs into command buffer
-            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), m_imGuiCommandBuffers[m_currentlyRenderedImage].GetHandle());
+            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), frame.m_imGuiCommandBuffer.GetHandle());
 
-            m_imGuiCommandBuffers[m_currentlyRenderedImage].GetHandle().endRenderPass();
-            m_imGuiCommandBuffers[m_currentlyRenderedImage].End();
+            frame.m_imGuiCommandBuffer.GetHandle().endRenderPass();
+            frame.m_imGuiCommandBuffer.End();
         }
 
-        // We use binary semaphores there so value can be 0. Change this for timeline semaphores.
+        frame.m_pendingTiming = true;
+
+        if (m_config->m_headless) {
+            // nothing is acquired or presented, the data is only waited for if the application signals it.
+            const vk::SemaphoreSubmitInfoKHR dataAvailableSemaphoreSubmit{m_dataAvailableSemaphore.GetHandle(), 0,
+                                                                          vk::PipelineStageFlagBits2KHR::eTopOfPipe};
+            const auto waitSemaphores = m_config->m_headlessWaitsForData
+                                            ? std::span{&dataAvailableSemaphoreSubmit, 1}
+                                            : std::span<const vk::SemaphoreSubmitInfoKHR>{};
+            const vk::CommandBufferSubmitInfoKHR submitCmdBuffer{frame.m_commandBuffer.GetHandle()};
+            vk::SubmitInfo2KHR submitInfo{vk::SubmitFlagBitsKHR{}, waitSemaphores, submitCmdBuffer};
+
+            const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
+            QUEUE_REGION(graphicsQueue, "Draw");
+            frame.m_finishPoint = graphicsQueue.Submit(submitInfo);
+            return;
+        }
+
+        // the window system semaphores are binary, so their values are ignored.
         std::array<vk::SemaphoreSubmitInfoKHR, 2> waitSemaphores{
-            vk::SemaphoreSubmitInfoKHR{m_imageAvailableSemaphore.GetHandle(), 0,
+            vk::SemaphoreSubmitInfoKHR{frame.m_imageAvailableSemaphore.GetHandle(), 0,
                                        vk::PipelineStageFlagBits2KHR::eColorAttachmentOutput},
             vk::SemaphoreSubmitInfoKHR{m_dataAvailableSemaphore.GetHandle(), 0,
                                        vk::PipelineStageFlagBits2KHR::eTopOfPipe}};
         std::array<const vk::CommandBufferSubmitInfoKHR, 2> submitCmdBuffers{
-            m_commandBuffers[m_currentlyRenderedImage].GetHandle(),
-            m_imGuiCommandBuffers[m_currentlyRenderedImage].GetHandle()};
-        const vk::SemaphoreSubmitInfoKHR renderingFinishedSemaphoreSubmit{m_renderingFinishedSemaphore.GetHandle(), 0,
-                                                                          vk::PipelineStageFlagBits2KHR::eBottomOfPipe};
-        vk::SubmitInfo2KHR submitInfo{vk::SubmitFlagBitsKHR{}, waitSemaphores, submitCmdBuffers,
+            frame.m_commandBuffer.GetHandle(), frame.m_imGuiCommandBuffer.GetHandle()};
+        const vk::SemaphoreSubmitInfoKHR renderingFinishedSemaphoreSubmit{
+            m_renderingFinishedSemaphores[m_currentlyRenderedImage].GetHandle(), 0,
+            vk::PipelineStageFlagBits2KHR::eBottomOfPipe};
+        // without GUI the ImGui command buffer is not recorded.
+        const auto numCmdBuffers = ApplicationBase::instance().IsGUIMode() ? submitCmdBuffers.size() : 1;
+        const auto recordedCmdBuffers = std::span{submitCmdBuffers}.first(numCmdBuffers);
+        vk::SubmitInfo2KHR submitInfo{vk::SubmitFlagBitsKHR{}, waitSemaphores, recordedCmdBuffers,
                                       renderingFinishedSemaphoreSubmit};
 
         const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
         {
             QUEUE_REGION(graphicsQueue, "Draw");
-            graphicsQueue.Submit(submitInfo, &m_cmdBufferFences[m_currentlyRenderedImage]);
+            frame.m_finishPoint = graphicsQueue.Submit(submitInfo);
         }
     }
 
     void VKWindow::SubmitFrame()
     {
-        const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
-        QUEUE_REGION(graphicsQueue, "Present");
-        std::array<vk::Semaphore, 1> semaphores = {m_renderingFinishedSemaphore.GetHandle()};
-        std::array<vk::SwapchainKHR, 1> swapchains = {m_swapchain.GetHandle()};
-        vk::PresentInfoKHR presentInfo{semaphores, swapchains, m_currentlyRenderedImage}; //<- wait on these semaphores
-        auto result = m_logicalDevice->GetQueue(m_graphicsQueue, 0).Present(presentInfo);
-
-        if (result == vk::Result::eErrorOutOfDateKHR || result == vk::Result::eSuboptimalKHR || m_frameBufferResize) {
-            m_frameBufferResize = false;
-            RecreateSwapChain();
+        if (m_config->m_headless) {
+            if (m_frameBufferResize) {
+                m_frameBufferResize = false;
+                RecreateSwapChain();
+                ApplicationBase::instance().OnResize(static_cast<int>(m_config->m_windowWidth),
+                                                     static_cast<int>(m_config->m_windowHeight), this);
+            }
+
+            m_logicalDevice->GetResourceReleaser().TryRelease();
+            ++m_frameCount;
+            return;
+        }
 
+        // if no image was acquired the swap chain was already recreated in PrepareFrame.
+        auto swapchainRecreated = !m_imageAcquired;
+        if (m_imageAcquired) {
+            const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
+            QUEUE_REGION(graphicsQueue, "Present");
+            std::array<vk::Semaphore, 1> semaphores = {
+                m_renderingFinishedSemaphores[m_currentlyRenderedImage].GetHandle()};
+            std::array<vk::SwapchainKHR, 1> swapchains = {m_swapchain.GetHandle()};
+            vk::PresentInfoKHR presentInfo{semaphores, swapchains, m_currentlyRenderedImage}; //<- wait on these semaphores
+            auto result = m_logicalDevice->GetQueue(m_graphicsQueue, 0).Present(presentInfo);
+
+            if (result == vk::Result::eErrorOutOfDateKHR || result == vk::Result::eSuboptimalKHR
+                || m_frameBufferResize) {
+                m_frameBufferResize = false;
+                RecreateSwapChain();
+                swapchainRecreated = true;
+            } else if (result != vk::Result::eSuccess) {
+                spdlog::critical("Could not present swap chain image ({}).", vk::to_string(result));
+                throw std::runtime_error("Could not present swap chain image.");
+            }
+        }
+
+        if (swapchainRecreated) {
             try {
                 // TODO: notify all resources depending on this...
                 ApplicationBase::instance().OnResize(static_cast<int>(m_config->m_windowWidth),
@@ -751,9 +924,6 @@ namespace vkfw_core {
                 spdlog::critical("Could not reacquire resources after resize: {}", e.what());
                 throw std::runtime_error("Could not reacquire resources after resize.");
             }
-        } else if (result != vk::Result::eSuccess) {
-            spdlog::critical("Could not present swap chain image ({}).", vk::to_string(result));
-            throw std::runtime_error("Could not present swap chain image.");
         }
 
         m_logicalDevice->GetResourceReleaser().TryRelease();
@@ -761,47 +931,87 @@ namespace vkfw_core {
         ++m_frameCount;
     }
 
-    void VKWindow::UpdatePrimaryCommandBuffers(
-        const function_view<void(gfx::CommandBuffer& commandBuffer, std::size_t cmdBufferIndex)>& fillFunc)
+    void VKWindow::RecordCommandBuffer(
+        const function_view<void(gfx::CommandBuffer& commandBuffer, std::size_t imageIndex)>& fillFunc)
     {
-        for (std::size_t i = 0U; i < m_commandBuffers.size(); ++i) {
-            {
-                auto syncResult = vk::Result::eTimeout;
-                while (syncResult == vk::Result::eTimeout) {
-                    syncResult = m_logicalDevice->GetHandle().waitForFences(m_cmdBufferFences[i].GetHandle(), VK_TRUE,
-                                                                            defaultFenceTimeout);
-                }
-
-                if (syncResult != vk::Result::eSuccess) {
-                    spdlog::critical("Error synchronizing command buffers. ({}).", vk::to_string(syncResult));
-                    throw std::runtime_error("Error synchronizing command buffers.");
-                }
-            }
-
-            m_logicalDevice->GetHandle().resetCommandPool(m_commandPools[i].GetHandle(), vk::CommandPoolResetFlags());
-
-            vk::CommandBufferBeginInfo cmdBufferBeginInfo{ vk::CommandBufferUsageFlagBits::eSimultaneousUse };
-            m_commandBuffers[i].Begin(cmdBufferBeginInfo);
-
-            fillFunc(m_commandBuffers[i], i);
-
-            m_commandBuffers[i].End();
-        }
+        auto& frame = m_frames[m_currentFrame];
+        assert(!frame.m_recorded && "The command buffer can only be recorded once per frame.");
+
+        vk::CommandBufferBeginInfo cmdBufferBeginInfo{vk::CommandBufferUsageFlagBits::eOneTimeSubmit};
+        frame.m_commandBuffer.Begin(cmdBufferBeginInfo);
+        fillFunc(frame.m_commandBuffer, m_currentlyRenderedImage);
+        frame.m_commandBuffer.End();
+        frame.m_recorded = true;
     }
 
-    void VKWindow::BeginSwapchainRenderPass(std::size_t cmdBufferIndex, std::span<gfx::DescriptorSet*> descriptorSets, std::span<gfx::VertexInputResources*> vertexInputs)
+    void VKWindow::BeginSwapchainRenderPass(std::size_t imageIndex, std::span<gfx::DescriptorSet*> descriptorSets,
+                                            std::span<gfx::VertexInputResources*> vertexInputs,
+                                            vk::SubpassContents subpassContents)
     {
         std::array<vk::ClearValue, 2> clearColor;
         clearColor[0].setColor(vk::ClearColorValue{std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f}});
         clearColor[1].setDepthStencil(vk::ClearDepthStencilValue{1.0f, 0});
-        m_swapchainFramebuffers[cmdBufferIndex].BeginRenderPass(
-            m_commandBuffers[cmdBufferIndex], m_mainRenderingRenderPass, descriptorSets, vertexInputs,
-            vk::Rect2D(vk::Offset2D(0, 0), m_vkSurfaceExtent), clearColor, vk::SubpassContents::eInline);
+        m_swapchainFramebuffers[imageIndex].BeginRenderPass(
+            m_frames[m_currentFrame].m_commandBuffer, m_mainRenderingRenderPass, descriptorSets, vertexInputs,
+            vk::Rect2D(vk::Offset2D(0, 0), m_vkSurfaceExtent), clearColor, subpassContents);
+    }
+
+    vk::CommandBufferInheritanceInfo VKWindow::GetSwapchainInheritanceInfo(std::size_t imageIndex) const
+    {
+        return vk::CommandBufferInheritanceInfo{m_mainRenderingRenderPass.GetHandle(), 0,
+                                                m_swapchainFramebuffers[imageIndex].GetHandle()};
     }
 
-    void VKWindow::EndSwapchainRenderPass(std::size_t cmdBufferIndex) const
+    void VKWindow::EndSwapchainRenderPass(std::size_t) const
     {
-        m_commandBuffers[cmdBufferIndex].GetHandle().endRenderPass();
+        m_frames[m_currentFrame].m_commandBuffer.GetHandle().endRenderPass();
+    }
+
+    void VKWindow::AddFrameResource(std::shared_ptr<void> resource)
+    {
+        m_frames[m_currentFrame].m_frameResources.emplace_back(std::move(resource));
+    }
+
+    std::vector<std::uint8_t> VKWindow::ReadbackImage(std::size_t imageIndex)
+    {
+        if (!m_config->m_headless) {
+            spdlog::error("Reading back images is only supported for headless windows.");
+            throw std::runtime_error("Reading back images is only supported for headless windows.");
+        }
+
+        // the image may have been rendered by any frame in flight.
+        for (const auto& frame : m_frames) { frame.m_finishPoint.Wait(m_logicalDevice.get(), defaultFenceTimeout); }
+
+        auto& colorTexture = m_swapchainFramebuffers[imageIndex].GetTexture(0);
+        const auto colorFormat = colorTexture.GetDescriptor().m_format;
+        gfx::HostTexture readbackTexture{
+            m_logicalDevice.get(), fmt::format("Win-{} ReadbackTexture{}", m_config->m_windowTitle, imageIndex),
+            gfx::TextureDescriptor{gfx::TextureDescriptor::StagingTextureDesc(colorTexture.GetDescriptor()),
+                                   vk::ImageUsageFlagBits::eTransferDst},
+            vk::ImageLayout::eUndefined};
+        readbackTexture.InitializeImage(colorTexture.GetPixelSize(), 1);
+
+        const auto& graphicsQueue = m_logicalDevice->GetQueue(m_graphicsQueue, 0);
+        auto cmdBuffer = gfx::CommandBuffer::beginSingleTimeSubmit(
+            m_logicalDevice.get(), fmt::format("Win-{} ReadbackCmdBuffer", m_config->m_windowTitle), "Readback",
+            m_logicalDevice->GetCommandPool(m_graphicsQueue));
+        colorTexture.CopyImageAsync(0, glm::u32vec4(0), readbackTexture, 0, glm::u32vec4(0), colorTexture.GetSize(),
+                                    cmdBuffer);
+
+        // the frame buffer expects the attachment layout at the beginning of the next render pass.
+        gfx::PipelineBarrier barrier{m_logicalDevice.get()};
+        colorTexture.AccessBarrier(gfx::Framebuffer::GetFittingAttachmentAccessFlags(colorFormat),
+                                   gfx::Framebuffer::GetFittingAttachmentPipelineStage(colorFormat),
+                                   gfx::Framebuffer::GetFittingAttachmentLayout(colorFormat), barrier);
+        readbackTexture.AccessBarrier(vk::AccessFlagBits2KHR::eHostRead, vk::PipelineStageFlagBits2KHR::eHost,
+                                      vk::ImageLayout::eGeneral, barrier);
+        barrier.Record(cmdBuffer);
+        gfx::CommandBuffer::endSingleTimeSubmitAndWait(m_logicalDevice.get(), graphicsQueue, cmdBuffer);
+
+        const auto& size = readbackTexture.GetSize();
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y));
+        readbackTexture.DownloadData(0, 0, glm::u32vec3(size.x, size.y, 1), pixels.data());
+        return pixels;
     }
 
     /**
@@ -815,11 +1025,14 @@ namespace vkfw_core {
         return MessageBoxA(glfwGetWin32Window(m_window), content.c_str(), title.c_str(), MB_YESNO) == IDYES;
     }
 
-    bool VKWindow::IsMouseButtonPressed(int button) const { return glfwGetMouseButton(m_window, button) == GLFW_PRESS; }
+    bool VKWindow::IsMouseButtonPressed(int button) const
+    {
+        return m_window != nullptr && glfwGetMouseButton(m_window, button) == GLFW_PRESS;
+    }
 
     bool VKWindow::IsKeyPressed(int key) const
     {
-        return glfwGetKey(m_window, key) == GLFW_PRESS;
+        return m_window != nullptr && glfwGetKey(m_window, key) == GLFW_PRESS;
     }
 
     void VKWindow::WindowPosCallback(int xpos, int ypos) const
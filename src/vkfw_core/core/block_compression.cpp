@@ -0,0 +1,838 @@
+/**
+ * @file   block_compression.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the CPU encoding and decoding of block compressed textures.
+ */
+
+#include "core/block_compression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace vkfw_core {
+
+    namespace {
+
+        constexpr std::size_t BLOCK_TEXELS = BLOCK_EXTENT * BLOCK_EXTENT;
+
+        using Texel = std::array<std::uint8_t, 4>;
+        using TexelBlock = std::array<Texel, BLOCK_TEXELS>;
+        using ChannelBlock = std::array<std::uint8_t, BLOCK_TEXELS>;
+        /** A point in up to 4 dimensional color space used while fitting endpoints. */
+        using Color = std::array<float, 4>;
+
+        struct Endpoints
+        {
+            /** Holds the first endpoint. */
+            Color m_e0{};
+            /** Holds the second endpoint. */
+            Color m_e1{};
+        };
+
+        struct BC7ModeInfo
+        {
+            /** Holds the number of subsets. */
+            std::uint32_t m_numSubsets = 0;
+            /** Holds the number of bits of the partition index. */
+            std::uint32_t m_partitionBits = 0;
+            /** Holds the number of bits of the channel rotation. */
+            std::uint32_t m_rotationBits = 0;
+            /** Holds the number of bits of the index selection. */
+            std::uint32_t m_indexSelectionBits = 0;
+            /** Holds the number of bits of each color channel of an endpoint. */
+            std::uint32_t m_colorBits = 0;
+            /** Holds the number of bits of the alpha channel of an endpoint (0 for opaque modes). */
+            std::uint32_t m_alphaBits = 0;
+            /** Holds whether each endpoint has its own P-bit. */
+            std::uint32_t m_endpointPBits = 0;
+            /** Holds whether the endpoints of a subset share a P-bit. */
+            std::uint32_t m_sharedPBits = 0;
+            /** Holds the number of bits of the primary indices. */
+            std::uint32_t m_indexBits = 0;
+            /** Holds the number of bits of the secondary indices (0 if there are none). */
+            std::uint32_t m_secondaryIndexBits = 0;
+        };
+
+        constexpr std::array<BC7ModeInfo, 8> BC7_MODES{{{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+                                                        {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+                                                        {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+                                                        {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+                                                        {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+                                                        {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+                                                        {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+                                                        {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}}};
+
+        /** The two subset partitions, bit i is the subset of texel i. */
+        constexpr std::array<std::uint16_t, 64> BC7_PARTITIONS_2{
+            0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80, 0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8,
+            0xff00, 0xfff0, 0xf000, 0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce, 0x088c, 0x3110,
+            0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c, 0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696,
+            0xa55a, 0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660, 0x0272, 0x04e4, 0x4e40, 0x2720,
+            0xc936, 0x936c, 0x39c6, 0x639c, 0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22};
+
+        /** The three subset partitions. */
+        constexpr std::array<std::array<std::uint8_t, BLOCK_TEXELS>, 64> BC7_PARTITIONS_3{{
+            {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2}, {0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1},
+            {0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1}, {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1},
+            {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2}, {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2},
+            {0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1}, {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+            {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2}, {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2},
+            {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2}, {0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2},
+            {0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2}, {0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2},
+            {0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2}, {0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0},
+            {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2}, {0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0},
+            {0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2}, {0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1},
+            {0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2}, {0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1},
+            {0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2}, {0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0},
+            {0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0}, {0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2},
+            {0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0}, {0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1},
+            {0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2}, {0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2},
+            {0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1}, {0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1},
+            {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2}, {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1},
+            {0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2}, {0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0},
+            {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0}, {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0},
+            {0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0}, {0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1},
+            {0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1}, {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+            {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1}, {0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2},
+            {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1}, {0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1},
+            {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1}, {0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1},
+            {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2}, {0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1},
+            {0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2}, {0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2},
+            {0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2}, {0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2},
+            {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2}, {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2},
+            {0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2}, {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2},
+            {0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+            {0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1}, {0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2},
+            {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2}, {0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0}}};
+
+        /** The anchor texel of the second subset of two subset partitions. */
+        constexpr std::array<std::uint8_t, 64> BC7_ANCHORS_2{
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 2,  8, 2,  2, 8,
+            8,  15, 2,  8,  2,  2,  8,  8,  2,  2,  15, 15, 6,  8,  2,  8,  15, 15, 2, 8,  2, 2,
+            2,  15, 15, 6,  6,  2,  6,  8,  15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2, 15};
+        /** The anchor texel of the second subset of three subset partitions. */
+        constexpr std::array<std::uint8_t, 64> BC7_ANCHORS_3_SECOND{
+            3, 3,  15, 15, 8, 3,  15, 15, 8, 8,  6, 6, 6, 5,  3, 3,  3,  3,  8,  15, 3, 3,
+            6, 10, 5,  8,  8, 6,  8,  5,  15, 15, 8, 15, 3, 5, 6, 10, 8,  15, 15, 3,  15, 5,
+            15, 15, 15, 15, 3, 15, 5,  5,  5, 8,  5, 10, 5, 10, 8, 13, 15, 12, 3,  3};
+        /** The anchor texel of the third subset of three subset partitions. */
+        constexpr std::array<std::uint8_t, 64> BC7_ANCHORS_3_THIRD{
+            15, 8,  8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15, 15, 15, 8, 15, 8,  15, 3,  15, 8,
+            15, 8,  3,  15, 6,  10, 15, 15, 10, 8,  15, 3,  15, 10, 10, 8, 9,  10, 6,  15, 8,  15,
+            3,  6,  6,  8,  15, 3,  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8};
+
+        constexpr std::array<std::uint32_t, 4> BC7_WEIGHTS_2{0, 21, 43, 64};
+        constexpr std::array<std::uint32_t, 8> BC7_WEIGHTS_3{0, 9, 18, 27, 37, 46, 55, 64};
+        constexpr std::array<std::uint32_t, 16> BC7_WEIGHTS_4{0,  4,  9,  13, 17, 21, 26, 30,
+                                                              34, 38, 43, 47, 51, 55, 60, 64};
+
+        /** Reads the bits of a block starting with the least significant bit of the first byte. */
+        class BlockBitReader
+        {
+        public:
+            explicit BlockBitReader(const std::uint8_t* block) : m_block{block} {}
+
+            std::uint32_t Read(std::uint32_t numBits)
+            {
+                std::uint32_t value = 0;
+                for (std::uint32_t i = 0; i < numBits; ++i, ++m_position) {
+                    const auto bit = (m_block[m_position / 8] >> (m_position % 8)) & 1U;
+                    value |= static_cast<std::uint32_t>(bit) << i;
+                }
+                return value;
+            }
+
+        private:
+            /** Holds the block. */
+            const std::uint8_t* m_block;
+            /** Holds the position of the next bit. */
+            std::uint32_t m_position = 0;
+        };
+
+        class BlockBitWriter
+        {
+        public:
+            explicit BlockBitWriter(std::uint8_t* block) : m_block{block} {}
+
+            void Write(std::uint32_t value, std::uint32_t numBits)
+            {
+                for (std::uint32_t i = 0; i < numBits; ++i, ++m_position) {
+                    if (((value >> i) & 1U) != 0) {
+                        m_block[m_position / 8] |= static_cast<std::uint8_t>(1U << (m_position % 8));
+                    }
+                }
+            }
+
+        private:
+            /** Holds the block (needs to be zero initialized). */
+            std::uint8_t* m_block;
+            /** Holds the position of the next bit. */
+            std::uint32_t m_position = 0;
+        };
+
+        std::uint64_t ReadLittleEndian(const std::uint8_t* data, std::size_t numBytes)
+        {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < numBytes; ++i) { value |= std::uint64_t{data[i]} << (8 * i); }
+            return value;
+        }
+
+        void WriteLittleEndian(std::uint8_t* data, std::uint64_t value, std::size_t numBytes)
+        {
+            for (std::size_t i = 0; i < numBytes; ++i) { data[i] = static_cast<std::uint8_t>(value >> (8 * i)); }
+        }
+
+        std::uint8_t ToByte(std::uint32_t value) { return static_cast<std::uint8_t>(std::min(value, 255U)); }
+
+        Texel Unpack565(std::uint32_t color)
+        {
+            const auto r = (color >> 11) & 0x1fU;
+            const auto g = (color >> 5) & 0x3fU;
+            const auto b = color & 0x1fU;
+            return {ToByte((r << 3) | (r >> 2)), ToByte((g << 2) | (g >> 4)), ToByte((b << 3) | (b >> 2)), 255};
+        }
+
+        std::uint32_t Pack565(const Color& color)
+        {
+            auto quantize = [](float value, float maxValue) {
+                return static_cast<std::uint32_t>(std::clamp(value, 0.0f, 255.0f) * maxValue / 255.0f + 0.5f);
+            };
+            return (quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5) | quantize(color[2], 31.0f);
+        }
+
+        /** Builds the colors of a BC1 block, BC2 and BC3 always use the four color mode. */
+        std::array<Texel, 4> BuildColorPalette(std::uint32_t c0, std::uint32_t c1, bool fourColorOnly)
+        {
+            std::array<Texel, 4> palette{Unpack565(c0), Unpack565(c1), Texel{}, Texel{}};
+            for (std::size_t c = 0; c < 3; ++c) {
+                const std::uint32_t a = palette[0][c];
+                const std::uint32_t b = palette[1][c];
+                if (fourColorOnly || c0 > c1) {
+                    palette[2][c] = ToByte((2 * a + b + 1) / 3);
+                    palette[3][c] = ToByte((a + 2 * b + 1) / 3);
+                } else {
+                    palette[2][c] = ToByte((a + b + 1) / 2);
+                    palette[3][c] = 0;
+                }
+            }
+            palette[2][3] = 255;
+            palette[3][3] = fourColorOnly || c0 > c1 ? 255 : 0;
+            return palette;
+        }
+
+        std::array<std::uint8_t, 8> BuildAlphaPalette(std::uint32_t a0, std::uint32_t a1)
+        {
+            std::array<std::uint8_t, 8> palette{ToByte(a0), ToByte(a1)};
+            if (a0 > a1) {
+                for (std::uint32_t i = 1; i < 7; ++i) { palette[i + 1] = ToByte(((7 - i) * a0 + i * a1 + 3) / 7); }
+            } else {
+                for (std::uint32_t i = 1; i < 5; ++i) { palette[i + 1] = ToByte(((5 - i) * a0 + i * a1 + 2) / 5); }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+            return palette;
+        }
+
+        // ------------------------------------------------------------------------------------------------------------
+        // Decoding.
+        // ------------------------------------------------------------------------------------------------------------
+
+        void DecodeColorBlock(const std::uint8_t* block, bool fourColorOnly, TexelBlock& texels)
+        {
+            const auto c0 = static_cast<std::uint32_t>(ReadLittleEndian(block, 2));
+            const auto c1 = static_cast<std::uint32_t>(ReadLittleEndian(block + 2, 2));
+            const auto indices = ReadLittleEndian(block + 4, 4);
+            const auto palette = BuildColorPalette(c0, c1, fourColorOnly);
+            for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { texels[i] = palette[(indices >> (2 * i)) & 3U]; }
+        }
+
+        void DecodeAlphaBlock(const std::uint8_t* block, ChannelBlock& values)
+        {
+            const auto palette = BuildAlphaPalette(block[0], block[1]);
+            const auto indices = ReadLittleEndian(block + 2, 6);
+            for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { values[i] = palette[(indices >> (3 * i)) & 7U]; }
+        }
+
+        std::uint32_t GetBC7Subset(std::uint32_t numSubsets, std::uint32_t partition, std::size_t texel)
+        {
+            if (numSubsets == 2) { return (BC7_PARTITIONS_2[partition] >> texel) & 1U; }
+            if (numSubsets == 3) { return BC7_PARTITIONS_3[partition][texel]; }
+            return 0;
+        }
+
+        bool IsBC7Anchor(std::uint32_t numSubsets, std::uint32_t partition, std::size_t texel)
+        {
+            if (texel == 0) { return true; }
+            if (numSubsets == 2) { return texel == BC7_ANCHORS_2[partition]; }
+            if (numSubsets == 3) {
+                return texel == BC7_ANCHORS_3_SECOND[partition] || texel == BC7_ANCHORS_3_THIRD[partition];
+            }
+            return false;
+        }
+
+        std::uint32_t InterpolateBC7(std::uint32_t e0, std::uint32_t e1, std::uint32_t index, std::uint32_t indexBits)
+        {
+            std::uint32_t weight = 0;
+            if (indexBits == 2) { weight = BC7_WEIGHTS_2[index]; }
+            if (indexBits == 3) { weight = BC7_WEIGHTS_3[index]; }
+            if (indexBits == 4) { weight = BC7_WEIGHTS_4[index]; }
+            return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+        }
+
+        std::uint32_t ExpandBC7Endpoint(std::uint32_t value, std::uint32_t bits)
+        {
+            return (value << (8 - bits)) | (value >> (2 * bits - 8));
+        }
+
+        void DecodeBC7Block(const std::uint8_t* block, TexelBlock& texels)
+        {
+            BlockBitReader bits{block};
+            std::uint32_t mode = 0;
+            while (mode < BC7_MODES.size() && bits.Read(1) == 0) { ++mode; }
+            if (mode == BC7_MODES.size()) {
+                // reserved modes decode to transparent black.
+                texels.fill(Texel{0, 0, 0, 0});
+                return;
+            }
+
+            const auto& info = BC7_MODES[mode];
+            const auto partition = bits.Read(info.m_partitionBits);
+            const auto rotation = bits.Read(info.m_rotationBits);
+            const auto indexSelection = bits.Read(info.m_indexSelectionBits);
+
+            const auto numEndpoints = info.m_numSubsets * 2;
+            std::array<std::array<std::uint32_t, 4>, 6> endpoints{};
+            for (std::size_t c = 0; c < 3; ++c) {
+                for (std::size_t e = 0; e < numEndpoints; ++e) { endpoints[e][c] = bits.Read(info.m_colorBits); }
+            }
+            for (std::size_t e = 0; e < numEndpoints; ++e) { endpoints[e][3] = bits.Read(info.m_alphaBits); }
+
+            std::array<std::uint32_t, 6> pBits{};
+            if (info.m_endpointPBits != 0) {
+                for (std::size_t e = 0; e < numEndpoints; ++e) { pBits[e] = bits.Read(1); }
+            } else if (info.m_sharedPBits != 0) {
+                for (std::size_t s = 0; s < info.m_numSubsets; ++s) { pBits[2 * s] = pBits[2 * s + 1] = bits.Read(1); }
+            }
+            const auto hasPBits = info.m_endpointPBits + info.m_sharedPBits;
+
+            for (std::size_t e = 0; e < numEndpoints; ++e) {
+                for (std::size_t c = 0; c < 4; ++c) {
+                    const auto channelBits = c < 3 ? info.m_colorBits : info.m_alphaBits;
+                    if (channelBits == 0) {
+                        endpoints[e][c] = 255;
+                        continue;
+                    }
+                    auto value = endpoints[e][c];
+                    if (hasPBits != 0) { value = (value << 1) | pBits[e]; }
+                    endpoints[e][c] = ExpandBC7Endpoint(value, channelBits + hasPBits);
+                }
+            }
+
+            std::array<std::uint32_t, BLOCK_TEXELS> indices{};
+            std::array<std::uint32_t, BLOCK_TEXELS> secondaryIndices{};
+            for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                indices[i] = bits.Read(info.m_indexBits - (IsBC7Anchor(info.m_numSubsets, partition, i) ? 1 : 0));
+            }
+            if (info.m_secondaryIndexBits != 0) {
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                    secondaryIndices[i] = bits.Read(info.m_secondaryIndexBits - (i == 0 ? 1 : 0));
+                }
+            }
+
+            for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                const auto subset = GetBC7Subset(info.m_numSubsets, partition, i);
+                const auto& e0 = endpoints[2 * subset];
+                const auto& e1 = endpoints[2 * subset + 1];
+
+                auto colorIndex = indices[i];
+                auto colorIndexBits = info.m_indexBits;
+                auto alphaIndex = indices[i];
+                auto alphaIndexBits = info.m_indexBits;
+                if (info.m_secondaryIndexBits != 0) {
+                    alphaIndex = secondaryIndices[i];
+                    alphaIndexBits = info.m_secondaryIndexBits;
+                    if (indexSelection != 0) {
+                        std::swap(colorIndex, alphaIndex);
+                        std::swap(colorIndexBits, alphaIndexBits);
+                    }
+                }
+
+                auto& texel = texels[i];
+                for (std::size_t c = 0; c < 3; ++c) {
+                    texel[c] = ToByte(InterpolateBC7(e0[c], e1[c], colorIndex, colorIndexBits));
+                }
+                texel[3] = ToByte(InterpolateBC7(e0[3], e1[3], alphaIndex, alphaIndexBits));
+                if (rotation != 0) { std::swap(texel[3], texel[rotation - 1]); }
+            }
+        }
+
+        void DecodeBlock(BlockFormat format, const std::uint8_t* block, TexelBlock& texels)
+        {
+            ChannelBlock channel{};
+            switch (format) {
+            case BlockFormat::BC1:
+                DecodeColorBlock(block, false, texels);
+                for (auto& texel : texels) { texel[3] = 255; }
+                break;
+            case BlockFormat::BC1A: DecodeColorBlock(block, false, texels); break;
+            case BlockFormat::BC2:
+                DecodeColorBlock(block + 8, true, texels);
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                    const auto alpha = (block[i / 2] >> (4 * (i % 2))) & 0xfU;
+                    texels[i][3] = ToByte(alpha * 17U);
+                }
+                break;
+            case BlockFormat::BC3:
+                DecodeColorBlock(block + 8, true, texels);
+                DecodeAlphaBlock(block, channel);
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { texels[i][3] = channel[i]; }
+                break;
+            case BlockFormat::BC4:
+                DecodeAlphaBlock(block, channel);
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { texels[i][0] = channel[i]; }
+                break;
+            case BlockFormat::BC5:
+                DecodeAlphaBlock(block, channel);
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { texels[i][0] = channel[i]; }
+                DecodeAlphaBlock(block + 8, channel);
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { texels[i][1] = channel[i]; }
+                break;
+            case BlockFormat::BC7: DecodeBC7Block(block, texels); break;
+            case BlockFormat::BC6H: throw std::runtime_error("BC6H blocks cannot be decoded on the CPU.");
+            }
+        }
+
+        // ------------------------------------------------------------------------------------------------------------
+        // Encoding.
+        // ------------------------------------------------------------------------------------------------------------
+
+        float DistanceSquared(const Color& a, const Color& b, std::size_t dims)
+        {
+            float distance = 0.0f;
+            for (std::size_t c = 0; c < dims; ++c) { distance += (a[c] - b[c]) * (a[c] - b[c]); }
+            return distance;
+        }
+
+        /** Fits a line through the points along their principal axis and returns the extreme projections. */
+        Endpoints FitPrincipalAxis(std::span<const Color> points, std::size_t dims)
+        {
+            Color mean{};
+            for (const auto& point : points) {
+                for (std::size_t c = 0; c < dims; ++c) { mean[c] += point[c]; }
+            }
+            for (std::size_t c = 0; c < dims; ++c) { mean[c] /= static_cast<float>(points.size()); }
+
+            std::array<Color, 4> covariance{};
+            for (const auto& point : points) {
+                for (std::size_t i = 0; i < dims; ++i) {
+                    for (std::size_t j = 0; j < dims; ++j) {
+                        covariance[i][j] += (point[i] - mean[i]) * (point[j] - mean[j]);
+                    }
+                }
+            }
+
+            // power iteration starting at the column of the channel with the largest variance.
+            std::size_t largest = 0;
+            for (std::size_t c = 1; c < dims; ++c) {
+                if (covariance[c][c] > covariance[largest][largest]) { largest = c; }
+            }
+            Color axis = covariance[largest];
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                Color next{};
+                for (std::size_t i = 0; i < dims; ++i) {
+                    for (std::size_t j = 0; j < dims; ++j) { next[i] += covariance[i][j] * axis[j]; }
+                }
+                const auto length = std::sqrt(DistanceSquared(next, Color{}, dims));
+                if (length < 1e-6f) { break; }
+                for (std::size_t c = 0; c < dims; ++c) { axis[c] = next[c] / length; }
+            }
+
+            auto minProjection = std::numeric_limits<float>::max();
+            auto maxProjection = std::numeric_limits<float>::lowest();
+            for (const auto& point : points) {
+                float projection = 0.0f;
+                for (std::size_t c = 0; c < dims; ++c) { projection += (point[c] - mean[c]) * axis[c]; }
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+            if (covariance[largest][largest] < 1e-6f) { minProjection = maxProjection = 0.0f; }
+
+            Endpoints endpoints;
+            for (std::size_t c = 0; c < dims; ++c) {
+                endpoints.m_e0[c] = std::clamp(mean[c] + minProjection * axis[c], 0.0f, 255.0f);
+                endpoints.m_e1[c] = std::clamp(mean[c] + maxProjection * axis[c], 0.0f, 255.0f);
+            }
+            return endpoints;
+        }
+
+        /**
+         *  Finds the endpoints minimizing the squared error for fixed interpolation weights.
+         *  @param weights the position of each point between the first (0) and second (1) endpoint.
+         */
+        Endpoints FitLeastSquares(std::span<const Color> points, std::span<const float> weights, std::size_t dims,
+                                  const Endpoints& fallback)
+        {
+            float a = 0.0f;
+            float b = 0.0f;
+            float c = 0.0f;
+            Color x0{};
+            Color x1{};
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                const auto w = weights[i];
+                a += (1.0f - w) * (1.0f - w);
+                b += (1.0f - w) * w;
+                c += w * w;
+                for (std::size_t d = 0; d < dims; ++d) {
+                    x0[d] += (1.0f - w) * points[i][d];
+                    x1[d] += w * points[i][d];
+                }
+            }
+
+            const auto determinant = a * c - b * b;
+            if (std::abs(determinant) < 1e-6f) { return fallback; }
+            Endpoints endpoints;
+            for (std::size_t d = 0; d < dims; ++d) {
+                endpoints.m_e0[d] = std::clamp((c * x0[d] - b * x1[d]) / determinant, 0.0f, 255.0f);
+                endpoints.m_e1[d] = std::clamp((a * x1[d] - b * x0[d]) / determinant, 0.0f, 255.0f);
+            }
+            return endpoints;
+        }
+
+        Color ToColor(const Texel& texel)
+        {
+            return {static_cast<float>(texel[0]), static_cast<float>(texel[1]), static_cast<float>(texel[2]),
+                    static_cast<float>(texel[3])};
+        }
+
+        /** Encodes the color part of BC1 to BC3 blocks. */
+        void EncodeColorBlock(const TexelBlock& texels, bool fourColorOnly, bool punchThroughAlpha, std::uint8_t* block)
+        {
+            constexpr std::size_t dims = 3;
+            std::array<bool, BLOCK_TEXELS> transparent{};
+            std::vector<Color> points;
+            points.reserve(BLOCK_TEXELS);
+            for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                transparent[i] = punchThroughAlpha && texels[i][3] < 128;
+                if (!transparent[i]) { points.push_back(ToColor(texels[i])); }
+            }
+            // the three color mode is needed for transparent texels.
+            const bool threeColor = points.size() < BLOCK_TEXELS;
+            if (points.empty()) {
+                WriteLittleEndian(block, 0, 4);
+                WriteLittleEndian(block + 4, 0xffffffffU, 4);
+                return;
+            }
+
+            auto endpoints = FitPrincipalAxis(points, dims);
+            auto bestError = std::numeric_limits<float>::max();
+            std::vector<float> weights(points.size());
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                auto c0 = Pack565(endpoints.m_e0);
+                auto c1 = Pack565(endpoints.m_e1);
+                if ((threeColor && c0 > c1) || (!threeColor && c0 < c1)) { std::swap(c0, c1); }
+                const auto palette = BuildColorPalette(c0, c1, fourColorOnly);
+                // identical endpoints in four color mode select the three color mode, where only index 0 is valid.
+                const std::size_t paletteSize = threeColor ? 3 : (c0 == c1 ? 1 : 4);
+
+                std::uint32_t indices = 0;
+                float error = 0.0f;
+                for (std::size_t i = 0, point = 0; i < BLOCK_TEXELS; ++i) {
+                    std::uint32_t index = 3;
+                    if (!transparent[i]) {
+                        auto bestDistance = std::numeric_limits<float>::max();
+                        for (std::size_t p = 0; p < paletteSize; ++p) {
+                            const auto distance = DistanceSquared(points[point], ToColor(palette[p]), dims);
+                            if (distance < bestDistance) {
+                                bestDistance = distance;
+                                index = static_cast<std::uint32_t>(p);
+                            }
+                        }
+                        error += bestDistance;
+                        constexpr std::array<float, 4> fourColorWeights{0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+                        constexpr std::array<float, 4> threeColorWeights{0.0f, 1.0f, 0.5f, 0.0f};
+                        weights[point++] = threeColor ? threeColorWeights[index] : fourColorWeights[index];
+                    }
+                    indices |= index << (2 * i);
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    WriteLittleEndian(block, c0, 2);
+                    WriteLittleEndian(block + 2, c1, 2);
+                    WriteLittleEndian(block + 4, indices, 4);
+                }
+                if (error == 0.0f) { break; }
+                // endpoints are assigned in the order of the palette, the weights refer to this order.
+                const Endpoints quantized{ToColor(palette[0]), ToColor(palette[1])};
+                endpoints = FitLeastSquares(points, weights, dims, quantized);
+            }
+        }
+
+        void EncodeAlphaBlock(const ChannelBlock& values, std::uint8_t* block)
+        {
+            auto encode = [&values](std::uint32_t a0, std::uint32_t a1, std::uint64_t& indices) {
+                const auto palette = BuildAlphaPalette(a0, a1);
+                std::uint32_t error = 0;
+                indices = 0;
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                    std::uint32_t bestIndex = 0;
+                    auto bestDistance = std::numeric_limits<std::uint32_t>::max();
+                    for (std::uint32_t p = 0; p < palette.size(); ++p) {
+                        const auto difference = static_cast<int>(values[i]) - static_cast<int>(palette[p]);
+                        const auto distance = static_cast<std::uint32_t>(difference * difference);
+                        if (distance < bestDistance) {
+                            bestDistance = distance;
+                            bestIndex = p;
+                        }
+                    }
+                    error += bestDistance;
+                    indices |= std::uint64_t{bestIndex} << (3 * i);
+                }
+                return error;
+            };
+
+            // eight interpolated values between the extremes.
+            const auto [minValue, maxValue] = std::minmax_element(values.begin(), values.end());
+            std::uint32_t a0 = *maxValue;
+            std::uint32_t a1 = *minValue;
+            std::uint64_t indices = 0;
+            auto error = encode(a0, a1, indices);
+
+            // six interpolated values and explicit 0 and 255 if the block contains them.
+            if (*minValue == 0 || *maxValue == 255) {
+                std::uint32_t innerMin = 255;
+                std::uint32_t innerMax = 0;
+                for (auto value : values) {
+                    if (value == 0 || value == 255) { continue; }
+                    innerMin = std::min<std::uint32_t>(innerMin, value);
+                    innerMax = std::max<std::uint32_t>(innerMax, value);
+                }
+                if (innerMin > innerMax) { innerMin = innerMax = 0; }
+                std::uint64_t innerIndices = 0;
+                const auto innerError = encode(innerMin, innerMax, innerIndices);
+                if (innerError < error) {
+                    a0 = innerMin;
+                    a1 = innerMax;
+                    indices = innerIndices;
+                }
+            }
+
+            block[0] = static_cast<std::uint8_t>(a0);
+            block[1] = static_cast<std::uint8_t>(a1);
+            WriteLittleEndian(block + 2, indices, 6);
+        }
+
+        /** Encodes a BC7 block in mode 6 (a single subset with 7 bit RGBA endpoints, P-bits and 4 bit indices). */
+        void EncodeBC7Block(const TexelBlock& texels, std::uint8_t* block)
+        {
+            constexpr std::size_t dims = 4;
+            std::array<Color, BLOCK_TEXELS> points{};
+            std::transform(texels.begin(), texels.end(), points.begin(), ToColor);
+
+            // endpoints are stored with 7 bits and a P-bit that is chosen per endpoint as the least significant bit.
+            auto quantize = [](const Color& endpoint, std::array<std::uint32_t, 4>& quantized, std::uint32_t& pBit) {
+                auto bestError = std::numeric_limits<float>::max();
+                for (std::uint32_t p = 0; p < 2; ++p) {
+                    float error = 0.0f;
+                    std::array<std::uint32_t, 4> candidate{};
+                    for (std::size_t c = 0; c < dims; ++c) {
+                        const auto value = (endpoint[c] - static_cast<float>(p)) / 2.0f;
+                        candidate[c] = static_cast<std::uint32_t>(std::clamp(value + 0.5f, 0.0f, 127.0f));
+                        const auto reconstructed = static_cast<float>((candidate[c] << 1) | p);
+                        error += (reconstructed - endpoint[c]) * (reconstructed - endpoint[c]);
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        quantized = candidate;
+                        pBit = p;
+                    }
+                }
+            };
+
+            auto endpoints = FitPrincipalAxis(points, dims);
+            auto bestError = std::numeric_limits<float>::max();
+            std::array<std::array<std::uint32_t, 4>, 2> bestEndpoints{};
+            std::array<std::uint32_t, 2> bestPBits{};
+            std::array<std::uint32_t, BLOCK_TEXELS> bestIndices{};
+            std::array<float, BLOCK_TEXELS> weights{};
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                std::array<std::array<std::uint32_t, 4>, 2> quantized{};
+                std::array<std::uint32_t, 2> pBits{};
+                quantize(endpoints.m_e0, quantized[0], pBits[0]);
+                quantize(endpoints.m_e1, quantized[1], pBits[1]);
+
+                std::array<Color, 16> palette{};
+                for (std::uint32_t p = 0; p < palette.size(); ++p) {
+                    for (std::size_t c = 0; c < dims; ++c) {
+                        palette[p][c] = static_cast<float>(InterpolateBC7((quantized[0][c] << 1) | pBits[0],
+                                                                          (quantized[1][c] << 1) | pBits[1], p, 4));
+                    }
+                }
+
+                float error = 0.0f;
+                std::array<std::uint32_t, BLOCK_TEXELS> indices{};
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) {
+                    auto bestDistance = std::numeric_limits<float>::max();
+                    for (std::uint32_t p = 0; p < palette.size(); ++p) {
+                        const auto distance = DistanceSquared(points[i], palette[p], dims);
+                        if (distance < bestDistance) {
+                            bestDistance = distance;
+                            indices[i] = p;
+                        }
+                    }
+                    error += bestDistance;
+                    weights[i] = static_cast<float>(BC7_WEIGHTS_4[indices[i]]) / 64.0f;
+                }
+
+                if (error < bestError) {
+                    bestError = error;
+                    bestEndpoints = quantized;
+                    bestPBits = pBits;
+                    bestIndices = indices;
+                }
+                if (error == 0.0f) { break; }
+                endpoints = FitLeastSquares(points, weights, dims, Endpoints{palette[0], palette[15]});
+            }
+
+            // the most significant bit of the anchor index is implicitly 0.
+            if (bestIndices[0] >= 8) {
+                std::swap(bestEndpoints[0], bestEndpoints[1]);
+                std::swap(bestPBits[0], bestPBits[1]);
+                for (auto& index : bestIndices) { index = 15 - index; }
+            }
+
+            std::fill_n(block, GetBlockSize(BlockFormat::BC7), std::uint8_t{0});
+            BlockBitWriter bits{block};
+            bits.Write(1U << 6, 7);
+            for (std::size_t c = 0; c < dims; ++c) {
+                bits.Write(bestEndpoints[0][c], 7);
+                bits.Write(bestEndpoints[1][c], 7);
+            }
+            bits.Write(bestPBits[0], 1);
+            bits.Write(bestPBits[1], 1);
+            bits.Write(bestIndices[0], 3);
+            for (std::size_t i = 1; i < BLOCK_TEXELS; ++i) { bits.Write(bestIndices[i], 4); }
+        }
+
+        void EncodeBlock(BlockFormat format, const TexelBlock& texels, std::uint8_t* block)
+        {
+            ChannelBlock channel{};
+            auto extractChannel = [&texels, &channel](std::size_t c) {
+                for (std::size_t i = 0; i < BLOCK_TEXELS; ++i) { channel[i] = texels[i][c]; }
+            };
+
+            switch (format) {
+            case BlockFormat::BC1: EncodeColorBlock(texels, false, false, block); break;
+            case BlockFormat::BC1A: EncodeColorBlock(texels, false, true, block); break;
+            case BlockFormat::BC2:
+                for (std::size_t i = 0; i < BLOCK_TEXELS; i += 2) {
+                    auto quantize = [](std::uint32_t alpha) { return (alpha * 15 + 127) / 255; };
+                    block[i / 2] =
+                        static_cast<std::uint8_t>(quantize(texels[i][3]) | (quantize(texels[i + 1][3]) << 4));
+                }
+                EncodeColorBlock(texels, true, false, block + 8);
+                break;
+            case BlockFormat::BC3:
+                extractChannel(3);
+                EncodeAlphaBlock(channel, block);
+                EncodeColorBlock(texels, true, false, block + 8);
+                break;
+            case BlockFormat::BC4:
+                extractChannel(0);
+                EncodeAlphaBlock(channel, block);
+                break;
+            case BlockFormat::BC5:
+                extractChannel(0);
+                EncodeAlphaBlock(channel, block);
+                extractChannel(1);
+                EncodeAlphaBlock(channel, block + 8);
+                break;
+            case BlockFormat::BC7: EncodeBC7Block(texels, block); break;
+            case BlockFormat::BC6H: throw std::runtime_error("BC6H blocks cannot be encoded on the CPU.");
+            }
+        }
+    }
+
+    std::vector<std::uint8_t> DecompressBlocks(BlockFormat format, std::span<const std::uint8_t> blocks,
+                                               std::uint32_t width, std::uint32_t height)
+    {
+        if (!CanDecompressBlocks(format)) { throw std::runtime_error("Block format cannot be decoded on the CPU."); }
+        if (blocks.size() < GetCompressedSize(format, width, height)) {
+            throw std::runtime_error("Not enough data for the compressed image.");
+        }
+
+        const std::size_t channels = GetBlockChannels(format);
+        const auto blockSize = GetBlockSize(format);
+        std::vector<std::uint8_t> texels(std::size_t{width} * height * channels);
+        TexelBlock blockTexels{};
+        const auto* block = blocks.data();
+        for (std::uint32_t by = 0; by < GetBlockCount(height); ++by) {
+            for (std::uint32_t bx = 0; bx < GetBlockCount(width); ++bx, block += blockSize) {
+                DecodeBlock(format, block, blockTexels);
+                for (std::uint32_t y = 0; y < BLOCK_EXTENT && by * BLOCK_EXTENT + y < height; ++y) {
+                    for (std::uint32_t x = 0; x < BLOCK_EXTENT && bx * BLOCK_EXTENT + x < width; ++x) {
+                        const auto texelIndex = std::size_t{by * BLOCK_EXTENT + y} * width + bx * BLOCK_EXTENT + x;
+                        const auto& texel = blockTexels[y * BLOCK_EXTENT + x];
+                        std::copy_n(texel.begin(), channels,
+                                    texels.begin() + static_cast<std::ptrdiff_t>(texelIndex * channels));
+                    }
+                }
+            }
+        }
+        return texels;
+    }
+
+    std::vector<std::uint8_t> CompressBlocks(BlockFormat format, std::span<const std::uint8_t> texels,
+                                             std::uint32_t width, std::uint32_t height)
+    {
+        if (!CanCompressBlocks(format)) { throw std::runtime_error("Block format cannot be encoded on the CPU."); }
+        const std::size_t channels = GetBlockChannels(format);
+        if (texels.size() < std::size_t{width} * height * channels) {
+            throw std::runtime_error("Not enough texels for the image.");
+        }
+
+        const auto blockSize = GetBlockSize(format);
+        std::vector<std::uint8_t> blocks(GetCompressedSize(format, width, height), 0);
+        TexelBlock blockTexels{};
+        auto* block = blocks.data();
+        for (std::uint32_t by = 0; by < GetBlockCount(height); ++by) {
+            for (std::uint32_t bx = 0; bx < GetBlockCount(width); ++bx, block += blockSize) {
+                for (std::uint32_t y = 0; y < BLOCK_EXTENT; ++y) {
+                    for (std::uint32_t x = 0; x < BLOCK_EXTENT; ++x) {
+                        const auto texelX = std::min(bx * BLOCK_EXTENT + x, width - 1);
+                        const auto texelY = std::min(by * BLOCK_EXTENT + y, height - 1);
+                        const auto texelIndex = std::size_t{texelY} * width + texelX;
+                        auto& texel = blockTexels[y * BLOCK_EXTENT + x];
+                        texel = Texel{0, 0, 0, 255};
+                        std::copy_n(texels.begin() + static_cast<std::ptrdiff_t>(texelIndex * channels), channels,
+                                    texel.begin());
+                    }
+                }
+                EncodeBlock(format, blockTexels, block);
+            }
+        }
+        return blocks;
+    }
+
+    CompressionError ComputeCompressionError(std::span<const std::uint8_t> reference,
+                                             std::span<const std::uint8_t> decoded)
+    {
+        if (reference.size() != decoded.size()) { throw std::runtime_error("Images differ in size."); }
+
+        CompressionError result;
+        double squaredError = 0.0;
+        for (std::size_t i = 0; i < reference.size(); ++i) {
+            const auto difference = static_cast<int>(reference[i]) - static_cast<int>(decoded[i]);
+            squaredError += static_cast<double>(difference * difference);
+            result.m_maxError = std::max(result.m_maxError, static_cast<std::uint32_t>(std::abs(difference)));
+        }
+        result.m_rmse = reference.empty() ? 0.0 : std::sqrt(squaredError / static_cast<double>(reference.size()));
+        result.m_psnr = result.m_rmse == 0.0 ? std::numeric_limits<double>::infinity()
+                                             : 20.0 * std::log10(255.0 / result.m_rmse);
+        return result;
+    }
+}
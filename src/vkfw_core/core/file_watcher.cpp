@@ -0,0 +1,189 @@
+/**
+ * @file   file_watcher.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the file watcher using inotify or polling.
+ */
+
+#include "core/file_watcher.h"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <system_error>
+
+#ifdef __linux__
+#include <cerrno>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace vkfw_core {
+
+    FileWatcher::FileWatcher(const std::vector<std::filesystem::path>& directories, std::chrono::milliseconds debounce,
+                             bool forcePolling, std::chrono::milliseconds pollInterval)
+        : m_debounce{debounce}, m_pollInterval{pollInterval}
+    {
+        for (const auto& directory : directories) {
+            std::error_code ec;
+            if (std::filesystem::is_directory(directory, ec)) { m_directories.push_back(directory); }
+        }
+
+#ifdef __linux__
+        if (!forcePolling) {
+            m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (m_inotifyFd < 0) { spdlog::warn("Could not initialize inotify, polling for file changes instead."); }
+        }
+#else
+        static_cast<void>(forcePolling);
+#endif
+
+        if (IsUsingInotify()) {
+            for (const auto& directory : m_directories) { AddInotifyWatches(directory); }
+        } else {
+            ScanDirectories(false);
+            m_pollingThread = std::jthread{[this](const std::stop_token& stopToken) { PollingLoop(stopToken); }};
+        }
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        if (m_pollingThread.joinable()) {
+            m_pollingThread.request_stop();
+            m_pollingThread.join();
+        }
+#ifdef __linux__
+        if (m_inotifyFd >= 0) { close(m_inotifyFd); }
+#endif
+    }
+
+    std::vector<std::filesystem::path> FileWatcher::GetChangedFiles()
+    {
+        if (IsUsingInotify()) { ReadInotifyEvents(); }
+
+        std::vector<std::filesystem::path> changedFiles;
+        const auto now = Clock::now();
+        const std::scoped_lock lock{m_mutex};
+        for (auto change = m_pendingChanges.begin(); change != m_pendingChanges.end();) {
+            if (now - change->second >= m_debounce) {
+                changedFiles.push_back(change->first);
+                change = m_pendingChanges.erase(change);
+            } else {
+                ++change;
+            }
+        }
+        return changedFiles;
+    }
+
+    void FileWatcher::AddInotifyWatches(const std::filesystem::path& directory)
+    {
+#ifdef __linux__
+        constexpr auto watchMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM;
+        auto addWatch = [this](const std::filesystem::path& watchedDirectory) {
+            auto watch = inotify_add_watch(m_inotifyFd, watchedDirectory.c_str(), watchMask);
+            if (watch < 0) {
+                spdlog::warn("Could not watch directory {} for changes.", watchedDirectory.string());
+                return;
+            }
+            m_inotifyWatches[watch] = watchedDirectory;
+        };
+
+        addWatch(directory);
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator entry{directory, ec}, end; !ec && entry != end;
+             entry.increment(ec)) {
+            if (entry->is_directory(ec)) { addWatch(entry->path()); }
+        }
+#else
+        static_cast<void>(directory);
+#endif
+    }
+
+    void FileWatcher::ReadInotifyEvents()
+    {
+#ifdef __linux__
+        alignas(inotify_event) std::array<char, 4096> buffer{};
+        std::vector<std::filesystem::path> createdDirectories;
+        const auto now = Clock::now();
+        while (true) {
+            auto length = read(m_inotifyFd, buffer.data(), buffer.size());
+            if (length <= 0) {
+                if (length < 0 && errno != EAGAIN) { spdlog::warn("Could not read file change events."); }
+                break;
+            }
+
+            const std::scoped_lock lock{m_mutex};
+            for (auto offset = 0L; offset < length;) {
+                const auto* eventData = &buffer[static_cast<std::size_t>(offset)];
+                const auto* event = reinterpret_cast<const inotify_event*>(eventData); // NOLINT
+                offset += static_cast<long>(sizeof(inotify_event) + event->len);
+                if ((event->mask & IN_Q_OVERFLOW) != 0) {
+                    spdlog::warn("File change events were lost, some changes may not be reloaded.");
+                    continue;
+                }
+                auto watch = m_inotifyWatches.find(event->wd);
+                if (watch == m_inotifyWatches.end() || event->len == 0) { continue; }
+
+                auto file = watch->second / &event->name[0];
+                if ((event->mask & IN_ISDIR) != 0) {
+                    if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) { createdDirectories.push_back(file); }
+                    RecordChange(file, now);
+                } else if ((event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM)) != 0) {
+                    RecordChange(file, now);
+                }
+            }
+        }
+        for (const auto& directory : createdDirectories) { AddInotifyWatches(directory); }
+#endif
+    }
+
+    void FileWatcher::ScanDirectories(bool recordChanges)
+    {
+        const auto now = Clock::now();
+        std::vector<std::filesystem::path> changedFiles;
+        std::map<std::filesystem::path, std::filesystem::file_time_type> writeTimes;
+        for (const auto& directory : m_directories) {
+            std::error_code ec;
+            for (std::filesystem::recursive_directory_iterator entry{directory, ec}, end; !ec && entry != end;
+                 entry.increment(ec)) {
+                if (!entry->is_regular_file(ec)) { continue; }
+                auto writeTime = entry->last_write_time(ec);
+                if (ec) { continue; }
+
+                writeTimes.emplace(entry->path(), writeTime);
+                auto knownFile = m_writeTimes.find(entry->path());
+                if (knownFile == m_writeTimes.end() || knownFile->second != writeTime) {
+                    changedFiles.push_back(entry->path());
+                }
+            }
+        }
+        // files not found anymore were deleted.
+        for (const auto& [file, writeTime] : m_writeTimes) {
+            if (!writeTimes.contains(file)) { changedFiles.push_back(file); }
+        }
+        m_writeTimes = std::move(writeTimes);
+
+        if (!recordChanges) { return; }
+        const std::scoped_lock lock{m_mutex};
+        for (const auto& file : changedFiles) { RecordChange(file, now); }
+    }
+
+    void FileWatcher::PollingLoop(const std::stop_token& stopToken)
+    {
+        std::mutex waitMutex;
+        while (!stopToken.stop_requested()) {
+            {
+                std::unique_lock lock{waitMutex};
+                if (m_pollWakeup.wait_for(lock, stopToken, m_pollInterval, []() { return false; })) { return; }
+            }
+            if (stopToken.stop_requested()) { return; }
+            ScanDirectories(true);
+        }
+    }
+
+    void FileWatcher::RecordChange(const std::filesystem::path& file, Clock::time_point time)
+    {
+        m_pendingChanges[file] = time;
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file   frame_statistics.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of frame pacing and latency statistics.
+ */
+
+#include "core/frame_statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace vkfw_core {
+
+    FrameStatistics::FrameStatistics(std::size_t windowSize) : m_frames(windowSize)
+    {
+        assert(windowSize > 0);
+    }
+
+    void FrameStatistics::AddFrame(const FrameTiming& timing)
+    {
+        m_frames[m_nextFrame] = timing;
+        m_nextFrame = (m_nextFrame + 1) % m_frames.size();
+        m_numFrames = std::min(m_numFrames + 1, m_frames.size());
+    }
+
+    void FrameStatistics::Clear()
+    {
+        m_nextFrame = 0;
+        m_numFrames = 0;
+    }
+
+    FrameTiming FrameStatistics::GetAverage() const
+    {
+        FrameTiming average;
+        if (m_numFrames == 0) { return average; }
+
+        // the valid frames are always the first m_numFrames entries or the whole buffer.
+        for (std::size_t i = 0; i < m_numFrames; ++i) {
+            average.m_frameTime += m_frames[i].m_frameTime;
+            average.m_waitTime += m_frames[i].m_waitTime;
+            average.m_latency += m_frames[i].m_latency;
+        }
+        const auto numFrames = static_cast<double>(m_numFrames);
+        average.m_frameTime /= numFrames;
+        average.m_waitTime /= numFrames;
+        average.m_latency /= numFrames;
+        return average;
+    }
+
+    FrameTiming FrameStatistics::GetMaximum() const
+    {
+        FrameTiming maximum;
+        for (std::size_t i = 0; i < m_numFrames; ++i) {
+            maximum.m_frameTime = std::max(maximum.m_frameTime, m_frames[i].m_frameTime);
+            maximum.m_waitTime = std::max(maximum.m_waitTime, m_frames[i].m_waitTime);
+            maximum.m_latency = std::max(maximum.m_latency, m_frames[i].m_latency);
+        }
+        return maximum;
+    }
+
+    double FrameStatistics::GetFramesPerSecond() const
+    {
+        auto averageFrameTime = GetAverage().m_frameTime;
+        return averageFrameTime > 0.0 ? 1000.0 / averageFrameTime : 0.0;
+    }
+
+    double FrameStatistics::GetFrameTimePercentile(double percentile) const
+    {
+        if (m_numFrames == 0) { return 0.0; }
+
+        std::vector<double> frameTimes(m_numFrames);
+        for (std::size_t i = 0; i < m_numFrames; ++i) { frameTimes[i] = m_frames[i].m_frameTime; }
+
+        // nearest rank percentile.
+        auto scaledPercentile = std::clamp(percentile, 0.0, 1.0) * static_cast<double>(m_numFrames);
+        auto rank = static_cast<std::size_t>(std::ceil(scaledPercentile));
+        auto index = rank == 0 ? 0 : rank - 1;
+        std::nth_element(frameTimes.begin(), frameTimes.begin() + static_cast<std::ptrdiff_t>(index), frameTimes.end());
+        return frameTimes[index];
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file   job_pool.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of a pool of persistent threads running independent jobs by priority.
+ */
+
+#include "core/job_pool.h"
+
+#include <algorithm>
+
+namespace vkfw_core {
+
+    JobPool::JobPool(std::size_t numThreads)
+    {
+        const auto numWorkers = std::max<std::size_t>(numThreads, 1);
+        m_threads.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) { m_threads.emplace_back(&JobPool::WorkerLoop, this); }
+    }
+
+    JobPool::~JobPool()
+    {
+        std::array<std::deque<QueuedJob>, 3> droppedJobs;
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_stop = true;
+            droppedJobs.swap(m_queues);
+        }
+        m_jobQueued.notify_all();
+        for (auto& thread : m_threads) { thread.join(); }
+    }
+
+    void JobPool::WaitIdle()
+    {
+        std::unique_lock lock{m_mutex};
+        m_jobFinished.wait(lock, [this]() {
+            return m_runningJobs == 0
+                   && std::all_of(m_queues.begin(), m_queues.end(), [](const auto& queue) { return queue.empty(); });
+        });
+    }
+
+    std::size_t JobPool::GetNumQueuedJobs() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        std::size_t numJobs = 0;
+        for (const auto& queue : m_queues) { numJobs += queue.size(); }
+        return numJobs;
+    }
+
+    std::size_t JobPool::GetDefaultNumThreads()
+    {
+        return std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+    }
+
+    void JobPool::Enqueue(QueuedJob job, JobPriority priority)
+    {
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_queues[static_cast<std::size_t>(priority)].push_back(std::move(job));
+        }
+        m_jobQueued.notify_one();
+    }
+
+    bool JobPool::PopJob(QueuedJob& job)
+    {
+        for (auto queue = m_queues.rbegin(); queue != m_queues.rend(); ++queue) {
+            while (!queue->empty()) {
+                job = std::move(queue->front());
+                queue->pop_front();
+                if (!job.m_stopToken.stop_requested()) { return true; }
+            }
+        }
+        return false;
+    }
+
+    void JobPool::WorkerLoop()
+    {
+        while (true) {
+            QueuedJob job;
+            {
+                std::unique_lock lock{m_mutex};
+                m_jobQueued.wait(lock, [this]() {
+                    return m_stop
+                           || std::any_of(m_queues.begin(), m_queues.end(),
+                                          [](const auto& queue) { return !queue.empty(); });
+                });
+                if (m_stop) { return; }
+                // stopped jobs are dropped, which breaks their promise.
+                if (!PopJob(job)) {
+                    lock.unlock();
+                    m_jobFinished.notify_all();
+                    continue;
+                }
+                ++m_runningJobs;
+            }
+
+            // packaged tasks store exceptions in their future, so jobs do not throw.
+            job.m_job();
+
+            {
+                const std::scoped_lock lock{m_mutex};
+                --m_runningJobs;
+            }
+            m_jobFinished.notify_all();
+        }
+    }
+}
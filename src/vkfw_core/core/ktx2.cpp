@@ -0,0 +1,300 @@
+/**
+ * @file   ktx2.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of reading and writing of KTX 2.0 texture containers.
+ */
+
+#include "core/ktx2.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+
+namespace vkfw_core {
+
+    namespace {
+
+        constexpr std::array<std::uint8_t, 12> KTX2_IDENTIFIER{0xab, 0x4b, 0x54, 0x58, 0x20, 0x32,
+                                                               0x30, 0xbb, 0x0d, 0x0a, 0x1a, 0x0a};
+        /** The size of the identifier, header and index up to the level index. */
+        constexpr std::size_t HEADER_SIZE = 80;
+        constexpr std::size_t LEVEL_INDEX_ENTRY_SIZE = 24;
+
+        // data format descriptor values of the Khronos data format specification.
+        constexpr std::uint32_t KHR_DF_VERSION = 2;
+        constexpr std::uint32_t KHR_DF_MODEL_RGBSDA = 1;
+        constexpr std::uint32_t KHR_DF_MODEL_BC1A = 128;
+        constexpr std::uint32_t KHR_DF_PRIMARIES_BT709 = 1;
+        constexpr std::uint32_t KHR_DF_TRANSFER_LINEAR = 1;
+        constexpr std::uint32_t KHR_DF_TRANSFER_SRGB = 2;
+        constexpr std::uint32_t KHR_DF_CHANNEL_ALPHA = 15;
+        constexpr std::uint32_t KHR_DF_QUALIFIER_LINEAR = 1U << 4;
+        constexpr std::uint32_t KHR_DF_QUALIFIER_SIGNED = 1U << 6;
+        constexpr std::uint32_t KHR_DF_QUALIFIER_FLOAT = 1U << 7;
+
+        struct DfdSample
+        {
+            /** Holds the channel id. */
+            std::uint32_t m_channel = 0;
+            /** Holds the offset of the sample in bits. */
+            std::uint32_t m_bitOffset = 0;
+            /** Holds the length of the sample in bits. */
+            std::uint32_t m_bitLength = 0;
+            /** Holds the qualifier bits (linear, exponent, signed, float). */
+            std::uint32_t m_qualifiers = 0;
+            /** Holds the value mapped to 0 (or -1 for signed formats). */
+            std::uint32_t m_lower = 0;
+            /** Holds the value mapped to 1. */
+            std::uint32_t m_upper = 0;
+        };
+
+        struct DfdFormat
+        {
+            /** Holds the color model. */
+            std::uint32_t m_colorModel = 0;
+            /** Holds the transfer function. */
+            std::uint32_t m_transfer = KHR_DF_TRANSFER_LINEAR;
+            /** Holds the width and height of a texel block. */
+            std::uint32_t m_blockExtent = 1;
+            /** Holds the size of a texel block in bytes. */
+            std::uint32_t m_blockSize = 0;
+            /** Holds the samples. */
+            std::vector<DfdSample> m_samples;
+        };
+
+        std::uint64_t ReadLittleEndian(std::span<const std::byte> data, std::size_t offset, std::size_t numBytes)
+        {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < numBytes; ++i) {
+                value |= static_cast<std::uint64_t>(data[offset + i]) << (8 * i);
+            }
+            return value;
+        }
+
+        std::uint32_t ReadUInt32(std::span<const std::byte> data, std::size_t offset)
+        {
+            return static_cast<std::uint32_t>(ReadLittleEndian(data, offset, 4));
+        }
+
+        void WriteLittleEndian(std::vector<std::byte>& data, std::size_t offset, std::uint64_t value,
+                               std::size_t numBytes)
+        {
+            for (std::size_t i = 0; i < numBytes; ++i) {
+                data[offset + i] = static_cast<std::byte>((value >> (8 * i)) & 0xffU);
+            }
+        }
+
+        /** Describes the formats a data format descriptor can be written for, the values are VkFormat values. */
+        std::optional<DfdFormat> GetDfdFormat(std::uint32_t vkFormat)
+        {
+            constexpr std::uint32_t unormUpper = 0xffffffffU;
+            auto uncompressed = [](std::uint32_t channels, std::uint32_t transfer) {
+                DfdFormat format{KHR_DF_MODEL_RGBSDA, transfer, 1, channels, {}};
+                for (std::uint32_t c = 0; c < channels; ++c) {
+                    const auto isAlpha = c == 3;
+                    format.m_samples.push_back(
+                        DfdSample{isAlpha ? KHR_DF_CHANNEL_ALPHA : c, c * 8, 8,
+                                  isAlpha && transfer == KHR_DF_TRANSFER_SRGB ? KHR_DF_QUALIFIER_LINEAR : 0, 0, 255});
+                }
+                return format;
+            };
+            // the block compressed models are consecutive starting with BC1A.
+            auto compressed = [](std::uint32_t model, std::uint32_t transfer, std::uint32_t blockSize,
+                                 std::vector<DfdSample> samples) {
+                return DfdFormat{KHR_DF_MODEL_BC1A + model, transfer, 4, blockSize, std::move(samples)};
+            };
+            const auto linearAlpha = [](std::uint32_t transfer) {
+                return transfer == KHR_DF_TRANSFER_SRGB ? KHR_DF_QUALIFIER_LINEAR : 0;
+            };
+
+            constexpr std::uint32_t snormLower = 0x80000000U;
+            constexpr std::uint32_t snormUpper = 0x7fffffffU;
+            const auto transfer = [vkFormat]() {
+                switch (vkFormat) {
+                case 15:  // R8_SRGB
+                case 22:  // R8G8_SRGB
+                case 43:  // R8G8B8A8_SRGB
+                case 132: // BC1_RGB_SRGB_BLOCK
+                case 134: // BC1_RGBA_SRGB_BLOCK
+                case 136: // BC2_SRGB_BLOCK
+                case 138: // BC3_SRGB_BLOCK
+                case 146: // BC7_SRGB_BLOCK
+                    return KHR_DF_TRANSFER_SRGB;
+                default: return KHR_DF_TRANSFER_LINEAR;
+                }
+            }();
+
+            switch (vkFormat) {
+            case 9:  // R8_UNORM
+            case 15: // R8_SRGB
+                return uncompressed(1, transfer);
+            case 16: // R8G8_UNORM
+            case 22: // R8G8_SRGB
+                return uncompressed(2, transfer);
+            case 37: // R8G8B8A8_UNORM
+            case 43: // R8G8B8A8_SRGB
+                return uncompressed(4, transfer);
+            case 131: // BC1_RGB_UNORM_BLOCK
+            case 132: // BC1_RGB_SRGB_BLOCK
+                return compressed(0, transfer, 8, {{0, 0, 64, 0, 0, unormUpper}});
+            case 133: // BC1_RGBA_UNORM_BLOCK
+            case 134: // BC1_RGBA_SRGB_BLOCK
+                return compressed(0, transfer, 8, {{1, 0, 64, 0, 0, unormUpper}});
+            case 135: // BC2_UNORM_BLOCK
+            case 136: // BC2_SRGB_BLOCK
+                return compressed(1, transfer, 16,
+                                  {{KHR_DF_CHANNEL_ALPHA, 0, 64, linearAlpha(transfer), 0, unormUpper},
+                                   {0, 64, 64, 0, 0, unormUpper}});
+            case 137: // BC3_UNORM_BLOCK
+            case 138: // BC3_SRGB_BLOCK
+                return compressed(2, transfer, 16,
+                                  {{KHR_DF_CHANNEL_ALPHA, 0, 64, linearAlpha(transfer), 0, unormUpper},
+                                   {0, 64, 64, 0, 0, unormUpper}});
+            case 139: // BC4_UNORM_BLOCK
+                return compressed(3, transfer, 8, {{0, 0, 64, 0, 0, unormUpper}});
+            case 140: // BC4_SNORM_BLOCK
+                return compressed(3, transfer, 8, {{0, 0, 64, KHR_DF_QUALIFIER_SIGNED, snormLower, snormUpper}});
+            case 141: // BC5_UNORM_BLOCK
+                return compressed(4, transfer, 16, {{0, 0, 64, 0, 0, unormUpper}, {1, 64, 64, 0, 0, unormUpper}});
+            case 142: // BC5_SNORM_BLOCK
+                return compressed(4, transfer, 16,
+                                  {{0, 0, 64, KHR_DF_QUALIFIER_SIGNED, snormLower, snormUpper},
+                                   {1, 64, 64, KHR_DF_QUALIFIER_SIGNED, snormLower, snormUpper}});
+            case 143: // BC6H_UFLOAT_BLOCK
+                return compressed(5, transfer, 16, {{0, 0, 128, KHR_DF_QUALIFIER_FLOAT, 0, 0x3f800000U}});
+            case 144: // BC6H_SFLOAT_BLOCK
+                return compressed(5, transfer, 16,
+                                  {{0, 0, 128, KHR_DF_QUALIFIER_FLOAT | KHR_DF_QUALIFIER_SIGNED, 0xbf800000U,
+                                    0x3f800000U}});
+            case 145: // BC7_UNORM_BLOCK
+            case 146: // BC7_SRGB_BLOCK
+                return compressed(6, transfer, 16, {{0, 0, 128, 0, 0, unormUpper}});
+            default: return std::nullopt;
+            }
+        }
+
+        std::vector<std::byte> CreateDataFormatDescriptor(const DfdFormat& format)
+        {
+            const std::size_t blockSize = 24 + 16 * format.m_samples.size();
+            std::vector<std::byte> dfd(4 + blockSize);
+            WriteLittleEndian(dfd, 0, dfd.size(), 4);
+            // vendor and descriptor type are 0 for the Khronos basic descriptor block.
+            WriteLittleEndian(dfd, 4, 0, 4);
+            WriteLittleEndian(dfd, 8, KHR_DF_VERSION | (blockSize << 16), 4);
+            WriteLittleEndian(dfd, 12,
+                              format.m_colorModel | (KHR_DF_PRIMARIES_BT709 << 8) | (format.m_transfer << 16), 4);
+            const auto blockDimension = format.m_blockExtent - 1;
+            WriteLittleEndian(dfd, 16, blockDimension | (blockDimension << 8), 4);
+            WriteLittleEndian(dfd, 20, format.m_blockSize, 8);
+            for (std::size_t i = 0; i < format.m_samples.size(); ++i) {
+                const auto& sample = format.m_samples[i];
+                const auto offset = 28 + 16 * i;
+                WriteLittleEndian(dfd, offset,
+                                  sample.m_bitOffset | ((sample.m_bitLength - 1) << 16)
+                                      | ((sample.m_channel | sample.m_qualifiers) << 24),
+                                  4);
+                WriteLittleEndian(dfd, offset + 4, 0, 4);
+                WriteLittleEndian(dfd, offset + 8, sample.m_lower, 4);
+                WriteLittleEndian(dfd, offset + 12, sample.m_upper, 4);
+            }
+            return dfd;
+        }
+    }
+
+    bool IsKtx2(std::span<const std::byte> data)
+    {
+        return data.size() >= KTX2_IDENTIFIER.size()
+               && std::equal(KTX2_IDENTIFIER.begin(), KTX2_IDENTIFIER.end(), data.begin(),
+                             [](std::uint8_t id, std::byte value) { return std::byte{id} == value; });
+    }
+
+    Ktx2Image ParseKtx2(std::span<const std::byte> data)
+    {
+        if (data.size() < HEADER_SIZE || !IsKtx2(data)) { throw std::runtime_error("Not a KTX 2.0 file."); }
+
+        Ktx2Image image;
+        auto& header = image.m_header;
+        header.m_vkFormat = ReadUInt32(data, 12);
+        header.m_typeSize = ReadUInt32(data, 16);
+        header.m_pixelWidth = ReadUInt32(data, 20);
+        header.m_pixelHeight = ReadUInt32(data, 24);
+        header.m_pixelDepth = ReadUInt32(data, 28);
+        header.m_layerCount = ReadUInt32(data, 32);
+        header.m_faceCount = ReadUInt32(data, 36);
+        header.m_levelCount = ReadUInt32(data, 40);
+        header.m_supercompressionScheme = ReadUInt32(data, 44);
+
+        if (header.m_supercompressionScheme != 0) {
+            throw std::runtime_error("Supercompressed KTX 2.0 files are not supported.");
+        }
+        if (header.m_pixelWidth == 0 || (header.m_faceCount != 1 && header.m_faceCount != 6)) {
+            throw std::runtime_error("Invalid KTX 2.0 image description.");
+        }
+
+        const std::size_t levelCount = std::max(header.m_levelCount, 1U);
+        if (levelCount > 32 || HEADER_SIZE + levelCount * LEVEL_INDEX_ENTRY_SIZE > data.size()) {
+            throw std::runtime_error("KTX 2.0 level index is out of bounds.");
+        }
+        image.m_levels.reserve(levelCount);
+        for (std::size_t level = 0; level < levelCount; ++level) {
+            const auto entryOffset = HEADER_SIZE + level * LEVEL_INDEX_ENTRY_SIZE;
+            const auto byteOffset = ReadLittleEndian(data, entryOffset, 8);
+            const auto byteLength = ReadLittleEndian(data, entryOffset + 8, 8);
+            if (byteOffset > data.size() || byteLength > data.size() - byteOffset) {
+                throw std::runtime_error("KTX 2.0 level data is out of bounds.");
+            }
+            image.m_levels.push_back(data.subspan(static_cast<std::size_t>(byteOffset),
+                                                  static_cast<std::size_t>(byteLength)));
+        }
+        return image;
+    }
+
+    std::vector<std::byte> WriteKtx2(const Ktx2Header& header, std::span<const std::span<const std::byte>> levels)
+    {
+        const auto format = GetDfdFormat(header.m_vkFormat);
+        if (!format) { throw std::runtime_error("No data format descriptor known for the KTX 2.0 format."); }
+        if (levels.empty()) { throw std::runtime_error("KTX 2.0 files need at least one level."); }
+
+        const auto dfd = CreateDataFormatDescriptor(*format);
+        const auto dfdOffset = HEADER_SIZE + levels.size() * LEVEL_INDEX_ENTRY_SIZE;
+        // levels are stored from the smallest to the largest one, each aligned to the texel block size.
+        const auto levelAlignment = std::lcm(std::size_t{format->m_blockSize}, std::size_t{4});
+        std::vector<std::size_t> levelOffsets(levels.size());
+        auto fileSize = dfdOffset + dfd.size();
+        for (auto level = levels.size(); level-- > 0;) {
+            fileSize = (fileSize + levelAlignment - 1) / levelAlignment * levelAlignment;
+            levelOffsets[level] = fileSize;
+            fileSize += levels[level].size();
+        }
+
+        std::vector<std::byte> file(fileSize);
+        std::transform(KTX2_IDENTIFIER.begin(), KTX2_IDENTIFIER.end(), file.begin(),
+                       [](std::uint8_t id) { return std::byte{id}; });
+        WriteLittleEndian(file, 12, header.m_vkFormat, 4);
+        WriteLittleEndian(file, 16, header.m_typeSize, 4);
+        WriteLittleEndian(file, 20, header.m_pixelWidth, 4);
+        WriteLittleEndian(file, 24, header.m_pixelHeight, 4);
+        WriteLittleEndian(file, 28, header.m_pixelDepth, 4);
+        WriteLittleEndian(file, 32, header.m_layerCount, 4);
+        WriteLittleEndian(file, 36, header.m_faceCount, 4);
+        WriteLittleEndian(file, 40, levels.size(), 4);
+        // index: the data format descriptor, no key/value data and no supercompression global data (all zero).
+        WriteLittleEndian(file, 48, dfdOffset, 4);
+        WriteLittleEndian(file, 52, dfd.size(), 4);
+
+        for (std::size_t level = 0; level < levels.size(); ++level) {
+            const auto entryOffset = HEADER_SIZE + level * LEVEL_INDEX_ENTRY_SIZE;
+            WriteLittleEndian(file, entryOffset, levelOffsets[level], 8);
+            WriteLittleEndian(file, entryOffset + 8, levels[level].size(), 8);
+            WriteLittleEndian(file, entryOffset + 16, levels[level].size(), 8);
+            std::copy(levels[level].begin(), levels[level].end(),
+                      file.begin() + static_cast<std::ptrdiff_t>(levelOffsets[level]));
+        }
+        std::copy(dfd.begin(), dfd.end(), file.begin() + static_cast<std::ptrdiff_t>(dfdOffset));
+        return file;
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * @file   culling.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of batch frustum culling of axis aligned bounding boxes.
+ */
+
+#include "core/math/culling.h"
+
+#include <algorithm>
+#include <cassert>
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define VKFW_CULLING_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKFW_CULLING_SSE
+#endif
+
+namespace vkfw_core::math {
+
+    void CullingBoxes::Reserve(std::size_t count)
+    {
+        for (auto& center : m_center) { center.reserve(count); }
+        for (auto& extent : m_extent) { extent.reserve(count); }
+    }
+
+    void CullingBoxes::Clear()
+    {
+        for (auto& center : m_center) { center.clear(); }
+        for (auto& extent : m_extent) { extent.clear(); }
+    }
+
+    void CullingBoxes::Add(const AABB3<float>& box)
+    {
+        for (glm::length_t i = 0; i < 3; ++i) {
+            auto axis = static_cast<std::size_t>(i);
+            m_center[axis].push_back(0.5f * (box.m_minmax[0][i] + box.m_minmax[1][i]));
+            m_extent[axis].push_back(0.5f * (box.m_minmax[1][i] - box.m_minmax[0][i]));
+        }
+    }
+
+    namespace {
+
+        constexpr std::size_t PLANE_LANES = 8;
+
+        /**
+         *  The frustum planes in structure of arrays layout, unused lanes are zero and always pass.
+         *  Distances are tested with "not greater or equal zero", so NaNs (from the infinite extents of empty boxes)
+         *  get culled.
+         */
+        struct CullingPlanes
+        {
+            /** The x components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_nx = {};
+            /** The y components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_ny = {};
+            /** The z components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_nz = {};
+            /** The plane distances. */
+            alignas(32) std::array<float, PLANE_LANES> m_w = {};
+            /** The absolute x components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_absNx = {};
+            /** The absolute y components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_absNy = {};
+            /** The absolute z components of the plane normals. */
+            alignas(32) std::array<float, PLANE_LANES> m_absNz = {};
+        };
+
+        CullingPlanes MakeCullingPlanes(const Frustum<float>& frustum)
+        {
+            static_assert(Frustum<float>::NUM_FRUSTUM_PLANES <= PLANE_LANES);
+            CullingPlanes planes;
+            for (std::size_t i = 0; i < Frustum<float>::NUM_FRUSTUM_PLANES; ++i) {
+                const auto& plane = frustum.m_planes[i];
+                planes.m_nx[i] = plane.x;
+                planes.m_ny[i] = plane.y;
+                planes.m_nz[i] = plane.z;
+                planes.m_w[i] = plane.w;
+                planes.m_absNx[i] = glm::abs(plane.x);
+                planes.m_absNy[i] = glm::abs(plane.y);
+                planes.m_absNz[i] = glm::abs(plane.z);
+            }
+            return planes;
+        }
+
+#if defined(VKFW_CULLING_AVX) || defined(VKFW_CULLING_SSE)
+        /** Transforms the center and extent of a box (w of the results is undefined). */
+        inline void TransformBox(const glm::mat4& matrix, const std::array<float, 3>& center,
+                                 const std::array<float, 3>& extent, __m128& worldCenter, __m128& worldExtent)
+        {
+            const auto* m = glm::value_ptr(matrix);
+            const auto signMask = _mm_set1_ps(-0.0f);
+            const auto col0 = _mm_loadu_ps(&m[0]);
+            const auto col1 = _mm_loadu_ps(&m[4]);
+            const auto col2 = _mm_loadu_ps(&m[8]);
+            const auto col3 = _mm_loadu_ps(&m[12]);
+
+            worldCenter = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(center[0])),
+                                                _mm_mul_ps(col1, _mm_set1_ps(center[1]))),
+                                     _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(center[2])), col3));
+            worldExtent = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, col0), _mm_set1_ps(extent[0])),
+                                                _mm_mul_ps(_mm_andnot_ps(signMask, col1), _mm_set1_ps(extent[1]))),
+                                     _mm_mul_ps(_mm_andnot_ps(signMask, col2), _mm_set1_ps(extent[2])));
+        }
+#endif
+
+#if defined(VKFW_CULLING_AVX)
+        inline bool IsBoxVisible(const CullingPlanes& planes, const glm::mat4& matrix, const std::array<float, 3>& center,
+                                 const std::array<float, 3>& extent)
+        {
+            __m128 worldCenter;
+            __m128 worldExtent;
+            TransformBox(matrix, center, extent, worldCenter, worldExtent);
+
+            const auto c = _mm256_insertf128_ps(_mm256_castps128_ps256(worldCenter), worldCenter, 1);
+            const auto e = _mm256_insertf128_ps(_mm256_castps128_ps256(worldExtent), worldExtent, 1);
+
+            // distance of the positive vertex: n * c + w + |n| * e.
+            auto d = _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(planes.m_nx.data()), _mm256_permute_ps(c, 0x00)),
+                                   _mm256_mul_ps(_mm256_load_ps(planes.m_ny.data()), _mm256_permute_ps(c, 0x55)));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(planes.m_nz.data()), _mm256_permute_ps(c, 0xAA)));
+            d = _mm256_add_ps(d, _mm256_load_ps(planes.m_w.data()));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(planes.m_absNx.data()), _mm256_permute_ps(e, 0x00)));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(planes.m_absNy.data()), _mm256_permute_ps(e, 0x55)));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(planes.m_absNz.data()), _mm256_permute_ps(e, 0xAA)));
+            return _mm256_movemask_ps(_mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_NGE_UQ)) == 0;
+        }
+#elif defined(VKFW_CULLING_SSE)
+        inline bool IsBoxVisible(const CullingPlanes& planes, const glm::mat4& matrix, const std::array<float, 3>& center,
+                                 const std::array<float, 3>& extent)
+        {
+            __m128 worldCenter;
+            __m128 worldExtent;
+            TransformBox(matrix, center, extent, worldCenter, worldExtent);
+
+            const auto cx = _mm_shuffle_ps(worldCenter, worldCenter, _MM_SHUFFLE(0, 0, 0, 0));
+            const auto cy = _mm_shuffle_ps(worldCenter, worldCenter, _MM_SHUFFLE(1, 1, 1, 1));
+            const auto cz = _mm_shuffle_ps(worldCenter, worldCenter, _MM_SHUFFLE(2, 2, 2, 2));
+            const auto ex = _mm_shuffle_ps(worldExtent, worldExtent, _MM_SHUFFLE(0, 0, 0, 0));
+            const auto ey = _mm_shuffle_ps(worldExtent, worldExtent, _MM_SHUFFLE(1, 1, 1, 1));
+            const auto ez = _mm_shuffle_ps(worldExtent, worldExtent, _MM_SHUFFLE(2, 2, 2, 2));
+
+            int outside = 0;
+            for (std::size_t i = 0; i < PLANE_LANES; i += 4) {
+                // distance of the positive vertex: n * c + w + |n| * e.
+                auto d = _mm_add_ps(_mm_mul_ps(_mm_load_ps(&planes.m_nx[i]), cx),
+                                    _mm_mul_ps(_mm_load_ps(&planes.m_ny[i]), cy));
+                d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(&planes.m_nz[i]), cz));
+                d = _mm_add_ps(d, _mm_load_ps(&planes.m_w[i]));
+                d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(&planes.m_absNx[i]), ex));
+                d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(&planes.m_absNy[i]), ey));
+                d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(&planes.m_absNz[i]), ez));
+                outside |= _mm_movemask_ps(_mm_cmpnge_ps(d, _mm_setzero_ps()));
+            }
+            return outside == 0;
+        }
+#else
+        inline bool IsBoxVisible(const CullingPlanes& planes, const glm::mat4& matrix, const std::array<float, 3>& center,
+                                 const std::array<float, 3>& extent)
+        {
+            auto worldCenter = glm::vec3(matrix * glm::vec4{center[0], center[1], center[2], 1.0f});
+            auto worldExtent = glm::abs(glm::vec3(matrix[0])) * extent[0] + glm::abs(glm::vec3(matrix[1])) * extent[1]
+                               + glm::abs(glm::vec3(matrix[2])) * extent[2];
+
+            for (std::size_t i = 0; i < Frustum<float>::NUM_FRUSTUM_PLANES; ++i) {
+                // distance of the positive vertex: n * c + w + |n| * e.
+                auto d = planes.m_nx[i] * worldCenter.x + planes.m_ny[i] * worldCenter.y
+                         + planes.m_nz[i] * worldCenter.z + planes.m_w[i] + planes.m_absNx[i] * worldExtent.x
+                         + planes.m_absNy[i] * worldExtent.y + planes.m_absNz[i] * worldExtent.z;
+                if (!(d >= 0.0f)) { return false; }
+            }
+            return true;
+        }
+#endif
+    }
+
+    void CullAABBs(const Frustum<float>& frustum, const CullingBoxes& boxes, std::span<const glm::mat4> worldMatrices,
+                   std::span<std::uint64_t> visibility)
+    {
+        const auto boxCount = boxes.size();
+        assert(worldMatrices.size() == 1 || worldMatrices.size() == boxCount);
+        assert(visibility.size() >= CullingMaskSize(boxCount));
+
+        const auto planes = MakeCullingPlanes(frustum);
+        const auto sharedMatrix = worldMatrices.size() == 1;
+        const std::array<std::span<const float>, 3> centers{boxes.GetCenter(0), boxes.GetCenter(1), boxes.GetCenter(2)};
+        const std::array<std::span<const float>, 3> extents{boxes.GetExtent(0), boxes.GetExtent(1), boxes.GetExtent(2)};
+
+        std::fill_n(visibility.begin(), CullingMaskSize(boxCount), std::uint64_t{0});
+        for (std::size_t i = 0; i < boxCount; ++i) {
+            const auto& matrix = worldMatrices[sharedMatrix ? 0 : i];
+            if (IsBoxVisible(planes, matrix, {centers[0][i], centers[1][i], centers[2][i]},
+                             {extents[0][i], extents[1][i], extents[2][i]})) {
+                visibility[i / 64] |= std::uint64_t{1} << (i % 64);
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file   memory_mapped_file.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a read-only memory mapped file.
+ */
+
+#include "core/memory_mapped_file.h"
+
+#include <fmt/format.h>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vkfw_core {
+
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& filename)
+    {
+        auto file = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error(fmt::format("Could not open file '{}' for mapping.", filename.string()));
+        }
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) == 0 || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw std::runtime_error(fmt::format("Could not map empty file '{}'.", filename.string()));
+        }
+
+        m_mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (m_mappingHandle == nullptr) {
+            throw std::runtime_error(fmt::format("Could not create file mapping for '{}'.", filename.string()));
+        }
+
+        m_data = static_cast<const std::byte*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr) {
+            CloseHandle(m_mappingHandle);
+            throw std::runtime_error(fmt::format("Could not map file '{}'.", filename.string()));
+        }
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mappingHandle);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& filename)
+    {
+        auto file = open(filename.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+        if (file == -1) {
+            throw std::runtime_error(fmt::format("Could not open file '{}' for mapping.", filename.string()));
+        }
+
+        struct stat fileStat = {};
+        if (fstat(file, &fileStat) == -1 || fileStat.st_size == 0) {
+            close(file);
+            throw std::runtime_error(fmt::format("Could not map empty file '{}'.", filename.string()));
+        }
+
+        m_size = static_cast<std::size_t>(fileStat.st_size);
+        auto mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (mapping == MAP_FAILED) { // NOLINT
+            throw std::runtime_error(fmt::format("Could not map file '{}'.", filename.string()));
+        }
+        m_data = static_cast<const std::byte*>(mapping);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        munmap(const_cast<std::byte*>(m_data), m_size); // NOLINT
+    }
+#endif
+}
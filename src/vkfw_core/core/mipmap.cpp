@@ -0,0 +1,269 @@
+/**
+ * @file   mipmap.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the CPU generation of mipmap chains.
+ */
+
+#include "core/mipmap.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+namespace vkfw_core {
+
+    namespace {
+
+        struct FilterTap
+        {
+            /** Holds the index of the source texel. */
+            std::uint32_t m_index = 0;
+            /** Holds the weight of the source texel. */
+            float m_weight = 0.0f;
+        };
+
+        std::uint32_t MapIndex(std::int64_t index, std::uint32_t size, bool wrap)
+        {
+            const auto signedSize = static_cast<std::int64_t>(size);
+            if (wrap) { return static_cast<std::uint32_t>(((index % signedSize) + signedSize) % signedSize); }
+            return static_cast<std::uint32_t>(std::clamp<std::int64_t>(index, 0, signedSize - 1));
+        }
+
+        /** The modified Bessel function of the first kind of order 0 used by the Kaiser window. */
+        double BesselI0(double x)
+        {
+            double sum = 1.0;
+            double term = 1.0;
+            const double halfXSquared = 0.25 * x * x;
+            for (int k = 1; term > 1e-12 * sum; ++k) {
+                term *= halfXSquared / static_cast<double>(k * k);
+                sum += term;
+            }
+            return sum;
+        }
+
+        double Sinc(double x)
+        {
+            if (std::abs(x) < 1e-6) { return 1.0; }
+            return std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+        }
+
+        /** Computes the weights of a 1D filter reducing srcSize texels to dstSize texels. */
+        std::vector<std::vector<FilterTap>> CreateFilterTaps(std::uint32_t srcSize, std::uint32_t dstSize,
+                                                             const MipmapOptions& options)
+        {
+            std::vector<std::vector<FilterTap>> taps(dstSize);
+            if (srcSize == dstSize) {
+                for (std::uint32_t i = 0; i < dstSize; ++i) { taps[i].push_back(FilterTap{i, 1.0f}); }
+                return taps;
+            }
+
+            // positions are in source texels, texel i covers [i, i + 1).
+            const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+            const double width = static_cast<double>(options.m_kaiserWidth);
+            const double alpha = static_cast<double>(options.m_kaiserAlpha);
+            const double windowNorm = BesselI0(alpha);
+
+            std::vector<double> weights;
+            for (std::uint32_t i = 0; i < dstSize; ++i) {
+                const double begin = static_cast<double>(i) * scale;
+                const double end = begin + scale;
+                std::int64_t first = 0;
+                weights.clear();
+
+                if (options.m_filter == MipmapFilter::BOX) {
+                    first = static_cast<std::int64_t>(std::floor(begin));
+                    const auto last = static_cast<std::int64_t>(std::ceil(end));
+                    for (auto j = first; j < last; ++j) {
+                        const auto texelBegin = static_cast<double>(j);
+                        weights.push_back(std::max(std::min(end, texelBegin + 1.0) - std::max(begin, texelBegin), 0.0));
+                    }
+                } else {
+                    const double center = 0.5 * (begin + end);
+                    const double radius = width * scale;
+                    first = static_cast<std::int64_t>(std::floor(center - radius));
+                    const auto last = static_cast<std::int64_t>(std::ceil(center + radius));
+                    for (auto j = first; j < last; ++j) {
+                        // distance of the texel center in destination texels.
+                        const double t = (static_cast<double>(j) + 0.5 - center) / scale;
+                        const double windowPos = t / width;
+                        if (std::abs(windowPos) >= 1.0) {
+                            weights.push_back(0.0);
+                            continue;
+                        }
+                        const double window = BesselI0(alpha * std::sqrt(1.0 - windowPos * windowPos)) / windowNorm;
+                        weights.push_back(Sinc(t) * window);
+                    }
+                }
+
+                double weightSum = 0.0;
+                for (auto weight : weights) { weightSum += weight; }
+                for (std::size_t j = 0; j < weights.size(); ++j) {
+                    if (weights[j] == 0.0) { continue; }
+                    taps[i].push_back(FilterTap{MapIndex(first + static_cast<std::int64_t>(j), srcSize, options.m_wrap),
+                                                static_cast<float>(weights[j] / weightSum)});
+                }
+            }
+            return taps;
+        }
+
+        /** Reduces a level in linear working space separably, first horizontally then vertically. */
+        std::vector<float> ReduceLevel(const std::vector<float>& src, std::uint32_t width, std::uint32_t height,
+                                       std::uint32_t dstWidth, std::uint32_t dstHeight, std::uint32_t channels,
+                                       const MipmapOptions& options)
+        {
+            const auto xTaps = CreateFilterTaps(width, dstWidth, options);
+            const auto yTaps = CreateFilterTaps(height, dstHeight, options);
+
+            std::vector<float> rows(static_cast<std::size_t>(dstWidth) * height * channels, 0.0f);
+            for (std::size_t y = 0; y < height; ++y) {
+                for (std::size_t x = 0; x < dstWidth; ++x) {
+                    auto* dstTexel = &rows[(y * dstWidth + x) * channels];
+                    for (const auto& tap : xTaps[x]) {
+                        const auto* srcTexel = &src[(y * width + tap.m_index) * channels];
+                        for (std::size_t c = 0; c < channels; ++c) { dstTexel[c] += tap.m_weight * srcTexel[c]; }
+                    }
+                }
+            }
+
+            const std::size_t rowSize = static_cast<std::size_t>(dstWidth) * channels;
+            std::vector<float> dst(rowSize * dstHeight, 0.0f);
+            for (std::size_t y = 0; y < dstHeight; ++y) {
+                auto* dstRow = &dst[y * rowSize];
+                for (const auto& tap : yTaps[y]) {
+                    const auto* srcRow = &rows[tap.m_index * rowSize];
+                    for (std::size_t i = 0; i < rowSize; ++i) { dstRow[i] += tap.m_weight * srcRow[i]; }
+                }
+            }
+            return dst;
+        }
+
+        void RenormalizeNormals(std::vector<float>& level, std::uint32_t channels)
+        {
+            for (std::size_t i = 0; i < level.size(); i += channels) {
+                const float length =
+                    std::sqrt(level[i] * level[i] + level[i + 1] * level[i + 1] + level[i + 2] * level[i + 2]);
+                if (length > 1e-6f) {
+                    level[i] /= length;
+                    level[i + 1] /= length;
+                    level[i + 2] /= length;
+                } else {
+                    level[i] = 0.0f;
+                    level[i + 1] = 0.0f;
+                    level[i + 2] = 1.0f;
+                }
+            }
+        }
+
+        /** Converts a normalized value to the linear working space, alpha is always the 4th channel. */
+        float DecodeContent(float value, std::uint32_t channel, MipmapContent content)
+        {
+            if (channel >= 3) { return value; }
+            if (content == MipmapContent::SRGB) { return SRGBToLinear(value); }
+            if (content == MipmapContent::NORMAL_MAP) { return value * 2.0f - 1.0f; }
+            return value;
+        }
+
+        float EncodeContent(float value, std::uint32_t channel, MipmapContent content)
+        {
+            if (channel >= 3) { return value; }
+            if (content == MipmapContent::SRGB) { return LinearToSRGB(value); }
+            if (content == MipmapContent::NORMAL_MAP) { return value * 0.5f + 0.5f; }
+            return value;
+        }
+
+        template<class T, class DecodeFn, class EncodeFn>
+        std::vector<MipLevel<T>> GenerateMipmapsImpl(std::span<const T> baseLevel, std::uint32_t width,
+                                                     std::uint32_t height, std::uint32_t channels,
+                                                     const MipmapOptions& options, DecodeFn decode, EncodeFn encode)
+        {
+            assert(channels >= 1 && channels <= 4);
+            assert(options.m_content != MipmapContent::NORMAL_MAP || channels >= 3);
+            assert(baseLevel.size() == static_cast<std::size_t>(width) * height * channels);
+
+            std::vector<float> current(baseLevel.size());
+            for (std::size_t i = 0; i < baseLevel.size(); ++i) {
+                current[i] = decode(baseLevel[i], static_cast<std::uint32_t>(i % channels));
+            }
+            if (options.m_content == MipmapContent::NORMAL_MAP) { RenormalizeNormals(current, channels); }
+
+            const auto levelCount = GetMipLevelCount(width, height);
+            std::vector<MipLevel<T>> levels;
+            levels.reserve(levelCount - 1);
+            for (std::uint32_t level = 1; level < levelCount; ++level) {
+                const auto levelWidth = GetMipLevelSize(width, level);
+                const auto levelHeight = GetMipLevelSize(height, level);
+                // each level is reduced from the previous one in working space, so quantization does not add up.
+                current = ReduceLevel(current, GetMipLevelSize(width, level - 1), GetMipLevelSize(height, level - 1),
+                                      levelWidth, levelHeight, channels, options);
+                if (options.m_content == MipmapContent::NORMAL_MAP) { RenormalizeNormals(current, channels); }
+
+                auto& mipLevel = levels.emplace_back(MipLevel<T>{levelWidth, levelHeight, {}});
+                mipLevel.m_data.resize(current.size());
+                for (std::size_t i = 0; i < current.size(); ++i) {
+                    mipLevel.m_data[i] = encode(current[i], static_cast<std::uint32_t>(i % channels));
+                }
+            }
+            return levels;
+        }
+    }
+
+    std::uint32_t GetMipLevelCount(std::uint32_t width, std::uint32_t height)
+    {
+        std::uint32_t levelCount = 1;
+        for (auto size = std::max(width, height); size > 1; size >>= 1) { ++levelCount; }
+        return levelCount;
+    }
+
+    float SRGBToLinear(float value)
+    {
+        if (value <= 0.04045f) { return value / 12.92f; }
+        return std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSRGB(float value)
+    {
+        if (value <= 0.0031308f) { return value * 12.92f; }
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    std::vector<MipLevel<std::uint8_t>> GenerateMipmaps(std::span<const std::uint8_t> baseLevel, std::uint32_t width,
+                                                        std::uint32_t height, std::uint32_t channels,
+                                                        const MipmapOptions& options)
+    {
+        // decoding tables for color channels (0) and alpha (1).
+        std::array<std::array<float, 256>, 2> decodeTable{};
+        for (std::size_t i = 0; i < 256; ++i) {
+            decodeTable[0][i] = DecodeContent(static_cast<float>(i) / 255.0f, 0, options.m_content);
+            decodeTable[1][i] = DecodeContent(static_cast<float>(i) / 255.0f, 3, options.m_content);
+        }
+
+        return GenerateMipmapsImpl<std::uint8_t>(
+            baseLevel, width, height, channels, options,
+            [&decodeTable](std::uint8_t value, std::uint32_t channel) {
+                return decodeTable[channel >= 3 ? 1 : 0][value];
+            },
+            [&options](float value, std::uint32_t channel) {
+                const auto encoded = std::clamp(EncodeContent(value, channel, options.m_content), 0.0f, 1.0f);
+                return static_cast<std::uint8_t>(encoded * 255.0f + 0.5f);
+            });
+    }
+
+    std::vector<MipLevel<float>> GenerateMipmaps(std::span<const float> baseLevel, std::uint32_t width,
+                                                 std::uint32_t height, std::uint32_t channels,
+                                                 const MipmapOptions& options)
+    {
+        return GenerateMipmapsImpl<float>(
+            baseLevel, width, height, channels, options,
+            [&options](float value, std::uint32_t channel) {
+                return DecodeContent(value, channel, options.m_content);
+            },
+            [&options](float value, std::uint32_t channel) {
+                return EncodeContent(value, channel, options.m_content);
+            });
+    }
+}
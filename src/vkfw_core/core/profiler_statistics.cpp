@@ -0,0 +1,77 @@
+/**
+ * @file   profiler_statistics.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of the aggregation of profiler samples per named region.
+ */
+
+#include "core/profiler_statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <ostream>
+#include <utility>
+
+namespace vkfw_core {
+
+    ProfilerStatistics::ProfilerStatistics(std::vector<std::string> counterNames)
+        : m_counterNames{std::move(counterNames)}
+    {
+    }
+
+    void ProfilerStatistics::AddSample(std::string_view name, std::uint32_t depth, double time,
+                                       std::span<const std::uint64_t> counters)
+    {
+        assert(counters.empty() || counters.size() == m_counterNames.size());
+
+        auto [it, inserted] = m_regionIndices.try_emplace(std::string{name}, m_regions.size());
+        if (inserted) {
+            auto& newRegion = m_regions.emplace_back();
+            newRegion.m_name = name;
+            newRegion.m_depth = depth;
+            newRegion.m_minTime = time;
+            newRegion.m_maxTime = time;
+            newRegion.m_counterSums.resize(m_counterNames.size(), 0.0);
+        }
+
+        auto& region = m_regions[it->second];
+        region.m_samples += 1;
+        region.m_minTime = std::min(region.m_minTime, time);
+        region.m_maxTime = std::max(region.m_maxTime, time);
+        region.m_sumTime += time;
+        if (!counters.empty()) {
+            region.m_counterSamples += 1;
+            for (std::size_t i = 0; i < counters.size(); ++i) {
+                region.m_counterSums[i] += static_cast<double>(counters[i]);
+            }
+        }
+    }
+
+    void ProfilerStatistics::Clear()
+    {
+        m_regions.clear();
+        m_regionIndices.clear();
+    }
+
+    const ProfilerRegionStatistics* ProfilerStatistics::FindRegion(std::string_view name) const
+    {
+        auto it = m_regionIndices.find(std::string{name});
+        if (it == m_regionIndices.end()) { return nullptr; }
+        return &m_regions[it->second];
+    }
+
+    void ProfilerStatistics::WriteCSV(std::ostream& out) const
+    {
+        out << "region,depth,samples,min_ms,avg_ms,max_ms";
+        for (const auto& counterName : m_counterNames) { out << ',' << counterName; }
+        out << '\n';
+
+        for (const auto& region : m_regions) {
+            out << '"' << region.m_name << "\"," << region.m_depth << ',' << region.m_samples << ','
+                << region.m_minTime << ',' << region.GetAverageTime() << ',' << region.m_maxTime;
+            for (std::size_t i = 0; i < m_counterNames.size(); ++i) { out << ',' << region.GetAverageCounter(i); }
+            out << '\n';
+        }
+    }
+}
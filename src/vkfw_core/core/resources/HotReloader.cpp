@@ -0,0 +1,222 @@
+/**
+ * @file   HotReloader.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the hot reloader.
+ */
+
+#include "core/resources/HotReloader.h"
+#include "core/job_pool.h"
+#include "core/resources/ShaderManager.h"
+#include "core/resources/TextureManager.h"
+#include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/pipeline/ReloadablePipeline.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <set>
+
+namespace vkfw_core {
+
+    namespace {
+        bool IsSameFile(const std::filesystem::path& file, const std::filesystem::path& otherFile)
+        {
+            std::error_code ec;
+            return std::filesystem::equivalent(file, otherFile, ec) && !ec;
+        }
+
+        bool IsShaderSource(const std::filesystem::path& file)
+        {
+            constexpr std::array shaderExtensions = {".vert", ".tesc",  ".tese",  ".geom",  ".frag",  ".comp", ".mesh",
+                                                     ".task", ".rgen", ".rint", ".rahit", ".rchit", ".rmiss", ".rcall"};
+            return std::find(shaderExtensions.begin(), shaderExtensions.end(), file.extension().string())
+                   != shaderExtensions.end();
+        }
+
+        bool IsShaderInclude(const std::filesystem::path& file)
+        {
+            const auto extension = file.extension().string();
+            return extension == ".glsl" || extension == ".h" || extension == ".inc";
+        }
+
+        template<typename T> bool IsReady(const std::future<T>& future)
+        {
+            return future.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+        }
+    }
+
+    HotReloader::HotReloader(const gfx::LogicalDevice* device) : m_device{device} {}
+
+    HotReloader::~HotReloader() = default;
+
+    void HotReloader::RegisterPipeline(gfx::ReloadablePipeline* pipeline)
+    {
+        const std::scoped_lock lock{m_pipelineMutex};
+        m_pipelines.push_back(pipeline);
+    }
+
+    void HotReloader::UnregisterPipeline(gfx::ReloadablePipeline* pipeline)
+    {
+        const std::scoped_lock lock{m_pipelineMutex};
+        m_pipelines.erase(std::remove(m_pipelines.begin(), m_pipelines.end(), pipeline), m_pipelines.end());
+    }
+
+    void HotReloader::ReplacePipeline(gfx::ReloadablePipeline* oldPipeline, gfx::ReloadablePipeline* newPipeline)
+    {
+        const std::scoped_lock lock{m_pipelineMutex};
+        std::replace(m_pipelines.begin(), m_pipelines.end(), oldPipeline, newPipeline);
+    }
+
+    void HotReloader::OnFilesChanged(const std::vector<std::filesystem::path>& changedFiles)
+    {
+        if (changedFiles.empty()) { return; }
+
+        const auto shaders = m_device->GetShaderManager()->GetLoadedResources();
+        const auto textures = m_device->GetTextureManager()->GetLoadedResources();
+        std::set<std::string> recompiledSources;
+        auto recompile = [this, &recompiledSources](const std::shared_ptr<gfx::Shader>& shader) {
+            // variants have no SPIR-V file, loading them compiles their source.
+            if (!shader->GetDefines().empty()) {
+                LoadShader(shader);
+            } else if (recompiledSources.insert(shader->GetSourceFilename()).second) {
+                CompileShader(shader->GetSourceFilename(), shader->GetSpirvFilename());
+            }
+        };
+
+        for (const auto& file : changedFiles) {
+            if (file.extension() == ".spv") {
+                for (const auto& [resId, shader] : shaders) {
+                    if (shader->GetDefines().empty() && IsSameFile(file, shader->GetSpirvFilename())) {
+                        LoadShader(shader);
+                    }
+                }
+            } else if (IsShaderSource(file)) {
+                for (const auto& [resId, shader] : shaders) {
+                    if (IsSameFile(file, shader->GetSourceFilename())) { recompile(shader); }
+                }
+            } else if (IsShaderInclude(file)) {
+                // includes are not tracked per shader, so all shaders are compiled again.
+                spdlog::info("Shader include {} changed, compiling all loaded shaders.", file.string());
+                for (const auto& [resId, shader] : shaders) { recompile(shader); }
+            } else {
+                for (const auto& [resId, texture] : textures) {
+                    if (IsSameFile(file, texture->GetFilename())) {
+                        spdlog::info("Texture {} changed, it is loaded again on the next request.", resId);
+                        m_device->GetTextureManager()->InvalidateResource(resId);
+                    }
+                }
+            }
+        }
+    }
+
+    bool HotReloader::Update()
+    {
+        UpdateCompiles();
+        if (!ApplyLoadedShaders()) { return false; }
+        return RebuildOutdatedPipelines();
+    }
+
+    void HotReloader::CompileShader(const std::string& sourceFilename, const std::string& spirvFilename)
+    {
+        auto compile = std::find_if(m_compiles.begin(), m_compiles.end(), [&sourceFilename](const auto& pending) {
+            return pending.m_sourceFilename == sourceFilename;
+        });
+        // compiling the same shader twice at once would write the same files.
+        if (compile != m_compiles.end()) {
+            compile->m_recompile = true;
+            return;
+        }
+
+        spdlog::info("Shader {} changed, compiling it.", sourceFilename);
+        // the compiled SPIR-V file is reported by the file watcher, which starts loading it.
+        auto result = m_device->GetResourceJobPool().Submit(
+            [compiler = m_device->GetShaderManager()->GetShaderCompiler(), sourceFilename, spirvFilename]() {
+                return compiler(sourceFilename, spirvFilename);
+            },
+            JobPriority::HIGH);
+        m_compiles.push_back(PendingCompile{sourceFilename, spirvFilename, std::move(result), false});
+    }
+
+    void HotReloader::LoadShader(const std::shared_ptr<gfx::Shader>& shader)
+    {
+        // a newer version of the code replaces loads that did not finish yet.
+        m_loads.erase(std::remove_if(m_loads.begin(), m_loads.end(),
+                                     [&shader](const auto& load) { return load.m_shader.lock() == shader; }),
+                      m_loads.end());
+        auto code = m_device->GetResourceJobPool().Submit(
+            [weakShader = std::weak_ptr{shader}]() -> std::vector<std::uint32_t> {
+                auto loadedShader = weakShader.lock();
+                if (!loadedShader) { return {}; }
+                if (!loadedShader->GetDefines().empty()) { return loadedShader->CompileSource(); }
+                return gfx::Shader::LoadSpirvFile(loadedShader->GetSpirvFilename());
+            },
+            JobPriority::HIGH);
+        m_loads.push_back(PendingLoad{shader, std::move(code)});
+    }
+
+    void HotReloader::UpdateCompiles()
+    {
+        std::vector<PendingCompile> recompiles;
+        for (auto compile = m_compiles.begin(); compile != m_compiles.end();) {
+            if (!IsReady(compile->m_result)) {
+                ++compile;
+                continue;
+            }
+
+            try {
+                if (!compile->m_result.get()) {
+                    spdlog::error("Compiling shader {} failed, using the old version.", compile->m_sourceFilename);
+                }
+            } catch (const std::exception& e) {
+                spdlog::error("Compiling shader {} failed, using the old version: {}", compile->m_sourceFilename,
+                              e.what());
+            }
+            if (compile->m_recompile) { recompiles.push_back(std::move(*compile)); }
+            compile = m_compiles.erase(compile);
+        }
+        for (const auto& recompile : recompiles) {
+            CompileShader(recompile.m_sourceFilename, recompile.m_spirvFilename);
+        }
+    }
+
+    bool HotReloader::ApplyLoadedShaders()
+    {
+        bool anyReloaded = false;
+        for (auto load = m_loads.begin(); load != m_loads.end();) {
+            if (!IsReady(load->m_code)) {
+                ++load;
+                continue;
+            }
+
+            if (auto shader = load->m_shader.lock()) {
+                try {
+                    shader->Reload(load->m_code.get());
+                    spdlog::info("Reloaded shader {}.", shader->GetId());
+                    anyReloaded = true;
+                } catch (const std::exception& e) {
+                    spdlog::error("Reloading shader {} failed, using the old version: {}", shader->GetId(), e.what());
+                }
+            }
+            load = m_loads.erase(load);
+        }
+        return anyReloaded;
+    }
+
+    bool HotReloader::RebuildOutdatedPipelines()
+    {
+        bool anyRebuilt = false;
+        const std::scoped_lock lock{m_pipelineMutex};
+        for (auto* pipeline : m_pipelines) {
+            if (!pipeline->IsOutdated()) { continue; }
+            try {
+                pipeline->Rebuild();
+                anyRebuilt = true;
+            } catch (const std::exception& e) {
+                spdlog::error("Rebuilding a pipeline failed, using the old version: {}", e.what());
+            }
+        }
+        return anyRebuilt;
+    }
+}
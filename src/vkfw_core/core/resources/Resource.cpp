@@ -10,6 +10,7 @@
 #include <filesystem>
 #include "app/ApplicationBase.h"
 #include "app/Configuration.h"
+#include "core/resources/ResourcePathIndex.h"
 
 namespace vkfw_core {
     /**
@@ -60,14 +61,8 @@ namespace vkfw_core {
      */
     std::string Resource::FindGeneralFileLocation(const std::string& localFilename, const std::string& resourceId)
     {
-        auto filename = ApplicationBase::instance().GetConfig().m_resourceBase + "/" + localFilename;
-        if (std::filesystem::exists(filename)) { return filename; }
-
-        for (const auto& dir : ApplicationBase::instance().GetConfig().m_resourceDirs) {
-            filename = dir;
-            filename.append("/").append(localFilename);
-            if (dir.empty()) { filename = localFilename; }
-            if (std::filesystem::exists(filename)) { return filename; }
+        if (auto filename = ApplicationBase::instance().GetResourcePathIndex().FindLocation(localFilename)) {
+            return *filename;
         }
 
         spdlog::error("Error while loading resource.\nResourceID: {}\nFilename: {}\nDescription: Cannot find local resource file.", resourceId, localFilename);
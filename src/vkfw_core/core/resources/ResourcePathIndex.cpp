@@ -0,0 +1,125 @@
+/**
+ * @file   ResourcePathIndex.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the resource path index.
+ */
+
+#include "core/resources/ResourcePathIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <system_error>
+
+namespace vkfw_core {
+
+    namespace {
+
+        /** Returns a key in lower case on platforms whose file names are case insensitive. */
+        std::string NormalizeCase(std::string key)
+        {
+#ifdef _WIN32
+            std::transform(key.begin(), key.end(), key.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+#endif
+            return key;
+        }
+    }
+
+    ResourcePathIndex::ResourcePathIndex(std::vector<std::string> searchDirectories)
+        : m_searchDirectories{std::move(searchDirectories)}
+    {
+    }
+
+    std::optional<std::string> ResourcePathIndex::FindLocation(const std::string& localFilename)
+    {
+        const auto key = MakeKey(localFilename);
+        const std::scoped_lock lock{m_mutex};
+        if (!m_isBuilt) { BuildUnlocked(); }
+        return FindLocationUnlocked(localFilename, key);
+    }
+
+    void ResourcePathIndex::Invalidate()
+    {
+        const std::scoped_lock lock{m_mutex};
+        m_isBuilt = false;
+    }
+
+    void ResourcePathIndex::Rebuild()
+    {
+        const std::scoped_lock lock{m_mutex};
+        BuildUnlocked();
+    }
+
+    std::size_t ResourcePathIndex::GetNumIndexedEntries()
+    {
+        const std::scoped_lock lock{m_mutex};
+        if (!m_isBuilt) { BuildUnlocked(); }
+        return m_entries.size();
+    }
+
+    void ResourcePathIndex::BuildUnlocked()
+    {
+        m_entries.clear();
+        m_isScanned.assign(m_searchDirectories.size(), false);
+        for (std::size_t i = 0; i < m_searchDirectories.size(); ++i) {
+            if (m_searchDirectories[i].empty()) { continue; }
+            m_isScanned[i] = true;
+
+            const std::filesystem::path directory{m_searchDirectories[i]};
+            std::error_code ec;
+            constexpr auto options = std::filesystem::directory_options::follow_directory_symlink;
+            for (std::filesystem::recursive_directory_iterator entry{directory, options, ec}, end;
+                 !ec && entry != end; entry.increment(ec)) {
+                // earlier directories take precedence.
+                m_entries.try_emplace(NormalizeCase(entry->path().lexically_relative(directory).generic_string()),
+                                      IndexedEntry{i});
+            }
+        }
+        m_isBuilt = true;
+    }
+
+    std::optional<std::string> ResourcePathIndex::FindLocationUnlocked(const std::string& localFilename,
+                                                                       const std::optional<std::string>& key) const
+    {
+        auto firstIndexed = m_searchDirectories.size();
+        auto isIndexed = false;
+        if (key) {
+            if (auto entry = m_entries.find(*key); entry != m_entries.end()) {
+                firstIndexed = entry->second.m_directory;
+                isIndexed = true;
+            }
+        }
+
+        // directories that are not indexed before the first one containing the file still need to be checked,
+        // files missing from the index (e.g., created after it was built) are checked in all directories.
+        for (std::size_t i = 0; i < firstIndexed; ++i) {
+            if (isIndexed && m_isScanned[i]) { continue; }
+            auto filename = MakeLocation(i, localFilename);
+            std::error_code ec;
+            if (std::filesystem::exists(filename, ec)) { return filename; }
+        }
+        if (firstIndexed < m_searchDirectories.size()) { return MakeLocation(firstIndexed, localFilename); }
+        return std::nullopt;
+    }
+
+    std::string ResourcePathIndex::MakeLocation(std::size_t directory, const std::string& localFilename) const
+    {
+        if (m_searchDirectories[directory].empty()) { return localFilename; }
+        return m_searchDirectories[directory] + "/" + localFilename;
+    }
+
+    std::optional<std::string> ResourcePathIndex::MakeKey(const std::string& localFilename)
+    {
+        const std::filesystem::path filename{localFilename};
+        auto normalized = filename.lexically_normal();
+        if (normalized.empty() || normalized == "." || normalized.has_root_path() || *normalized.begin() == "..") {
+            return std::nullopt;
+        }
+        auto key = normalized.generic_string();
+        // directories are indexed without a trailing separator.
+        if (key.ends_with('/')) { key.pop_back(); }
+        return NormalizeCase(std::move(key));
+    }
+}
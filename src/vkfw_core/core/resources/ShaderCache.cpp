@@ -0,0 +1,202 @@
+/**
+ * @file   ShaderCache.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the SPIR-V disk cache.
+ */
+
+#include "core/resources/ShaderCache.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <system_error>
+#include <tuple>
+
+namespace vkfw_core {
+
+    namespace {
+        constexpr std::uint32_t spirvMagicNumber = 0x07230203U;
+        constexpr std::string_view cacheExtension = ".spv";
+        constexpr std::string_view temporaryExtension = ".tmp";
+        /** Temporary files older than this are left by stores that did not finish, others may still be written. */
+        constexpr auto staleTemporaryAge = std::chrono::minutes{10};
+
+        std::uint64_t HashFNV1a64(std::string_view data, std::uint64_t hash)
+        {
+            for (auto c : data) { hash = (hash ^ static_cast<std::uint8_t>(c)) * 1099511628211ULL; }
+            return hash;
+        }
+    }
+
+    ShaderCache::ShaderCache(std::filesystem::path directory, std::uintmax_t budget)
+        : m_directory{std::move(directory)}, m_budget{budget}
+    {
+        std::vector<std::tuple<std::filesystem::file_time_type, std::string, std::uintmax_t>> files;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator entry{m_directory, ec}, end; !ec && entry != end;
+             entry.increment(ec)) {
+            if (!entry->is_regular_file(ec)) { continue; }
+            auto lastUse = entry->last_write_time(ec);
+            if (entry->path().extension() == temporaryExtension) {
+                if (!ec && std::filesystem::file_time_type::clock::now() - lastUse > staleTemporaryAge) {
+                    std::error_code removeEc;
+                    std::filesystem::remove(entry->path(), removeEc);
+                }
+                continue;
+            }
+            if (entry->path().extension() != cacheExtension) { continue; }
+            auto size = entry->file_size(ec);
+            if (!ec) { files.emplace_back(lastUse, entry->path().stem().string(), size); }
+        }
+
+        // the file times hold the last use of the previous runs.
+        std::sort(files.begin(), files.end());
+        const std::scoped_lock lock{m_mutex};
+        for (const auto& [lastUse, key, size] : files) {
+            m_entries[key] = CacheEntry{size, m_nextUse++};
+            m_size += size;
+        }
+        EvictUnlocked();
+    }
+
+    std::string ShaderCache::ComputeKey(std::string_view preprocessedSource, std::string_view compileOptions)
+    {
+        // two hashes with different offset bases make accidental collisions very unlikely.
+        std::array<std::uint64_t, 2> hashes = {14695981039346656037ULL, 9650029242287828579ULL};
+        for (auto& hash : hashes) {
+            hash = HashFNV1a64(compileOptions, hash);
+            hash = HashFNV1a64(std::string_view{"\n"}, hash);
+            hash = HashFNV1a64(preprocessedSource, hash);
+        }
+        return fmt::format("{:016x}{:016x}", hashes[0], hashes[1]);
+    }
+
+    std::optional<std::vector<std::uint32_t>> ShaderCache::Load(const std::string& key)
+    {
+        const std::scoped_lock lock{m_mutex};
+        auto entry = m_entries.find(key);
+        if (entry == m_entries.end()) {
+            ++m_numMisses;
+            return std::nullopt;
+        }
+
+        const auto filename = GetFilename(key);
+        std::ifstream file(filename, std::ios::ate | std::ios::binary);
+        const auto fileSize = file.is_open() ? static_cast<std::size_t>(file.tellg()) : std::size_t{0};
+        std::vector<std::uint32_t> code;
+        if (fileSize % sizeof(std::uint32_t) == 0) {
+            code.resize(fileSize / sizeof(std::uint32_t));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(fileSize)); // NOLINT
+        }
+        if (!file || code.empty() || code[0] != spirvMagicNumber) {
+            spdlog::warn("Removing invalid shader cache entry {}.", filename.string());
+            file.close();
+            RemoveUnlocked(entry);
+            ++m_numMisses;
+            return std::nullopt;
+        }
+
+        entry->second.m_lastUse = m_nextUse++;
+        std::error_code ec;
+        std::filesystem::last_write_time(filename, std::filesystem::file_time_type::clock::now(), ec);
+        ++m_numHits;
+        return code;
+    }
+
+    void ShaderCache::Store(const std::string& key, const std::vector<std::uint32_t>& code)
+    {
+        const std::scoped_lock lock{m_mutex};
+        const auto filename = GetFilename(key);
+        // writing to a temporary file first keeps other processes from reading incomplete entries.
+        auto tmpFilename = filename;
+        tmpFilename += temporaryExtension;
+        std::error_code ec;
+        std::filesystem::create_directories(m_directory, ec);
+        {
+            std::ofstream file(tmpFilename, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(code.data()), // NOLINT
+                       static_cast<std::streamsize>(code.size() * sizeof(std::uint32_t)));
+            if (!file) { ec = std::make_error_code(std::errc::io_error); }
+        }
+        if (!ec) { std::filesystem::rename(tmpFilename, filename, ec); }
+        if (ec) {
+            spdlog::warn("Could not store shader cache entry {}: {}", filename.string(), ec.message());
+            std::filesystem::remove(tmpFilename, ec);
+            return;
+        }
+
+        auto& entry = m_entries[key];
+        m_size -= entry.m_size;
+        entry = CacheEntry{code.size() * sizeof(std::uint32_t), m_nextUse++};
+        m_size += entry.m_size;
+        EvictUnlocked();
+    }
+
+    void ShaderCache::SetBudget(std::uintmax_t budget)
+    {
+        const std::scoped_lock lock{m_mutex};
+        m_budget = budget;
+        EvictUnlocked();
+    }
+
+    std::uintmax_t ShaderCache::GetBudget() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        return m_budget;
+    }
+
+    std::uintmax_t ShaderCache::GetSize() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        return m_size;
+    }
+
+    std::size_t ShaderCache::GetNumEntries() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        return m_entries.size();
+    }
+
+    std::size_t ShaderCache::GetNumHits() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        return m_numHits;
+    }
+
+    std::size_t ShaderCache::GetNumMisses() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        return m_numMisses;
+    }
+
+    std::filesystem::path ShaderCache::GetFilename(const std::string& key) const
+    {
+        return m_directory / (key + std::string{cacheExtension});
+    }
+
+    void ShaderCache::RemoveUnlocked(std::map<std::string, CacheEntry>::iterator entry)
+    {
+        std::error_code ec;
+        std::filesystem::remove(GetFilename(entry->first), ec);
+        m_size -= entry->second.m_size;
+        m_entries.erase(entry);
+    }
+
+    void ShaderCache::EvictUnlocked()
+    {
+        while (m_size > m_budget && !m_entries.empty()) {
+            auto leastRecentlyUsed =
+                std::min_element(m_entries.begin(), m_entries.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.m_lastUse < rhs.second.m_lastUse;
+                });
+            RemoveUnlocked(leastRecentlyUsed);
+        }
+    }
+}
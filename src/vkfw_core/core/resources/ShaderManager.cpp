@@ -7,14 +7,21 @@
  */
 
 #include "core/resources/ShaderManager.h"
+#include "app/ApplicationBase.h"
+#include "gfx/vk/RuntimeShaderCompiler.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 namespace vkfw_core {
     /**
      * Constructor.
      * @param device the device to create resources in this manager.
+     * @param jobPool the job pool for loading shaders asynchronously.
      */
-    ShaderManager::ShaderManager(const gfx::LogicalDevice* device) :
-        ResourceManager(device)
+    ShaderManager::ShaderManager(const gfx::LogicalDevice* device, JobPool* jobPool) :
+        ResourceManager(device, jobPool)
     {
     }
 
@@ -24,16 +31,93 @@ namespace vkfw_core {
     ShaderManager& ShaderManager::operator=(const ShaderManager&) = default;
 
     /** Default move constructor. */
-    ShaderManager::ShaderManager(ShaderManager&& rhs) noexcept : ResourceManagerBase(std::move(rhs)) {}
+    ShaderManager::ShaderManager(ShaderManager&& rhs) noexcept
+        : ResourceManagerBase(std::move(rhs)), m_shaderCompiler{std::move(rhs.m_shaderCompiler)}
+    {
+    }
 
     /** Default move assignment operator. */
     ShaderManager& ShaderManager::operator=(ShaderManager&& rhs) noexcept
     {
         ResourceManagerBase* tResMan = this;
         *tResMan = static_cast<ResourceManagerBase&&>(std::move(rhs));
+        m_shaderCompiler = std::move(rhs.m_shaderCompiler);
         return *this;
     }
 
     /** Default destructor. */
     ShaderManager::~ShaderManager() = default;
+
+    bool ShaderManager::CompileShader(const std::string& sourceFilename, const std::string& spirvFilename)
+    {
+        if (!gfx::RuntimeShaderCompiler::IsAvailable()) {
+            return CompileWithExternalTools(sourceFilename, spirvFilename);
+        }
+
+        std::vector<std::uint32_t> code;
+        try {
+            code = ApplicationBase::instance().GetRuntimeShaderCompiler().Compile(
+                sourceFilename, gfx::Shader::GetShaderStage(sourceFilename), {});
+        } catch (const std::exception& e) {
+            spdlog::error("Could not compile shader {}: {}", sourceFilename, e.what());
+            return false;
+        }
+
+        // writing to a temporary file and renaming it replaces the old code at once.
+        const auto compiledFilename = spirvFilename + ".tmp";
+        std::error_code ec;
+        {
+            std::ofstream compiledFile(compiledFilename, std::ios::binary | std::ios::trunc);
+            compiledFile.write(reinterpret_cast<const char*>(code.data()), // NOLINT
+                               static_cast<std::streamsize>(code.size() * sizeof(std::uint32_t)));
+            if (!compiledFile) { ec = std::make_error_code(std::errc::io_error); }
+        }
+        if (!ec) { std::filesystem::rename(compiledFilename, spirvFilename, ec); }
+        if (ec) {
+            spdlog::error("Could not replace compiled shader {}: {}", spirvFilename, ec.message());
+            std::filesystem::remove(compiledFilename, ec);
+            return false;
+        }
+        return true;
+    }
+
+    bool ShaderManager::CompileWithExternalTools(const std::string& sourceFilename, const std::string& spirvFilename)
+    {
+#if defined(VKFW_GLSL_PREPROCESSOR) && defined(VKFW_GLSLANG_VALIDATOR)
+        auto runCommand = [](std::string command) {
+#ifdef _WIN32
+            // cmd removes the outer quotes of the command.
+            command = "\"" + command + "\"";
+#endif
+            return std::system(command.c_str()) == 0; // NOLINT(cert-env33-c)
+        };
+
+        const std::filesystem::path source{sourceFilename};
+        const auto preprocessedFilename =
+            (source.parent_path() / (source.stem().string() + ".gen" + source.extension().string())).string();
+        // compiling to a temporary file keeps the old code if compilation fails and renaming it replaces it at once.
+        const auto compiledFilename = spirvFilename + ".tmp";
+        if (!runCommand(fmt::format(R"("{}" "{}" -i "{}" -o "{}")", VKFW_GLSL_PREPROCESSOR, sourceFilename,
+                                    VKFW_SHADER_INCLUDE_DIR, preprocessedFilename))
+            || !runCommand(fmt::format(R"("{}" -V "{}" --target-env vulkan1.2 -o "{}")", VKFW_GLSLANG_VALIDATOR,
+                                       preprocessedFilename, compiledFilename))) {
+            spdlog::error("Could not compile shader {}.", sourceFilename);
+            std::error_code ec;
+            std::filesystem::remove(compiledFilename, ec);
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(compiledFilename, spirvFilename, ec);
+        if (ec) {
+            spdlog::error("Could not replace compiled shader {}: {}", spirvFilename, ec.message());
+            return false;
+        }
+        return true;
+#else
+        static_cast<void>(spirvFilename);
+        spdlog::warn("No shader compiler available, {} needs to be compiled by the build.", sourceFilename);
+        return false;
+#endif
+    }
 }
@@ -0,0 +1,165 @@
+/**
+ * @file   TextureManager.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Contains the implementation of TextureManager.
+ */
+
+#include "core/resources/TextureManager.h"
+#include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/QueuedDeviceTransfer.h"
+#include "gfx/vk/memory/MemoryGroup.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+#include "gfx/vk/wrappers/PipelineBarriers.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace vkfw_core {
+
+    TextureManager::TextureManager(const gfx::LogicalDevice* device, JobPool* jobPool)
+        : ResourceManager(device, jobPool)
+    {
+    }
+
+    TextureManager::~TextureManager() = default;
+
+    TextureHandle TextureManager::GetResourceAsync(const std::string& resId, bool useSRGB, bool flipTexture,
+                                                   const gfx::TextureMipmapDesc& mipmaps,
+                                                   const gfx::TextureCompressionDesc& compression,
+                                                   const ResourceLoadDesc& loadDesc)
+    {
+        // the lock keeps uploads from registering the texture between the lookups.
+        const std::scoped_lock lock{m_pendingMutex};
+        if (auto texture = FindResource(resId)) {
+            auto state = std::make_shared<TextureHandle::State>();
+            state->m_texture = std::move(texture);
+            state->m_ready.store(true, std::memory_order_release);
+            return TextureHandle{std::move(state)};
+        }
+
+        // loads whose requests all stopped may already be dropped, so they are not shared anymore.
+        auto pending = std::find_if(m_pendingLoads.begin(), m_pendingLoads.end(), [&resId](const PendingLoad& load) {
+            return load.m_id == resId && !load.m_stopSource.stop_requested();
+        });
+        if (pending != m_pendingLoads.end()) {
+            AddRequest(*pending, loadDesc.m_stopToken);
+            return TextureHandle{pending->m_state};
+        }
+
+        auto state = std::make_shared<TextureHandle::State>();
+        state->m_placeholder = GetDevice()->GetDummyTexture();
+        auto decode = [device = GetDevice(), resId, useSRGB, flipTexture, mipmaps, compression]() {
+            return std::make_shared<gfx::Texture2D>(resId, device, useSRGB, flipTexture, mipmaps, compression);
+        };
+        std::stop_source stopSource;
+        auto& load = m_pendingLoads.emplace_back(
+            PendingLoad{resId, GetJobPool().Submit(std::move(decode), loadDesc.m_priority, stopSource.get_token()),
+                        state, stopSource, std::make_shared<std::atomic_size_t>(0), {}, nullptr, gfx::TimelinePoint{}});
+        AddRequest(load, loadDesc.m_stopToken);
+        return TextureHandle{std::move(state)};
+    }
+
+    std::size_t TextureManager::UploadLoadedTextures(const gfx::Queue& queue)
+    {
+        const std::scoped_lock lock{m_pendingMutex};
+        const auto numReady = FinishUploads();
+        StartUploads(queue);
+        return numReady;
+    }
+
+    void TextureManager::WaitForLoads(const gfx::Queue& queue)
+    {
+        const std::scoped_lock lock{m_pendingMutex};
+        for (const auto& load : m_pendingLoads) {
+            if (load.m_texture.valid()) { load.m_texture.wait(); }
+        }
+        StartUploads(queue);
+        for (const auto& load : m_pendingLoads) { load.m_uploadPoint.Wait(GetDevice(), defaultFenceTimeout); }
+        FinishUploads();
+    }
+
+    std::size_t TextureManager::GetNumPendingLoads() const
+    {
+        const std::scoped_lock lock{m_pendingMutex};
+        return m_pendingLoads.size();
+    }
+
+    void TextureManager::AddRequest(PendingLoad& load, const std::stop_token& stopToken)
+    {
+        load.m_numActiveRequests->fetch_add(1);
+        // requests that cannot be stopped keep the load alive for good.
+        if (!stopToken.stop_possible()) { return; }
+
+        load.m_stopCallbacks.push_back(std::make_unique<std::stop_callback<std::function<void()>>>(
+            stopToken, [numActiveRequests = load.m_numActiveRequests, stopSource = load.m_stopSource]() mutable {
+                if (numActiveRequests->fetch_sub(1) == 1) { stopSource.request_stop(); }
+            }));
+    }
+
+    void TextureManager::StartUploads(const gfx::Queue& queue)
+    {
+        std::shared_ptr<gfx::MemoryGroup> memGroup;
+        std::vector<PendingLoad*> uploads;
+        const auto blitMipmaps = gfx::QueuedDeviceTransfer::CanGenerateMipmaps(GetDevice(), queue);
+        for (auto& load : m_pendingLoads) {
+            const auto isDecoded = load.m_texture.valid()
+                                   && load.m_texture.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+            if (!isDecoded) { continue; }
+            try {
+                auto texture = load.m_texture.get();
+                if (!blitMipmaps) { texture->GenerateMipmapsOnCPU(); }
+                if (!memGroup) {
+                    memGroup = std::make_shared<gfx::MemoryGroup>(
+                        GetDevice(), fmt::format("AsyncTextures-{}", m_uploadCount++), vk::MemoryPropertyFlags());
+                }
+                texture->AddToMemoryGroup(memGroup);
+                load.m_uploadedTexture = std::move(texture);
+                uploads.push_back(&load);
+            } catch (const std::future_error&) {
+                spdlog::info("Loading texture \"{}\" asynchronously was cancelled.", load.m_id);
+                load.m_state->m_failed.store(true, std::memory_order_release);
+            } catch (const std::exception& e) {
+                spdlog::error("Could not load texture \"{}\" asynchronously: {}", load.m_id, e.what());
+                load.m_state->m_failed.store(true, std::memory_order_release);
+            }
+        }
+
+        if (!uploads.empty()) {
+            memGroup->FinalizeDeviceGroup();
+            gfx::QueuedDeviceTransfer transfer{GetDevice(), queue};
+            memGroup->TransferData(transfer);
+
+            // the layouts are changed in the same submit, so the textures can be used right after it like the dummy.
+            gfx::PipelineBarrier barrier{GetDevice()};
+            for (auto* load : uploads) {
+                load->m_uploadedTexture->GetTexture().AccessBarrier(vk::AccessFlagBits2KHR::eShaderRead,
+                                                                    vk::PipelineStageFlagBits2KHR::eFragmentShader,
+                                                                    vk::ImageLayout::eShaderReadOnlyOptimal, barrier);
+            }
+            transfer.RecordBarrier(barrier);
+            const auto uploadPoint = transfer.FlushAndRelease();
+            for (auto* load : uploads) { load->m_uploadPoint = uploadPoint; }
+        }
+
+        // failed loads have neither a decode nor an upload running.
+        std::erase_if(m_pendingLoads,
+                      [](const PendingLoad& load) { return !load.m_texture.valid() && !load.m_uploadedTexture; });
+    }
+
+    std::size_t TextureManager::FinishUploads()
+    {
+        auto uploadedBegin =
+            std::stable_partition(m_pendingLoads.begin(), m_pendingLoads.end(), [this](const auto& load) {
+                return !load.m_uploadedTexture || !load.m_uploadPoint.IsReached(GetDevice());
+            });
+        const auto numReady = static_cast<std::size_t>(std::distance(uploadedBegin, m_pendingLoads.end()));
+        for (auto load = uploadedBegin; load != m_pendingLoads.end(); ++load) {
+            load->m_state->m_texture = SetResource(load->m_id, std::move(load->m_uploadedTexture));
+            load->m_state->m_ready.store(true, std::memory_order_release);
+        }
+        m_pendingLoads.erase(uploadedBegin, m_pendingLoads.end());
+        return numReady;
+    }
+}
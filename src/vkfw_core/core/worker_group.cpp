@@ -0,0 +1,82 @@
+/**
+ * @file   worker_group.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of a group of persistent threads that run the same task in fork-join fashion.
+ */
+
+#include "core/worker_group.h"
+
+#include <algorithm>
+
+namespace vkfw_core {
+
+    WorkerGroup::WorkerGroup(std::size_t numThreads)
+    {
+        const auto numWorkers = std::max<std::size_t>(numThreads, 1) - 1;
+        m_threads.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) { m_threads.emplace_back(&WorkerGroup::WorkerLoop, this, i + 1); }
+    }
+
+    WorkerGroup::~WorkerGroup()
+    {
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_stop = true;
+        }
+        m_runStarted.notify_all();
+        for (auto& thread : m_threads) { thread.join(); }
+    }
+
+    void WorkerGroup::Run(function_view<void(std::size_t threadIndex)> task)
+    {
+        {
+            const std::scoped_lock lock{m_mutex};
+            m_task = task;
+            m_runningWorkers = m_threads.size();
+            m_exception = nullptr;
+            ++m_run;
+        }
+        m_runStarted.notify_all();
+
+        std::exception_ptr exception;
+        try {
+            task(0);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+
+        std::unique_lock lock{m_mutex};
+        m_workerFinished.wait(lock, [this]() { return m_runningWorkers == 0; });
+        if (!exception) { exception = m_exception; }
+        m_task = nullptr;
+        lock.unlock();
+
+        if (exception) { std::rethrow_exception(exception); }
+    }
+
+    void WorkerGroup::WorkerLoop(std::size_t threadIndex)
+    {
+        std::size_t lastRun = 0;
+        std::unique_lock lock{m_mutex};
+        while (true) {
+            m_runStarted.wait(lock, [this, lastRun]() { return m_stop || m_run != lastRun; });
+            if (m_stop) { return; }
+            lastRun = m_run;
+            auto task = m_task;
+            lock.unlock();
+
+            std::exception_ptr exception;
+            try {
+                task(threadIndex);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+
+            lock.lock();
+            if (exception && !m_exception) { m_exception = exception; }
+            if (--m_runningWorkers == 0) { m_workerFinished.notify_one(); }
+        }
+    }
+}
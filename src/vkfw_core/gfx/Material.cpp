@@ -8,6 +8,7 @@
 
 #include "gfx/Material.h"
 #include "gfx/Texture2D.h"
+#include "core/resources/TextureManager.h"
 #include "gfx/vk/LogicalDevice.h"
 #include "gfx/vk/textures/DeviceTexture.h"
 
@@ -8,7 +8,11 @@
 
 #include "gfx/Texture2D.h"
 #include <filesystem>
+#include <fstream>
 #include <stb_image.h>
+#include "core/block_compression.h"
+#include "core/ktx2.h"
+#include "core/memory_mapped_file.h"
 #include "gfx/vk/LogicalDevice.h"
 #include "gfx/vk/textures/HostTexture.h"
 #include "gfx/vk/QueuedDeviceTransfer.h"
@@ -17,6 +21,102 @@
 
 namespace vkfw_core::gfx {
 
+    namespace {
+        bool IsSRGBFormat(vk::Format format)
+        {
+            return format == vk::Format::eR8Srgb || format == vk::Format::eR8G8Srgb
+                   || format == vk::Format::eR8G8B8Srgb || format == vk::Format::eR8G8B8A8Srgb;
+        }
+
+        bool IsFloatFormat(vk::Format format)
+        {
+            return format == vk::Format::eR32Sfloat || format == vk::Format::eR32G32Sfloat
+                   || format == vk::Format::eR32G32B32Sfloat || format == vk::Format::eR32G32B32A32Sfloat;
+        }
+
+        std::optional<BlockFormat> GetBlockFormat(vk::Format format)
+        {
+            switch (format) {
+            case vk::Format::eBc1RgbUnormBlock:
+            case vk::Format::eBc1RgbSrgbBlock: return BlockFormat::BC1;
+            case vk::Format::eBc1RgbaUnormBlock:
+            case vk::Format::eBc1RgbaSrgbBlock: return BlockFormat::BC1A;
+            case vk::Format::eBc2UnormBlock:
+            case vk::Format::eBc2SrgbBlock: return BlockFormat::BC2;
+            case vk::Format::eBc3UnormBlock:
+            case vk::Format::eBc3SrgbBlock: return BlockFormat::BC3;
+            case vk::Format::eBc4UnormBlock:
+            case vk::Format::eBc4SnormBlock: return BlockFormat::BC4;
+            case vk::Format::eBc5UnormBlock:
+            case vk::Format::eBc5SnormBlock: return BlockFormat::BC5;
+            case vk::Format::eBc6HUfloatBlock:
+            case vk::Format::eBc6HSfloatBlock: return BlockFormat::BC6H;
+            case vk::Format::eBc7UnormBlock:
+            case vk::Format::eBc7SrgbBlock: return BlockFormat::BC7;
+            default: return std::nullopt;
+            }
+        }
+
+        /** The format of the texels decoded on the CPU, undefined if the blocks cannot be decoded. */
+        vk::Format GetDecompressedFormat(vk::Format format)
+        {
+            switch (format) {
+            case vk::Format::eBc1RgbUnormBlock:
+            case vk::Format::eBc1RgbaUnormBlock:
+            case vk::Format::eBc2UnormBlock:
+            case vk::Format::eBc3UnormBlock:
+            case vk::Format::eBc7UnormBlock: return vk::Format::eR8G8B8A8Unorm;
+            case vk::Format::eBc1RgbSrgbBlock:
+            case vk::Format::eBc1RgbaSrgbBlock:
+            case vk::Format::eBc2SrgbBlock:
+            case vk::Format::eBc3SrgbBlock:
+            case vk::Format::eBc7SrgbBlock: return vk::Format::eR8G8B8A8Srgb;
+            case vk::Format::eBc4UnormBlock: return vk::Format::eR8Unorm;
+            case vk::Format::eBc5UnormBlock: return vk::Format::eR8G8Unorm;
+            default: return vk::Format::eUndefined;
+            }
+        }
+
+        /** The bytes per pixel of the uncompressed formats loaded from KTX 2.0 files, 0 for other formats. */
+        unsigned int GetUncompressedBytesPP(vk::Format format)
+        {
+            switch (format) {
+            case vk::Format::eR8Unorm:
+            case vk::Format::eR8Srgb: return 1;
+            case vk::Format::eR8G8Unorm:
+            case vk::Format::eR8G8Srgb: return 2;
+            case vk::Format::eR8G8B8A8Unorm:
+            case vk::Format::eR8G8B8A8Srgb: return 4;
+            default: return 0;
+            }
+        }
+
+        /** Returns the cache filename, the options that change the encoded data are hashed into the name. */
+        std::string GetCacheFilename(const std::string& filename, bool useSRGB, bool flipTexture,
+                                     const TextureMipmapDesc& mipmaps, const TextureCompressionDesc& compression)
+        {
+            auto key = fmt::format("{} {} {} {}", useSRGB, flipTexture, compression.m_highQuality,
+                                   mipmaps.m_generation != MipmapGeneration::NONE);
+            if (mipmaps.m_generation != MipmapGeneration::NONE) {
+                const auto& options = mipmaps.m_options;
+                key += fmt::format(" {} {} {} {} {}", static_cast<int>(options.m_filter),
+                                   static_cast<int>(options.m_content), options.m_wrap, options.m_kaiserWidth,
+                                   options.m_kaiserAlpha);
+            }
+
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (auto c : key) { hash = (hash ^ static_cast<std::uint8_t>(c)) * 1099511628211ULL; }
+            return fmt::format("{}.{:016x}.ktx2", filename, hash);
+        }
+
+        bool IsCacheUpToDate(const std::filesystem::path& cacheFilename, const std::filesystem::path& filename)
+        {
+            std::error_code ec;
+            const auto cacheTime = std::filesystem::last_write_time(cacheFilename, ec);
+            return !ec && cacheTime >= std::filesystem::last_write_time(filename);
+        }
+    }
+
     Texture2D::Texture2D(const std::string& textureFilename, bool flipTexture, const LogicalDevice* device)
         : Resource{textureFilename, device}
         , m_textureFilename{FindResourceLocation(textureFilename)}
@@ -30,28 +130,55 @@ namespace vkfw_core::gfx {
             throw file_not_found{m_textureFilename};
         }
 
-        if (flipTexture) {
-            stbi_set_flip_vertically_on_load(1);
-        } else {
-            stbi_set_flip_vertically_on_load(0);
-        }
+        // the thread local flag keeps decoding on multiple threads independent.
+        stbi_set_flip_vertically_on_load_thread(flipTexture ? 1 : 0);
     }
 
     Texture2D::Texture2D(const std::string& textureFilename, const LogicalDevice* device,
                          bool useSRGB, bool flipTexture, MemoryGroup& memGroup,
-                         const std::vector<std::uint32_t>& queueFamilyIndices)
-        : Texture2D{ textureFilename, flipTexture, device }
+                         const std::vector<std::uint32_t>& queueFamilyIndices, const TextureMipmapDesc& mipmaps,
+                         const TextureCompressionDesc& compression)
+        : Texture2D{textureFilename, device, useSRGB, flipTexture, mipmaps, compression}
     {
-        m_memoryGroup = &memGroup;
-        auto loadFn = [this, &memGroup, &queueFamilyIndices](const glm::u32vec4& size, const TextureDescriptor& desc, void* data)
+        AddToMemoryGroup(memGroup, queueFamilyIndices);
+    }
+
+    Texture2D::Texture2D(const std::string& textureFilename, const LogicalDevice* device, bool useSRGB,
+                         bool flipTexture, const TextureMipmapDesc& mipmaps, const TextureCompressionDesc& compression)
+        : Texture2D{textureFilename, flipTexture, device}
+    {
+        if (std::filesystem::path{m_textureFilename}.extension() == ".ktx2") {
+            LoadTextureKTX2(m_textureFilename);
+            return;
+        }
+
+        const auto isHDR = stbi_is_hdr(m_textureFilename.c_str()) != 0;
+        if (compression.m_cache != TextureCache::NONE && !isHDR) {
+            const auto cacheFilename = GetCacheFilename(m_textureFilename, useSRGB, flipTexture, mipmaps, compression);
+            if (compression.m_cache == TextureCache::READ_WRITE && !IsCacheUpToDate(cacheFilename, m_textureFilename)) {
+                WriteTextureCache(m_textureFilename, cacheFilename, useSRGB, mipmaps, compression);
+            }
+            if (IsCacheUpToDate(cacheFilename, m_textureFilename)) {
+                LoadTextureKTX2(cacheFilename);
+                return;
+            }
+        }
+
+        auto loadFn = [this, &mipmaps](const glm::u32vec4& size, const TextureDescriptor& desc, void* data)
         {
-            m_textureIdx = memGroup.AddTextureToGroup(GetId(), desc, vk::ImageLayout::ePreinitialized, size, 1,
-                                                      queueFamilyIndices);
-            glm::u32vec3 dataSize(size.x * memGroup.GetHostTexture(m_textureIdx)->GetDescriptor().m_bytesPP, size.y, size.z);
-            memGroup.AddDataToTextureInGroup(m_textureIdx, vk::ImageAspectFlagBits::eColor, 0, 0, dataSize, data,
-                                             stbi_image_free);
+            std::shared_ptr<const void> image{data, stbi_image_free};
+            const auto generation = GetMipmapGeneration(mipmaps, desc.m_format);
+            m_decoded.m_size = size;
+            m_decoded.m_format = desc.m_format;
+            m_decoded.m_bytesPP = desc.m_bytesPP;
+            m_decoded.m_mipLevels = generation == MipmapGeneration::NONE ? 1U : GetMipLevelCount(size.x, size.y);
+            m_decoded.m_generateMipmaps = generation == MipmapGeneration::GPU;
+            m_decoded.m_mipmapOptions = mipmaps.m_options;
+            m_decoded.m_levels.push_back(
+                DecodedLevel{0, glm::u32vec3(size.x * desc.m_bytesPP, size.y, size.z), data, std::move(image)});
+            if (generation == MipmapGeneration::CPU) { AddMipmapLevels(size, desc, data, mipmaps.m_options); }
         };
-        if (stbi_is_hdr(m_textureFilename.c_str()) != 0) {
+        if (isHDR) {
             LoadTextureHDR(m_textureFilename, loadFn);
         } else {
             LoadTextureLDR(m_textureFilename, useSRGB, loadFn);
@@ -60,6 +187,42 @@ namespace vkfw_core::gfx {
 
     Texture2D::~Texture2D() = default;
 
+    void Texture2D::GenerateMipmapsOnCPU()
+    {
+        assert(m_memoryGroup == nullptr);
+        if (!m_decoded.m_generateMipmaps) { return; }
+
+        const auto desc = TextureDescriptor::SampleOnlyTextureDesc(m_decoded.m_bytesPP, m_decoded.m_format);
+        AddMipmapLevels(m_decoded.m_size, desc, m_decoded.m_levels[0].m_data, m_decoded.m_mipmapOptions);
+        m_decoded.m_generateMipmaps = false;
+    }
+
+    void Texture2D::AddToMemoryGroup(MemoryGroup& memGroup, const std::vector<std::uint32_t>& queueFamilyIndices)
+    {
+        assert(m_memoryGroup == nullptr);
+        auto desc = TextureDescriptor::SampleOnlyTextureDesc(m_decoded.m_bytesPP, m_decoded.m_format);
+        if (m_decoded.m_generateMipmaps) { desc.m_imageUsage |= vk::ImageUsageFlagBits::eTransferSrc; }
+
+        m_memoryGroup = &memGroup;
+        m_textureIdx = memGroup.AddTextureToGroup(GetId(), desc, vk::ImageLayout::ePreinitialized, m_decoded.m_size,
+                                                  m_decoded.m_mipLevels, queueFamilyIndices);
+        for (auto& level : m_decoded.m_levels) {
+            // the data lives as long as the deleter, which the memory group keeps until the data is transferred.
+            memGroup.AddDataToTextureInGroup(m_textureIdx, vk::ImageAspectFlagBits::eColor, level.m_mipLevel, 0,
+                                             level.m_dataSize, level.m_data,
+                                             [owner = std::move(level.m_owner)](void*) {});
+        }
+        if (m_decoded.m_generateMipmaps) { memGroup.AddMipmapGenerationToTextureInGroup(m_textureIdx); }
+        m_decoded.m_levels.clear();
+    }
+
+    void Texture2D::AddToMemoryGroup(std::shared_ptr<MemoryGroup> memGroup,
+                                     const std::vector<std::uint32_t>& queueFamilyIndices)
+    {
+        AddToMemoryGroup(*memGroup, queueFamilyIndices);
+        m_ownedMemoryGroup = std::move(memGroup);
+    }
+
     void Texture2D::LoadTextureLDR(const std::string& filename, bool useSRGB,
         const function_view<void(const glm::u32vec4& size, const TextureDescriptor& desc, void* data)>& loadFn)
     {
@@ -119,6 +282,165 @@ namespace vkfw_core::gfx {
         // Data deletion is handled in the loadFn function.
     }
 
+    void Texture2D::LoadTextureKTX2(const std::string& filename)
+    {
+        // the level data is read from the mapped file, which lives as long as the deleters of the memory group.
+        auto file = std::make_shared<const MemoryMappedFile>(filename);
+        Ktx2Image image;
+        try {
+            image = ParseKtx2(file->GetData());
+        } catch (const std::runtime_error& e) {
+            spdlog::error("Could not load texture (KTX2).\nResourceID: {}\nFilename: {}\nDescription: {}", GetId(),
+                          filename, e.what());
+            throw;
+        }
+
+        const auto& header = image.m_header;
+        if (header.m_pixelHeight == 0 || header.m_pixelDepth != 0 || header.m_layerCount != 0
+            || header.m_faceCount != 1) {
+            spdlog::error("Could not load texture (KTX2).\nResourceID: {}\nFilename: {}\nDescription: Only 2D "
+                          "textures without array layers or faces are supported.",
+                          GetId(), filename);
+            throw std::runtime_error("Unsupported KTX2 texture type.");
+        }
+
+        const auto format = static_cast<vk::Format>(header.m_vkFormat);
+        const auto blockFormat = GetBlockFormat(format);
+        std::vector<std::pair<unsigned int, vk::Format>> candidateFormats;
+        if (blockFormat) {
+            candidateFormats.emplace_back(static_cast<unsigned int>(GetBlockSize(*blockFormat)), format);
+            if (auto decompressedFormat = GetDecompressedFormat(format); decompressedFormat != vk::Format::eUndefined) {
+                candidateFormats.emplace_back(GetBlockChannels(*blockFormat), decompressedFormat);
+            }
+        } else if (auto bytesPP = GetUncompressedBytesPP(format); bytesPP > 0) {
+            candidateFormats.emplace_back(bytesPP, format);
+        } else {
+            spdlog::error("Could not load texture (KTX2).\nResourceID: {}\nFilename: {}\nDescription: Format {} is "
+                          "not supported.",
+                          GetId(), filename, vk::to_string(format));
+            throw std::runtime_error("Unsupported KTX2 texture format.");
+        }
+
+        const auto [bytesPP, fmt] = GetDevice()->FindSupportedFormat(
+            candidateFormats, vk::ImageTiling::eOptimal,
+            vk::FormatFeatureFlagBits::eSampledImage | vk::FormatFeatureFlagBits::eSampledImageFilterLinear);
+        const auto decompress = fmt != format;
+        if (decompress) {
+            spdlog::info("Format {} of texture {} is not supported, it is decompressed on the CPU.",
+                         vk::to_string(format), GetId());
+        }
+
+        const glm::u32vec4 size{header.m_pixelWidth, header.m_pixelHeight, 1, 1};
+        const auto mipLevels = static_cast<std::uint32_t>(image.m_levels.size());
+        m_decoded.m_size = size;
+        m_decoded.m_format = fmt;
+        m_decoded.m_bytesPP = bytesPP;
+        m_decoded.m_mipLevels = mipLevels;
+        for (std::uint32_t level = 0; level < mipLevels; ++level) {
+            const auto width = GetMipLevelSize(size.x, level);
+            const auto height = GetMipLevelSize(size.y, level);
+            const auto levelData = image.m_levels[level];
+            if (decompress) {
+                const auto blockData = reinterpret_cast<const std::uint8_t*>(levelData.data()); // NOLINT
+                auto texels = std::make_shared<std::vector<std::uint8_t>>(
+                    DecompressBlocks(*blockFormat, std::span{blockData, levelData.size()}, width, height));
+                m_decoded.m_levels.push_back(
+                    DecodedLevel{level, glm::u32vec3{width * bytesPP, height, 1}, texels->data(), texels});
+                continue;
+            }
+
+            const glm::u32vec3 dataSize = blockFormat
+                                              ? glm::u32vec3{GetBlockCount(width) * bytesPP, GetBlockCount(height), 1}
+                                              : glm::u32vec3{width * bytesPP, height, 1};
+            if (levelData.size() < static_cast<std::size_t>(dataSize.x) * dataSize.y) {
+                spdlog::error("Could not load texture (KTX2).\nResourceID: {}\nFilename: {}\nDescription: Level {} "
+                              "is too small.",
+                              GetId(), filename, level);
+                throw std::runtime_error("KTX2 texture level is too small.");
+            }
+            m_decoded.m_levels.push_back(
+                DecodedLevel{level, dataSize, const_cast<std::byte*>(levelData.data()), file});
+        }
+    }
+
+    void Texture2D::WriteTextureCache(const std::string& filename, const std::string& cacheFilename, bool useSRGB,
+                                      const TextureMipmapDesc& mipmaps, const TextureCompressionDesc& compression) const
+    {
+        auto imgWidth = 0;
+        auto imgHeight = 0;
+        auto imgChannels = 0;
+        if (stbi_info(filename.c_str(), &imgWidth, &imgHeight, &imgChannels) == 0) {
+            spdlog::error(
+                "Could not get information from texture (LDR).\nResourceID: {}\nFilename: {}\nDescription: STBI Error.",
+                GetId(), filename);
+            throw stbi_error{};
+        }
+
+        // BC4 and BC5 have no sRGB variants, so sRGB images always use the color formats.
+        const auto channels = imgChannels <= 2 && !useSRGB ? imgChannels : 4;
+        auto blockFormat = BlockFormat::BC7;
+        auto format = useSRGB ? vk::Format::eBc7SrgbBlock : vk::Format::eBc7UnormBlock;
+        if (channels == 1) {
+            blockFormat = BlockFormat::BC4;
+            format = vk::Format::eBc4UnormBlock;
+        } else if (channels == 2) {
+            blockFormat = BlockFormat::BC5;
+            format = vk::Format::eBc5UnormBlock;
+        } else if (!compression.m_highQuality && (imgChannels == 2 || imgChannels == 4)) {
+            blockFormat = BlockFormat::BC3;
+            format = useSRGB ? vk::Format::eBc3SrgbBlock : vk::Format::eBc3UnormBlock;
+        } else if (!compression.m_highQuality) {
+            blockFormat = BlockFormat::BC1;
+            format = useSRGB ? vk::Format::eBc1RgbSrgbBlock : vk::Format::eBc1RgbUnormBlock;
+        }
+
+        std::unique_ptr<stbi_uc, decltype(&stbi_image_free)> image{
+            stbi_load(filename.c_str(), &imgWidth, &imgHeight, &imgChannels, channels), stbi_image_free};
+        if (image == nullptr) {
+            spdlog::error("Could not load texture (LDR).\nResourceID: {}\nFilename: {}\nDescription: STBI Error.",
+                          GetId(), filename);
+            throw stbi_error{};
+        }
+
+        const auto width = static_cast<std::uint32_t>(imgWidth);
+        const auto height = static_cast<std::uint32_t>(imgHeight);
+        const std::span<const std::uint8_t> baseLevel{image.get(),
+                                                      std::size_t{width} * height * static_cast<std::size_t>(channels)};
+        std::vector<std::vector<std::uint8_t>> levels;
+        levels.push_back(CompressBlocks(blockFormat, baseLevel, width, height));
+        if (mipmaps.m_generation != MipmapGeneration::NONE) {
+            auto options = mipmaps.m_options;
+            if (options.m_content == MipmapContent::LINEAR && useSRGB) { options.m_content = MipmapContent::SRGB; }
+            for (const auto& level :
+                 GenerateMipmaps(baseLevel, width, height, static_cast<std::uint32_t>(channels), options)) {
+                levels.push_back(CompressBlocks(blockFormat, level.m_data, level.m_width, level.m_height));
+            }
+        }
+
+        Ktx2Header header;
+        header.m_vkFormat = static_cast<std::uint32_t>(format);
+        header.m_pixelWidth = width;
+        header.m_pixelHeight = height;
+        std::vector<std::span<const std::byte>> levelData;
+        for (const auto& level : levels) { levelData.push_back(std::as_bytes(std::span{level})); }
+        const auto file = WriteKtx2(header, levelData);
+
+        // other textures may load the cache at the same time, so it is replaced instead of written in place.
+        const auto tmpFilename = cacheFilename + ".tmp";
+        std::error_code ec;
+        {
+            std::ofstream out{tmpFilename, std::ios::binary | std::ios::trunc};
+            out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size())); // NOLINT
+            if (!out) { ec = std::make_error_code(std::errc::io_error); }
+        }
+        if (!ec) { std::filesystem::rename(tmpFilename, cacheFilename, ec); }
+        if (ec) {
+            spdlog::warn("Could not write texture cache.\nResourceID: {}\nFilename: {}\nError Message: {}", GetId(),
+                         cacheFilename, ec.message());
+            std::filesystem::remove(tmpFilename, ec);
+        }
+    }
+
     std::pair<unsigned int, vk::Format> Texture2D::FindFormat(const std::string&, int& imgChannels, FormatProperties fmtProps) const
     {
         std::vector<std::pair<unsigned int, vk::Format>> candiateFormats;
@@ -171,6 +493,59 @@ namespace vkfw_core::gfx {
         return fmt;
     }
 
+    MipmapGeneration Texture2D::GetMipmapGeneration(const TextureMipmapDesc& mipmaps, vk::Format format) const
+    {
+        if (mipmaps.m_generation != MipmapGeneration::GPU) { return mipmaps.m_generation; }
+        // blits cannot renormalize.
+        if (mipmaps.m_options.m_content == MipmapContent::NORMAL_MAP) { return MipmapGeneration::CPU; }
+        if (!Texture::SupportsMipmapGeneration(GetDevice(), format)) {
+            spdlog::info("Format {} of texture {} does not support linear blits, mipmaps are generated on the CPU.",
+                         vk::to_string(format), GetId());
+            return MipmapGeneration::CPU;
+        }
+        return MipmapGeneration::GPU;
+    }
+
+    void Texture2D::AddMipmapLevels(const glm::u32vec4& size, const TextureDescriptor& desc, const void* data,
+                                    const MipmapOptions& options)
+    {
+        auto levelOptions = options;
+        if (levelOptions.m_content == MipmapContent::LINEAR && IsSRGBFormat(desc.m_format)) {
+            levelOptions.m_content = MipmapContent::SRGB;
+        }
+
+        const auto isHDR = IsFloatFormat(desc.m_format);
+        const auto bytesPP = static_cast<std::uint32_t>(desc.m_bytesPP);
+        const auto channels = isHDR ? bytesPP / 4 : bytesPP;
+        const auto numValues = static_cast<std::size_t>(size.x) * size.y * channels;
+
+        auto addLevels = [this, bytesPP](auto levels) {
+            for (std::uint32_t i = 0; i < levels.size(); ++i) {
+                auto levelData = std::make_shared<decltype(levels[i].m_data)>(std::move(levels[i].m_data));
+                const glm::u32vec3 dataSize{levels[i].m_width * bytesPP, levels[i].m_height, 1};
+                m_decoded.m_levels.push_back(DecodedLevel{i + 1, dataSize, levelData->data(), levelData});
+            }
+        };
+        if (isHDR) {
+            addLevels(GenerateMipmaps(std::span{static_cast<const float*>(data), numValues}, size.x, size.y, channels,
+                                      levelOptions));
+        } else {
+            addLevels(GenerateMipmaps(std::span{static_cast<const std::uint8_t*>(data), numValues}, size.x, size.y,
+                                      channels, levelOptions));
+        }
+    }
+
+    ResourceFootprint Texture2D::GetFootprint() const
+    {
+        ResourceFootprint footprint{sizeof(Texture2D), 0};
+        for (const auto& level : m_decoded.m_levels) {
+            const auto dataSize = glm::u64vec3{level.m_dataSize};
+            footprint.m_cpuBytes += static_cast<std::size_t>(dataSize.x * dataSize.y * dataSize.z);
+        }
+        if (m_memoryGroup != nullptr) { footprint.m_deviceBytes = GetTexture().GetMemoryRequirements().size; }
+        return footprint;
+    }
+
     const DeviceTexture& Texture2D::GetTexture() const { return *m_memoryGroup->GetTexture(m_textureIdx); }
     DeviceTexture& Texture2D::GetTexture() { return *m_memoryGroup->GetTexture(m_textureIdx); }
 }
@@ -68,6 +68,19 @@ namespace vkfw_core::gfx {
         }
     }
 
+    /**
+     *  Constructor for animations from already flattened channels.
+     *  @param name the animations name.
+     *  @param channels the channels for each node.
+     *  @param framesPerSecond the number of ticks per second.
+     *  @param duration the duration in ticks.
+     */
+    Animation::Animation(std::string name, std::vector<Channel> channels, float framesPerSecond, float duration)
+        : m_name{std::move(name)}, m_channels{std::move(channels)}, m_framesPerSecond{framesPerSecond},
+          m_duration{duration}
+    {
+    }
+
     /**
      *  Flattens the node hierarchy for animation channels.
      *  @param numNodes the number of nodes in the mesh.
@@ -0,0 +1,145 @@
+/**
+ * @file   AnimationSampler.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a sampler for animation key frames.
+ */
+
+#include "gfx/meshes/AnimationSampler.h"
+
+#include <algorithm>
+
+namespace vkfw_core::gfx {
+
+    namespace {
+
+        template<typename T> AnimationTrack<T> MakeTrack(const std::vector<std::pair<Time, T>>& frames)
+        {
+            AnimationTrack<T> track;
+            track.m_times.reserve(frames.size());
+            track.m_values.reserve(frames.size());
+            for (const auto& [time, value] : frames) {
+                track.m_times.push_back(time);
+                track.m_values.push_back(value);
+            }
+            return track;
+        }
+
+        inline glm::vec3 Interpolate(const glm::vec3& v0, const glm::vec3& v1, float alpha)
+        {
+            return glm::mix(v0, v1, alpha);
+        }
+
+        inline glm::quat Interpolate(const glm::quat& q0, const glm::quat& q1, float alpha)
+        {
+            return glm::slerp(q0, q1, glm::abs(alpha));
+        }
+    }
+
+    AnimationSampler::AnimationSampler(std::span<const Channel> channels, Time duration, float resampleRate)
+        : m_duration{duration}
+    {
+        m_channels.reserve(channels.size());
+        for (const auto& channel : channels) {
+            m_channels.push_back(ChannelTracks{MakeTrack(channel.m_positionFrames),
+                                               MakeTrack(channel.m_rotationFrames),
+                                               MakeTrack(channel.m_scalingFrames)});
+        }
+
+        if (resampleRate <= 0.0f) { return; }
+
+        // the last sample is at or after the end of the animation.
+        auto numSamples = static_cast<std::size_t>(glm::ceil(m_duration * resampleRate)) + 1;
+        for (auto& channel : m_channels) {
+            channel.m_positions = ResampleTrack(channel.m_positions, resampleRate, numSamples);
+            channel.m_rotations = ResampleTrack(channel.m_rotations, resampleRate, numSamples);
+            channel.m_scalings = ResampleTrack(channel.m_scalings, resampleRate, numSamples);
+        }
+        m_resampleRate = resampleRate;
+    }
+
+    AnimationSampler::AnimationSampler(const Animation& animation, float resampleRate)
+        : AnimationSampler{animation.GetChannels(), animation.GetDuration(), resampleRate}
+    {
+    }
+
+    bool AnimationSampler::SamplePose(std::size_t channel, Time time, glm::mat4& pose) const
+    {
+        AnimationCursor cursor;
+        return SamplePose(channel, time, cursor, pose);
+    }
+
+    bool AnimationSampler::SamplePose(std::size_t channel, Time time, AnimationCursor& cursor, glm::mat4& pose) const
+    {
+        const auto& tracks = m_channels[channel];
+        if (tracks.m_positions.m_values.empty() || tracks.m_rotations.m_values.empty()
+            || tracks.m_scalings.m_values.empty()) {
+            return false;
+        }
+
+        time = glm::clamp(time, 0.0f, m_duration);
+        auto translation = SampleTrack(tracks.m_positions, time, cursor.m_position);
+        auto rotation = SampleTrack(tracks.m_rotations, time, cursor.m_rotation);
+        auto scale = SampleTrack(tracks.m_scalings, time, cursor.m_scaling);
+
+        pose = glm::mat4_cast(rotation);
+        pose[0] *= scale.x;
+        pose[1] *= scale.y;
+        pose[2] *= scale.z;
+        pose[3] = glm::vec4(translation, 1);
+        return true;
+    }
+
+    std::uint32_t AnimationSampler::FindKey(std::span<const Time> times, Time time, std::uint32_t cursor)
+    {
+        const auto numKeys = times.size();
+        if (cursor < numKeys && times[cursor] <= time) {
+            if (cursor + 1 == numKeys || time < times[cursor + 1]) { return cursor; }
+            if (cursor + 2 == numKeys || time < times[cursor + 2]) { return cursor + 1; }
+        }
+
+        auto next = std::upper_bound(times.begin(), times.end(), time);
+        if (next == times.begin()) { return 0; }
+        return static_cast<std::uint32_t>(std::distance(times.begin(), next) - 1);
+    }
+
+    template<typename T>
+    T AnimationSampler::SampleTrack(const AnimationTrack<T>& track, Time time, std::uint32_t& cursor) const
+    {
+        const auto numKeys = track.m_values.size();
+        if (numKeys == 1) { return track.m_values[0]; }
+
+        if (IsResampled()) {
+            auto sample = time * m_resampleRate;
+            auto key = std::min(static_cast<std::size_t>(sample), numKeys - 2);
+            return Interpolate(track.m_values[key], track.m_values[key + 1], sample - static_cast<float>(key));
+        }
+
+        cursor = FindKey(track.m_times, time, cursor);
+        // the last key is interpolated with the first one like in Animation::ComputePoseAtTime.
+        auto nextKey = (cursor + 1) % numKeys;
+        auto alpha = (time - track.m_times[cursor]) / (track.m_times[nextKey] - track.m_times[cursor]);
+        return Interpolate(track.m_values[cursor], track.m_values[nextKey], alpha);
+    }
+
+    template<typename T>
+    AnimationTrack<T> AnimationSampler::ResampleTrack(const AnimationTrack<T>& track, float resampleRate,
+                                                      std::size_t numSamples) const
+    {
+        // samples the key frames, so this has to be called before m_resampleRate is set.
+        AnimationTrack<T> resampled;
+        if (track.m_values.size() <= 1) {
+            resampled.m_values = track.m_values;
+            return resampled;
+        }
+
+        resampled.m_values.reserve(numSamples);
+        std::uint32_t cursor = 0;
+        for (std::size_t i = 0; i < numSamples; ++i) {
+            auto time = glm::min(static_cast<float>(i) / resampleRate, m_duration);
+            resampled.m_values.push_back(SampleTrack(track, time, cursor));
+        }
+        return resampled;
+    }
+}
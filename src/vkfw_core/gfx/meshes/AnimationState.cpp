@@ -33,11 +33,13 @@ namespace vkfw_core::gfx {
         for (const auto& mapping : mappings) {
             m_animations.emplace_back(m_mesh->GetAnimations()[mapping.m_animationIndex].GetSubSequence(
                 mapping.m_name, mapping.m_startTime, mapping.m_endTime));
+            m_samplers.emplace_back(m_animations.back(), mapping.m_resampleRate);
             m_animationPlaybackSpeed.emplace_back(mapping.m_playbackSpeed);
         }
 
         m_localBonePoses.resize(m_mesh->GetNodes().size());
         m_globalBonePoses.resize(m_mesh->GetNodes().size());
+        m_cursors.resize(m_mesh->GetNodes().size());
         for (auto i = 0U; i < m_localBonePoses.size(); ++i) {
             m_localBonePoses[i] = m_mesh->GetNodes()[i]->GetLocalTransform();
         }
@@ -102,12 +104,12 @@ namespace vkfw_core::gfx {
      */
     void AnimationState::ComputeAnimationsFinalBonePoses()
     {
-        const auto& currentAnimation = m_animations[m_animationIndex];
+        const auto& sampler = m_samplers[m_animationIndex];
         const auto& invBindPoseMatrices = m_mesh->GetInverseBindPoseMatrices();
 
         for (auto i = 0U; i < m_mesh->GetNodes().size(); ++i) {
             glm::mat4 pose;
-            if (currentAnimation.ComputePoseAtTime(i, m_currentPlayTime, pose)) { m_localBonePoses[i] = pose; }
+            if (sampler.SamplePose(i, m_currentPlayTime, m_cursors[i], pose)) { m_localBonePoses[i] = pose; }
         }
 
         ComputeGlobalBonePose(m_mesh->GetRootNode());
@@ -7,12 +7,16 @@
  */
 
 #include "gfx/meshes/AssImpScene.h"
+#include "gfx/meshes/MeshBinaryFile.h"
 #include "app/ApplicationBase.h"
 #include <fstream>
 #include <filesystem>
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <atomic>
+#include <future>
+#include <thread>
 #include <unordered_map>
 
 #include <cereal/cereal.hpp>
@@ -28,6 +32,16 @@
 
 namespace vkfw_core::gfx {
 
+    /** Returns the number of triangles of a mesh (lines and points are ignored). */
+    inline unsigned int CountTriangles(const aiMesh* mesh)
+    {
+        unsigned int numTriangles = 0;
+        for (unsigned int fi = 0; fi < mesh->mNumFaces; ++fi) {
+            if (mesh->mFaces[fi].mNumIndices == 3) { numTriangles += 1; } // NOLINT
+        }
+        return numTriangles;
+    }
+
     inline glm::vec3 GetMaterialColor(aiMaterial* material, const char* pKey, unsigned int type, unsigned int idx) {
         aiColor3D c;
         material->Get(pKey, type, idx, c);
@@ -47,6 +61,13 @@ namespace vkfw_core::gfx {
         FlattenHierarchies();
     }
 
+    AssImpScene::AssImpScene(const std::filesystem::path& filename, MeshCreateFlags flags)
+        : Resource{filename.string(), nullptr}, m_meshFilename{filename.string()}
+    {
+        createNewMesh(m_meshFilename, flags);
+        FlattenHierarchies();
+    }
+
     /** Default copy constructor. */
     AssImpScene::AssImpScene(const AssImpScene& rhs) = default;
 
@@ -98,29 +119,20 @@ namespace vkfw_core::gfx {
 
         unsigned int maxUVChannels = 0;
         unsigned int maxColorChannels = 0;
-        unsigned int numVertices = 0;
-        unsigned int numIndices = 0;
         bool hasTangentSpace = false;
-        std::vector<std::vector<unsigned int>> indices;
-        indices.resize(static_cast<size_t>(scene->mNumMeshes));
         auto numMeshes = static_cast<std::size_t>(scene->mNumMeshes);
+        // offsets of each mesh in the vertex and index arrays, the last entry holds the total size.
+        std::vector<unsigned int> vertexOffsets(numMeshes + 1, 0);
+        std::vector<unsigned int> indexOffsets(numMeshes + 1, 0);
         for (std::size_t i = 0; i < numMeshes; ++i) {
             maxUVChannels = glm::max(maxUVChannels, scene->mMeshes[i]->GetNumUVChannels());          // NOLINT
             if (scene->mMeshes[i]->HasTangentsAndBitangents()) { hasTangentSpace = true; }           // NOLINT
             maxColorChannels = glm::max(maxColorChannels, scene->mMeshes[i]->GetNumColorChannels()); // NOLINT
-            numVertices += scene->mMeshes[i]->mNumVertices;                         // NOLINT
-            auto numFaces = static_cast<std::size_t>(scene->mMeshes[i]->mNumFaces); // NOLINT
-            for (std::size_t fi = 0; fi < numFaces; ++fi) {
-                auto faceIndices = scene->mMeshes[i]->mFaces[fi].mNumIndices; // NOLINT
-                // TODO: currently lines and points are ignored. [12/14/2016 Sebastian Maisch]
-                if (faceIndices == 3) {
-                    indices[i].push_back(scene->mMeshes[i]->mFaces[fi].mIndices[0]); // NOLINT
-                    indices[i].push_back(scene->mMeshes[i]->mFaces[fi].mIndices[1]); // NOLINT
-                    indices[i].push_back(scene->mMeshes[i]->mFaces[fi].mIndices[2]); // NOLINT
-                    numIndices += faceIndices;
-                }
-            }
+            vertexOffsets[i + 1] = vertexOffsets[i] + scene->mMeshes[i]->mNumVertices;              // NOLINT
+            indexOffsets[i + 1] = indexOffsets[i] + 3 * CountTriangles(scene->mMeshes[i]);          // NOLINT
         }
+        auto numVertices = vertexOffsets.back();
+        auto numIndices = indexOffsets.back();
 
         std::filesystem::path sceneFilePath{ m_meshFilename };
 
@@ -160,75 +172,45 @@ namespace vkfw_core::gfx {
             }
         }
 
-        unsigned int currentMeshIndexOffset = 0;
-        unsigned int currentMeshVertexOffset = 0;
-        std::map<std::string, unsigned int> bones;
-        std::vector<std::vector<std::pair<unsigned int, float>>> boneWeights;
-        boneWeights.resize(numVertices);
-        for (unsigned int iMesh = 0; iMesh < scene->mNumMeshes; ++iMesh) {
+        // bone indices are assigned in mesh order, so the result does not depend on the import mode.
+        std::unordered_map<std::string, unsigned int> bones;
+        std::vector<std::vector<unsigned int>> meshBoneIndices(numMeshes);
+        for (std::size_t iMesh = 0; iMesh < numMeshes; ++iMesh) {
             auto mesh = scene->mMeshes[iMesh]; // NOLINT
-
-            if (mesh->HasPositions()) {
-                std::copy(mesh->mVertices, &mesh->mVertices[mesh->mNumVertices],                   // NOLINT
-                          reinterpret_cast<aiVector3D*>(&GetVertices()[currentMeshVertexOffset])); // NOLINT
-            }
-            if (mesh->HasNormals()) {
-                std::copy(mesh->mNormals, &mesh->mNormals[mesh->mNumVertices],                    // NOLINT
-                          reinterpret_cast<aiVector3D*>(&GetNormals()[currentMeshVertexOffset])); // NOLINT
-            }
-            for (unsigned int ti = 0; ti < mesh->GetNumUVChannels(); ++ti) {
-                std::copy(mesh->mTextureCoords[ti], &mesh->mTextureCoords[ti][mesh->mNumVertices],      // NOLINT
-                          reinterpret_cast<aiVector3D*>(&GetTexCoords()[ti][currentMeshVertexOffset])); // NOLINT
-            }
-            if (mesh->HasTangentsAndBitangents()) {
-                std::copy(mesh->mTangents, &mesh->mTangents[mesh->mNumVertices],                    // NOLINT
-                          reinterpret_cast<aiVector3D*>(&GetTangents()[currentMeshVertexOffset])); // NOLINT
-                std::copy(mesh->mBitangents, &mesh->mBitangents[mesh->mNumVertices],                // NOLINT
-                          reinterpret_cast<aiVector3D*>(&GetBinormals()[currentMeshVertexOffset])); // NOLINT
-            }
-            for (unsigned int ci = 0; ci < mesh->GetNumColorChannels(); ++ci) {
-                std::copy(mesh->mColors[ci], &mesh->mColors[ci][mesh->mNumVertices],                // NOLINT
-                          reinterpret_cast<aiColor4D*>(&GetColors()[ci][currentMeshVertexOffset])); // NOLINT
-            }
-
-            if (mesh->HasBones()) {
-
-                // Walk all bones of this mesh
-                for (auto b = 0U; b < mesh->mNumBones; ++b) {
-                    auto aiBone = mesh->mBones[b]; // NOLINT
-
-                    auto bone = bones.find(aiBone->mName.C_Str());
-
-                    // We don't have this bone, yet -> insert into mesh datastructure
-                    if (bone == bones.end()) {
-                        bones[aiBone->mName.C_Str()] = static_cast<unsigned int>(GetInverseBindPoseMatrices().size());
-
-                        GetInverseBindPoseMatrices().push_back(AiMatrixToGLM(aiBone->mOffsetMatrix));
-                    }
-
-                    unsigned int indexOfCurrentBone = bones[aiBone->mName.C_Str()];
-
-                    for (auto w = 0U; w < aiBone->mNumWeights; ++w) {
-                        auto boneIndex = static_cast<std::size_t>(currentMeshVertexOffset)
-                                         + static_cast<std::size_t>(aiBone->mWeights[w].mVertexId); // NOLINT
-                        boneWeights[boneIndex].emplace_back(indexOfCurrentBone, aiBone->mWeights[w].mWeight); // NOLINT
-                    }
-                }
-            }
-            else {
-                for (std::size_t iVert = 0; iVert < mesh->mNumVertices; ++iVert) {
-                    boneWeights[currentMeshVertexOffset + iVert].emplace_back(std::make_pair(0, 0.0f));
-                }
+            for (auto b = 0U; b < mesh->mNumBones; ++b) {
+                auto aiBone = mesh->mBones[b]; // NOLINT
+                auto nextBoneIndex = static_cast<unsigned int>(GetInverseBindPoseMatrices().size());
+                auto [bone, inserted] = bones.try_emplace(aiBone->mName.C_Str(), nextBoneIndex);
+                if (inserted) { GetInverseBindPoseMatrices().push_back(AiMatrixToGLM(aiBone->mOffsetMatrix)); }
+                meshBoneIndices[iMesh].push_back(bone->second);
             }
+        }
 
-            if (!indices[iMesh].empty()) {
-                std::transform(indices[iMesh].begin(), indices[iMesh].end(), &GetIndices()[currentMeshIndexOffset],
-                    [currentMeshVertexOffset](unsigned int idx) { return static_cast<unsigned int>(idx + currentMeshVertexOffset); });
+        GetBoneOffsetMatrixIndices().resize(numVertices);
+        GetBoneWeigths().resize(numVertices);
+        auto importMesh = [this, scene, &vertexOffsets, &indexOffsets, &meshBoneIndices](std::size_t iMesh) {
+            ImportMeshData(scene->mMeshes[iMesh], vertexOffsets[iMesh], indexOffsets[iMesh], // NOLINT
+                           meshBoneIndices[iMesh]);
+        };
+        if (flags & MeshCreateFlagBits::PARALLEL_IMPORT) {
+            // every mesh writes to its own range of the mesh arrays, so meshes can be imported in any order.
+            std::atomic_size_t nextMesh = 0;
+            auto numWorkers = std::min<std::size_t>(numMeshes, std::max(1U, std::thread::hardware_concurrency()));
+            std::vector<std::future<void>> workers;
+            for (std::size_t i = 0; i < numWorkers; ++i) {
+                workers.emplace_back(std::async(std::launch::async, [&nextMesh, numMeshes, &importMesh]() {
+                    for (auto iMesh = nextMesh++; iMesh < numMeshes; iMesh = nextMesh++) { importMesh(iMesh); }
+                }));
             }
+            for (auto& worker : workers) { worker.get(); }
+        } else {
+            for (std::size_t iMesh = 0; iMesh < numMeshes; ++iMesh) { importMesh(iMesh); }
+        }
 
-            AddSubMesh(mesh->mName.C_Str(), currentMeshIndexOffset, static_cast<unsigned int>(indices[iMesh].size()), mesh->mMaterialIndex);
-            currentMeshVertexOffset += mesh->mNumVertices;
-            currentMeshIndexOffset += static_cast<unsigned int>(indices[iMesh].size());
+        for (std::size_t iMesh = 0; iMesh < numMeshes; ++iMesh) {
+            auto mesh = scene->mMeshes[iMesh]; // NOLINT
+            AddSubMesh(mesh->mName.C_Str(), indexOffsets[iMesh], indexOffsets[iMesh + 1] - indexOffsets[iMesh],
+                       mesh->mMaterialIndex);
         }
 
         // Parse parent information for each bone.
@@ -236,34 +218,6 @@ namespace vkfw_core::gfx {
         // Root node has a parent index of max value of size_t
         ParseBoneHierarchy(bones, scene->mRootNode, std::numeric_limits<std::size_t>::max(), glm::mat4(1.0f));
 
-        // Iterate all weights for each vertex
-        for (auto& weights : boneWeights) {
-            // sort the weights.
-            std::sort(weights.begin(), weights.end(),
-                [](const std::pair<unsigned int, float>& left, const std::pair<unsigned int, float>& right) {
-                return left.second > right.second;
-            });
-
-            // resize the weights, because we only take 4 bones per vertex into account.
-            weights.resize(4);
-
-            // build vec's with up to 4 components, one for each bone, influencing
-            // the current vertex.
-            glm::uvec4 newIndices;
-            glm::vec4 newWeights;
-            float sumWeights = 0.0f;
-            for (auto i = 0U; i < weights.size(); ++i) {
-                newIndices[i] = weights[i].first;
-                newWeights[i] = weights[i].second;
-                sumWeights += newWeights[i];
-            }
-
-            GetBoneOffsetMatrixIndices().push_back(newIndices);
-            // normalize the bone weights.
-            constexpr float WEIGHT_EPSILON = 0.000000001f;
-            GetBoneWeigths().push_back(newWeights / glm::max(sumWeights, WEIGHT_EPSILON));
-        }
-
         // Loading animations
         if (scene->HasAnimations()) {
             for (auto a = 0U; a < scene->mNumAnimations; ++a) {
@@ -274,32 +228,82 @@ namespace vkfw_core::gfx {
         CreateSceneNodes(scene->mRootNode, bones);
     }
 
+    void AssImpScene::ImportMeshData(const aiMesh* mesh, unsigned int vertexOffset, unsigned int indexOffset,
+                                     const std::vector<unsigned int>& boneIndices)
+    {
+        if (mesh->HasPositions()) {
+            std::copy(mesh->mVertices, &mesh->mVertices[mesh->mNumVertices],        // NOLINT
+                      reinterpret_cast<aiVector3D*>(&GetVertices()[vertexOffset])); // NOLINT
+        }
+        if (mesh->HasNormals()) {
+            std::copy(mesh->mNormals, &mesh->mNormals[mesh->mNumVertices],         // NOLINT
+                      reinterpret_cast<aiVector3D*>(&GetNormals()[vertexOffset])); // NOLINT
+        }
+        for (unsigned int ti = 0; ti < mesh->GetNumUVChannels(); ++ti) {
+            std::copy(mesh->mTextureCoords[ti], &mesh->mTextureCoords[ti][mesh->mNumVertices], // NOLINT
+                      reinterpret_cast<aiVector3D*>(&GetTexCoords()[ti][vertexOffset]));       // NOLINT
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            std::copy(mesh->mTangents, &mesh->mTangents[mesh->mNumVertices],         // NOLINT
+                      reinterpret_cast<aiVector3D*>(&GetTangents()[vertexOffset]));  // NOLINT
+            std::copy(mesh->mBitangents, &mesh->mBitangents[mesh->mNumVertices],     // NOLINT
+                      reinterpret_cast<aiVector3D*>(&GetBinormals()[vertexOffset])); // NOLINT
+        }
+        for (unsigned int ci = 0; ci < mesh->GetNumColorChannels(); ++ci) {
+            std::copy(mesh->mColors[ci], &mesh->mColors[ci][mesh->mNumVertices],     // NOLINT
+                      reinterpret_cast<aiColor4D*>(&GetColors()[ci][vertexOffset])); // NOLINT
+        }
+
+        // TODO: currently lines and points are ignored. [12/14/2016 Sebastian Maisch]
+        auto* indices = GetIndices().data() + indexOffset; // NOLINT
+        for (unsigned int fi = 0; fi < mesh->mNumFaces; ++fi) {
+            const auto& face = mesh->mFaces[fi]; // NOLINT
+            if (face.mNumIndices != 3) { continue; }
+            for (unsigned int i = 0; i < 3; ++i) { *indices++ = face.mIndices[i] + vertexOffset; } // NOLINT
+        }
+
+        // keep the 4 strongest bones per vertex, sorted by descending weight (ties keep the bone order).
+        auto* vertexBones = GetBoneOffsetMatrixIndices().data() + vertexOffset; // NOLINT
+        auto* vertexWeights = GetBoneWeigths().data() + vertexOffset;           // NOLINT
+        std::fill_n(vertexBones, mesh->mNumVertices, glm::uvec4{0});
+        std::fill_n(vertexWeights, mesh->mNumVertices, glm::vec4{0.0f});
+        for (auto b = 0U; b < mesh->mNumBones; ++b) {
+            auto aiBone = mesh->mBones[b]; // NOLINT
+            for (auto w = 0U; w < aiBone->mNumWeights; ++w) {
+                const auto& vertexWeight = aiBone->mWeights[w];                // NOLINT
+                auto& bonesOfVertex = vertexBones[vertexWeight.mVertexId];     // NOLINT
+                auto& weightsOfVertex = vertexWeights[vertexWeight.mVertexId]; // NOLINT
+                glm::length_t slot = 0;
+                while (slot < 4 && weightsOfVertex[slot] >= vertexWeight.mWeight) { ++slot; }
+                for (auto i = 3; i > slot; --i) {
+                    bonesOfVertex[i] = bonesOfVertex[i - 1];
+                    weightsOfVertex[i] = weightsOfVertex[i - 1];
+                }
+                if (slot < 4) {
+                    bonesOfVertex[slot] = boneIndices[b];
+                    weightsOfVertex[slot] = vertexWeight.mWeight;
+                }
+            }
+        }
+
+        // normalize the bone weights.
+        constexpr float WEIGHT_EPSILON = 0.000000001f;
+        for (auto i = 0U; i < mesh->mNumVertices; ++i) {
+            auto& weights = vertexWeights[i]; // NOLINT
+            weights /= glm::max(weights.x + weights.y + weights.z + weights.w, WEIGHT_EPSILON);
+        }
+    }
+
     void AssImpScene::saveBinary(const std::string& filename) const
     {
-        BinaryOAWrapper oa{ filename };
-        oa(cereal::make_nvp("meshInfo", *static_cast<const MeshInfo*>(this)), cereal::make_nvp("meshFilename", m_meshFilename));
+        MeshBinaryFile::Write(*this, filename);
     }
 
     bool AssImpScene::loadBinary(const std::string& filename)
     {
-        try {
-            BinaryIAWrapper ia{ filename };
-            if (ia.IsValid()) {
-                ia(cereal::make_nvp("meshInfo", *static_cast<MeshInfo*>(this)),
-                   cereal::make_nvp("meshFilename", m_meshFilename));
-                return true;
-            }
-        } catch (cereal::Exception& e) {
-            spdlog::error("Could not load binary file. Falling back to Assimp.\nResourceID: {}\nFilename: "
-                          "{}\nDescription: Cereal Error.\nError Message: {}",
-                          GetId(), BinaryIAWrapper::GetBinFilename(filename), e.what());
-            return false;
-        } catch (...) {
-            spdlog::error("Could not load binary file. Falling back to Assimp.\nResourceID: {}\nFilename: "
-                          "{}\nDescription: Reason unknown",
-                          GetId(), BinaryIAWrapper::GetBinFilename(filename));
-            return false;
-        }
+        if (MeshBinaryFile::Read(*this, filename)) { return true; }
+        spdlog::info("No valid binary file found, loading with Assimp.\nResourceID: {}\nFilename: {}", GetId(),
+                     MeshBinaryFile::GetBinaryFilename(filename).string());
         return false;
     }
 
@@ -315,7 +319,7 @@ namespace vkfw_core::gfx {
     /// \param Matrix including all transformations from the parents of the
     ///        current node.
     ///
-    void AssImpScene::ParseBoneHierarchy(const std::map<std::string, unsigned int>& bones, const aiNode* node,
+    void AssImpScene::ParseBoneHierarchy(const std::unordered_map<std::string, unsigned int>& bones, const aiNode* node,
         std::size_t parent, glm::mat4 parentMatrix)
     {
         auto bone = bones.find(node->mName.C_Str());
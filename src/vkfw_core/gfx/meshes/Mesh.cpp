@@ -8,6 +8,7 @@
 
 #include "gfx/meshes/Mesh.h"
 #include "core/math/math.h"
+#include "core/math/culling.h"
 #include "gfx/Texture2D.h"
 #include "gfx/camera/CameraBase.h"
 #include "gfx/renderer/RenderList.h"
@@ -37,6 +38,7 @@ namespace vkfw_core::gfx {
         , m_materialDescriptorSetLayout{fmt::format("{} MaterialDescSetLayout", name)}
     {
         CreateMaterials(queueFamilyIndices);
+        CreateCullingBoxes();
         m_worldMatricesUBO.AddDescriptorLayoutBinding(m_worldMatricesDescriptorSetLayout,
                                                       vk::ShaderStageFlagBits::eVertex, true, 0);
     }
@@ -59,6 +61,7 @@ namespace vkfw_core::gfx {
         , m_materialDescriptorSetLayout{fmt::format("{} MaterialDescSetLayout", name)}
     {
         CreateMaterials(queueFamilyIndices);
+        CreateCullingBoxes();
         m_worldMatricesUBO.AddDescriptorLayoutBinding(m_worldMatricesDescriptorSetLayout,
                                                       vk::ShaderStageFlagBits::eVertex, true, 0);
     }
@@ -69,23 +72,25 @@ namespace vkfw_core::gfx {
 
     Mesh::~Mesh() = default;
 
+    void Mesh::CreateCullingBoxes()
+    {
+        m_nodeCullingBoxes.resize(m_meshInfo->GetNodes().size());
+        for (const auto* node : m_meshInfo->GetNodes()) {
+            auto& cullingBoxes = m_nodeCullingBoxes[node->GetNodeIndex()];
+            cullingBoxes.Reserve(1 + node->GetNumberOfSubMeshes());
+            cullingBoxes.Add(node->GetBoundingBox());
+            for (std::size_t i = 0; i < node->GetNumberOfSubMeshes(); ++i) {
+                cullingBoxes.Add(m_meshInfo->GetSubMeshes()[node->GetSubMeshID(i)].GetLocalAABB());
+            }
+        }
+    }
+
     void Mesh::CreateMaterials(const std::vector<std::uint32_t>& queueFamilyIndices)
     {
         // sets:
         // 0: world
         // 1: material UBO + textures
         // 2: camera (not handled in this class)
-        {
-            vk::SamplerCreateInfo samplerCreateInfo{vk::SamplerCreateFlags(),
-                                                    vk::Filter::eLinear,
-                                                    vk::Filter::eLinear,
-                                                    vk::SamplerMipmapMode::eNearest,
-                                                    vk::SamplerAddressMode::eRepeat,
-                                                    vk::SamplerAddressMode::eRepeat,
-                                                    vk::SamplerAddressMode::eRepeat};
-            m_textureSampler.SetHandle(m_device->GetHandle(), m_device->GetHandle().createSamplerUnique(samplerCreateInfo));
-        }
-
         {
             // Binding 0: Diffuse map
             Texture::AddDescriptorLayoutBinding(m_materialDescriptorSetLayout,
@@ -105,6 +110,27 @@ namespace vkfw_core::gfx {
         for (const auto& mat : m_meshInfo->GetMaterials()) {
             m_materials.emplace_back(mat.get(), m_device, *m_memoryGroup, queueFamilyIndices);
         }
+
+        {
+            // the LOD range covers the MIP levels of all material textures.
+            std::uint32_t maxMipLevels = 1;
+            for (const auto& material : m_materials) {
+                for (const auto& texture : material.m_textures) {
+                    if (texture) { maxMipLevels = std::max(maxMipLevels, texture->GetTexture().GetMipLevels()); }
+                }
+            }
+
+            vk::SamplerCreateInfo samplerCreateInfo{vk::SamplerCreateFlags(),
+                                                    vk::Filter::eLinear,
+                                                    vk::Filter::eLinear,
+                                                    vk::SamplerMipmapMode::eLinear,
+                                                    vk::SamplerAddressMode::eRepeat,
+                                                    vk::SamplerAddressMode::eRepeat,
+                                                    vk::SamplerAddressMode::eRepeat};
+            samplerCreateInfo.setMinLod(0.0f);
+            samplerCreateInfo.setMaxLod(static_cast<float>(maxMipLevels));
+            m_textureSampler.SetHandle(m_device->GetHandle(), m_device->GetHandle().createSamplerUnique(samplerCreateInfo));
+        }
     }
 
     void Mesh::AddDescriptorPoolSizes(std::vector<vk::DescriptorPoolSize>& poolSizes, std::size_t& setCount) const
@@ -270,8 +296,11 @@ namespace vkfw_core::gfx {
     {
         auto nodeWorld = node->GetLocalTransform() * worldMatrix;
 
-        auto aabb = node->GetBoundingBox().NewFromTransform(nodeWorld);
-        if (!math::AABBInFrustumTest(camera.GetViewFrustum(), aabb)) { return; }
+        // the node is culled together with its sub meshes, the node box is the first one.
+        const auto& cullingBoxes = m_nodeCullingBoxes[node->GetNodeIndex()];
+        m_cullingVisibility.resize(math::CullingMaskSize(cullingBoxes.size()));
+        math::CullAABBs(camera.GetViewFrustum(), cullingBoxes, std::span{&nodeWorld, 1}, m_cullingVisibility);
+        if (!math::IsVisible(m_cullingVisibility, 0)) { return; }
 
         // bind world matrices
         auto instanceIndex = backbufferIdx * m_meshInfo->GetNodes().size() + node->GetNodeIndex();
@@ -280,6 +309,7 @@ namespace vkfw_core::gfx {
             static_cast<std::uint32_t>(instanceIndex * m_worldMatricesUBO.GetInstanceSize())});
 
         for (unsigned int i = 0; i < node->GetNumberOfSubMeshes(); ++i) {
+            if (!math::IsVisible(m_cullingVisibility, i + 1)) { continue; }
             GetDrawElementsSubMesh(nodeWorld, camera, m_meshInfo->GetSubMeshes()[node->GetSubMeshID(i)], renderList);
         }
         for (unsigned int i = 0; i < node->GetNumberOfNodes(); ++i) {
@@ -290,8 +320,10 @@ namespace vkfw_core::gfx {
     void Mesh::GetDrawElementsSubMesh(const glm::mat4& worldMatrix, const CameraBase& camera, const SubMesh& subMesh,
                                       RenderList& renderList)
     {
-        auto aabb = subMesh.GetLocalAABB().NewFromTransform(worldMatrix);
-        if (!math::AABBInFrustumTest(camera.GetViewFrustum(), aabb)) { return; }
+        // culling is done in GetDrawElementsNode, the render list only needs the center of the box.
+        const auto& localAABB = subMesh.GetLocalAABB();
+        auto center = glm::vec3{worldMatrix * glm::vec4{0.5f * (localAABB.m_minmax[0] + localAABB.m_minmax[1]), 1.0f}};
+        math::AABB3<float> aabb{center, center};
 
         // bind material.
         const auto mat = m_meshInfo->GetMaterial(subMesh.GetMaterialID());
@@ -0,0 +1,404 @@
+/**
+ * @file   MeshBinaryFile.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of the memory mappable binary file format (.vkbin) for meshes.
+ */
+
+#include "gfx/meshes/MeshBinaryFile.h"
+#include "gfx/meshes/MeshInfo.h"
+#include "core/memory_mapped_file.h"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+namespace vkfw_core::gfx {
+
+    namespace {
+
+        constexpr std::array<char, 8> FILE_MAGIC = {'V', 'K', 'F', 'W', 'M', 'E', 'S', 'H'};
+        constexpr std::uint32_t ENDIAN_MARKER = 0x01020304;
+
+        enum class SectionType : std::uint16_t {
+            Metadata,
+            Vertices,
+            Normals,
+            TexCoords,
+            Tangents,
+            Binormals,
+            Colors,
+            BoneOffsetMatrixIndices,
+            BoneWeights,
+            IndexVectors,
+            InverseBindPoseMatrices,
+            BoneParents,
+            Indices,
+            BoneBoundingBoxes
+        };
+
+        struct FileHeader
+        {
+            std::array<char, 8> m_magic = FILE_MAGIC;
+            std::uint32_t m_version = MeshBinaryFile::FORMAT_VERSION;
+            std::uint32_t m_headerSize = 0;
+            std::uint32_t m_endianMarker = ENDIAN_MARKER;
+            std::uint32_t m_sectionCount = 0;
+            std::uint64_t m_fileSize = 0;
+            std::int64_t m_sourceTimestamp = 0;
+            std::uint64_t m_sourceSize = 0;
+            std::uint64_t m_sourceHash = 0;
+            std::uint32_t m_checksum = 0;
+            std::uint32_t m_padding = 0;
+        };
+        static_assert(sizeof(FileHeader) == 64 && std::is_trivially_copyable_v<FileHeader>);
+
+        struct SectionEntry
+        {
+            SectionType m_type = SectionType::Metadata;
+            std::uint16_t m_channel = 0;
+            std::uint32_t m_elementSize = 0;
+            std::uint64_t m_offset = 0;
+            std::uint64_t m_count = 0;
+        };
+        static_assert(sizeof(SectionEntry) == 24 && std::is_trivially_copyable_v<SectionEntry>);
+
+        std::uint64_t HashFNV1a64(std::span<const std::byte> data)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (auto b : data) { hash = (hash ^ static_cast<std::uint64_t>(b)) * 1099511628211ULL; }
+            return hash;
+        }
+
+        std::uint32_t HashFNV1a32(std::span<const std::byte> data, std::uint32_t hash = 2166136261U)
+        {
+            for (auto b : data) { hash = (hash ^ static_cast<std::uint32_t>(b)) * 16777619U; }
+            return hash;
+        }
+
+        std::uint32_t ComputeChecksum(FileHeader header, std::span<const SectionEntry> sections)
+        {
+            header.m_checksum = 0;
+            auto hash = HashFNV1a32(std::as_bytes(std::span{&header, 1}));
+            return HashFNV1a32(std::as_bytes(sections), hash);
+        }
+
+        std::uint64_t AlignSectionOffset(std::uint64_t offset)
+        {
+            constexpr auto alignment = static_cast<std::uint64_t>(MeshBinaryFile::SECTION_ALIGNMENT);
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        struct SourceInfo
+        {
+            std::int64_t m_timestamp = 0;
+            std::uint64_t m_size = 0;
+        };
+
+        SourceInfo GetSourceInfo(const std::filesystem::path& sourceFilename)
+        {
+            return SourceInfo{std::filesystem::last_write_time(sourceFilename).time_since_epoch().count(),
+                              std::filesystem::file_size(sourceFilename)};
+        }
+
+        std::uint64_t HashSourceFile(const std::filesystem::path& sourceFilename)
+        {
+            if (std::filesystem::file_size(sourceFilename) == 0) { return HashFNV1a64({}); }
+            MemoryMappedFile source{sourceFilename};
+            return HashFNV1a64(source.GetData());
+        }
+
+        /** Stores a new source timestamp in the header, so the source does not need to be hashed again. */
+        void UpdateSourceTimestamp(const std::filesystem::path& binaryFilename, FileHeader header,
+                                   std::span<const SectionEntry> sections, std::int64_t timestamp)
+        {
+            header.m_sourceTimestamp = timestamp;
+            header.m_checksum = ComputeChecksum(header, sections);
+            std::fstream file{binaryFilename, std::ios::binary | std::ios::in | std::ios::out};
+            if (!file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader))) { // NOLINT
+                spdlog::warn("Could not update source timestamp of mesh binary file.\nFilename: {}",
+                             binaryFilename.string());
+            }
+        }
+
+        /** Read only stream buffer over mapped memory, so cereal reads the metadata without copying the file. */
+        class SpanStreamBuffer : public std::streambuf
+        {
+        public:
+            explicit SpanStreamBuffer(std::span<const std::byte> data)
+            {
+                // std::streambuf needs non-const pointers but the buffer is never written to.
+                auto* begin = const_cast<char*>(reinterpret_cast<const char*>(data.data())); // NOLINT
+                setg(begin, begin, begin + data.size()); // NOLINT
+            }
+        };
+
+        /** Collects the sections to write. */
+        class SectionWriter
+        {
+        public:
+            template<typename T> void Add(SectionType type, std::size_t channel, std::span<const T> data)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                m_entries.push_back(SectionEntry{type, static_cast<std::uint16_t>(channel),
+                                                 static_cast<std::uint32_t>(sizeof(T)), 0, data.size()});
+                m_data.push_back(std::as_bytes(data));
+            }
+
+            void AddMetadata(std::span<const std::byte> data)
+            {
+                m_entries.push_back(SectionEntry{SectionType::Metadata, 0, 1, 0, data.size()});
+                m_data.push_back(data);
+            }
+
+            void Write(std::ostream& out, FileHeader header)
+            {
+                header.m_sectionCount = static_cast<std::uint32_t>(m_entries.size());
+                header.m_headerSize = static_cast<std::uint32_t>(sizeof(FileHeader));
+                const std::uint64_t tableEnd = sizeof(FileHeader) + m_entries.size() * sizeof(SectionEntry);
+                auto offset = tableEnd;
+                for (std::size_t i = 0; i < m_entries.size(); ++i) {
+                    offset = AlignSectionOffset(offset);
+                    m_entries[i].m_offset = offset;
+                    offset += m_data[i].size();
+                }
+                header.m_fileSize = offset;
+                header.m_checksum = ComputeChecksum(header, m_entries);
+
+                WriteBytes(out, std::as_bytes(std::span{&header, 1}));
+                WriteBytes(out, std::as_bytes(std::span{m_entries}));
+                auto position = tableEnd;
+                const std::array<std::byte, MeshBinaryFile::SECTION_ALIGNMENT> padding = {};
+                for (std::size_t i = 0; i < m_entries.size(); ++i) {
+                    auto paddingSize = m_entries[i].m_offset - position;
+                    WriteBytes(out, std::span{padding}.first(paddingSize));
+                    WriteBytes(out, m_data[i]);
+                    position = m_entries[i].m_offset + m_data[i].size();
+                }
+            }
+
+        private:
+            static void WriteBytes(std::ostream& out, std::span<const std::byte> data)
+            {
+                const auto* bytes = reinterpret_cast<const char*>(data.data()); // NOLINT
+                out.write(bytes, static_cast<std::streamsize>(data.size()));
+            }
+
+            /** Holds the section table. */
+            std::vector<SectionEntry> m_entries;
+            /** Holds the data of the sections. */
+            std::vector<std::span<const std::byte>> m_data;
+        };
+
+        /** Validates and resolves the sections of a mapped file. */
+        class SectionReader
+        {
+        public:
+            SectionReader(std::span<const std::byte> file, std::span<const SectionEntry> entries)
+                : m_file{file}, m_entries{entries}
+            {
+            }
+
+            [[nodiscard]] const SectionEntry* Find(SectionType type, std::size_t channel) const
+            {
+                for (const auto& entry : m_entries) {
+                    if (entry.m_type == type && entry.m_channel == channel) { return &entry; }
+                }
+                return nullptr;
+            }
+
+            [[nodiscard]] std::size_t CountChannels(SectionType type) const
+            {
+                std::size_t count = 0;
+                while (Find(type, count) != nullptr) { count += 1; }
+                return count;
+            }
+
+            [[nodiscard]] std::span<const std::byte> GetBytes(const SectionEntry& entry) const
+            {
+                if (entry.m_elementSize == 0 || entry.m_offset > m_file.size()
+                    || entry.m_count > (m_file.size() - entry.m_offset) / entry.m_elementSize) {
+                    throw std::runtime_error("Mesh binary file section is out of bounds.");
+                }
+                return m_file.subspan(entry.m_offset, entry.m_count * entry.m_elementSize);
+            }
+
+            template<typename T> void Map(SectionType type, std::size_t channel, MeshArray<T>& array) const
+            {
+                const auto* entry = Find(type, channel);
+                if (entry == nullptr) { throw std::runtime_error("Mesh binary file section is missing."); }
+                if (entry->m_elementSize != sizeof(T)) {
+                    throw std::runtime_error("Mesh binary file section has a wrong element size.");
+                }
+                auto bytes = GetBytes(*entry);
+                if (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(T) != 0) { // NOLINT
+                    throw std::runtime_error("Mesh binary file section is not aligned.");
+                }
+                const auto* elements = reinterpret_cast<const T*>(bytes.data()); // NOLINT
+                array.Map({elements, entry->m_count});
+            }
+
+            template<typename T>
+            void MapChannels(SectionType type, std::vector<MeshArray<T>>& arrays) const
+            {
+                arrays.resize(CountChannels(type));
+                for (std::size_t i = 0; i < arrays.size(); ++i) { Map(type, i, arrays[i]); }
+            }
+
+        private:
+            /** Holds the whole mapped file. */
+            std::span<const std::byte> m_file;
+            /** Holds the section table. */
+            std::span<const SectionEntry> m_entries;
+        };
+    }
+
+    std::filesystem::path MeshBinaryFile::GetBinaryFilename(const std::filesystem::path& sourceFilename)
+    {
+        auto filename = sourceFilename;
+        filename += ".vkbin";
+        return filename;
+    }
+
+    void MeshBinaryFile::Write(const MeshInfo& mesh, const std::filesystem::path& sourceFilename)
+    {
+        if constexpr (std::endian::native != std::endian::little) {
+            spdlog::warn("Mesh binary files are only written on little endian systems.\nFilename: {}",
+                         sourceFilename.string());
+            return;
+        }
+
+        std::ostringstream metadataStream;
+        {
+            cereal::BinaryOutputArchive oa{metadataStream};
+            oa(cereal::make_nvp("materials", mesh.m_materials), cereal::make_nvp("subMeshes", mesh.m_subMeshes),
+               cereal::make_nvp("animations", mesh.m_animations), cereal::make_nvp("rootNode", mesh.m_rootNode),
+               cereal::make_nvp("globalInverse", mesh.m_globalInverse));
+        }
+        auto metadata = std::move(metadataStream).str();
+
+        SectionWriter writer;
+        writer.AddMetadata(std::as_bytes(std::span{metadata}));
+        writer.Add(SectionType::Vertices, 0, mesh.m_vertices.View());
+        writer.Add(SectionType::Normals, 0, mesh.m_normals.View());
+        for (std::size_t i = 0; i < mesh.m_texCoords.size(); ++i) {
+            writer.Add(SectionType::TexCoords, i, mesh.m_texCoords[i].View());
+        }
+        writer.Add(SectionType::Tangents, 0, mesh.m_tangents.View());
+        writer.Add(SectionType::Binormals, 0, mesh.m_binormals.View());
+        for (std::size_t i = 0; i < mesh.m_colors.size(); ++i) {
+            writer.Add(SectionType::Colors, i, mesh.m_colors[i].View());
+        }
+        writer.Add(SectionType::BoneOffsetMatrixIndices, 0, mesh.m_boneOffsetMatrixIndices.View());
+        writer.Add(SectionType::BoneWeights, 0, mesh.m_boneWeights.View());
+        for (std::size_t i = 0; i < mesh.m_indexVectors.size(); ++i) {
+            writer.Add(SectionType::IndexVectors, i, mesh.m_indexVectors[i].View());
+        }
+        writer.Add(SectionType::InverseBindPoseMatrices, 0, mesh.m_inverseBindPoseMatrices.View());
+        writer.Add(SectionType::BoneParents, 0, mesh.m_boneParent.View());
+        writer.Add(SectionType::Indices, 0, mesh.m_indices.View());
+        writer.Add(SectionType::BoneBoundingBoxes, 0, mesh.m_boneBoundingBoxes.View());
+
+        FileHeader header;
+        auto sourceInfo = GetSourceInfo(sourceFilename);
+        header.m_sourceTimestamp = sourceInfo.m_timestamp;
+        header.m_sourceSize = sourceInfo.m_size;
+        header.m_sourceHash = HashSourceFile(sourceFilename);
+
+        auto binaryFilename = GetBinaryFilename(sourceFilename);
+        // the old file may still be mapped by loaded meshes, so it is replaced instead of written in place.
+        auto tmpFilename = binaryFilename;
+        tmpFilename += ".tmp";
+        std::error_code ec;
+        {
+            std::ofstream out{tmpFilename, std::ios::binary | std::ios::trunc};
+            writer.Write(out, header);
+            if (!out) { ec = std::make_error_code(std::errc::io_error); }
+        }
+        if (!ec) { std::filesystem::rename(tmpFilename, binaryFilename, ec); }
+        if (ec) {
+            spdlog::warn("Could not write mesh binary file.\nFilename: {}\nError Message: {}", binaryFilename.string(),
+                         ec.message());
+            std::filesystem::remove(tmpFilename, ec);
+        }
+    }
+
+    bool MeshBinaryFile::Read(MeshInfo& mesh, const std::filesystem::path& sourceFilename)
+    {
+        auto binaryFilename = GetBinaryFilename(sourceFilename);
+        if (!std::filesystem::exists(binaryFilename)) { return false; }
+
+        try {
+            auto mappedFile = std::make_shared<const MemoryMappedFile>(binaryFilename);
+            auto file = mappedFile->GetData();
+
+            FileHeader header;
+            if (file.size() < sizeof(FileHeader)) { throw std::runtime_error("File is too small."); }
+            std::memcpy(&header, file.data(), sizeof(FileHeader));
+            if (header.m_magic != FILE_MAGIC || header.m_version != FORMAT_VERSION
+                || header.m_endianMarker != ENDIAN_MARKER || header.m_headerSize != sizeof(FileHeader)
+                || header.m_fileSize != file.size()
+                || header.m_sectionCount > (file.size() - sizeof(FileHeader)) / sizeof(SectionEntry)) {
+                throw std::runtime_error("Header does not match the current format.");
+            }
+
+            std::vector<SectionEntry> entries(header.m_sectionCount);
+            std::memcpy(entries.data(), file.subspan(sizeof(FileHeader)).data(), entries.size() * sizeof(SectionEntry));
+            if (ComputeChecksum(header, entries) != header.m_checksum) {
+                throw std::runtime_error("Header checksum does not match.");
+            }
+
+            auto sourceInfo = GetSourceInfo(sourceFilename);
+            if (sourceInfo.m_size != header.m_sourceSize) { return false; }
+            const auto sourceTouched = sourceInfo.m_timestamp != header.m_sourceTimestamp;
+            if (sourceTouched && HashSourceFile(sourceFilename) != header.m_sourceHash) { return false; }
+
+            SectionReader reader{file, entries};
+            const auto* metadataEntry = reader.Find(SectionType::Metadata, 0);
+            if (metadataEntry == nullptr || metadataEntry->m_elementSize != 1) {
+                throw std::runtime_error("Metadata section is missing.");
+            }
+            // load into a temporary so a broken file does not leave the mesh half mapped.
+            MeshInfo loaded;
+            SpanStreamBuffer metadataBuffer{reader.GetBytes(*metadataEntry)};
+            std::istream metadataStream{&metadataBuffer};
+            {
+                cereal::BinaryInputArchive ia{metadataStream};
+                ia(cereal::make_nvp("materials", loaded.m_materials),
+                   cereal::make_nvp("subMeshes", loaded.m_subMeshes),
+                   cereal::make_nvp("animations", loaded.m_animations),
+                   cereal::make_nvp("rootNode", loaded.m_rootNode),
+                   cereal::make_nvp("globalInverse", loaded.m_globalInverse));
+            }
+
+            reader.Map(SectionType::Vertices, 0, loaded.m_vertices);
+            reader.Map(SectionType::Normals, 0, loaded.m_normals);
+            reader.MapChannels(SectionType::TexCoords, loaded.m_texCoords);
+            reader.Map(SectionType::Tangents, 0, loaded.m_tangents);
+            reader.Map(SectionType::Binormals, 0, loaded.m_binormals);
+            reader.MapChannels(SectionType::Colors, loaded.m_colors);
+            reader.Map(SectionType::BoneOffsetMatrixIndices, 0, loaded.m_boneOffsetMatrixIndices);
+            reader.Map(SectionType::BoneWeights, 0, loaded.m_boneWeights);
+            reader.MapChannels(SectionType::IndexVectors, loaded.m_indexVectors);
+            reader.Map(SectionType::InverseBindPoseMatrices, 0, loaded.m_inverseBindPoseMatrices);
+            reader.Map(SectionType::BoneParents, 0, loaded.m_boneParent);
+            reader.Map(SectionType::Indices, 0, loaded.m_indices);
+            reader.Map(SectionType::BoneBoundingBoxes, 0, loaded.m_boneBoundingBoxes);
+            loaded.m_mappedFile = std::move(mappedFile);
+            mesh = std::move(loaded);
+            if (sourceTouched) { UpdateSourceTimestamp(binaryFilename, header, entries, sourceInfo.m_timestamp); }
+            return true;
+        } catch (const std::exception& e) {
+            spdlog::error("Could not load mesh binary file.\nFilename: {}\nError Message: {}", binaryFilename.string(),
+                          e.what());
+            return false;
+        }
+    }
+}
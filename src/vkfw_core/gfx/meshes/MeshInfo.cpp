@@ -12,6 +12,7 @@
 #include "core/serialization_helper.h"
 #include "gfx/meshes/SceneMeshNode.h"
 #include <gfx/vk/buffers/DeviceBuffer.h>
+#include "core/memory_mapped_file.h"
 #include <fstream>
 
 
@@ -22,6 +23,7 @@ namespace vkfw_core::gfx {
 
     /** Copy constructor. */
     MeshInfo::MeshInfo(const MeshInfo& rhs) :
+        m_mappedFile(rhs.m_mappedFile),
         m_vertices(rhs.m_vertices),
         m_normals(rhs.m_normals),
         m_texCoords(rhs.m_texCoords),
@@ -58,7 +60,8 @@ namespace vkfw_core::gfx {
 
     /** Default move constructor. */
     MeshInfo::MeshInfo(MeshInfo&& rhs) noexcept
-        : m_vertices(std::move(rhs.m_vertices)),
+        : m_mappedFile(std::move(rhs.m_mappedFile)),
+          m_vertices(std::move(rhs.m_vertices)),
           m_normals(std::move(rhs.m_normals)),
           m_texCoords(std::move(rhs.m_texCoords)),
           m_tangents(std::move(rhs.m_tangents)),
@@ -83,7 +86,7 @@ namespace vkfw_core::gfx {
     /** Default move assignment operator. */
     MeshInfo& MeshInfo::operator=(MeshInfo&& rhs) noexcept
     {
-        this->~MeshInfo();
+        m_mappedFile = std::move(rhs.m_mappedFile);
         m_vertices = std::move(rhs.m_vertices);
         m_normals = std::move(rhs.m_normals);
         m_texCoords = std::move(rhs.m_texCoords);
@@ -114,7 +117,7 @@ namespace vkfw_core::gfx {
         m_subMeshes.emplace_back(this, name, idxOffset, numIndices, materialID);
     }
 
-    void MeshInfo::CreateSceneNodes(aiNode* rootNode, const std::map<std::string, unsigned int>& boneMap)
+    void MeshInfo::CreateSceneNodes(aiNode* rootNode, const std::unordered_map<std::string, unsigned int>& boneMap)
     {
         m_rootNode = std::make_unique<SceneMeshNode>(rootNode, nullptr, boneMap);
         m_rootNode->GenerateBoundingBoxes(*this);
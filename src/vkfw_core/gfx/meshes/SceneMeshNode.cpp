@@ -23,7 +23,8 @@ namespace vkfw_core::gfx {
         m_aabb.m_minmax[1] = glm::vec3(-std::numeric_limits<float>::infinity());
     }
 
-    SceneMeshNode::SceneMeshNode(aiNode* node, const SceneMeshNode* parent, const std::map<std::string, unsigned int>& boneMap) :
+    SceneMeshNode::SceneMeshNode(aiNode* node, const SceneMeshNode* parent,
+                                 const std::unordered_map<std::string, unsigned int>& boneMap) :
         m_nodeName(node->mName.C_Str()),
         m_localTransform{ AiMatrixToGLM(node->mTransformation) },
         m_parent{ parent },
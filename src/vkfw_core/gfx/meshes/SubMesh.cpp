@@ -19,8 +19,8 @@ namespace vkfw_core::gfx {
         m_materialID(materialID)
     {
         if (m_numIndices == 0) { return; }
-        auto& vertices = mesh->GetVertices();
-        auto& indices = mesh->GetIndices();
+        auto vertices = mesh->GetVertices();
+        auto indices = mesh->GetIndices();
         m_aabb.m_minmax[0] = m_aabb.m_minmax[1] = vertices[indices[m_indexOffset]];
         for (auto i = m_indexOffset; i < m_indexOffset + m_numIndices; ++i) {
             m_aabb.m_minmax[0] = glm::min(m_aabb.m_minmax[0], vertices[indices[i]]);
@@ -133,8 +133,8 @@ namespace vkfw_core::gfx {
         barrier.Record(cmdBuffer.has_value() ? cmdBuffer.value().get() : ucmdBuffer);
         if (!cmdBuffer.has_value()) {
             auto& queue = m_device->GetQueue(0, 0);
-            auto fence = CommandBuffer::endSingleTimeSubmit(queue, ucmdBuffer);
-            fence->Wait(m_device, defaultFenceTimeout);
+            auto submitPoint = CommandBuffer::endSingleTimeSubmit(queue, ucmdBuffer);
+            submitPoint.Wait(m_device, defaultFenceTimeout);
             // queue.WaitIdle();
         }
     }
@@ -0,0 +1,242 @@
+/**
+ * @file   GPUProfiler.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a profiler for GPU timestamps and pipeline statistics.
+ */
+
+#include "gfx/vk/GPUProfiler.h"
+#include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+
+#include <fstream>
+#include "imgui.h"
+
+namespace vkfw_core::gfx {
+
+    namespace {
+
+        // the results of a pipeline statistics query are written in the order of the flag bits.
+        constexpr vk::QueryPipelineStatisticFlags StatisticsFlags =
+            vk::QueryPipelineStatisticFlagBits::eInputAssemblyVertices
+            | vk::QueryPipelineStatisticFlagBits::eInputAssemblyPrimitives
+            | vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations
+            | vk::QueryPipelineStatisticFlagBits::eClippingPrimitives
+            | vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations
+            | vk::QueryPipelineStatisticFlagBits::eComputeShaderInvocations;
+        constexpr std::uint32_t NumStatistics = 6;
+
+        std::vector<std::string> GetStatisticsNames()
+        {
+            return {"ia_vertices", "ia_primitives", "vs_invocations",
+                    "clipping_primitives", "fs_invocations", "cs_invocations"};
+        }
+    }
+
+    GPUProfiler::GPUProfiler(const LogicalDevice* device, std::string_view name, std::size_t framesInFlight,
+                             unsigned int queueFamily, std::uint32_t maxRegionsPerFrame, bool pipelineStatistics)
+        : m_device{device}
+        , m_name{name}
+        , m_maxRegionsPerFrame{maxRegionsPerFrame}
+        , m_frameSlots(framesInFlight)
+    {
+        auto queueFamilyProperties = m_device->GetPhysicalDevice().getQueueFamilyProperties();
+        m_timestampValidBits = queueFamilyProperties[queueFamily].timestampValidBits;
+        m_timestampPeriod = static_cast<double>(m_device->GetDeviceProperties().limits.timestampPeriod);
+        if (m_timestampValidBits == 0) {
+            spdlog::warn("Queue family {} does not support timestamps, GPU profiler '{}' only records labels.",
+                         queueFamily, m_name);
+            return;
+        }
+
+        const auto numFrames = static_cast<std::uint32_t>(framesInFlight);
+        vk::QueryPoolCreateInfo timestampPoolInfo{vk::QueryPoolCreateFlags{}, vk::QueryType::eTimestamp,
+                                                  2 * m_maxRegionsPerFrame * numFrames};
+        m_timestampPool = QueryPool{m_device->GetHandle(), fmt::format("{}:TimestampPool", m_name),
+                                    m_device->GetHandle().createQueryPoolUnique(timestampPoolInfo)};
+
+        if (pipelineStatistics && m_device->GetDeviceFeatures().pipelineStatisticsQuery) {
+            vk::QueryPoolCreateInfo statisticsPoolInfo{vk::QueryPoolCreateFlags{}, vk::QueryType::ePipelineStatistics,
+                                                       m_maxRegionsPerFrame * numFrames, StatisticsFlags};
+            m_statisticsPool = QueryPool{m_device->GetHandle(), fmt::format("{}:StatisticsPool", m_name),
+                                         m_device->GetHandle().createQueryPoolUnique(statisticsPoolInfo)};
+            m_statistics = ProfilerStatistics{GetStatisticsNames()};
+        } else if (pipelineStatistics) {
+            spdlog::warn("Pipeline statistics queries are not supported, GPU profiler '{}' only measures times.",
+                         m_name);
+        }
+
+        for (std::size_t i = 0; i < framesInFlight; ++i) { ResetQueries(i); }
+    }
+
+    GPUProfiler::~GPUProfiler() = default;
+
+    void GPUProfiler::BeginRecording(std::size_t frameIndex)
+    {
+        assert(m_openRegions.empty() && "All regions need to be ended before recording another frame.");
+        m_recordingSlot = frameIndex;
+        m_frameSlots[frameIndex].m_regions.clear();
+        m_frameSlots[frameIndex].m_numStatisticsQueries = 0;
+        if (HasTimestamps()) { ResetQueries(frameIndex); }
+    }
+
+    void GPUProfiler::BeginRegion(const CommandBuffer& cmdBuffer, std::string_view regionName,
+                                  vk::PipelineStageFlags2KHR stage, const glm::vec4& color)
+    {
+        auto& slot = m_frameSlots[m_recordingSlot];
+        if (slot.m_regions.size() >= m_maxRegionsPerFrame) {
+            spdlog::error("GPU profiler '{}' has more than {} regions in a frame.", m_name, m_maxRegionsPerFrame);
+            throw std::runtime_error("Too many GPU profiler regions in a frame.");
+        }
+
+        Region region;
+        region.m_depth = static_cast<std::uint32_t>(m_openRegions.size());
+        region.m_name = m_openRegions.empty()
+                            ? std::string{regionName}
+                            : fmt::format("{}/{}", slot.m_regions[m_openRegions.back()].m_name, regionName);
+        cmdBuffer.BeginLabel(region.m_name, color);
+
+        const auto regionIndex = static_cast<std::uint32_t>(slot.m_regions.size());
+        if (HasTimestamps()) {
+            cmdBuffer.GetHandle().writeTimestamp2KHR(stage, m_timestampPool.GetHandle(),
+                                                     GetFirstTimestampQuery(m_recordingSlot) + 2 * regionIndex);
+        }
+        // pipeline statistics queries cannot be nested, so they are only used for top-level regions.
+        if (HasPipelineStatistics() && region.m_depth == 0) {
+            region.m_statisticsQuery = slot.m_numStatisticsQueries++;
+            cmdBuffer.GetHandle().beginQuery(m_statisticsPool.GetHandle(),
+                                             GetFirstStatisticsQuery(m_recordingSlot) + region.m_statisticsQuery,
+                                             vk::QueryControlFlags{});
+        }
+
+        m_openRegions.push_back(slot.m_regions.size());
+        slot.m_regions.emplace_back(std::move(region));
+    }
+
+    void GPUProfiler::EndRegion(const CommandBuffer& cmdBuffer, vk::PipelineStageFlags2KHR stage)
+    {
+        assert(!m_openRegions.empty() && "No GPU profiler region to end.");
+        const auto regionIndex = m_openRegions.back();
+        m_openRegions.pop_back();
+        const auto& region = m_frameSlots[m_recordingSlot].m_regions[regionIndex];
+
+        if (region.m_statisticsQuery != static_cast<std::uint32_t>(-1)) {
+            cmdBuffer.GetHandle().endQuery(m_statisticsPool.GetHandle(),
+                                           GetFirstStatisticsQuery(m_recordingSlot) + region.m_statisticsQuery);
+        }
+        if (HasTimestamps()) {
+            cmdBuffer.GetHandle().writeTimestamp2KHR(
+                stage, m_timestampPool.GetHandle(),
+                GetFirstTimestampQuery(m_recordingSlot) + 2 * static_cast<std::uint32_t>(regionIndex) + 1);
+        }
+        cmdBuffer.EndLabel();
+    }
+
+    bool GPUProfiler::Resolve(std::size_t frameIndex)
+    {
+        const auto& slot = m_frameSlots[frameIndex];
+        if (!HasTimestamps() || slot.m_regions.empty()) { return false; }
+
+        const auto numTimestamps = 2 * static_cast<std::uint32_t>(slot.m_regions.size());
+        const auto numStatisticsValues = NumStatistics * slot.m_numStatisticsQueries;
+        m_queryResults.resize(numTimestamps + numStatisticsValues);
+
+        // without the wait flag this returns eNotReady if the slot was not submitted since its queries were reset.
+        auto result = m_device->GetHandle().getQueryPoolResults(
+            m_timestampPool.GetHandle(), GetFirstTimestampQuery(frameIndex), numTimestamps,
+            numTimestamps * sizeof(std::uint64_t), m_queryResults.data(), sizeof(std::uint64_t),
+            vk::QueryResultFlagBits::e64);
+        if (result == vk::Result::eSuccess && slot.m_numStatisticsQueries > 0) {
+            result = m_device->GetHandle().getQueryPoolResults(
+                m_statisticsPool.GetHandle(), GetFirstStatisticsQuery(frameIndex), slot.m_numStatisticsQueries,
+                numStatisticsValues * sizeof(std::uint64_t), &m_queryResults[numTimestamps],
+                NumStatistics * sizeof(std::uint64_t), vk::QueryResultFlagBits::e64);
+        }
+        if (result == vk::Result::eNotReady) { return false; }
+        if (result != vk::Result::eSuccess) {
+            spdlog::error("Could not read GPU profiler '{}' queries: {}.", m_name, vk::to_string(result));
+            throw std::runtime_error("Could not read GPU profiler queries.");
+        }
+
+        const auto timestampMask =
+            m_timestampValidBits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << m_timestampValidBits) - 1;
+        for (std::size_t i = 0; i < slot.m_regions.size(); ++i) {
+            const auto& region = slot.m_regions[i];
+            auto ticks = (m_queryResults[2 * i + 1] - m_queryResults[2 * i]) & timestampMask;
+            auto time = static_cast<double>(ticks) * m_timestampPeriod * 1e-6;
+
+            std::span<const std::uint64_t> statistics;
+            if (region.m_statisticsQuery != static_cast<std::uint32_t>(-1)) {
+                statistics = std::span<const std::uint64_t>{
+                    &m_queryResults[numTimestamps + NumStatistics * region.m_statisticsQuery], NumStatistics};
+            }
+            m_statistics.AddSample(region.m_name, region.m_depth, time, statistics);
+        }
+
+        ResetQueries(frameIndex);
+        return true;
+    }
+
+    void GPUProfiler::DrawGUI() const
+    {
+        constexpr auto tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+        if (!ImGui::BeginTable(m_name.c_str(), 4, tableFlags)) { return; }
+
+        ImGui::TableSetupColumn("Region");
+        ImGui::TableSetupColumn("Min [ms]");
+        ImGui::TableSetupColumn("Avg [ms]");
+        ImGui::TableSetupColumn("Max [ms]");
+        ImGui::TableHeadersRow();
+        for (const auto& region : m_statistics.GetRegions()) {
+            auto separator = region.m_name.rfind('/');
+            auto regionName = separator == std::string::npos ? region.m_name : region.m_name.substr(separator + 1);
+
+            // ImGui::Indent(0) would indent by the default spacing.
+            auto indent = static_cast<float>(region.m_depth) * ImGui::GetStyle().IndentSpacing;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            if (region.m_depth > 0) { ImGui::Indent(indent); }
+            ImGui::TextUnformatted(regionName.c_str());
+            if (region.m_depth > 0) { ImGui::Unindent(indent); }
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", region.m_minTime);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", region.GetAverageTime());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", region.m_maxTime);
+        }
+        ImGui::EndTable();
+    }
+
+    void GPUProfiler::WriteCSV(const std::filesystem::path& filename) const
+    {
+        std::ofstream out{filename, std::ios::trunc};
+        if (!out) {
+            spdlog::warn("Could not write GPU profiler results.\nFilename: {}", filename.string());
+            return;
+        }
+        m_statistics.WriteCSV(out);
+    }
+
+    std::uint32_t GPUProfiler::GetFirstTimestampQuery(std::size_t frameIndex) const
+    {
+        return 2 * m_maxRegionsPerFrame * static_cast<std::uint32_t>(frameIndex);
+    }
+
+    std::uint32_t GPUProfiler::GetFirstStatisticsQuery(std::size_t frameIndex) const
+    {
+        return m_maxRegionsPerFrame * static_cast<std::uint32_t>(frameIndex);
+    }
+
+    void GPUProfiler::ResetQueries(std::size_t frameIndex)
+    {
+        // host query reset (Vulkan 1.2), the caller guarantees the slot is not in use by the GPU.
+        m_device->GetHandle().resetQueryPool(m_timestampPool.GetHandle(), GetFirstTimestampQuery(frameIndex),
+                                             2 * m_maxRegionsPerFrame);
+        if (HasPipelineStatistics()) {
+            m_device->GetHandle().resetQueryPool(m_statisticsPool.GetHandle(), GetFirstStatisticsQuery(frameIndex),
+                                                 m_maxRegionsPerFrame);
+        }
+    }
+}
@@ -9,13 +9,21 @@
 #include "gfx/vk/LogicalDevice.h"
 #include <app/ApplicationBase.h>
 #include "gfx/vk/Shader.h"
+#include "core/job_pool.h"
+#include "core/resources/HotReloader.h"
 #include "core/resources/ShaderManager.h"
+#include "core/resources/TextureManager.h"
 #include "gfx/vk/pipeline/GraphicsPipeline.h"
 #include "gfx/vk/textures/Texture.h"
 #include "gfx/Texture2D.h"
 #include "gfx/vk/memory/MemoryGroup.h"
+#include "gfx/vk/memory/DeviceMemoryAllocator.h"
+#include "gfx/vk/buffers/StagingRingBuffer.h"
+#include "gfx/vk/pipeline/PipelineCache.h"
 #include "gfx/vk/QueuedDeviceTransfer.h"
 
+#include <cstring>
+
 namespace vkfw_core::gfx {
 
     LogicalDevice::LogicalDevice(const cfg::WindowCfg& windowCfg, vk::PhysicalDevice phDevice,
@@ -105,6 +113,20 @@ namespace vkfw_core::gfx {
             if (surface) {
                 enabledDeviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
             } // checked this extension earlier
+
+            // creation feedback is optional and only used to report pipeline cache hits.
+            m_pipelineCreationFeedback =
+                std::any_of(extensions.begin(), extensions.end(), [](const vk::ExtensionProperties& extProps) {
+                    return std::strcmp(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME, &extProps.extensionName[0])
+                           == 0;
+                });
+            auto alreadyEnabled =
+                std::any_of(enabledDeviceExtensions.begin(), enabledDeviceExtensions.end(), [](const char* enabledExt) {
+                    return std::strcmp(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME, enabledExt) == 0;
+                });
+            if (m_pipelineCreationFeedback && !alreadyEnabled) {
+                enabledDeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+            }
         }
 
         vk::DeviceCreateInfo deviceCreateInfo{
@@ -178,12 +200,40 @@ namespace vkfw_core::gfx {
             }
         }
 
-        m_shaderManager = std::make_unique<ShaderManager>(this);
-        m_textureManager = std::make_unique<TextureManager>(this);
+        {
+            auto cacheFile = std::filesystem::path{ApplicationBase::instance().GetConfig().m_evalDirectory}
+                             / fmt::format("pipeline_cache_{:04x}_{:04x}.bin", m_deviceProperties.vendorID,
+                                           m_deviceProperties.deviceID);
+            m_pipelineCache = std::make_unique<PipelineCache>(
+                this, fmt::format("Dev-{} PipelineCache", windowCfg.m_windowTitle), cacheFile,
+                m_pipelineCreationFeedback);
+        }
+
+        if (windowCfg.m_useMemoryPool) {
+            m_memoryAllocator = std::make_unique<DeviceMemoryAllocator>(this, windowCfg.m_deviceMemoryBlockSize,
+                                                                        windowCfg.m_hostMemoryBlockSize);
+        }
+        m_stagingRingBuffer = std::make_unique<StagingRingBuffer>(
+            this, fmt::format("Dev-{} StagingRingBuffer", windowCfg.m_windowTitle), windowCfg.m_stagingBufferSize);
+
+        m_resourceJobPool = std::make_unique<JobPool>(JobPool::GetDefaultNumThreads());
+        m_shaderManager = std::make_unique<ShaderManager>(this, m_resourceJobPool.get());
+        m_textureManager = std::make_unique<TextureManager>(this, m_resourceJobPool.get());
+        // evicted resources may still be used by submitted work.
+        m_shaderManager->SetEvictionCallback([this](const std::string&, std::shared_ptr<Shader> shader) {
+            m_resourceReleaser->AddResourceAfterSubmittedWork(
+                std::make_shared<SharedReleaseableResource<Shader>>(std::move(shader)));
+        });
+        m_textureManager->SetEvictionCallback([this](const std::string&, std::shared_ptr<Texture2D> texture) {
+            m_resourceReleaser->AddResourceAfterSubmittedWork(
+                std::make_shared<SharedReleaseableResource<Texture2D>>(std::move(texture)));
+        });
 
         m_dummyMemGroup = std::make_unique<MemoryGroup>(this, "DummyMemGroup", vk::MemoryPropertyFlags());
-        m_dummyTexture = m_textureManager->GetResource("dummy.png", true, true,
-                                                       *m_dummyMemGroup); // , std::vector<std::uint32_t>{ {0, 1} }
+        // the dummy texture has no mipmaps, so creating the device does not depend on the capabilities of queue 0.
+        m_dummyTexture = m_textureManager->GetResource("dummy.png", true, true, *m_dummyMemGroup,
+                                                       std::vector<std::uint32_t>{},
+                                                       TextureMipmapDesc{MipmapGeneration::NONE, MipmapOptions{}});
 
         QueuedDeviceTransfer transfer{this, GetQueue(0, 0)};
         m_dummyMemGroup->FinalizeDeviceGroup();
@@ -198,24 +248,39 @@ namespace vkfw_core::gfx {
                                                        vk::PipelineStageFlagBits2KHR::eFragmentShader,
                                                        vk::ImageLayout::eShaderReadOnlyOptimal, barrier);
             barrier.Record(cmdBuffer);
-            auto fence = CommandBuffer::endSingleTimeSubmit(GetQueue(0, 0), cmdBuffer, {}, {});
-            if (auto r = GetHandle().waitForFences({fence->GetHandle()}, VK_TRUE, vkfw_core::defaultFenceTimeout);
-                r != vk::Result::eSuccess) {
-                spdlog::error("Could not wait for fence while transitioning layout: {}.", r);
-                throw std::runtime_error("Could not wait for fence while transitioning layout.");
-            }
+            auto submitPoint = CommandBuffer::endSingleTimeSubmit(GetQueue(0, 0), cmdBuffer, {}, {});
+            submitPoint.Wait(this, vkfw_core::defaultFenceTimeout);
         }
     }
 
 
     LogicalDevice::~LogicalDevice()
     {
+        // loads finishing during the destruction of the managers must not hand evicted resources to the releaser.
+        m_shaderManager->SetEvictionCallback({});
+        m_textureManager->SetEvictionCallback({});
+        // the releaser waits for the timeline semaphores of the queues, so it has to go first.
+        m_resourceReleaser.reset();
         m_vkCmdPoolsByDeviceQFamily.clear();
         m_cmdPoolsByRequestedQFamily.clear();
         m_vkQueuesByDeviceFamily.clear();
         m_queuesByRequestedFamily.clear();
     }
 
+    std::vector<TimelinePoint> LogicalDevice::GetLastSubmits() const
+    {
+        std::vector<TimelinePoint> lastSubmits;
+        for (const auto& familyQueues : m_queuesByRequestedFamily) {
+            for (const auto& queue : familyQueues) { lastSubmits.push_back(queue.GetLastSubmit()); }
+        }
+        return lastSubmits;
+    }
+
+    void LogicalDevice::EnableHotReload()
+    {
+        if (!m_hotReloader) { m_hotReloader = std::make_unique<HotReloader>(this); }
+    }
+
     CommandPool LogicalDevice::CreateCommandPoolForQueue(std::string_view name, unsigned int familyIndex, const vk::CommandPoolCreateFlags& flags) const
     {
         if constexpr (use_debug_pipeline) {
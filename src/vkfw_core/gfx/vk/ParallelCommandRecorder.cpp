@@ -0,0 +1,63 @@
+/**
+ * @file   ParallelCommandRecorder.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of a recorder for secondary command buffers on multiple threads.
+ */
+
+#include "gfx/vk/ParallelCommandRecorder.h"
+#include "gfx/vk/LogicalDevice.h"
+
+namespace vkfw_core::gfx {
+
+    ParallelCommandRecorder::ParallelCommandRecorder(const LogicalDevice* device, std::string_view name,
+                                                     unsigned int queueFamily, std::size_t numThreads,
+                                                     std::size_t framesInFlight)
+        : m_device{device}, m_workers{numThreads}
+    {
+        const auto deviceQueueFamily = m_device->GetQueueInfo(queueFamily).m_familyIndex;
+        vk::CommandPoolCreateInfo poolInfo{vk::CommandPoolCreateFlagBits::eTransient, deviceQueueFamily};
+
+        m_frameResources.resize(std::max<std::size_t>(framesInFlight, 1));
+        for (std::size_t iFrame = 0; iFrame < m_frameResources.size(); ++iFrame) {
+            for (std::size_t iThread = 0; iThread < GetNumThreads(); ++iThread) {
+                CommandPool commandPool{m_device->GetHandle(),
+                                        fmt::format("{} CommandPool{}-{}", name, iFrame, iThread), queueFamily,
+                                        m_device->GetHandle().createCommandPoolUnique(poolInfo)};
+                vk::CommandBufferAllocateInfo allocInfo{commandPool.GetHandle(), vk::CommandBufferLevel::eSecondary, 1};
+                auto commandBuffers = m_device->GetHandle().allocateCommandBuffersUnique(allocInfo);
+                m_frameResources[iFrame].emplace_back(ThreadResources{
+                    std::move(commandPool),
+                    CommandBuffer{m_device, fmt::format("{} CommandBuffer{}-{}", name, iFrame, iThread), queueFamily,
+                                  std::move(commandBuffers[0])}});
+            }
+        }
+        m_secondaryHandles.resize(GetNumThreads());
+    }
+
+    ParallelCommandRecorder::~ParallelCommandRecorder() = default;
+
+    void ParallelCommandRecorder::Record(
+        std::size_t frameIndex, CommandBuffer& primaryCmdBuffer, const vk::CommandBufferInheritanceInfo& inheritance,
+        function_view<void(CommandBuffer& cmdBuffer, std::size_t threadIndex)> recordFunc)
+    {
+        auto& frameResources = m_frameResources[frameIndex % m_frameResources.size()];
+
+        vk::CommandBufferUsageFlags usage = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+        if (inheritance.renderPass) { usage |= vk::CommandBufferUsageFlagBits::eRenderPassContinue; }
+        const vk::CommandBufferBeginInfo beginInfo{usage, &inheritance};
+
+        m_workers.Run([this, &frameResources, &beginInfo, recordFunc](std::size_t threadIndex) {
+            auto& threadResources = frameResources[threadIndex];
+            m_device->GetHandle().resetCommandPool(threadResources.m_commandPool.GetHandle(),
+                                                   vk::CommandPoolResetFlags());
+            threadResources.m_commandBuffer.Begin(beginInfo);
+            recordFunc(threadResources.m_commandBuffer, threadIndex);
+            threadResources.m_commandBuffer.End();
+            m_secondaryHandles[threadIndex] = threadResources.m_commandBuffer.GetHandle();
+        });
+
+        primaryCmdBuffer.GetHandle().executeCommands(m_secondaryHandles);
+    }
+}
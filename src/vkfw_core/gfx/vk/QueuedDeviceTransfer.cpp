@@ -12,12 +12,20 @@
 #include "gfx/vk/textures/HostTexture.h"
 #include "gfx/vk/textures/DeviceTexture.h"
 #include "gfx/vk/wrappers/CommandBuffer.h"
+#include "gfx/vk/wrappers/PipelineBarriers.h"
+#include "gfx/vk/buffers/StagingRingBuffer.h"
+
+#include <numeric>
 
 namespace vkfw_core::gfx {
 
+    /** Alignment of buffer data in the staging ring. */
+    constexpr std::size_t STAGING_BUFFER_ALIGNMENT = 16;
+
     QueuedDeviceTransfer::QueuedDeviceTransfer(const LogicalDevice* device, const Queue& transferQueue)
         : m_device{ device }
-        , m_transferQueue{ std::move(transferQueue) }
+        , m_transferQueue{ transferQueue }
+        , m_transferCmdBuffer{ device }
     {
     }
 
@@ -25,18 +33,22 @@ namespace vkfw_core::gfx {
     QueuedDeviceTransfer::~QueuedDeviceTransfer()
     {
         try {
-            if (!m_transferCmdBuffers.empty()) { FinishTransfer(); }
+            if (m_recording || !m_submittedBatches.empty()) { FinishTransfer(); }
         } catch (...) {
             spdlog::critical("Could not finish queued device transfer. Unknown exception.");
         }
     }
 
-    QueuedDeviceTransfer::QueuedDeviceTransfer(QueuedDeviceTransfer&& rhs) noexcept :
-    m_device{ rhs.m_device },
-        m_transferQueue{ std::move(rhs.m_transferQueue) },
-        m_stagingBuffers{ std::move(rhs.m_stagingBuffers) },
-        m_transferCmdBuffers{ std::move(rhs.m_transferCmdBuffers) }
+    QueuedDeviceTransfer::QueuedDeviceTransfer(QueuedDeviceTransfer&& rhs) noexcept
+        : m_device{ rhs.m_device }
+        , m_transferQueue{ std::move(rhs.m_transferQueue) }
+        , m_transferCmdBuffer{ std::move(rhs.m_transferCmdBuffer) }
+        , m_recording{ rhs.m_recording }
+        , m_stagingRegions{ std::move(rhs.m_stagingRegions) }
+        , m_stagingBuffers{ std::move(rhs.m_stagingBuffers) }
+        , m_submittedBatches{ std::move(rhs.m_submittedBatches) }
     {
+        rhs.m_recording = false;
     }
 
     QueuedDeviceTransfer& QueuedDeviceTransfer::operator=(QueuedDeviceTransfer&& rhs) noexcept
@@ -44,8 +56,12 @@ namespace vkfw_core::gfx {
         this->~QueuedDeviceTransfer();
         m_device = rhs.m_device;
         m_transferQueue = std::move(rhs.m_transferQueue);
+        m_transferCmdBuffer = std::move(rhs.m_transferCmdBuffer);
+        m_recording = rhs.m_recording;
+        m_stagingRegions = std::move(rhs.m_stagingRegions);
         m_stagingBuffers = std::move(rhs.m_stagingBuffers);
-        m_transferCmdBuffers = std::move(rhs.m_transferCmdBuffers);
+        m_submittedBatches = std::move(rhs.m_submittedBatches);
+        rhs.m_recording = false;
         return *this;
     }
 
@@ -54,8 +70,6 @@ namespace vkfw_core::gfx {
         const vk::MemoryPropertyFlags& memoryFlags, const std::vector<std::uint32_t>& deviceBufferQueues,
         std::size_t bufferSize, std::size_t dataSize, const void* data)
     {
-        AddStagingBuffer(fmt::format("StagingBuffer:{}", name), dataSize, data);
-
         std::vector<std::uint32_t> queueFamilies;
         queueFamilies.reserve(deviceBufferQueues.size());
         for (auto queue : deviceBufferQueues) { queueFamilies.push_back(m_device->GetQueueInfo(queue).m_familyIndex); }
@@ -63,7 +77,7 @@ namespace vkfw_core::gfx {
             m_device, name, vk::BufferUsageFlagBits::eTransferDst | deviceBufferUsage, memoryFlags, queueFamilies);
         deviceBuffer->InitializeBuffer(bufferSize);
 
-        AddTransferToQueue(m_stagingBuffers.back(), *deviceBuffer);
+        TransferDataToBuffer(dataSize, data, *deviceBuffer, 0);
 
         return deviceBuffer;
     }
@@ -73,15 +87,21 @@ namespace vkfw_core::gfx {
         const std::vector<std::uint32_t>& deviceBufferQueues, const glm::u32vec4& textureSize, std::uint32_t mipLevels,
         const glm::u32vec4& dataSize, const void* data)
     {
-        AddStagingTexture(fmt::format("StagingTexture:{}", name), dataSize, mipLevels, textureDesc, data);
-
         std::vector<std::uint32_t> queueFamilies;
         queueFamilies.reserve(deviceBufferQueues.size());
         for (auto queue : deviceBufferQueues) { queueFamilies.push_back(m_device->GetQueueInfo(queue).m_familyIndex); }
         auto deviceTexture = std::make_unique<DeviceTexture>(m_device, name, textureDesc, initialLayout, queueFamilies);
         deviceTexture->InitializeImage(textureSize, mipLevels);
 
-        AddTransferToQueue(m_stagingTextures.back(), *deviceTexture);
+        // texel offsets in the staging buffer need to be aligned to the texel size and 4 bytes.
+        const auto bytesPP = static_cast<std::uint32_t>(textureDesc.m_bytesPP);
+        const glm::u32vec4 copySize{dataSize.x * bytesPP, dataSize.y, dataSize.z, dataSize.w};
+        auto [stagingBuffer, stagingOffset] =
+            StageData(fmt::format("StagingTexture:{}", name),
+                      static_cast<std::size_t>(copySize.x) * copySize.y * copySize.z * copySize.w, data,
+                      std::lcm(static_cast<std::size_t>(bytesPP), std::size_t{4}));
+        deviceTexture->CopyFromStagingAsync(stagingBuffer, stagingOffset, 0, glm::u32vec4(0), copySize,
+                                            GetTransferCmdBuffer());
 
         return deviceTexture;
     }
@@ -104,13 +124,27 @@ namespace vkfw_core::gfx {
 
     void QueuedDeviceTransfer::TransferDataToBuffer(std::size_t dataSize, const void* data, Buffer& dst, std::size_t dstOffset)
     {
-        AddStagingBuffer(fmt::format("StagingBuffer:{}", dst.GetName()), dataSize, data);
-        AddTransferToQueue(m_stagingBuffers.back(), 0, dst, dstOffset, dataSize);
+        if (dataSize == 0) { return; }
+        auto [stagingBuffer, stagingOffset] =
+            StageData(fmt::format("StagingBuffer:{}", dst.GetName()), dataSize, data, STAGING_BUFFER_ALIGNMENT);
+        dst.CopyFromStagingAsync(stagingBuffer, stagingOffset, dstOffset, dataSize, GetTransferCmdBuffer());
+    }
+
+    void QueuedDeviceTransfer::TransferDataToTexture(const glm::u32vec3& dataSize, const void* data, Texture& dst,
+                                                     std::uint32_t mipLevel, std::uint32_t arrayLayer)
+    {
+        const auto bytesPP = dst.GetDescriptor().m_bytesPP;
+        auto [stagingBuffer, stagingOffset] =
+            StageData(fmt::format("StagingTexture:{}-{}", dst.GetName(), mipLevel),
+                      static_cast<std::size_t>(dataSize.x) * dataSize.y * dataSize.z, data,
+                      std::lcm(bytesPP, std::size_t{4}));
+        dst.CopyFromStagingAsync(stagingBuffer, stagingOffset, mipLevel, glm::u32vec4(0, 0, 0, arrayLayer),
+                                 glm::u32vec4(dataSize, 1), GetTransferCmdBuffer());
     }
 
     void QueuedDeviceTransfer::AddTransferToQueue(Buffer& src, std::size_t srcOffset, Buffer& dst, std::size_t dstOffset, std::size_t copySize)
     {
-        m_transferCmdBuffers.emplace_back(nullptr, src.CopyBufferAsync(srcOffset, dst, dstOffset, copySize, m_transferQueue));
+        src.CopyBufferAsync(srcOffset, dst, dstOffset, copySize, GetTransferCmdBuffer());
     }
 
     void QueuedDeviceTransfer::AddTransferToQueue(Buffer& src, Buffer& dst)
@@ -120,34 +154,113 @@ namespace vkfw_core::gfx {
 
     void QueuedDeviceTransfer::AddTransferToQueue(Texture& src, Texture& dst)
     {
-        auto imgCopyCmdBuffer = CommandBuffer::beginSingleTimeSubmit(
-            m_device, fmt::format("{} to {} CmdBuffer", src.GetName(), dst.GetName()),
-            fmt::format("{} to {} Transfer", src.GetName(), dst.GetName()), m_transferQueue.GetCommandPool());
-        src.CopyImageAsync(0, glm::u32vec4(0), dst, 0, glm::u32vec4(0), src.GetSize(), imgCopyCmdBuffer);
-        auto fence = CommandBuffer::endSingleTimeSubmit(m_transferQueue, imgCopyCmdBuffer);
+        src.CopyImageAsync(0, glm::u32vec4(0), dst, 0, glm::u32vec4(0), src.GetSize(), GetTransferCmdBuffer());
+    }
+
+    void QueuedDeviceTransfer::GenerateMipmaps(Texture& texture)
+    {
+        if (texture.GetMipLevels() <= 1) { return; }
 
-        m_transferCmdBuffers.emplace_back(fence, std::move(imgCopyCmdBuffer));
+        if (!CanGenerateMipmaps(m_device, m_transferQueue)) {
+            spdlog::error("Cannot generate mipmaps for texture {}: blits need a graphics queue.", texture.GetName());
+            throw std::runtime_error("Mipmap generation needs a graphics queue.");
+        }
+        texture.GenerateMipmaps(GetTransferCmdBuffer());
     }
 
-    void QueuedDeviceTransfer::FinishTransfer()
+    void QueuedDeviceTransfer::RecordBarrier(PipelineBarrier& barrier) { barrier.Record(GetTransferCmdBuffer()); }
+
+    bool QueuedDeviceTransfer::CanGenerateMipmaps(const LogicalDevice* device, const Queue& queue)
     {
-        m_transferQueue.WaitIdle();
-        m_transferCmdBuffers.clear();
+        const auto deviceQueueFamily = device->GetQueueInfo(queue.GetCommandPool().GetQueueFamily()).m_familyIndex;
+        const auto queueFlags = device->GetPhysicalDevice().getQueueFamilyProperties()[deviceQueueFamily].queueFlags;
+        return static_cast<bool>(queueFlags & vk::QueueFlagBits::eGraphics);
+    }
+
+    void QueuedDeviceTransfer::Flush()
+    {
+        if (!m_recording) { return; }
+
+        auto finishPoint = CommandBuffer::endSingleTimeSubmit(m_transferQueue, m_transferCmdBuffer);
+        m_device->GetStagingRingBuffer().Submit(m_stagingRegions, finishPoint);
+        m_submittedBatches.emplace_back(
+            TransferBatch{finishPoint, std::move(m_transferCmdBuffer), std::move(m_stagingBuffers)});
+
+        m_transferCmdBuffer = CommandBuffer{m_device};
+        m_stagingRegions.clear();
         m_stagingBuffers.clear();
+        m_recording = false;
     }
 
-    void QueuedDeviceTransfer::AddStagingBuffer(std::string_view name, std::size_t dataSize, const void* data)
+    TimelinePoint QueuedDeviceTransfer::FlushAndRelease()
     {
-        m_stagingBuffers.emplace_back(m_device, name, vk::BufferUsageFlagBits::eTransferSrc);
-        m_stagingBuffers.back().InitializeData(dataSize, data);
+        Flush();
+        if (m_submittedBatches.empty()) { return m_transferQueue.GetLastSubmit(); }
+
+        const auto finishPoint = m_submittedBatches.back().m_finishPoint;
+        for (auto& batch : m_submittedBatches) {
+            m_device->GetResourceReleaser().AddResourceAfterSubmittedWork(
+                std::make_shared<SharedReleaseableResource<TransferBatch>>(
+                    std::make_shared<TransferBatch>(std::move(batch))));
+        }
+        m_submittedBatches.clear();
+        return finishPoint;
+    }
+
+    bool QueuedDeviceTransfer::IsFinished()
+    {
+        RetireFinishedBatches();
+        return !m_recording && m_submittedBatches.empty();
+    }
+
+    void QueuedDeviceTransfer::FinishTransfer()
+    {
+        Flush();
+        for (const auto& batch : m_submittedBatches) { batch.m_finishPoint.Wait(m_device, defaultFenceTimeout); }
+        m_submittedBatches.clear();
+        m_device->GetStagingRingBuffer().Retire();
+    }
+
+    CommandBuffer& QueuedDeviceTransfer::GetTransferCmdBuffer()
+    {
+        if (!m_recording) {
+            m_transferCmdBuffer = CommandBuffer::beginSingleTimeSubmit(
+                m_device, fmt::format("QueuedDeviceTransfer-{} CmdBuffer", m_submittedBatches.size()),
+                "QueuedDeviceTransfer", m_transferQueue.GetCommandPool());
+            m_recording = true;
+        }
+        return m_transferCmdBuffer;
+    }
+
+    std::pair<vk::Buffer, std::size_t> QueuedDeviceTransfer::StageData(std::string_view name, std::size_t dataSize,
+                                                                       const void* data, std::size_t alignment)
+    {
+        auto& stagingRing = m_device->GetStagingRingBuffer();
+        auto region = stagingRing.Stage(dataSize, data, alignment);
+        if (!region.has_value() && !m_stagingRegions.empty()) {
+            // our own unsubmitted regions block the ring, submit them so they can be waited for.
+            Flush();
+            region = stagingRing.Stage(dataSize, data, alignment);
+        }
+        if (region.has_value()) {
+            m_stagingRegions.push_back(region->m_id);
+            return std::make_pair(stagingRing.GetHandle(), region->m_offset);
+        }
+
+        // data larger than the ring (or a ring blocked by other transfers) gets its own staging buffer.
+        auto& stagingBuffer = m_stagingBuffers.emplace_back(m_device, name, vk::BufferUsageFlagBits::eTransferSrc);
+        stagingBuffer.InitializeData(dataSize, data);
+        PipelineBarrier barrier{m_device};
+        auto buffer = stagingBuffer.GetBuffer(false, vk::AccessFlagBits2KHR::eTransferRead,
+                                              vk::PipelineStageFlagBits2KHR::eTransfer, barrier);
+        barrier.Record(GetTransferCmdBuffer());
+        return std::make_pair(buffer, std::size_t{0});
     }
 
-    void QueuedDeviceTransfer::AddStagingTexture(std::string_view name, const glm::u32vec4& size,
-                                                 std::uint32_t mipLevels,
-        const TextureDescriptor& textureDesc, const void* data)
+    void QueuedDeviceTransfer::RetireFinishedBatches()
     {
-        m_stagingTextures.emplace_back(m_device, name, TextureDescriptor::StagingTextureDesc(textureDesc),
-                                       vk::ImageLayout::ePreinitialized);
-        m_stagingTextures.back().InitializeData(size, mipLevels, data);
+        std::erase_if(m_submittedBatches,
+                      [this](const TransferBatch& batch) { return batch.m_finishPoint.IsReached(m_device); });
+        m_device->GetStagingRingBuffer().Retire();
     }
 }
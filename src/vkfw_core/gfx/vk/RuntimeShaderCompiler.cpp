@@ -0,0 +1,107 @@
+/**
+ * @file   RuntimeShaderCompiler.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the runtime shader compiler.
+ */
+
+#include "gfx/vk/RuntimeShaderCompiler.h"
+#include "core/resources/ShaderCache.h"
+
+#include "vkfw_glsl_preprocessor/shader_preprocess.h"
+
+#ifdef VKFW_SHADERC
+#include <shaderc/shaderc.hpp>
+#endif
+
+namespace vkfw_core::gfx {
+
+    namespace {
+        /** The target environment, the same the build compiles for. */
+        constexpr std::string_view targetEnvironment = "vulkan1.2";
+
+#ifdef VKFW_SHADERC
+        shaderc_shader_kind GetShaderKind(vk::ShaderStageFlagBits stage)
+        {
+            switch (stage) {
+            case vk::ShaderStageFlagBits::eFragment: return shaderc_fragment_shader;
+            case vk::ShaderStageFlagBits::eGeometry: return shaderc_geometry_shader;
+            case vk::ShaderStageFlagBits::eTessellationControl: return shaderc_tess_control_shader;
+            case vk::ShaderStageFlagBits::eTessellationEvaluation: return shaderc_tess_evaluation_shader;
+            case vk::ShaderStageFlagBits::eCompute: return shaderc_compute_shader;
+            case vk::ShaderStageFlagBits::eMeshNV: return shaderc_mesh_shader;
+            case vk::ShaderStageFlagBits::eTaskNV: return shaderc_task_shader;
+            case vk::ShaderStageFlagBits::eRaygenKHR: return shaderc_raygen_shader;
+            case vk::ShaderStageFlagBits::eIntersectionKHR: return shaderc_intersection_shader;
+            case vk::ShaderStageFlagBits::eAnyHitKHR: return shaderc_anyhit_shader;
+            case vk::ShaderStageFlagBits::eClosestHitKHR: return shaderc_closesthit_shader;
+            case vk::ShaderStageFlagBits::eMissKHR: return shaderc_miss_shader;
+            case vk::ShaderStageFlagBits::eCallableKHR: return shaderc_callable_shader;
+            default: return shaderc_vertex_shader;
+            }
+        }
+#endif
+    }
+
+    RuntimeShaderCompiler::RuntimeShaderCompiler(std::vector<std::filesystem::path> includeDirectories,
+                                                 ShaderCache* cache)
+        : m_includeDirectories{std::move(includeDirectories)}, m_cache{cache}
+    {
+    }
+
+    bool RuntimeShaderCompiler::IsAvailable()
+    {
+#ifdef VKFW_SHADERC
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::string RuntimeShaderCompiler::GetCompilerIdentity()
+    {
+#ifdef VKFW_SHADERC
+        unsigned int spirvVersion = 0;
+        unsigned int revision = 0;
+        shaderc_get_spv_version(&spirvVersion, &revision);
+        return fmt::format("shaderc {} spv{:x}.{}", VKFW_SHADERC_VERSION, spirvVersion, revision);
+#else
+        return "none";
+#endif
+    }
+
+    std::vector<std::uint32_t> RuntimeShaderCompiler::Compile(const std::string& sourceFilename,
+                                                              vk::ShaderStageFlagBits stage,
+                                                              const std::vector<std::string>& defines) const
+    {
+        // the preprocessed source contains all includes and defines, so it identifies the compiled code.
+        vkfw_glsl::shader_processor processor{m_includeDirectories, defines};
+        const auto source = processor.process_shader(std::filesystem::absolute(sourceFilename));
+        static const auto compilerIdentity = GetCompilerIdentity();
+        const auto key = ShaderCache::ComputeKey(
+            source, fmt::format("{} {} {}", compilerIdentity, vk::to_string(stage), targetEnvironment));
+        if (m_cache != nullptr) {
+            if (auto code = m_cache->Load(key)) { return std::move(*code); }
+        }
+
+#ifdef VKFW_SHADERC
+        shaderc::CompileOptions options;
+        options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
+        const shaderc::Compiler compiler;
+        auto result = compiler.CompileGlslToSpv(source, GetShaderKind(stage), sourceFilename.c_str(), options);
+        if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
+            spdlog::error("Could not compile shader {}:\n{}", sourceFilename, result.GetErrorMessage());
+            throw std::runtime_error("Could not compile shader.");
+        }
+
+        std::vector<std::uint32_t> code{result.cbegin(), result.cend()};
+        if (m_cache != nullptr) { m_cache->Store(key, code); }
+        return code;
+#else
+        spdlog::error("Shader {} is not cached and the framework was built without a shader compiler.",
+                      sourceFilename);
+        throw std::runtime_error("No runtime shader compiler available.");
+#endif
+    }
+}
@@ -7,63 +7,68 @@
  */
 
 #include "gfx/vk/Shader.h"
+#include <array>
+#include <filesystem>
 #include <fstream>
+#include <string_view>
+#include "app/ApplicationBase.h"
 #include "gfx/vk/LogicalDevice.h"
-#include "core/string_algorithms.h"
+#include "gfx/vk/RuntimeShaderCompiler.h"
 
 namespace vkfw_core::gfx {
 
-    Shader::Shader(const std::string & resourceId, const LogicalDevice * device, std::string shaderFilename)
-        : Resource{ resourceId, device }
+    namespace {
+        struct ShaderStageInfo
+        {
+            std::string_view m_extension;
+            vk::ShaderStageFlagBits m_stage;
+            std::string_view m_name;
+        };
+
+        constexpr std::array shaderStages = {
+            ShaderStageInfo{".vert", vk::ShaderStageFlagBits::eVertex, "vertex"},
+            ShaderStageInfo{".frag", vk::ShaderStageFlagBits::eFragment, "fragment"},
+            ShaderStageInfo{".geom", vk::ShaderStageFlagBits::eGeometry, "geometry"},
+            ShaderStageInfo{".tesc", vk::ShaderStageFlagBits::eTessellationControl, "tesselation control"},
+            ShaderStageInfo{".tese", vk::ShaderStageFlagBits::eTessellationEvaluation, "tesselation evaluation"},
+            ShaderStageInfo{".comp", vk::ShaderStageFlagBits::eCompute, "compute"},
+            ShaderStageInfo{".mesh", vk::ShaderStageFlagBits::eMeshNV, "mesh"},
+            ShaderStageInfo{".task", vk::ShaderStageFlagBits::eTaskNV, "task"},
+            ShaderStageInfo{".rgen", vk::ShaderStageFlagBits::eRaygenKHR, "raygen"},
+            ShaderStageInfo{".rint", vk::ShaderStageFlagBits::eIntersectionKHR, "intersection"},
+            ShaderStageInfo{".rahit", vk::ShaderStageFlagBits::eAnyHitKHR, "anyhit"},
+            ShaderStageInfo{".rchit", vk::ShaderStageFlagBits::eClosestHitKHR, "closesthit"},
+            ShaderStageInfo{".rmiss", vk::ShaderStageFlagBits::eMissKHR, "miss"},
+            ShaderStageInfo{".rcall", vk::ShaderStageFlagBits::eCallableKHR, "callable"}};
+
+        const ShaderStageInfo& FindShaderStage(const std::string& shaderFilename)
+        {
+            for (const auto& stage : shaderStages) {
+                if (shaderFilename.ends_with(stage.m_extension)) { return stage; }
+            }
+            return shaderStages[0];
+        }
+    }
+
+    Shader::Shader(const std::string& resourceId, const LogicalDevice* device, std::string shaderFilename,
+                   std::vector<std::string> defines)
+        : Resource{resourceId, device}
         , VulkanObjectWrapper{device->GetHandle(), fmt::format("Shader:{}", resourceId), vk::UniqueShaderModule{}}
-        ,m_shaderFilename{ std::move(shaderFilename) },
-        m_type{ vk::ShaderStageFlagBits::eVertex },
-        m_strType{ "vertex" }
+        , m_shaderFilename{std::move(shaderFilename)}
+        , m_defines{std::move(defines)}
     {
-        if (ends_with(m_shaderFilename, ".frag")) {
-            m_type = vk::ShaderStageFlagBits::eFragment;
-            m_strType = "fragment";
-        } else if (ends_with(m_shaderFilename, ".geom")) {
-            m_type = vk::ShaderStageFlagBits::eGeometry;
-            m_strType = "geometry";
-        } else if (ends_with(m_shaderFilename, ".tesc")) {
-            m_type = vk::ShaderStageFlagBits::eTessellationControl;
-            m_strType = "tesselation control";
-        } else if (ends_with(m_shaderFilename, ".tese")) {
-            m_type = vk::ShaderStageFlagBits::eTessellationEvaluation;
-            m_strType = "tesselation evaluation";
-        } else if (ends_with(m_shaderFilename, ".comp")) {
-            m_type = vk::ShaderStageFlagBits::eCompute;
-            m_strType = "compute";
-        } else if (ends_with(m_shaderFilename, ".mesh")) {
-            m_type = vk::ShaderStageFlagBits::eMeshNV;
-            m_strType = "mesh";
-        } else if (ends_with(m_shaderFilename, ".task")) {
-            m_type = vk::ShaderStageFlagBits::eTaskNV;
-            m_strType = "task";
-        } else if (ends_with(m_shaderFilename, ".rgen")) {
-            m_type = vk::ShaderStageFlagBits::eRaygenKHR;
-            m_strType = "raygen";
-        } else if (ends_with(m_shaderFilename, ".rint")) {
-            m_type = vk::ShaderStageFlagBits::eIntersectionKHR;
-            m_strType = "intersection";
-        } else if (ends_with(m_shaderFilename, ".rahit")) {
-            m_type = vk::ShaderStageFlagBits::eAnyHitKHR;
-            m_strType = "anyhit";
-        } else if (ends_with(m_shaderFilename, ".rchit")) {
-            m_type = vk::ShaderStageFlagBits::eClosestHitKHR;
-            m_strType = "closesthit";
-        } else if (ends_with(m_shaderFilename, ".rmiss")) {
-            m_type = vk::ShaderStageFlagBits::eMissKHR;
-            m_strType = "miss";
-        } else if (ends_with(m_shaderFilename, ".rcall")) {
-            m_type = vk::ShaderStageFlagBits::eCallableKHR;
-            m_strType = "callable";
-        }
+        const auto& stage = FindShaderStage(m_shaderFilename);
+        m_type = stage.m_stage;
+        m_strType = stage.m_name;
 
         LoadCompiledShaderFromFile();
     }
 
+    Shader::Shader(const std::string& resourceId, const LogicalDevice* device, std::string shaderFilename)
+        : Shader{resourceId, device, std::move(shaderFilename), {}}
+    {
+    }
+
     Shader::Shader(const std::string& shaderFilename, const LogicalDevice* device) :
         Shader{ shaderFilename, device, shaderFilename }
     {
@@ -71,6 +76,11 @@ namespace vkfw_core::gfx {
 
     Shader::~Shader() = default;
 
+    vk::ShaderStageFlagBits Shader::GetShaderStage(const std::string& shaderFilename)
+    {
+        return FindShaderStage(shaderFilename).m_stage;
+    }
+
     void Shader::FillShaderStageInfo(vk::PipelineShaderStageCreateInfo& shaderStageCreateInfo) const
     {
         shaderStageCreateInfo.setStage(m_type);
@@ -78,9 +88,19 @@ namespace vkfw_core::gfx {
         shaderStageCreateInfo.setPName("main");
     }
 
-    void Shader::LoadCompiledShaderFromFile()
+    void Shader::Reload(const std::vector<std::uint32_t>& code)
+    {
+        auto reflection = Reflect(code);
+        auto shaderModule = CreateShaderModule(code);
+        // pipelines do not need the modules they were created with, so the old module can be destroyed right away.
+        ResetHandle(GetDevice()->GetHandle(), std::move(shaderModule));
+        m_reflection = std::move(reflection);
+        m_codeSize = code.size() * sizeof(std::uint32_t);
+        m_generation += 1;
+    }
+
+    std::vector<std::uint32_t> Shader::LoadSpirvFile(const std::string& filename)
     {
-        auto filename = FindResourceLocation(m_shaderFilename) + ".spv";
         std::ifstream file(filename, std::ios::ate | std::ios::binary);
 
         if (!file.is_open()) {
@@ -88,13 +108,49 @@ namespace vkfw_core::gfx {
             throw std::runtime_error("Could not open shader file.");
         }
         auto fileSize = static_cast<std::size_t>(file.tellg());
-        std::vector<char> buffer(fileSize);
+        if (fileSize == 0 || fileSize % sizeof(std::uint32_t) != 0) {
+            spdlog::error("Shader file ({}) does not contain SPIR-V code.", filename);
+            throw std::runtime_error("Shader file does not contain SPIR-V code.");
+        }
+        std::vector<std::uint32_t> code(fileSize / sizeof(std::uint32_t));
         file.seekg(0);
-        file.read(buffer.data(), fileSize);
-        file.close();
+        file.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(fileSize)); // NOLINT
+        return code;
+    }
+
+    std::vector<std::uint32_t> Shader::CompileSource() const
+    {
+        return ApplicationBase::instance().GetRuntimeShaderCompiler().Compile(m_sourceFilename, m_type, m_defines);
+    }
 
-        vk::ShaderModuleCreateInfo moduleCreateInfo{ vk::ShaderModuleCreateFlags(), fileSize, reinterpret_cast<std::uint32_t*>(buffer.data()) }; // NOLINT
+    void Shader::LoadCompiledShaderFromFile()
+    {
+        m_sourceFilename = FindResourceLocation(m_shaderFilename);
+        // variants with defines have no SPIR-V file from the build, neither have shaders added without a build step.
+        std::error_code ec;
+        const auto hasSpirvFile = m_defines.empty() && std::filesystem::exists(GetSpirvFilename(), ec);
+        auto code = hasSpirvFile ? LoadSpirvFile(GetSpirvFilename()) : CompileSource();
+        m_reflection = Reflect(code);
+        m_codeSize = code.size() * sizeof(std::uint32_t);
 
-        SetHandle(GetDevice()->GetHandle(), GetDevice()->GetHandle().createShaderModuleUnique(moduleCreateInfo));
+        SetHandle(GetDevice()->GetHandle(), CreateShaderModule(code));
+    }
+
+    ShaderReflection Shader::Reflect(const std::vector<std::uint32_t>& code) const
+    {
+        // the module is still valid, only pipelines relying on the reflection cannot use the shader.
+        try {
+            return ShaderReflection{code};
+        } catch (const std::runtime_error& e) {
+            spdlog::warn("Could not reflect shader {}, its reflection stays empty: {}", m_shaderFilename, e.what());
+            return ShaderReflection{};
+        }
+    }
+
+    vk::UniqueShaderModule Shader::CreateShaderModule(const std::vector<std::uint32_t>& code) const
+    {
+        vk::ShaderModuleCreateInfo moduleCreateInfo{vk::ShaderModuleCreateFlags(), code.size() * sizeof(std::uint32_t),
+                                                    code.data()};
+        return GetDevice()->GetHandle().createShaderModuleUnique(moduleCreateInfo);
     }
 }
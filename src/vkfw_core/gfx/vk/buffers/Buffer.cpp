@@ -70,7 +70,7 @@ namespace vkfw_core::gfx {
         if (initMemory) {
             auto memRequirements = m_device->GetHandle().getBufferMemoryRequirements(GetHandle());
             m_bufferDeviceMemory.InitializeMemory(memRequirements, IsShaderDeviceAddress());
-            BindMemory(m_bufferDeviceMemory.GetHandle(), 0);
+            BindMemory(m_bufferDeviceMemory.GetMemoryHandle(), m_bufferDeviceMemory.GetOffset());
         }
     }
 
@@ -93,19 +93,34 @@ namespace vkfw_core::gfx {
         cmdBuffer.GetHandle().copyBuffer(GetHandle(), dstBuffer.GetHandle(), copyRegion);
     }
 
+    void Buffer::CopyFromStagingAsync(vk::Buffer stagingBuffer, std::size_t stagingOffset, std::size_t dstOffset,
+                                      std::size_t size, CommandBuffer& cmdBuffer)
+    {
+        assert(m_usage & vk::BufferUsageFlagBits::eTransferDst);
+        assert(dstOffset + size <= m_size);
+
+        PipelineBarrier barrier{m_device};
+        AccessBarrierRange(false, dstOffset, size, vk::AccessFlagBits2KHR::eTransferWrite,
+                           vk::PipelineStageFlagBits2KHR::eTransfer, barrier);
+        barrier.Record(cmdBuffer);
+
+        vk::BufferCopy copyRegion{stagingOffset, dstOffset, size};
+        cmdBuffer.GetHandle().copyBuffer(stagingBuffer, GetHandle(), copyRegion);
+    }
+
     CommandBuffer Buffer::CopyBufferAsync(std::size_t srcOffset, Buffer& dstBuffer, std::size_t dstOffset,
                                           std::size_t size, const Queue& copyQueue,
                                           std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
                                           std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores,
-                                          std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence)
+                                          std::optional<std::reference_wrapper<TimelinePoint>> submitPoint)
     {
         auto transferCmdBuffer = CommandBuffer::beginSingleTimeSubmit(
             m_device, fmt::format("CopyCMDBuffer {}", GetName()),
             fmt::format("Copy {} to {}", GetName(), dstBuffer.GetName()), copyQueue.GetCommandPool());
         CopyBufferAsync(srcOffset, dstBuffer, dstOffset, size, transferCmdBuffer);
-        auto submitFence =
+        auto copyPoint =
             CommandBuffer::endSingleTimeSubmit(copyQueue, transferCmdBuffer, waitSemaphores, signalSemaphores);
-        if (fence.has_value()) { fence = submitFence; }
+        if (submitPoint.has_value()) { submitPoint->get() = copyPoint; }
 
         return transferCmdBuffer;
     }
@@ -113,9 +128,9 @@ namespace vkfw_core::gfx {
     CommandBuffer Buffer::CopyBufferAsync(Buffer& dstBuffer, const Queue& copyQueue,
                                           std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
                                           std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores,
-                                          std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence)
+                                          std::optional<std::reference_wrapper<TimelinePoint>> submitPoint)
     {
-        return CopyBufferAsync(0, dstBuffer, 0, m_size, copyQueue, waitSemaphores, signalSemaphores, fence);
+        return CopyBufferAsync(0, dstBuffer, 0, m_size, copyQueue, waitSemaphores, signalSemaphores, submitPoint);
     }
 
     void Buffer::CopyBufferSync(Buffer& dstBuffer, const Queue& copyQueue)
@@ -0,0 +1,105 @@
+/**
+ * @file   StagingRingBuffer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a persistently mapped ring buffer used for staging uploads.
+ */
+
+#include "gfx/vk/buffers/StagingRingBuffer.h"
+#include "gfx/vk/LogicalDevice.h"
+
+namespace vkfw_core::gfx {
+
+    StagingRingBuffer::StagingRingBuffer(const LogicalDevice* device, std::string_view name, std::size_t size)
+        : VulkanObjectWrapper{device->GetHandle(), name,
+                              device->GetHandle().createBufferUnique(vk::BufferCreateInfo{
+                                  vk::BufferCreateFlags(), size, vk::BufferUsageFlagBits::eTransferSrc})}
+        , m_device{device}
+        , m_size{size}
+        , m_memory{device, fmt::format("RingMemory:{}", name),
+                   vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent}
+    {
+        m_memory.InitializeMemory(m_device->GetHandle().getBufferMemoryRequirements(GetHandle()));
+        m_device->GetHandle().bindBufferMemory(GetHandle(), m_memory.GetMemoryHandle(), m_memory.GetOffset());
+
+        if (m_memory.IsSubAllocated()) {
+            m_mappedMemory = reinterpret_cast<std::uint8_t*>(m_memory.GetMappedPointer()); // NOLINT
+        } else {
+            m_mappedMemory = reinterpret_cast<std::uint8_t*>( // NOLINT
+                m_device->GetHandle().mapMemory(m_memory.GetHandle(), 0, VK_WHOLE_SIZE));
+            m_ownsMapping = true;
+        }
+    }
+
+    StagingRingBuffer::~StagingRingBuffer()
+    {
+        if (m_ownsMapping) { m_device->GetHandle().unmapMemory(m_memory.GetHandle()); }
+    }
+
+    std::optional<StagingRegion> StagingRingBuffer::Stage(std::size_t dataSize, const void* data,
+                                                          std::size_t alignment)
+    {
+        assert(dataSize > 0);
+        const std::scoped_lock lock{m_mutex};
+        RetireReachedRegions();
+
+        auto offset = FindFreeOffset(dataSize, alignment);
+        while (!offset.has_value()) {
+            // only wait for regions already submitted, unsubmitted ones would never be freed.
+            if (m_regions.empty() || !m_regions.front().m_releasePoint) { return {}; }
+            m_regions.front().m_releasePoint->Wait(m_device, defaultFenceTimeout);
+            RetireReachedRegions();
+            offset = FindFreeOffset(dataSize, alignment);
+        }
+
+        memcpy(&m_mappedMemory[*offset], data, dataSize); // NOLINT
+        auto& region = m_regions.emplace_back(Region{m_nextRegionId++, *offset, *offset + dataSize, {}});
+        return StagingRegion{region.m_id, region.m_offset};
+    }
+
+    void StagingRingBuffer::Submit(std::span<const std::uint64_t> regions, const TimelinePoint& releasePoint)
+    {
+        const std::scoped_lock lock{m_mutex};
+        for (auto regionId : regions) {
+            assert(!m_regions.empty() && regionId >= m_regions.front().m_id);
+            auto& region = m_regions[static_cast<std::size_t>(regionId - m_regions.front().m_id)];
+            assert(region.m_id == regionId && !region.m_releasePoint);
+            region.m_releasePoint = releasePoint;
+        }
+    }
+
+    void StagingRingBuffer::Retire()
+    {
+        const std::scoped_lock lock{m_mutex};
+        RetireReachedRegions();
+    }
+
+    std::optional<std::size_t> StagingRingBuffer::FindFreeOffset(std::size_t size, std::size_t alignment) const
+    {
+        auto alignUp = [alignment](std::size_t value) { return alignment * ((value + alignment - 1) / alignment); };
+        if (m_regions.empty()) {
+            if (size <= m_size) { return 0; }
+            return {};
+        }
+
+        const auto tail = m_regions.front().m_offset;
+        const auto head = m_regions.back().m_end;
+        if (head > tail) {
+            // free memory is behind the head and (after wrapping around) in front of the tail.
+            if (auto offset = alignUp(head); offset + size <= m_size) { return offset; }
+            if (size <= tail) { return 0; }
+        } else if (auto offset = alignUp(head); offset + size <= tail) {
+            return offset;
+        }
+        return {};
+    }
+
+    void StagingRingBuffer::RetireReachedRegions()
+    {
+        while (!m_regions.empty() && m_regions.front().m_releasePoint
+               && m_regions.front().m_releasePoint->IsReached(m_device)) {
+            m_regions.pop_front();
+        }
+    }
+}
@@ -36,6 +36,7 @@ namespace vkfw_core::gfx {
         , m_device{ rhs.m_device }
         , m_size{ rhs.m_size },
         m_memoryProperties{ rhs.m_memoryProperties }
+        , m_allocation{std::move(rhs.m_allocation)}
     {
         rhs.m_size = 0;
     }
@@ -47,14 +48,22 @@ namespace vkfw_core::gfx {
         m_device = rhs.m_device;
         m_size = rhs.m_size;
         m_memoryProperties = rhs.m_memoryProperties;
+        m_allocation = std::move(rhs.m_allocation);
         rhs.m_size = 0;
         return *this;
     }
 
     DeviceMemory::~DeviceMemory() = default;
 
-    void DeviceMemory::InitializeMemory(const vk::MemoryRequirements& memRequirements, bool shaderDeviceAddress)
+    void DeviceMemory::InitializeMemory(const vk::MemoryRequirements& memRequirements, bool shaderDeviceAddress,
+                                        RangeAllocationType allocationType)
     {
+        m_size = memRequirements.size;
+        if (auto allocator = m_device->GetMemoryAllocator(); allocator != nullptr) {
+            m_allocation = allocator->Allocate(memRequirements, m_memoryProperties, allocationType, shaderDeviceAddress);
+            return;
+        }
+
         vk::MemoryAllocateInfo allocInfo{ memRequirements.size,
             FindMemoryType(m_device, memRequirements.memoryTypeBits, m_memoryProperties) };
         vk::MemoryAllocateFlagsInfoKHR allocateFlagsInfo{};
@@ -67,19 +76,20 @@ namespace vkfw_core::gfx {
 
     void DeviceMemory::InitializeMemory(const vk::MemoryAllocateInfo& memAllocateInfo)
     {
+        m_size = memAllocateInfo.allocationSize;
         SetHandle(m_device->GetHandle(), m_device->GetHandle().allocateMemoryUnique(memAllocateInfo));
     }
 
     void DeviceMemory::CopyToHostMemory(std::size_t offset, std::size_t size, const void* data) const
     {
-        assert(GetHandle() && "Device memory must be valid.");
+        assert(GetMemoryHandle() && "Device memory must be valid.");
         MapAndProcess(offset, size, [data](void* deviceMem, std::size_t size) { memcpy(deviceMem, data, size); });
     }
 
     void DeviceMemory::CopyToHostMemory(std::size_t offsetToTexture, const glm::u32vec3& offset,
         const vk::SubresourceLayout& layout, const glm::u32vec3& dataSize, const void* data) const
     {
-        assert(GetHandle() && "Device memory must be valid.");
+        assert(GetMemoryHandle() && "Device memory must be valid.");
         auto dataBytes = reinterpret_cast<const std::uint8_t*>(data); // NOLINT
         MapAndProcess(offsetToTexture, offset, layout, dataSize,
                       [dataBytes](void* deviceMem, std::size_t offset, std::size_t size) {
@@ -89,14 +99,14 @@ namespace vkfw_core::gfx {
 
     void DeviceMemory::CopyFromHostMemory(std::size_t offset, std::size_t size, void* data) const
     {
-        assert(GetHandle() && "Device memory must be valid.");
+        assert(GetMemoryHandle() && "Device memory must be valid.");
         MapAndProcess(offset, size, [data](void* deviceMem, std::size_t size) { memcpy(data, deviceMem, size); });
     }
 
     void DeviceMemory::CopyFromHostMemory(std::size_t offsetToTexture, const glm::u32vec3& offset,
         const vk::SubresourceLayout& layout, const glm::u32vec3& dataSize, void* data) const
     {
-        assert(GetHandle() && "Device memory must be valid.");
+        assert(GetMemoryHandle() && "Device memory must be valid.");
         auto dataBytes = reinterpret_cast<std::uint8_t*>(data); // NOLINT
         MapAndProcess(offsetToTexture, offset, layout, dataSize,
                       [dataBytes](void* deviceMem, std::size_t offset, std::size_t size) {
@@ -134,6 +144,11 @@ namespace vkfw_core::gfx {
                                      const function_view<void(void* deviceMem, std::size_t size)>& processFunc) const
     {
         assert(m_memoryProperties & (vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent));
+        if (auto mappedMem = m_allocation.GetMappedPointer(); mappedMem != nullptr) {
+            processFunc(&reinterpret_cast<std::uint8_t*>(mappedMem)[offset], size); // NOLINT
+            return;
+        }
+
         auto deviceMem = m_device->GetHandle().mapMemory(GetHandle(), offset, size, vk::MemoryMapFlags());
         processFunc(deviceMem, size);
         m_device->GetHandle().unmapMemory(GetHandle());
@@ -146,7 +161,10 @@ namespace vkfw_core::gfx {
         assert(m_memoryProperties
                & (vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent));
         auto mapOffset = offset.z * layout.depthPitch + offsetToTexture;
-        auto deviceMem = m_device->GetHandle().mapMemory(GetHandle(), mapOffset + layout.offset, layout.size);
+        auto mappedMem = m_allocation.GetMappedPointer();
+        auto deviceMem = mappedMem != nullptr
+                             ? &reinterpret_cast<std::uint8_t*>(mappedMem)[mapOffset + layout.offset] // NOLINT
+                             : m_device->GetHandle().mapMemory(GetHandle(), mapOffset + layout.offset, layout.size);
         auto deviceBytes = reinterpret_cast<std::uint8_t*>(deviceMem); // NOLINT
 
         if (layout.rowPitch == dataSize.x && layout.depthPitch == dataSize.y
@@ -170,6 +188,6 @@ namespace vkfw_core::gfx {
             }
         }
 
-        m_device->GetHandle().unmapMemory(GetHandle());
+        if (mappedMem == nullptr) { m_device->GetHandle().unmapMemory(GetHandle()); }
     }
 }
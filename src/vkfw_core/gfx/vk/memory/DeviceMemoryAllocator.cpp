@@ -0,0 +1,260 @@
+/**
+ * @file   DeviceMemoryAllocator.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a pooled allocator that sub-allocates device memory blocks per memory type.
+ */
+
+#include "gfx/vk/memory/DeviceMemoryAllocator.h"
+#include "gfx/vk/memory/DeviceMemory.h"
+#include "gfx/vk/LogicalDevice.h"
+
+#include <algorithm>
+
+namespace vkfw_core::gfx {
+
+    /** Heaps up to this size use an eighth of the heap as block size. */
+    constexpr std::size_t SMALL_HEAP_SIZE = 1024ULL * 1024ULL * 1024ULL;
+    /** Blocks are never made smaller than this when device memory runs low. */
+    constexpr std::size_t MIN_BLOCK_SIZE = 1024ULL * 1024ULL;
+
+    struct DeviceMemoryBlock
+    {
+        DeviceMemoryBlock(const LogicalDevice* device, std::string_view name, std::uint32_t memoryType,
+                          const vk::MemoryPropertyFlags& properties, std::size_t size, std::size_t granularity,
+                          bool dedicated, bool shaderDeviceAddress)
+            : m_memoryType{memoryType}
+            , m_dedicated{dedicated}
+            , m_shaderDeviceAddress{shaderDeviceAddress}
+            , m_memory{device, name, properties}
+            , m_allocator{size, granularity}
+        {
+            vk::MemoryAllocateInfo allocInfo{size, memoryType};
+            vk::MemoryAllocateFlagsInfo allocateFlagsInfo{};
+            if (shaderDeviceAddress) {
+                allocateFlagsInfo.flags = vk::MemoryAllocateFlagBits::eDeviceAddress;
+                allocInfo.pNext = &allocateFlagsInfo;
+            }
+            m_memory.InitializeMemory(allocInfo);
+
+            if (properties & vk::MemoryPropertyFlagBits::eHostVisible) {
+                m_mappedMemory = device->GetHandle().mapMemory(m_memory.GetHandle(), 0, VK_WHOLE_SIZE);
+            }
+        }
+
+        /** Holds the memory type index of the block. */
+        std::uint32_t m_memoryType;
+        /** Holds whether the block was created for a single large resource. */
+        bool m_dedicated;
+        /** Holds whether the block was allocated with the device address flag. */
+        bool m_shaderDeviceAddress;
+        /** Holds the Vulkan memory of the block. */
+        DeviceMemory m_memory;
+        /** Manages the ranges inside the block. */
+        RangeAllocator m_allocator;
+        /** Holds the persistently mapped memory for host visible blocks. */
+        void* m_mappedMemory = nullptr;
+    };
+
+    DeviceMemoryAllocation::DeviceMemoryAllocation(DeviceMemoryAllocator* allocator, DeviceMemoryBlock* block,
+                                                   std::size_t offset, std::size_t size)
+        : m_allocator{allocator}, m_block{block}, m_offset{offset}, m_size{size}
+    {
+    }
+
+    DeviceMemoryAllocation::DeviceMemoryAllocation(DeviceMemoryAllocation&& rhs) noexcept
+        : m_allocator{rhs.m_allocator}, m_block{rhs.m_block}, m_offset{rhs.m_offset}, m_size{rhs.m_size}
+    {
+        rhs.m_allocator = nullptr;
+        rhs.m_block = nullptr;
+    }
+
+    DeviceMemoryAllocation& DeviceMemoryAllocation::operator=(DeviceMemoryAllocation&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Free();
+            m_allocator = rhs.m_allocator;
+            m_block = rhs.m_block;
+            m_offset = rhs.m_offset;
+            m_size = rhs.m_size;
+            rhs.m_allocator = nullptr;
+            rhs.m_block = nullptr;
+        }
+        return *this;
+    }
+
+    DeviceMemoryAllocation::~DeviceMemoryAllocation() { Free(); }
+
+    void DeviceMemoryAllocation::Free()
+    {
+        if (m_block != nullptr) { m_allocator->Free(m_block, m_offset); }
+        m_allocator = nullptr;
+        m_block = nullptr;
+        m_offset = 0;
+        m_size = 0;
+    }
+
+    vk::DeviceMemory DeviceMemoryAllocation::GetMemory() const
+    {
+        return m_block != nullptr ? m_block->m_memory.GetHandle() : vk::DeviceMemory{};
+    }
+
+    void* DeviceMemoryAllocation::GetMappedPointer() const
+    {
+        if (m_block == nullptr || m_block->m_mappedMemory == nullptr) { return nullptr; }
+        return &reinterpret_cast<std::uint8_t*>(m_block->m_mappedMemory)[m_offset]; // NOLINT
+    }
+
+    DeviceMemoryAllocator::DeviceMemoryAllocator(const LogicalDevice* device, std::size_t deviceBlockSize,
+                                                 std::size_t hostBlockSize)
+        : m_device{device}
+        , m_memoryProperties{device->GetPhysicalDevice().getMemoryProperties()}
+        , m_bufferImageGranularity{device->GetDeviceProperties().limits.bufferImageGranularity}
+        , m_deviceBlockSize{deviceBlockSize}
+        , m_hostBlockSize{hostBlockSize}
+        , m_pools(GetPoolIndex(VK_MAX_MEMORY_TYPES, false))
+    {
+    }
+
+    DeviceMemoryAllocator::~DeviceMemoryAllocator()
+    {
+        if constexpr (debug_build) {
+            auto stats = GetStatistics();
+            if (stats.m_allocationCount != 0) {
+                spdlog::warn("DeviceMemoryAllocator destroyed with {} allocations ({} bytes) still alive.",
+                             stats.m_allocationCount, stats.m_usedBytes);
+            }
+        }
+    }
+
+    DeviceMemoryAllocation DeviceMemoryAllocator::Allocate(const vk::MemoryRequirements& memRequirements,
+                                                           const vk::MemoryPropertyFlags& properties,
+                                                           RangeAllocationType type, bool shaderDeviceAddress)
+    {
+        const std::scoped_lock lock{m_mutex};
+        auto memoryType = DeviceMemory::FindMemoryType(m_device, memRequirements.memoryTypeBits, properties);
+        auto& pool = m_pools[GetPoolIndex(memoryType, shaderDeviceAddress)];
+        auto blockSize = GetPreferredBlockSize(memoryType);
+
+        if (memRequirements.size > blockSize / 2) {
+            auto block =
+                CreateBlock(memoryType, memRequirements.size, memRequirements.size, true, shaderDeviceAddress);
+            auto offset = block->m_allocator.Allocate(memRequirements.size, memRequirements.alignment, type);
+            assert(offset.has_value() && *offset == 0);
+            return DeviceMemoryAllocation{this, block, *offset, memRequirements.size};
+        }
+
+        for (auto& block : pool.m_blocks) {
+            if (block->m_dedicated) { continue; }
+            if (auto offset = block->m_allocator.Allocate(memRequirements.size, memRequirements.alignment, type);
+                offset.has_value()) {
+                return DeviceMemoryAllocation{this, block.get(), *offset, memRequirements.size};
+            }
+        }
+
+        auto block = CreateBlock(memoryType, blockSize, memRequirements.size, false, shaderDeviceAddress);
+        auto offset = block->m_allocator.Allocate(memRequirements.size, memRequirements.alignment, type);
+        if (!offset.has_value()) {
+            spdlog::critical("Could not sub-allocate {} bytes from a new memory block of size {}.",
+                             memRequirements.size, block->m_allocator.GetSize());
+            throw std::runtime_error("Could not sub-allocate from a new memory block.");
+        }
+        return DeviceMemoryAllocation{this, block, *offset, memRequirements.size};
+    }
+
+    DeviceMemoryStatistics DeviceMemoryAllocator::GetStatistics() const
+    {
+        const std::scoped_lock lock{m_mutex};
+        DeviceMemoryStatistics result;
+        for (const auto& pool : m_pools) {
+            for (const auto& block : pool.m_blocks) { AddStatistics(*block, result); }
+        }
+        return result;
+    }
+
+    DeviceMemoryStatistics DeviceMemoryAllocator::GetStatistics(std::uint32_t memoryType) const
+    {
+        const std::scoped_lock lock{m_mutex};
+        DeviceMemoryStatistics result;
+        for (auto shaderDeviceAddress : {false, true}) {
+            for (const auto& block : m_pools[GetPoolIndex(memoryType, shaderDeviceAddress)].m_blocks) {
+                AddStatistics(*block, result);
+            }
+        }
+        return result;
+    }
+
+    void DeviceMemoryAllocator::LogStatistics() const
+    {
+        for (std::uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i) {
+            auto stats = GetStatistics(i);
+            if (stats.m_blockCount == 0) { continue; }
+            spdlog::info("Memory type {} ({}): {} blocks, {} allocations, {} bytes used, {} bytes free, largest free "
+                         "range {} bytes.",
+                         i, vk::to_string(m_memoryProperties.memoryTypes[i].propertyFlags), stats.m_blockCount,
+                         stats.m_allocationCount, stats.m_usedBytes, stats.m_freeBytes, stats.m_largestFreeRange);
+        }
+    }
+
+    void DeviceMemoryAllocator::Free(DeviceMemoryBlock* block, std::size_t offset)
+    {
+        const std::scoped_lock lock{m_mutex};
+        block->m_allocator.Free(offset);
+        if (!block->m_allocator.IsEmpty()) { return; }
+
+        // keep a single empty block per pool to avoid reallocating on load/unload patterns.
+        auto& pool = m_pools[GetPoolIndex(block->m_memoryType, block->m_shaderDeviceAddress)];
+        auto hasOtherEmptyBlock = std::any_of(pool.m_blocks.begin(), pool.m_blocks.end(), [block](const auto& other) {
+            return other.get() != block && !other->m_dedicated && other->m_allocator.IsEmpty();
+        });
+        if (block->m_dedicated || hasOtherEmptyBlock) {
+            std::erase_if(pool.m_blocks, [block](const auto& poolBlock) { return poolBlock.get() == block; });
+        }
+    }
+
+    std::size_t DeviceMemoryAllocator::GetPreferredBlockSize(std::uint32_t memoryType) const
+    {
+        const auto& memType = m_memoryProperties.memoryTypes[memoryType]; // NOLINT
+        const auto heapSize = static_cast<std::size_t>(m_memoryProperties.memoryHeaps[memType.heapIndex].size); // NOLINT
+        auto blockSize = (memType.propertyFlags & vk::MemoryPropertyFlagBits::eDeviceLocal) ? m_deviceBlockSize
+                                                                                              : m_hostBlockSize;
+        if (heapSize <= SMALL_HEAP_SIZE) { blockSize = std::min(blockSize, heapSize / 8); }
+        return blockSize;
+    }
+
+    DeviceMemoryBlock* DeviceMemoryAllocator::CreateBlock(std::uint32_t memoryType, std::size_t size,
+                                                          std::size_t requiredSize, bool dedicated,
+                                                          bool shaderDeviceAddress)
+    {
+        auto& pool = m_pools[GetPoolIndex(memoryType, shaderDeviceAddress)];
+        const auto& properties = m_memoryProperties.memoryTypes[memoryType].propertyFlags; // NOLINT
+
+        // on out of memory retry with smaller blocks until only the requested size is left.
+        auto blockSize = size;
+        while (true) {
+            try {
+                auto& block = pool.m_blocks.emplace_back(std::make_unique<DeviceMemoryBlock>(
+                    m_device, fmt::format("MemoryPool{}-Block{}", memoryType, pool.m_blocks.size()), memoryType,
+                    properties, blockSize, m_bufferImageGranularity, dedicated, shaderDeviceAddress));
+                return block.get();
+            } catch (const vk::OutOfDeviceMemoryError&) {
+                if (dedicated || blockSize / 2 < std::max(MIN_BLOCK_SIZE, requiredSize)) { throw; }
+                spdlog::warn("Out of device memory allocating a block of {} bytes, retrying with half the size.",
+                             blockSize);
+                blockSize /= 2;
+            }
+        }
+    }
+
+    void DeviceMemoryAllocator::AddStatistics(const DeviceMemoryBlock& block, DeviceMemoryStatistics& stats)
+    {
+        auto blockStats = block.m_allocator.GetStatistics();
+        stats.m_blockCount += 1;
+        stats.m_allocationCount += blockStats.m_allocationCount;
+        stats.m_blockBytes += block.m_allocator.GetSize();
+        stats.m_usedBytes += blockStats.m_usedBytes;
+        stats.m_freeBytes += blockStats.m_freeBytes;
+        stats.m_largestFreeRange = std::max(stats.m_largestFreeRange, blockStats.m_largestFreeRange);
+    }
+}
@@ -88,14 +88,32 @@ namespace vkfw_core::gfx {
         vk::MemoryAllocateInfo allocInfo;
         offsets.resize(buffers.size() + images.size());
         std::size_t offset = 0U;
+        std::size_t alignment = 1U;
         for (auto i = 0U; i < buffers.size(); ++i) {
             offsets[i] = offset;
             offset += FillBufferAllocationInfo(device, buffers[i], allocInfo, shaderDeviceAddress);
+            alignment = std::max(alignment, static_cast<std::size_t>(buffers[i].GetMemoryRequirements().alignment));
         }
         for (auto i = 0U; i < images.size(); ++i) {
             offsets[i + buffers.size()] = offset;
             offset += FillImageAllocationInfo(device, (i == 0 ? nullptr : &images[i - 1]),
                 images[i], offsets[i + buffers.size()], allocInfo);
+            alignment = std::max(alignment, static_cast<std::size_t>(images[i].GetMemoryRequirements().alignment));
+        }
+
+        // the group as a whole is a single range in a pool block, offsets inside the group stay relative.
+        if (device->GetMemoryAllocator() != nullptr) {
+            if (allocInfo.allocationSize == 0) { return; }
+            auto allocationType = GetGroupAllocationType(buffers.empty(), images);
+            // the offsets inside the group are padded to the granularity relative to the start of the group.
+            if (allocationType == RangeAllocationType::Unknown) {
+                alignment = std::max(alignment, static_cast<std::size_t>(
+                                                    device->GetDeviceProperties().limits.bufferImageGranularity));
+            }
+            vk::MemoryRequirements groupRequirements{allocInfo.allocationSize, alignment,
+                                                     1U << allocInfo.memoryTypeIndex};
+            memory.InitializeMemory(groupRequirements, shaderDeviceAddress, allocationType);
+            return;
         }
 
         vk::MemoryAllocateFlagsInfo allocateFlagsInfo{};
@@ -110,11 +128,26 @@ namespace vkfw_core::gfx {
         std::vector<B>& buffers, std::vector<T>& images, DeviceMemory & memory)
     {
         for (auto i = 0U; i < buffers.size(); ++i) {
-            buffers[i].BindMemory(memory.GetHandle(), offsets[i]);
+            buffers[i].BindMemory(memory.GetMemoryHandle(), memory.GetOffset() + offsets[i]);
         }
         for (auto i = 0U; i < images.size(); ++i) {
-            images[i].BindMemory(memory.GetHandle(), offsets[i + buffers.size()]);
+            images[i].BindMemory(memory.GetMemoryHandle(), memory.GetOffset() + offsets[i + buffers.size()]);
+        }
+    }
+
+    template<class T>
+    RangeAllocationType DeviceMemoryGroup::GetGroupAllocationType(bool noBuffers, const std::vector<T>& images)
+    {
+        auto result = noBuffers ? RangeAllocationType::Free : RangeAllocationType::Linear;
+        for (const auto& image : images) {
+            auto imageType = image.GetAllocationType();
+            if (result == RangeAllocationType::Free) {
+                result = imageType;
+            } else if (result != imageType) {
+                return RangeAllocationType::Unknown;
+            }
         }
+        return result;
     }
 
     void DeviceMemoryGroup::InitializeDeviceMemory(const LogicalDevice* device, std::vector<std::size_t>& deviceOffsets,
@@ -98,10 +98,18 @@ namespace vkfw_core::gfx {
     {
         auto idx = DeviceMemoryGroup::AddTextureToGroup(name, desc, initialLayout, size, mipLevels, queueFamilyIndices);
 
+        // linear images do not support block compressed formats, their levels are all staged when transferring.
+        if (Texture::IsBlockCompressed(desc.m_format)) {
+            m_hostImageIndices.push_back(INVALID_INDEX);
+            return idx;
+        }
+
+        m_hostImageIndices.push_back(static_cast<unsigned int>(m_hostImages.size()));
         TextureDescriptor stagingTexDesc{desc, vk::ImageUsageFlagBits::eTransferSrc};
         stagingTexDesc.m_imageTiling = vk::ImageTiling::eLinear;
         m_hostImages.emplace_back(GetDevice(), fmt::format("Host:{}", name), stagingTexDesc, initialLayout, queueFamilyIndices);
-        m_hostImages.back().InitializeImage(size, mipLevels, false);
+        // linear images usually support only a single MIP level, the others are staged when transferring the data.
+        m_hostImages.back().InitializeImage(size, 1, false);
 
         return idx;
     }
@@ -140,6 +148,11 @@ namespace vkfw_core::gfx {
         m_imageContents.push_back(imgContDesc);
     }
 
+    void MemoryGroup::AddMipmapGenerationToTextureInGroup(unsigned int textureIdx)
+    {
+        m_mipmapImages.push_back(textureIdx);
+    }
+
     void MemoryGroup::FinalizeDeviceGroup()
     {
         // check if all buffers are initialized first.
@@ -173,30 +186,41 @@ namespace vkfw_core::gfx {
             if (contentDesc.m_deleter) { contentDesc.m_deleter( std::get<void*>(contentDesc.m_data)); }
         }
         for (const auto& contentDesc : m_imageContents) {
-            vk::ImageSubresource imgSubresource{ contentDesc.m_aspectFlags, contentDesc.m_mipLevel, contentDesc.m_arrayLayer };
-            auto subresourceLayout = m_hostImages[contentDesc.m_imageIdx].GetSubresourceLayout(imgSubresource);
-            m_hostMemory.CopyToHostMemory(m_hostOffsets[contentDesc.m_imageIdx + m_hostBuffers.size()], glm::u32vec3(0),
-                                         subresourceLayout, contentDesc.m_size,
-                                         contentDesc.m_deleter ? std::get<void*>(contentDesc.m_data)
-                                                              : std::get<const void*>(contentDesc.m_data));
+            const void* data = contentDesc.m_deleter ? std::get<void*>(contentDesc.m_data)
+                                                     : std::get<const void*>(contentDesc.m_data);
+            auto hostImage = GetHostTexture(contentDesc.m_imageIdx);
+            if (hostImage != nullptr && contentDesc.m_mipLevel < hostImage->GetMipLevels()) {
+                vk::ImageSubresource imgSubresource{ contentDesc.m_aspectFlags, contentDesc.m_mipLevel, contentDesc.m_arrayLayer };
+                auto subresourceLayout = hostImage->GetSubresourceLayout(imgSubresource);
+                m_hostMemory.CopyToHostMemory(GetHostTextureOffset(contentDesc.m_imageIdx), glm::u32vec3(0),
+                                              subresourceLayout, contentDesc.m_size, data);
+            } else {
+                transfer.TransferDataToTexture(contentDesc.m_size, data, *GetTexture(contentDesc.m_imageIdx),
+                                               contentDesc.m_mipLevel, contentDesc.m_arrayLayer);
+            }
             if (contentDesc.m_deleter) { contentDesc.m_deleter(std::get<void*>(contentDesc.m_data)); }
         }
 
         for (auto i = 0U; i < m_hostBuffers.size(); ++i) {
             transfer.AddTransferToQueue(m_hostBuffers[i], *GetBuffer(i));
         }
-        for (auto i = 0U; i < m_hostImages.size(); ++i) {
-            transfer.AddTransferToQueue(m_hostImages[i], *GetTexture(i));
+        for (auto i = 0U; i < m_hostImageIndices.size(); ++i) {
+            if (auto hostImage = GetHostTexture(i); hostImage != nullptr) {
+                transfer.AddTransferToQueue(*hostImage, *GetTexture(i));
+            }
         }
+        for (auto textureIdx : m_mipmapImages) { transfer.GenerateMipmaps(*GetTexture(textureIdx)); }
 
         m_bufferContents.clear();
         m_imageContents.clear();
+        m_mipmapImages.clear();
     }
 
     void MemoryGroup::RemoveHostMemory()
     {
         m_hostBuffers.clear();
         m_hostImages.clear();
+        std::fill(m_hostImageIndices.begin(), m_hostImageIndices.end(), INVALID_INDEX);
         m_hostMemory.~DeviceMemory();
         m_hostOffsets.clear();
     }
@@ -0,0 +1,183 @@
+/**
+ * @file   RangeAllocator.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a best-fit free-list allocator for ranges inside a memory block.
+ */
+
+#include "gfx/vk/memory/RangeAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace vkfw_core::gfx {
+
+    RangeAllocator::RangeAllocator(std::size_t size, std::size_t bufferImageGranularity)
+        : m_size{size}, m_granularity{bufferImageGranularity == 0 ? 1 : bufferImageGranularity}
+    {
+        assert(m_size > 0);
+        assert((m_granularity & (m_granularity - 1)) == 0 && "bufferImageGranularity needs to be a power of two.");
+        AddFreeRange(0, m_size);
+    }
+
+    std::optional<std::size_t> RangeAllocator::Allocate(std::size_t size, std::size_t alignment,
+                                                        RangeAllocationType type)
+    {
+        assert(size > 0);
+        assert(type != RangeAllocationType::Free);
+        if (alignment == 0) { alignment = 1; }
+
+        for (auto it = m_freeRangesBySize.lower_bound(size); it != m_freeRangesBySize.end(); ++it) {
+            auto rangeIt = m_ranges.find(it->second);
+            assert(rangeIt != m_ranges.end());
+            auto placement = FindPlacement(rangeIt, size, alignment, type);
+            if (!placement.has_value()) { continue; }
+
+            auto rangeOffset = rangeIt->first;
+            auto rangeEnd = rangeOffset + rangeIt->second.m_size;
+            m_freeRangesBySize.erase(it);
+            m_ranges.erase(rangeIt);
+
+            if (*placement > rangeOffset) { AddFreeRange(rangeOffset, *placement - rangeOffset); }
+            m_ranges.emplace(*placement, Range{size, type});
+            if (*placement + size < rangeEnd) { AddFreeRange(*placement + size, rangeEnd - *placement - size); }
+
+            m_usedBytes += size;
+            return placement;
+        }
+        return {};
+    }
+
+    void RangeAllocator::Free(std::size_t offset)
+    {
+        auto it = m_ranges.find(offset);
+        if (it == m_ranges.end() || it->second.m_type == RangeAllocationType::Free) {
+            assert(false && "Range to free was not allocated.");
+            return;
+        }
+
+        m_usedBytes -= it->second.m_size;
+        auto freeOffset = it->first;
+        auto freeSize = it->second.m_size;
+
+        if (auto next = std::next(it); next != m_ranges.end() && next->second.m_type == RangeAllocationType::Free) {
+            freeSize += next->second.m_size;
+            RemoveFreeRangeIndex(next->first, next->second.m_size);
+            m_ranges.erase(next);
+        }
+        if (it != m_ranges.begin()) {
+            if (auto prev = std::prev(it); prev->second.m_type == RangeAllocationType::Free) {
+                freeOffset = prev->first;
+                freeSize += prev->second.m_size;
+                RemoveFreeRangeIndex(prev->first, prev->second.m_size);
+                m_ranges.erase(prev);
+            }
+        }
+        m_ranges.erase(it);
+        AddFreeRange(freeOffset, freeSize);
+    }
+
+    std::size_t RangeAllocator::GetLargestFreeRange() const
+    {
+        return m_freeRangesBySize.empty() ? 0 : m_freeRangesBySize.rbegin()->first;
+    }
+
+    RangeAllocatorStatistics RangeAllocator::GetStatistics() const
+    {
+        RangeAllocatorStatistics result;
+        result.m_allocationCount = m_ranges.size() - m_freeRangesBySize.size();
+        result.m_freeRangeCount = m_freeRangesBySize.size();
+        result.m_usedBytes = m_usedBytes;
+        result.m_freeBytes = m_size - m_usedBytes;
+        result.m_largestFreeRange = GetLargestFreeRange();
+        return result;
+    }
+
+    bool RangeAllocator::CheckConsistency() const
+    {
+        std::size_t expectedOffset = 0;
+        std::size_t usedBytes = 0;
+        std::size_t freeRanges = 0;
+        bool previousFree = false;
+        for (const auto& [offset, range] : m_ranges) {
+            if (offset != expectedOffset || range.m_size == 0) { return false; }
+            const bool isFree = range.m_type == RangeAllocationType::Free;
+            if (isFree) {
+                if (previousFree) { return false; }
+                auto [first, last] = m_freeRangesBySize.equal_range(range.m_size);
+                bool indexed = false;
+                for (auto it = first; it != last; ++it) { indexed = indexed || it->second == offset; }
+                if (!indexed) { return false; }
+                freeRanges += 1;
+            } else {
+                usedBytes += range.m_size;
+            }
+            previousFree = isFree;
+            expectedOffset = offset + range.m_size;
+        }
+        return expectedOffset == m_size && usedBytes == m_usedBytes && freeRanges == m_freeRangesBySize.size();
+    }
+
+    std::optional<std::size_t> RangeAllocator::FindPlacement(RangeMap::const_iterator freeRange, std::size_t size,
+                                                             std::size_t alignment, RangeAllocationType type) const
+    {
+        const auto rangeOffset = freeRange->first;
+        const auto rangeEnd = rangeOffset + freeRange->second.m_size;
+        // ranges holding linear and optimal resources pad them relative to their start, so it needs to be on a page.
+        if (type == RangeAllocationType::Unknown) { alignment = std::max(alignment, m_granularity); }
+        auto offset = AlignUp(rangeOffset, alignment);
+
+        if (m_granularity > 1) {
+            for (auto it = std::make_reverse_iterator(freeRange); it != m_ranges.rend(); ++it) {
+                if (!OnSamePage(it->first + it->second.m_size, offset)) { break; }
+                if (HasGranularityConflict(it->second.m_type, type)) {
+                    offset = AlignUp(offset, m_granularity);
+                    break;
+                }
+            }
+        }
+
+        if (offset + size > rangeEnd) { return {}; }
+
+        if (m_granularity > 1) {
+            for (auto it = std::next(freeRange); it != m_ranges.end(); ++it) {
+                if (!OnSamePage(offset + size, it->first)) { break; }
+                if (HasGranularityConflict(type, it->second.m_type)) { return {}; }
+            }
+        }
+        return offset;
+    }
+
+    bool RangeAllocator::OnSamePage(std::size_t firstEnd, std::size_t secondStart) const
+    {
+        const auto pageMask = ~(m_granularity - 1);
+        return ((firstEnd - 1) & pageMask) == (secondStart & pageMask);
+    }
+
+    bool RangeAllocator::HasGranularityConflict(RangeAllocationType first, RangeAllocationType second)
+    {
+        if (first == RangeAllocationType::Free || second == RangeAllocationType::Free) { return false; }
+        if (first == RangeAllocationType::Unknown || second == RangeAllocationType::Unknown) { return true; }
+        return first != second;
+    }
+
+    void RangeAllocator::AddFreeRange(std::size_t offset, std::size_t size)
+    {
+        m_ranges.emplace(offset, Range{size, RangeAllocationType::Free});
+        m_freeRangesBySize.emplace(size, offset);
+    }
+
+    void RangeAllocator::RemoveFreeRangeIndex(std::size_t offset, std::size_t size)
+    {
+        auto [first, last] = m_freeRangesBySize.equal_range(size);
+        for (auto it = first; it != last; ++it) {
+            if (it->second == offset) {
+                m_freeRangesBySize.erase(it);
+                return;
+            }
+        }
+        assert(false && "Free range was not indexed.");
+    }
+}
@@ -8,16 +8,140 @@
 
 #include "gfx/vk/pipeline/ComputePipeline.h"
 #include "gfx/vk/LogicalDevice.h"
-#include "core/resources/ShaderManager.h"
+#include "gfx/vk/Shader.h"
+#include "gfx/vk/buffers/Buffer.h"
+#include "gfx/vk/pipeline/PipelineCache.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+#include "gfx/vk/wrappers/PipelineLayout.h"
+#include "core/resources/HotReloader.h"
 
 namespace vkfw_core::gfx {
 
-    ComputePipeline::ComputePipeline(const std::string& shaderStageId, gfx::LogicalDevice* device) :
-        Resource(shaderStageId, device)
+    ComputePipeline::ComputePipeline(const LogicalDevice* device, std::string_view name,
+                                     std::shared_ptr<Shader> shader)
+        : VulkanObjectWrapper{device->GetHandle(), name, vk::UniquePipeline{}}
+        , m_device{device}
+        , m_barrier{device}
     {
-        throw std::runtime_error("NOT YET IMPLEMENTED!");
+        ResetShader(std::move(shader));
     }
 
+    ComputePipeline::ComputePipeline(ComputePipeline&& rhs) noexcept
+        : VulkanObjectWrapper{std::move(rhs)}
+        , m_device{rhs.m_device}
+        , m_shader{std::move(rhs.m_shader)}
+        , m_shaderStage{rhs.m_shaderStage}
+        , m_pipelineLayout{rhs.m_pipelineLayout}
+        , m_shaderGeneration{rhs.m_shaderGeneration}
+        , m_specializations{std::move(rhs.m_specializations)}
+        , m_localSize{rhs.m_localSize}
+        , m_barrier{std::move(rhs.m_barrier)}
+    {
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->ReplacePipeline(&rhs, this); }
+    }
+
+    ComputePipeline& ComputePipeline::operator=(ComputePipeline&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            // this is unregistered before rhs is replaced, so the hot reloader never holds the pointer twice.
+            if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->UnregisterPipeline(this); }
+            VulkanObjectWrapper::operator=(std::move(rhs));
+            m_device = rhs.m_device;
+            m_shader = std::move(rhs.m_shader);
+            m_shaderStage = rhs.m_shaderStage;
+            m_pipelineLayout = rhs.m_pipelineLayout;
+            m_shaderGeneration = rhs.m_shaderGeneration;
+            m_specializations = std::move(rhs.m_specializations);
+            m_localSize = rhs.m_localSize;
+            m_barrier = std::move(rhs.m_barrier);
+            if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->ReplacePipeline(&rhs, this); }
+        }
+        return *this;
+    }
+
+    ComputePipeline::~ComputePipeline()
+    {
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->UnregisterPipeline(this); }
+    }
+
+    void ComputePipeline::ResetShader(std::shared_ptr<Shader> shader)
+    {
+        if (Shader::GetShaderStage(shader->GetSourceFilename()) != vk::ShaderStageFlagBits::eCompute) {
+            spdlog::error("Compute pipeline {} needs a compute shader ({}).", GetName(), shader->GetSourceFilename());
+            throw std::runtime_error("Compute pipeline needs a compute shader.");
+        }
+        m_shader = std::move(shader);
+        m_shader->FillShaderStageInfo(m_shaderStage);
+    }
+
+    void ComputePipeline::CreatePipeline(const PipelineLayout& pipelineLayout)
+    {
+        m_pipelineLayout = pipelineLayout.GetHandle();
+        SetHandle(m_device->GetHandle(), CreatePipelineHandle());
+
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->RegisterPipeline(this); }
+    }
+
+    bool ComputePipeline::IsOutdated() const { return m_shader->GetGeneration() != m_shaderGeneration; }
+
+    void ComputePipeline::Rebuild()
+    {
+        // the shader stage needs the new shader module.
+        m_shader->FillShaderStageInfo(m_shaderStage);
+        auto oldPipeline = ExchangeHandle(m_device->GetHandle(), CreatePipelineHandle());
+        m_device->GetResourceReleaser().AddResourceAfterSubmittedWork(
+            std::make_shared<SharedReleaseableResource<vk::UniquePipeline>>(
+                std::make_shared<vk::UniquePipeline>(std::move(oldPipeline))));
+    }
+
+    const ShaderReflection& ComputePipeline::GetReflection() const { return m_shader->GetReflection(); }
 
-    ComputePipeline::~ComputePipeline() = default;
+    void ComputePipeline::BindPipeline(CommandBuffer& cmdBuffer)
+    {
+        m_barrier.Record(cmdBuffer);
+        cmdBuffer.GetHandle().bindPipeline(vk::PipelineBindPoint::eCompute, GetHandle());
+    }
+
+    glm::uvec3 ComputePipeline::GetGroupCount(const glm::uvec3& numInvocations) const
+    {
+        return GetGroupCount(numInvocations, m_localSize);
+    }
+
+    glm::uvec3 ComputePipeline::GetGroupCount(const glm::uvec3& numInvocations, const glm::uvec3& localSize)
+    {
+        return (numInvocations + localSize - glm::uvec3{1}) / localSize;
+    }
+
+    void ComputePipeline::Dispatch(CommandBuffer& cmdBuffer, const glm::uvec3& numInvocations) const
+    {
+        const auto groupCount = GetGroupCount(numInvocations);
+        cmdBuffer.GetHandle().dispatch(groupCount.x, groupCount.y, groupCount.z);
+    }
+
+    void ComputePipeline::DispatchIndirect(CommandBuffer& cmdBuffer, Buffer& buffer, std::size_t offset) const
+    {
+        PipelineBarrier barrier{m_device};
+        auto vkBuffer = buffer.GetBuffer(false, vk::AccessFlagBits2KHR::eIndirectCommandRead,
+                                         vk::PipelineStageFlagBits2KHR::eDrawIndirect, barrier);
+        barrier.Record(cmdBuffer);
+        cmdBuffer.GetHandle().dispatchIndirect(vkBuffer, offset);
+    }
+
+    vk::UniquePipeline ComputePipeline::CreatePipelineHandle()
+    {
+        // a failed rebuild is not tried again until the shader changes again.
+        m_shaderGeneration = m_shader->GetGeneration();
+
+        m_specializations.Reset(1);
+        m_specializations.Apply(0, m_shaderStage, m_shader->GetSpecializationConstants(), m_shader->GetReflection());
+        const auto localSize = m_shader->GetReflection().GetLocalSize(m_specializations.GetStageConstants(0));
+
+        vk::ComputePipelineCreateInfo pipelineInfo{vk::PipelineCreateFlags{}, m_shaderStage, m_pipelineLayout};
+        auto pipeline = m_device->GetPipelineCache().CreatePipeline(
+            GetName(), pipelineInfo, [this](vk::PipelineCache cache, const auto& info) {
+                return m_device->GetHandle().createComputePipelineUnique(cache, info);
+            });
+        m_localSize = glm::uvec3{localSize[0], localSize[1], localSize[2]};
+        return pipeline;
+    }
 }
@@ -8,6 +8,7 @@
 
 #include "gfx/vk/pipeline/DescriptorSetLayout.h"
 #include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/pipeline/ShaderReflection.h"
 
 namespace vkfw_core::gfx {
 
@@ -28,6 +29,13 @@ namespace vkfw_core::gfx {
         m_bindings.emplace_back(binding, type, count, stageFlags, sampler);
     }
 
+    void DescriptorSetLayout::AddBindings(const ShaderReflection& reflection, std::uint32_t set,
+                                          std::uint32_t runtimeArrayCount)
+    {
+        auto bindings = reflection.GetLayoutBindings(set, runtimeArrayCount);
+        m_bindings.insert(m_bindings.end(), bindings.begin(), bindings.end());
+    }
+
     vk::DescriptorSetLayout DescriptorSetLayout::CreateDescriptorLayout(const LogicalDevice* device)
     {
         vk::DescriptorSetLayoutCreateInfo layoutInfo{vk::DescriptorSetLayoutCreateFlags{},
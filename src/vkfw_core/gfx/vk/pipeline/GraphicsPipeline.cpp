@@ -8,7 +8,10 @@
 
 #include "gfx/vk/pipeline/GraphicsPipeline.h"
 #include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/pipeline/PipelineCache.h"
+#include "gfx/vk/pipeline/ShaderReflection.h"
 #include "core/resources/ShaderManager.h"
+#include "core/resources/HotReloader.h"
 
 namespace vkfw_core::gfx {
 
@@ -87,22 +90,38 @@ namespace vkfw_core::gfx {
         , m_device{ rhs.m_device }
         , m_shaders{ std::move(rhs.m_shaders) }
         , m_state{ std::move(rhs.m_state) }
+        , m_renderPass{rhs.m_renderPass}
+        , m_subpass{rhs.m_subpass}
+        , m_pipelineLayout{rhs.m_pipelineLayout}
+        , m_shaderGenerations{std::move(rhs.m_shaderGenerations)}
+        , m_specializations{std::move(rhs.m_specializations)}
     {
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->ReplacePipeline(&rhs, this); }
     }
 
     GraphicsPipeline& GraphicsPipeline::operator=(GraphicsPipeline&& rhs) noexcept
     {
         if (this != &rhs) {
-            this->~GraphicsPipeline();
+            // this is unregistered before rhs is replaced, so the hot reloader never holds the pointer twice.
+            if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->UnregisterPipeline(this); }
             VulkanObjectWrapper::operator=(std::move(rhs));
             m_device = rhs.m_device;
             m_shaders = std::move(rhs.m_shaders);
             m_state = std::move(rhs.m_state);
+            m_renderPass = rhs.m_renderPass;
+            m_subpass = rhs.m_subpass;
+            m_pipelineLayout = rhs.m_pipelineLayout;
+            m_shaderGenerations = std::move(rhs.m_shaderGenerations);
+            m_specializations = std::move(rhs.m_specializations);
+            if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->ReplacePipeline(&rhs, this); }
         }
         return *this;
     }
 
-    GraphicsPipeline::~GraphicsPipeline() = default;
+    GraphicsPipeline::~GraphicsPipeline()
+    {
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->UnregisterPipeline(this); }
+    }
 
     void GraphicsPipeline::ResetShaders(std::vector<std::shared_ptr<Shader>>&& shaders)
     {
@@ -128,8 +147,68 @@ namespace vkfw_core::gfx {
     }
 
     void GraphicsPipeline::CreatePipeline(bool keepState, const RenderPass& renderPass, unsigned int subpass, const PipelineLayout& pipelineLayout)
+    {
+        m_renderPass = renderPass.GetHandle();
+        m_subpass = subpass;
+        m_pipelineLayout = pipelineLayout.GetHandle();
+        SetHandle(m_device->GetHandle(), CreatePipelineHandle());
+
+        if (auto* hotReloader = m_device->GetHotReloader()) {
+            hotReloader->RegisterPipeline(this);
+        } else if (!keepState) {
+            m_state.reset();
+        }
+    }
+
+    bool GraphicsPipeline::IsOutdated() const
+    {
+        // the shaders may have been reset since the pipeline was created.
+        if (m_shaders.size() != m_shaderGenerations.size()) { return true; }
+        for (std::size_t i = 0; i < m_shaders.size(); ++i) {
+            if (m_shaders[i]->GetGeneration() != m_shaderGenerations[i]) { return true; }
+        }
+        return false;
+    }
+
+    void GraphicsPipeline::Rebuild()
+    {
+        // the shader stages need the new shader modules.
+        ResetShaders(std::vector<std::shared_ptr<Shader>>{m_shaders});
+        auto oldPipeline = ExchangeHandle(m_device->GetHandle(), CreatePipelineHandle());
+        m_device->GetResourceReleaser().AddResourceAfterSubmittedWork(
+            std::make_shared<SharedReleaseableResource<vk::UniquePipeline>>(
+                std::make_shared<vk::UniquePipeline>(std::move(oldPipeline))));
+    }
+
+    ShaderReflection GraphicsPipeline::GetReflection() const
+    {
+        ShaderReflection reflection;
+        for (const auto& shader : m_shaders) { reflection.Merge(shader->GetReflection()); }
+        return reflection;
+    }
+
+    vk::UniquePipeline GraphicsPipeline::CreatePipelineHandle()
     {
         assert(m_state);
+        // a failed rebuild is not tried again until a shader changes again.
+        m_shaderGenerations.clear();
+        for (const auto& shader : m_shaders) { m_shaderGenerations.push_back(shader->GetGeneration()); }
+
+        m_specializations.Reset(m_shaders.size());
+        for (std::size_t i = 0; i < m_shaders.size(); ++i) {
+            m_specializations.Apply(i, m_state->m_shaderStageInfos[i], m_shaders[i]->GetSpecializationConstants(),
+                                    m_shaders[i]->GetReflection());
+        }
+
+        const auto& vertexInput = m_state->m_vertexInputCreateInfo;
+        const std::span attributes{vertexInput.pVertexAttributeDescriptions,
+                                   vertexInput.vertexAttributeDescriptionCount};
+        for (const auto& shader : m_shaders) {
+            for (const auto& error : shader->GetReflection().ValidateVertexInput(attributes)) {
+                spdlog::warn("Pipeline {}: {}", GetName(), error);
+            }
+        }
+
         vk::PipelineDynamicStateCreateInfo dynamicState{vk::PipelineDynamicStateCreateFlags(),
                                                         static_cast<std::uint32_t>(m_state->m_dynamicStates.size()),
                                                         m_state->m_dynamicStates.data()};
@@ -140,12 +219,12 @@ namespace vkfw_core::gfx {
                                                     m_state->m_shaderStageInfos.data(),
             &m_state->m_vertexInputCreateInfo, &m_state->m_inputAssemblyCreateInfo, &m_state->m_tesselation,
             &m_state->m_viewportState, &m_state->m_rasterizer, &m_state->m_multisampling, &m_state->m_depthStencil,
-            &m_state->m_colorBlending, &dynamicState, pipelineLayout.GetHandle(), renderPass.GetHandle(), subpass };
-
-        SetHandle(m_device->GetHandle(),
-                  m_device->GetHandle().createGraphicsPipelineUnique(vk::PipelineCache(), pipelineInfo));
+            &m_state->m_colorBlending, &dynamicState, m_pipelineLayout, m_renderPass, m_subpass };
 
-        if (!keepState) { m_state.reset(); }
+        return m_device->GetPipelineCache().CreatePipeline(
+            GetName(), pipelineInfo, [this](vk::PipelineCache cache, const auto& info) {
+                return m_device->GetHandle().createGraphicsPipelineUnique(cache, info);
+            });
     }
 
     void GraphicsPipeline::ResetVertexInput() const
@@ -0,0 +1,112 @@
+/**
+ * @file   PipelineCache.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.15
+ *
+ * @brief  Implementation of a pipeline cache that is persisted on disk between runs.
+ */
+
+#include "gfx/vk/pipeline/PipelineCache.h"
+#include "gfx/vk/LogicalDevice.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace vkfw_core::gfx {
+
+    PipelineCache::PipelineCache(const LogicalDevice* device, std::string_view name, std::filesystem::path cacheFile,
+                                 bool useCreationFeedback)
+        : VulkanObjectWrapper{device->GetHandle(), name, vk::UniquePipelineCache{}}
+        , m_device{device}
+        , m_cacheFile{std::move(cacheFile)}
+        , m_useCreationFeedback{useCreationFeedback}
+    {
+        auto cacheData = LoadCacheData();
+        vk::PipelineCacheCreateInfo cacheInfo{vk::PipelineCacheCreateFlags{}, cacheData.size(), cacheData.data()};
+        SetHandle(m_device->GetHandle(), m_device->GetHandle().createPipelineCacheUnique(cacheInfo));
+    }
+
+    PipelineCache::~PipelineCache()
+    {
+        try {
+            Save();
+        } catch (const std::exception& e) {
+            spdlog::error("Could not save pipeline cache to '{}': {}", m_cacheFile.string(), e.what());
+        }
+    }
+
+    void PipelineCache::Save() const
+    {
+        auto cacheData = m_device->GetHandle().getPipelineCacheData(GetHandle());
+        if (cacheData.empty()) { return; }
+
+        if (m_cacheFile.has_parent_path()) { std::filesystem::create_directories(m_cacheFile.parent_path()); }
+        // other instances may load the cache at the same time, so it is replaced instead of written in place.
+        auto tmpFile = m_cacheFile;
+        tmpFile += ".tmp";
+        std::error_code ec;
+        {
+            std::ofstream cacheFile{tmpFile, std::ios::binary | std::ios::trunc};
+            cacheFile.write(reinterpret_cast<const char*>(cacheData.data()), // NOLINT
+                            static_cast<std::streamsize>(cacheData.size()));
+            if (!cacheFile) { ec = std::make_error_code(std::errc::io_error); }
+        }
+        if (!ec) { std::filesystem::rename(tmpFile, m_cacheFile, ec); }
+        if (ec) {
+            spdlog::warn("Could not write pipeline cache file '{}': {}", m_cacheFile.string(), ec.message());
+            std::filesystem::remove(tmpFile, ec);
+            return;
+        }
+        spdlog::info("Saved pipeline cache ({} bytes) to '{}'.", cacheData.size(), m_cacheFile.string());
+    }
+
+    std::vector<std::uint8_t> PipelineCache::LoadCacheData() const
+    {
+        std::ifstream cacheFile{m_cacheFile, std::ios::binary | std::ios::ate};
+        if (!cacheFile) {
+            spdlog::info("No pipeline cache found at '{}', starting with an empty cache.", m_cacheFile.string());
+            return {};
+        }
+
+        std::vector<std::uint8_t> cacheData(static_cast<std::size_t>(cacheFile.tellg()));
+        cacheFile.seekg(0);
+        cacheFile.read(reinterpret_cast<char*>(cacheData.data()), // NOLINT
+                       static_cast<std::streamsize>(cacheData.size()));
+
+        // header layout is VkPipelineCacheHeaderVersionOne: size, version, vendor id, device id, uuid.
+        constexpr std::size_t headerSize = 4 * sizeof(std::uint32_t) + VK_UUID_SIZE;
+        std::array<std::uint32_t, 4> header = {};
+        if (cacheData.size() < headerSize) {
+            spdlog::warn("Pipeline cache '{}' is truncated, dropping it.", m_cacheFile.string());
+            return {};
+        }
+        memcpy(header.data(), cacheData.data(), sizeof(header));
+
+        const auto& properties = m_device->GetDeviceProperties();
+        const auto* cacheUUID = &cacheData[4 * sizeof(std::uint32_t)];
+        if (header[0] < headerSize || header[1] != static_cast<std::uint32_t>(vk::PipelineCacheHeaderVersion::eOne)
+            || header[2] != properties.vendorID || header[3] != properties.deviceID
+            || !std::equal(properties.pipelineCacheUUID.begin(), properties.pipelineCacheUUID.end(), cacheUUID)) {
+            spdlog::warn("Pipeline cache '{}' was created for a different device or driver, dropping it.",
+                         m_cacheFile.string());
+            return {};
+        }
+
+        spdlog::info("Loaded pipeline cache ({} bytes) from '{}'.", cacheData.size(), m_cacheFile.string());
+        return cacheData;
+    }
+
+    void PipelineCache::LogPipelineCreation(std::string_view pipelineName,
+                                            std::chrono::duration<double, std::milli> duration,
+                                            const vk::PipelineCreationFeedbackEXT& feedback) const
+    {
+        if (!m_useCreationFeedback || !(feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eValid)) {
+            spdlog::debug("Created pipeline '{}' in {:.3f}ms (cache hit unknown).", pipelineName, duration.count());
+            return;
+        }
+        const bool cacheHit =
+            static_cast<bool>(feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eApplicationPipelineCacheHit);
+        spdlog::debug("Created pipeline '{}' in {:.3f}ms (cache {}).", pipelineName, duration.count(),
+                     cacheHit ? "hit" : "miss");
+    }
+}
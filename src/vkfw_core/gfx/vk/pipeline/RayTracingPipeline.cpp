@@ -8,9 +8,12 @@
 
 #include "gfx/vk/pipeline/RayTracingPipeline.h"
 #include "gfx/vk/LogicalDevice.h"
+#include "gfx/vk/pipeline/PipelineCache.h"
+#include "gfx/vk/pipeline/ShaderReflection.h"
 #include "gfx/vk/buffers/HostBuffer.h"
 #include "gfx/vk/Shader.h"
 #include "gfx/vk/wrappers/PipelineLayout.h"
+#include "core/resources/HotReloader.h"
 
 namespace vkfw_core::gfx {
 
@@ -38,25 +41,80 @@ namespace vkfw_core::gfx {
         ResetShaders(std::move(shaders));
     }
 
-    RayTracingPipeline::~RayTracingPipeline() = default;
+    RayTracingPipeline::~RayTracingPipeline()
+    {
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->UnregisterPipeline(this); }
+    }
 
     void RayTracingPipeline::CreatePipeline(std::uint32_t maxRecursionDepth, const PipelineLayout& pipelineLayout)
     {
+        m_maxRecursionDepth = maxRecursionDepth;
+        m_pipelineLayout = pipelineLayout.GetHandle();
+        SetHandle(m_device->GetHandle(), CreatePipelineHandle());
+        InitializeShaderBindingTable();
+
+        if (auto* hotReloader = m_device->GetHotReloader()) { hotReloader->RegisterPipeline(this); }
+    }
+
+    bool RayTracingPipeline::IsOutdated() const
+    {
+        // the shaders may have been reset since the pipeline was created.
+        if (m_shaders.size() != m_shaderGenerations.size()) { return true; }
+        for (std::size_t i = 0; i < m_shaders.size(); ++i) {
+            if (m_shaders[i].shader->GetGeneration() != m_shaderGenerations[i]) { return true; }
+        }
+        return false;
+    }
+
+    ShaderReflection RayTracingPipeline::GetReflection() const
+    {
+        ShaderReflection reflection;
+        for (const auto& shaderInfo : m_shaders) { reflection.Merge(shaderInfo.shader->GetReflection()); }
+        return reflection;
+    }
+
+    void RayTracingPipeline::Rebuild()
+    {
+        // the shader stages need the new shader modules.
+        ResetShaders(std::vector<RTShaderInfo>{m_shaders});
+        auto oldPipeline = ExchangeHandle(m_device->GetHandle(), CreatePipelineHandle());
+        std::shared_ptr<const HostBuffer> oldShaderBindingTable = std::move(m_shaderBindingTable);
+        InitializeShaderBindingTable();
+
+        auto& releaser = m_device->GetResourceReleaser();
+        releaser.AddResourceAfterSubmittedWork(std::make_shared<SharedReleaseableResource<vk::UniquePipeline>>(
+            std::make_shared<vk::UniquePipeline>(std::move(oldPipeline))));
+        releaser.AddResourceAfterSubmittedWork(
+            std::make_shared<SharedReleaseableResource<HostBuffer>>(std::move(oldShaderBindingTable)));
+    }
+
+    vk::UniquePipeline RayTracingPipeline::CreatePipelineHandle()
+    {
+        // a failed rebuild is not tried again until a shader changes again.
+        m_shaderGenerations.clear();
+        for (const auto& shaderInfo : m_shaders) { m_shaderGenerations.push_back(shaderInfo.shader->GetGeneration()); }
+
+        m_specializations.Reset(m_shaders.size());
+        for (std::size_t i = 0; i < m_shaders.size(); ++i) {
+            const auto& shader = *m_shaders[i].shader;
+            m_specializations.Apply(i, m_shaderStages[i], shader.GetSpecializationConstants(), shader.GetReflection());
+        }
 
         vk::PipelineLibraryCreateInfoKHR pipelineLibraryInfo{0, nullptr};
         vk::RayTracingPipelineCreateInfoKHR pipelineInfo{
-            vk::PipelineCreateFlags{}, m_shaderStages, m_shaderGroups, maxRecursionDepth,
-            &pipelineLibraryInfo,      nullptr,        nullptr,        pipelineLayout.GetHandle()};
-
-        if (auto result = m_device->GetHandle().createRayTracingPipelinesKHRUnique(vk::DeferredOperationKHR{},
-                                                                                   vk::PipelineCache{}, pipelineInfo);
-            result.result != vk::Result::eSuccess) {
+            vk::PipelineCreateFlags{}, m_shaderStages, m_shaderGroups, m_maxRecursionDepth,
+            &pipelineLibraryInfo,      nullptr,        nullptr,        m_pipelineLayout};
+
+        auto result = m_device->GetPipelineCache().CreatePipeline(
+            GetName(), pipelineInfo, [this](vk::PipelineCache cache, const auto& info) {
+                return m_device->GetHandle().createRayTracingPipelinesKHRUnique(vk::DeferredOperationKHR{}, cache,
+                                                                                info);
+            });
+        if (result.result != vk::Result::eSuccess) {
             spdlog::error("Could not create ray tracing pipeline.");
-            assert(false);
-        } else {
-            SetHandle(m_device->GetHandle(), std::move(result.value[0]));
+            throw std::runtime_error("Could not create ray tracing pipeline.");
         }
-        InitializeShaderBindingTable();
+        return std::move(result.value[0]);
     }
 
     void RayTracingPipeline::BindPipeline(CommandBuffer& cmdBuffer)
@@ -0,0 +1,732 @@
+/**
+ * @file   ShaderReflection.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the SPIR-V reflection.
+ */
+
+#include "gfx/vk/pipeline/ShaderReflection.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+
+namespace vkfw_core::gfx {
+
+    namespace {
+        // the values of the SPIR-V specification used for reflection.
+        namespace spv {
+            constexpr std::uint32_t magicNumber = 0x07230203U;
+            constexpr std::size_t headerSize = 5;
+
+            enum Op : std::uint32_t {
+                OpName = 5,
+                OpEntryPoint = 15,
+                OpExecutionMode = 16,
+                OpTypeBool = 20,
+                OpTypeInt = 21,
+                OpTypeFloat = 22,
+                OpTypeVector = 23,
+                OpTypeMatrix = 24,
+                OpTypeImage = 25,
+                OpTypeSampler = 26,
+                OpTypeSampledImage = 27,
+                OpTypeArray = 28,
+                OpTypeRuntimeArray = 29,
+                OpTypeStruct = 30,
+                OpTypePointer = 32,
+                OpConstantTrue = 41,
+                OpConstantFalse = 42,
+                OpConstant = 43,
+                OpConstantComposite = 44,
+                OpSpecConstantTrue = 48,
+                OpSpecConstantFalse = 49,
+                OpSpecConstant = 50,
+                OpSpecConstantComposite = 51,
+                OpSpecConstantOp = 52,
+                OpVariable = 59,
+                OpDecorate = 71,
+                OpMemberDecorate = 72,
+                OpExecutionModeId = 331,
+                OpTypeAccelerationStructureKHR = 5341,
+            };
+
+            enum Decoration : std::uint32_t {
+                SpecId = 1,
+                Block = 2,
+                BufferBlock = 3,
+                ArrayStride = 6,
+                MatrixStride = 7,
+                BuiltIn = 11,
+                Location = 30,
+                Binding = 33,
+                DescriptorSet = 34,
+                Offset = 35,
+            };
+
+            enum StorageClass : std::uint32_t {
+                UniformConstant = 0,
+                Input = 1,
+                Uniform = 2,
+                PushConstant = 9,
+                StorageBuffer = 12,
+            };
+
+            constexpr std::uint32_t ExecutionModeLocalSize = 17;
+            constexpr std::uint32_t ExecutionModeLocalSizeId = 38;
+            constexpr std::uint32_t BuiltInWorkgroupSize = 25;
+            constexpr std::uint32_t DimBuffer = 5;
+            constexpr std::uint32_t DimSubpassData = 6;
+            constexpr std::uint32_t ImageSampledStorage = 2;
+        }
+
+        /** Returns the stage of an execution model or std::nullopt for unknown ones. */
+        std::optional<vk::ShaderStageFlagBits> GetStage(std::uint32_t executionModel)
+        {
+            switch (executionModel) {
+            case 0: return vk::ShaderStageFlagBits::eVertex;
+            case 1: return vk::ShaderStageFlagBits::eTessellationControl;
+            case 2: return vk::ShaderStageFlagBits::eTessellationEvaluation;
+            case 3: return vk::ShaderStageFlagBits::eGeometry;
+            case 4: return vk::ShaderStageFlagBits::eFragment;
+            case 5: return vk::ShaderStageFlagBits::eCompute;
+            case 5267: return vk::ShaderStageFlagBits::eTaskNV;
+            case 5268: return vk::ShaderStageFlagBits::eMeshNV;
+            // the EXT task and mesh stages have the same bits as the NV ones.
+            case 5364: return vk::ShaderStageFlagBits::eTaskNV;
+            case 5365: return vk::ShaderStageFlagBits::eMeshNV;
+            case 5313: return vk::ShaderStageFlagBits::eRaygenKHR;
+            case 5314: return vk::ShaderStageFlagBits::eIntersectionKHR;
+            case 5315: return vk::ShaderStageFlagBits::eAnyHitKHR;
+            case 5316: return vk::ShaderStageFlagBits::eClosestHitKHR;
+            case 5317: return vk::ShaderStageFlagBits::eMissKHR;
+            case 5318: return vk::ShaderStageFlagBits::eCallableKHR;
+            default: return std::nullopt;
+            }
+        }
+
+        struct Instruction
+        {
+            std::uint32_t m_opcode = 0;
+            std::span<const std::uint32_t> m_operands;
+        };
+
+        struct Decorations
+        {
+            std::optional<std::uint32_t> m_set;
+            std::optional<std::uint32_t> m_binding;
+            std::optional<std::uint32_t> m_location;
+            std::optional<std::uint32_t> m_specId;
+            std::optional<std::uint32_t> m_builtIn;
+            std::optional<std::uint32_t> m_arrayStride;
+            bool m_block = false;
+            bool m_bufferBlock = false;
+        };
+
+        struct MemberDecorations
+        {
+            std::optional<std::uint32_t> m_offset;
+            std::optional<std::uint32_t> m_matrixStride;
+        };
+
+        struct Constant
+        {
+            std::uint32_t m_type = 0;
+            std::uint64_t m_value = 0;
+            bool m_isSpecialization = false;
+        };
+
+        struct Variable
+        {
+            std::uint32_t m_id = 0;
+            std::uint32_t m_type = 0;
+            std::uint32_t m_storageClass = 0;
+        };
+
+        /** Reads a null terminated string from operands, returns the string and the number of words it used. */
+        std::pair<std::string, std::size_t> ReadString(std::span<const std::uint32_t> operands)
+        {
+            std::string result;
+            for (std::size_t i = 0; i < operands.size(); ++i) {
+                for (std::size_t byte = 0; byte < 4; ++byte) {
+                    auto c = static_cast<char>((operands[i] >> (byte * 8)) & 0xFFU);
+                    if (c == '\0') { return {result, i + 1}; }
+                    result.push_back(c);
+                }
+            }
+            return {result, operands.size()};
+        }
+
+        /** Collects the module information needed for reflection in one pass over the instructions. */
+        class SpirvModule
+        {
+        public:
+            explicit SpirvModule(std::span<const std::uint32_t> code)
+            {
+                if (code.size() < spv::headerSize || code[0] != spv::magicNumber) {
+                    spdlog::error("Shader code is no SPIR-V code.");
+                    throw std::runtime_error("Shader code is no SPIR-V code.");
+                }
+
+                for (auto offset = spv::headerSize; offset < code.size();) {
+                    const auto wordCount = code[offset] >> 16U;
+                    if (wordCount == 0 || offset + wordCount > code.size()) {
+                        spdlog::error("SPIR-V code is truncated at word {}.", offset);
+                        throw std::runtime_error("SPIR-V code is truncated.");
+                    }
+                    ParseInstruction(Instruction{code[offset] & 0xFFFFU, code.subspan(offset + 1, wordCount - 1)});
+                    offset += wordCount;
+                }
+                if (!m_stage) {
+                    spdlog::error("SPIR-V code has no entry point with a known execution model.");
+                    throw std::runtime_error("SPIR-V code has no entry point with a known execution model.");
+                }
+            }
+
+            [[nodiscard]] const Decorations& GetDecorations(std::uint32_t id) const
+            {
+                static const Decorations noDecorations;
+                auto decorations = m_decorations.find(id);
+                return decorations == m_decorations.end() ? noDecorations : decorations->second;
+            }
+
+            [[nodiscard]] std::string GetName(std::uint32_t id) const
+            {
+                auto name = m_names.find(id);
+                return name == m_names.end() ? std::string{} : name->second;
+            }
+
+            [[nodiscard]] const Instruction& GetType(std::uint32_t id) const
+            {
+                auto type = m_types.find(id);
+                if (type == m_types.end()) {
+                    spdlog::error("SPIR-V code uses undefined type {}.", id);
+                    throw std::runtime_error("SPIR-V code uses an undefined type.");
+                }
+                return type->second;
+            }
+
+            [[nodiscard]] const Constant& GetConstant(std::uint32_t id) const
+            {
+                auto constant = m_constants.find(id);
+                if (constant == m_constants.end()) {
+                    spdlog::error("SPIR-V code uses undefined constant {}.", id);
+                    throw std::runtime_error("SPIR-V code uses an undefined constant.");
+                }
+                return constant->second;
+            }
+
+            /** Returns the length of an array type or std::nullopt if it depends on specialization constants. */
+            [[nodiscard]] std::optional<std::uint32_t> GetArrayLength(const Instruction& arrayType) const
+            {
+                const auto lengthId = arrayType.m_operands[2];
+                if (m_specConstantOps.contains(lengthId)) { return std::nullopt; }
+                const auto& length = GetConstant(lengthId);
+                if (length.m_isSpecialization) { return std::nullopt; }
+                return static_cast<std::uint32_t>(length.m_value);
+            }
+
+            /** Returns the size of a type in bytes following the explicit layout decorations. */
+            [[nodiscard]] std::uint32_t GetTypeSize(std::uint32_t typeId, std::uint32_t matrixStride = 0) const
+            {
+                const auto& type = GetType(typeId);
+                switch (type.m_opcode) {
+                case spv::OpTypeBool: return 4;
+                case spv::OpTypeInt:
+                case spv::OpTypeFloat: return type.m_operands[1] / 8;
+                case spv::OpTypeVector: return type.m_operands[2] * GetTypeSize(type.m_operands[1]);
+                case spv::OpTypeMatrix: {
+                    auto columnSize = matrixStride != 0 ? matrixStride : GetTypeSize(type.m_operands[1]);
+                    return type.m_operands[2] * columnSize;
+                }
+                case spv::OpTypeArray: {
+                    auto stride = GetDecorations(typeId).m_arrayStride.value_or(GetTypeSize(type.m_operands[1]));
+                    return GetArrayLength(type).value_or(0) * stride;
+                }
+                case spv::OpTypeStruct: {
+                    std::uint32_t size = 0;
+                    for (std::uint32_t member = 1; member < type.m_operands.size(); ++member) {
+                        auto decorations = m_memberDecorations.find({typeId, member - 1});
+                        MemberDecorations memberDecorations;
+                        if (decorations != m_memberDecorations.end()) { memberDecorations = decorations->second; }
+                        auto memberSize =
+                            GetTypeSize(type.m_operands[member], memberDecorations.m_matrixStride.value_or(0));
+                        size = std::max(size, memberDecorations.m_offset.value_or(size) + memberSize);
+                    }
+                    return size;
+                }
+                default: return 0;
+                }
+            }
+
+            /** Returns the offset of the first member of a struct. */
+            [[nodiscard]] std::uint32_t GetFirstMemberOffset(std::uint32_t structId) const
+            {
+                std::optional<std::uint32_t> offset;
+                for (auto decorations = m_memberDecorations.lower_bound({structId, 0});
+                     decorations != m_memberDecorations.end() && decorations->first.first == structId; ++decorations) {
+                    if (decorations->second.m_offset) {
+                        offset = std::min(offset.value_or(*decorations->second.m_offset),
+                                          *decorations->second.m_offset);
+                    }
+                }
+                return offset.value_or(0);
+            }
+
+            /** Holds the stage of the first entry point with a known execution model. */
+            std::optional<vk::ShaderStageFlagBits> m_stage;
+            /** Holds the id of the entry point. */
+            std::uint32_t m_entryPointId = 0;
+            /** Holds the name of the entry point. */
+            std::string m_entryPoint;
+            /** Holds the local size set by an execution mode (literals or constant ids). */
+            std::array<std::uint32_t, 3> m_localSize = {1, 1, 1};
+            /** Holds the ids of the local size constants. */
+            std::optional<std::array<std::uint32_t, 3>> m_localSizeIds;
+            std::map<std::uint32_t, std::string> m_names;
+            std::map<std::uint32_t, Decorations> m_decorations;
+            std::map<std::pair<std::uint32_t, std::uint32_t>, MemberDecorations> m_memberDecorations;
+            std::map<std::uint32_t, Instruction> m_types;
+            std::map<std::uint32_t, Constant> m_constants;
+            std::map<std::uint32_t, std::vector<std::uint32_t>> m_composites;
+            /** Holds the result ids of OpSpecConstantOp, their values are only known after specialization. */
+            std::set<std::uint32_t> m_specConstantOps;
+            std::vector<Variable> m_variables;
+
+        private:
+            void ParseInstruction(const Instruction& instruction)
+            {
+                const auto& operands = instruction.m_operands;
+                switch (instruction.m_opcode) {
+                case spv::OpName: m_names[operands[0]] = ReadString(operands.subspan(1)).first; break;
+                case spv::OpEntryPoint:
+                    if (!m_stage) {
+                        m_stage = GetStage(operands[0]);
+                        if (!m_stage) {
+                            spdlog::warn("Skipped entry point with unknown SPIR-V execution model {}.", operands[0]);
+                            break;
+                        }
+                        m_entryPointId = operands[1];
+                        m_entryPoint = ReadString(operands.subspan(2)).first;
+                    }
+                    break;
+                case spv::OpExecutionMode:
+                    if (operands[0] == m_entryPointId && operands[1] == spv::ExecutionModeLocalSize) {
+                        m_localSize = {operands[2], operands[3], operands[4]};
+                    }
+                    break;
+                case spv::OpExecutionModeId:
+                    if (operands[0] == m_entryPointId && operands[1] == spv::ExecutionModeLocalSizeId) {
+                        m_localSizeIds = std::array{operands[2], operands[3], operands[4]};
+                    }
+                    break;
+                case spv::OpDecorate:
+                    ParseDecoration(m_decorations[operands[0]], operands[1], operands.subspan(2));
+                    break;
+                case spv::OpMemberDecorate: {
+                    auto& decorations = m_memberDecorations[{operands[0], operands[1]}];
+                    if (operands[2] == spv::Offset) { decorations.m_offset = operands[3]; }
+                    if (operands[2] == spv::MatrixStride) { decorations.m_matrixStride = operands[3]; }
+                    break;
+                }
+                case spv::OpTypeBool:
+                case spv::OpTypeInt:
+                case spv::OpTypeFloat:
+                case spv::OpTypeVector:
+                case spv::OpTypeMatrix:
+                case spv::OpTypeImage:
+                case spv::OpTypeSampler:
+                case spv::OpTypeSampledImage:
+                case spv::OpTypeArray:
+                case spv::OpTypeRuntimeArray:
+                case spv::OpTypeStruct:
+                case spv::OpTypePointer:
+                case spv::OpTypeAccelerationStructureKHR: m_types[operands[0]] = instruction; break;
+                case spv::OpConstantTrue:
+                case spv::OpConstantFalse:
+                case spv::OpSpecConstantTrue:
+                case spv::OpSpecConstantFalse: {
+                    const auto isTrue =
+                        instruction.m_opcode == spv::OpConstantTrue || instruction.m_opcode == spv::OpSpecConstantTrue;
+                    const auto isSpecialization = instruction.m_opcode == spv::OpSpecConstantTrue
+                                                  || instruction.m_opcode == spv::OpSpecConstantFalse;
+                    m_constants[operands[1]] = Constant{operands[0], isTrue ? 1U : 0U, isSpecialization};
+                    break;
+                }
+                case spv::OpConstant:
+                case spv::OpSpecConstant: {
+                    std::uint64_t value = operands[2];
+                    if (operands.size() > 3) { value |= static_cast<std::uint64_t>(operands[3]) << 32U; }
+                    const auto isSpecialization = instruction.m_opcode == spv::OpSpecConstant;
+                    m_constants[operands[1]] = Constant{operands[0], value, isSpecialization};
+                    break;
+                }
+                case spv::OpConstantComposite:
+                case spv::OpSpecConstantComposite:
+                    m_composites[operands[1]] = std::vector(operands.begin() + 2, operands.end());
+                    break;
+                case spv::OpSpecConstantOp: m_specConstantOps.insert(operands[1]); break;
+                case spv::OpVariable: m_variables.push_back(Variable{operands[1], operands[0], operands[2]}); break;
+                default: break;
+                }
+            }
+
+            static void ParseDecoration(Decorations& decorations, std::uint32_t decoration,
+                                        std::span<const std::uint32_t> literals)
+            {
+                switch (decoration) {
+                case spv::SpecId: decorations.m_specId = literals[0]; break;
+                case spv::Block: decorations.m_block = true; break;
+                case spv::BufferBlock: decorations.m_bufferBlock = true; break;
+                case spv::ArrayStride: decorations.m_arrayStride = literals[0]; break;
+                case spv::BuiltIn: decorations.m_builtIn = literals[0]; break;
+                case spv::Location: decorations.m_location = literals[0]; break;
+                case spv::Binding: decorations.m_binding = literals[0]; break;
+                case spv::DescriptorSet: decorations.m_set = literals[0]; break;
+                default: break;
+                }
+            }
+        };
+
+        std::optional<vk::DescriptorType> GetDescriptorType(const SpirvModule& module, const Instruction& type,
+                                                            std::uint32_t typeId, std::uint32_t storageClass)
+        {
+            if (storageClass == spv::StorageBuffer) { return vk::DescriptorType::eStorageBuffer; }
+            if (storageClass == spv::Uniform) {
+                return module.GetDecorations(typeId).m_bufferBlock ? vk::DescriptorType::eStorageBuffer
+                                                                   : vk::DescriptorType::eUniformBuffer;
+            }
+
+            switch (type.m_opcode) {
+            case spv::OpTypeSampler: return vk::DescriptorType::eSampler;
+            case spv::OpTypeAccelerationStructureKHR: return vk::DescriptorType::eAccelerationStructureKHR;
+            case spv::OpTypeSampledImage: {
+                const auto& image = module.GetType(type.m_operands[1]);
+                if (image.m_operands[2] == spv::DimBuffer) { return vk::DescriptorType::eUniformTexelBuffer; }
+                return vk::DescriptorType::eCombinedImageSampler;
+            }
+            case spv::OpTypeImage: {
+                const auto isStorage = type.m_operands[6] == spv::ImageSampledStorage;
+                if (type.m_operands[2] == spv::DimBuffer) {
+                    return isStorage ? vk::DescriptorType::eStorageTexelBuffer
+                                     : vk::DescriptorType::eUniformTexelBuffer;
+                }
+                if (type.m_operands[2] == spv::DimSubpassData) { return vk::DescriptorType::eInputAttachment; }
+                return isStorage ? vk::DescriptorType::eStorageImage : vk::DescriptorType::eSampledImage;
+            }
+            default: return std::nullopt;
+            }
+        }
+
+        vk::Format GetVertexFormat(const SpirvModule& module, const Instruction& type)
+        {
+            std::uint32_t numComponents = 1;
+            const auto* component = &type;
+            if (type.m_opcode == spv::OpTypeVector) {
+                numComponents = type.m_operands[2];
+                component = &module.GetType(type.m_operands[1]);
+            }
+            if (numComponents < 1 || numComponents > 4) { return vk::Format::eUndefined; }
+            const auto index = numComponents - 1;
+
+            const auto width = component->m_operands[1];
+            if (component->m_opcode == spv::OpTypeFloat) {
+                constexpr std::array formats16 = {vk::Format::eR16Sfloat, vk::Format::eR16G16Sfloat,
+                                                  vk::Format::eR16G16B16Sfloat, vk::Format::eR16G16B16A16Sfloat};
+                constexpr std::array formats32 = {vk::Format::eR32Sfloat, vk::Format::eR32G32Sfloat,
+                                                  vk::Format::eR32G32B32Sfloat, vk::Format::eR32G32B32A32Sfloat};
+                constexpr std::array formats64 = {vk::Format::eR64Sfloat, vk::Format::eR64G64Sfloat,
+                                                  vk::Format::eR64G64B64Sfloat, vk::Format::eR64G64B64A64Sfloat};
+                if (width == 16) { return formats16[index]; }
+                if (width == 32) { return formats32[index]; }
+                if (width == 64) { return formats64[index]; }
+            } else if (component->m_opcode == spv::OpTypeInt && width == 32) {
+                constexpr std::array formatsSigned = {vk::Format::eR32Sint, vk::Format::eR32G32Sint,
+                                                      vk::Format::eR32G32B32Sint, vk::Format::eR32G32B32A32Sint};
+                constexpr std::array formatsUnsigned = {vk::Format::eR32Uint, vk::Format::eR32G32Uint,
+                                                        vk::Format::eR32G32B32Uint, vk::Format::eR32G32B32A32Uint};
+                return component->m_operands[2] != 0 ? formatsSigned[index] : formatsUnsigned[index];
+            }
+            return vk::Format::eUndefined;
+        }
+
+        void AddVertexInputs(const SpirvModule& module, std::uint32_t typeId, std::uint32_t location,
+                             const std::string& name, std::vector<ReflectedVertexInput>& vertexInputs)
+        {
+            const auto& type = module.GetType(typeId);
+            if (type.m_opcode == spv::OpTypeArray || type.m_opcode == spv::OpTypeMatrix) {
+                const auto& elementType = module.GetType(type.m_operands[1]);
+                const auto numElements =
+                    type.m_opcode == spv::OpTypeArray ? module.GetArrayLength(type).value_or(0) : type.m_operands[2];
+                // 64 bit vectors with more than 2 components use two locations.
+                auto elementLocations = elementType.m_opcode == spv::OpTypeMatrix ? elementType.m_operands[2] : 1U;
+                if (module.GetTypeSize(type.m_operands[1]) > 16 * elementLocations) { elementLocations *= 2; }
+                for (std::uint32_t i = 0; i < numElements; ++i) {
+                    AddVertexInputs(module, type.m_operands[1], location + i * elementLocations, name, vertexInputs);
+                }
+                return;
+            }
+            vertexInputs.push_back(ReflectedVertexInput{location, GetVertexFormat(module, type), name});
+        }
+    }
+
+    ShaderReflection::ShaderReflection(std::span<const std::uint32_t> code)
+    {
+        const SpirvModule module{code};
+        const auto stage = *module.m_stage;
+        m_stages = stage;
+        m_entryPoint = module.m_entryPoint;
+
+        for (const auto& variable : module.m_variables) {
+            const auto& pointer = module.GetType(variable.m_type);
+            if (pointer.m_opcode != spv::OpTypePointer) { continue; }
+            const auto& decorations = module.GetDecorations(variable.m_id);
+            auto typeId = pointer.m_operands[2];
+
+            if (variable.m_storageClass == spv::PushConstant) {
+                const auto offset = module.GetFirstMemberOffset(typeId);
+                const auto size = module.GetTypeSize(typeId) - offset;
+                m_pushConstantRanges.emplace_back(vk::ShaderStageFlags{stage}, offset, size);
+            } else if (variable.m_storageClass == spv::Input && stage == vk::ShaderStageFlagBits::eVertex) {
+                if (decorations.m_location && !decorations.m_builtIn) {
+                    AddVertexInputs(module, typeId, *decorations.m_location, module.GetName(variable.m_id),
+                                    m_vertexInputs);
+                }
+            } else if (decorations.m_binding) {
+                // arrays of descriptors multiply their counts, runtime sized arrays have none.
+                std::uint32_t count = 1;
+                auto isSpecializationDependent = false;
+                for (auto type = &module.GetType(typeId);
+                     type->m_opcode == spv::OpTypeArray || type->m_opcode == spv::OpTypeRuntimeArray;
+                     type = &module.GetType(typeId)) {
+                    if (type->m_opcode == spv::OpTypeRuntimeArray) {
+                        count = 0;
+                    } else if (auto length = module.GetArrayLength(*type)) {
+                        count *= *length;
+                    } else {
+                        count = 0;
+                        isSpecializationDependent = true;
+                    }
+                    typeId = type->m_operands[1];
+                }
+
+                auto descriptorType =
+                    GetDescriptorType(module, module.GetType(typeId), typeId, variable.m_storageClass);
+                if (!descriptorType) { continue; }
+                auto name = module.GetName(variable.m_id);
+                if (name.empty()) { name = module.GetName(typeId); }
+                m_descriptorBindings.push_back(ReflectedDescriptorBinding{
+                    decorations.m_set.value_or(0), *decorations.m_binding, *descriptorType, count,
+                    vk::ShaderStageFlags{stage}, name, isSpecializationDependent});
+            }
+        }
+
+        for (const auto& [id, constant] : module.m_constants) {
+            const auto& decorations = module.GetDecorations(id);
+            if (!constant.m_isSpecialization || !decorations.m_specId) { continue; }
+            m_specializationConstants.push_back(
+                ReflectedSpecializationConstant{*decorations.m_specId, module.GetTypeSize(constant.m_type),
+                                                constant.m_value, vk::ShaderStageFlags{stage}, module.GetName(id)});
+        }
+
+        m_localSize = module.m_localSize;
+        // the workgroup size built-in overrides the execution mode, it is used with local_size_*_id in GLSL.
+        std::optional<std::array<std::uint32_t, 3>> localSizeIds = module.m_localSizeIds;
+        for (const auto& [id, constituents] : module.m_composites) {
+            if (module.GetDecorations(id).m_builtIn == spv::BuiltInWorkgroupSize && constituents.size() == 3) {
+                localSizeIds = std::array{constituents[0], constituents[1], constituents[2]};
+            }
+        }
+        if (localSizeIds) {
+            for (std::size_t i = 0; i < 3; ++i) {
+                const auto constantId = (*localSizeIds)[i];
+                m_localSize[i] = static_cast<std::uint32_t>(module.GetConstant(constantId).m_value);
+                m_localSizeSpecializationIds[i] = module.GetDecorations(constantId).m_specId;
+            }
+        }
+
+        auto bySetAndBinding = [](const auto& lhs, const auto& rhs) {
+            return std::tie(lhs.m_set, lhs.m_binding) < std::tie(rhs.m_set, rhs.m_binding);
+        };
+        std::sort(m_descriptorBindings.begin(), m_descriptorBindings.end(), bySetAndBinding);
+        std::sort(m_specializationConstants.begin(), m_specializationConstants.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.m_constantId < rhs.m_constantId; });
+        std::sort(m_vertexInputs.begin(), m_vertexInputs.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.m_location < rhs.m_location; });
+    }
+
+    void ShaderReflection::Merge(const ShaderReflection& other)
+    {
+        for (const auto& binding : other.m_descriptorBindings) {
+            auto existing = std::find_if(m_descriptorBindings.begin(), m_descriptorBindings.end(),
+                                         [&binding](const auto& existingBinding) {
+                                             return existingBinding.m_set == binding.m_set
+                                                    && existingBinding.m_binding == binding.m_binding;
+                                         });
+            if (existing == m_descriptorBindings.end()) {
+                m_descriptorBindings.push_back(binding);
+                continue;
+            }
+            if (existing->m_type != binding.m_type || existing->m_count != binding.m_count) {
+                spdlog::error("Shader stages use set {} binding {} differently ({}[{}] and {}[{}]).", binding.m_set,
+                              binding.m_binding, vk::to_string(existing->m_type), existing->m_count,
+                              vk::to_string(binding.m_type), binding.m_count);
+                throw std::runtime_error("Shader stages use a descriptor binding differently.");
+            }
+            existing->m_stages |= binding.m_stages;
+        }
+        std::sort(m_descriptorBindings.begin(), m_descriptorBindings.end(), [](const auto& lhs, const auto& rhs) {
+            return std::tie(lhs.m_set, lhs.m_binding) < std::tie(rhs.m_set, rhs.m_binding);
+        });
+
+        // stages sharing the same range use a single range with all of them.
+        for (const auto& range : other.m_pushConstantRanges) {
+            auto existing = std::find_if(m_pushConstantRanges.begin(), m_pushConstantRanges.end(),
+                                         [&range](const auto& existingRange) {
+                                             return existingRange.offset == range.offset
+                                                    && existingRange.size == range.size;
+                                         });
+            if (existing == m_pushConstantRanges.end()) {
+                m_pushConstantRanges.push_back(range);
+            } else {
+                existing->stageFlags |= range.stageFlags;
+            }
+        }
+
+        for (const auto& constant : other.m_specializationConstants) {
+            auto existing = std::find_if(m_specializationConstants.begin(), m_specializationConstants.end(),
+                                         [&constant](const auto& existingConstant) {
+                                             return existingConstant.m_constantId == constant.m_constantId;
+                                         });
+            if (existing == m_specializationConstants.end()) {
+                m_specializationConstants.push_back(constant);
+                continue;
+            }
+            if (existing->m_size != constant.m_size) {
+                spdlog::error("Shader stages use specialization constant {} with different sizes ({} and {}).",
+                              constant.m_constantId, existing->m_size, constant.m_size);
+                throw std::runtime_error("Shader stages use a specialization constant with different sizes.");
+            }
+            existing->m_stages |= constant.m_stages;
+        }
+        std::sort(m_specializationConstants.begin(), m_specializationConstants.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.m_constantId < rhs.m_constantId; });
+
+        if (other.m_stages & vk::ShaderStageFlagBits::eVertex) { m_vertexInputs = other.m_vertexInputs; }
+        if (other.m_stages & vk::ShaderStageFlagBits::eCompute) {
+            m_localSize = other.m_localSize;
+            m_localSizeSpecializationIds = other.m_localSizeSpecializationIds;
+        }
+        if (m_entryPoint.empty()) { m_entryPoint = other.m_entryPoint; }
+        m_stages |= other.m_stages;
+    }
+
+    std::uint32_t ShaderReflection::GetNumDescriptorSets() const
+    {
+        std::uint32_t numSets = 0;
+        for (const auto& binding : m_descriptorBindings) { numSets = std::max(numSets, binding.m_set + 1); }
+        return numSets;
+    }
+
+    std::array<std::uint32_t, 3> ShaderReflection::GetLocalSize(const SpecializationConstants& constants) const
+    {
+        auto localSize = m_localSize;
+        for (std::size_t i = 0; i < localSize.size(); ++i) {
+            if (!m_localSizeSpecializationIds[i]) { continue; }
+            if (auto value = constants.Get<std::uint32_t>(*m_localSizeSpecializationIds[i])) { localSize[i] = *value; }
+        }
+        return localSize;
+    }
+
+    std::vector<vk::DescriptorSetLayoutBinding>
+    ShaderReflection::GetLayoutBindings(std::uint32_t set, std::uint32_t runtimeArrayCount) const
+    {
+        std::vector<vk::DescriptorSetLayoutBinding> layoutBindings;
+        for (const auto& binding : m_descriptorBindings) {
+            if (binding.m_set != set) { continue; }
+            layoutBindings.emplace_back(binding.m_binding, binding.m_type,
+                                        binding.m_count == 0 ? runtimeArrayCount : binding.m_count, binding.m_stages);
+        }
+        return layoutBindings;
+    }
+
+    std::vector<std::string>
+    ShaderReflection::ValidateLayoutBindings(std::uint32_t set,
+                                             std::span<const vk::DescriptorSetLayoutBinding> bindings) const
+    {
+        auto toNonDynamic = [](vk::DescriptorType type) {
+            if (type == vk::DescriptorType::eUniformBufferDynamic) { return vk::DescriptorType::eUniformBuffer; }
+            if (type == vk::DescriptorType::eStorageBufferDynamic) { return vk::DescriptorType::eStorageBuffer; }
+            return type;
+        };
+
+        std::vector<std::string> errors;
+        for (const auto& binding : m_descriptorBindings) {
+            if (binding.m_set != set) { continue; }
+            auto layoutBinding =
+                std::find_if(bindings.begin(), bindings.end(),
+                             [&binding](const auto& candidate) { return candidate.binding == binding.m_binding; });
+            if (layoutBinding == bindings.end()) {
+                errors.push_back(fmt::format("Set {} binding {} ({}) is missing in the layout.", set,
+                                             binding.m_binding, binding.m_name));
+                continue;
+            }
+            if (toNonDynamic(layoutBinding->descriptorType) != binding.m_type) {
+                errors.push_back(fmt::format("Set {} binding {} ({}) is {} in the layout but {} in the shader.", set,
+                                             binding.m_binding, binding.m_name,
+                                             vk::to_string(layoutBinding->descriptorType),
+                                             vk::to_string(binding.m_type)));
+            }
+            if (layoutBinding->descriptorCount < binding.m_count) {
+                errors.push_back(fmt::format("Set {} binding {} ({}) has {} descriptors in the layout but {} in the "
+                                             "shader.",
+                                             set, binding.m_binding, binding.m_name, layoutBinding->descriptorCount,
+                                             binding.m_count));
+            }
+            if ((layoutBinding->stageFlags & binding.m_stages) != binding.m_stages) {
+                errors.push_back(fmt::format("Set {} binding {} ({}) is not available to all stages using it ({}).",
+                                             set, binding.m_binding, binding.m_name,
+                                             vk::to_string(binding.m_stages)));
+            }
+        }
+        return errors;
+    }
+
+    std::vector<std::uint32_t>
+    ShaderReflection::FindUnusedBindings(std::uint32_t set,
+                                         std::span<const vk::DescriptorSetLayoutBinding> bindings) const
+    {
+        std::vector<std::uint32_t> unusedBindings;
+        for (const auto& layoutBinding : bindings) {
+            const auto isUsed = std::any_of(
+                m_descriptorBindings.begin(), m_descriptorBindings.end(), [set, &layoutBinding](const auto& binding) {
+                    return binding.m_set == set && binding.m_binding == layoutBinding.binding;
+                });
+            if (!isUsed) { unusedBindings.push_back(layoutBinding.binding); }
+        }
+        return unusedBindings;
+    }
+
+    std::vector<std::string>
+    ShaderReflection::ValidateVertexInput(std::span<const vk::VertexInputAttributeDescription> attributes) const
+    {
+        std::vector<std::string> errors;
+        for (const auto& input : m_vertexInputs) {
+            const auto hasAttribute =
+                std::any_of(attributes.begin(), attributes.end(),
+                            [&input](const auto& attribute) { return attribute.location == input.m_location; });
+            if (!hasAttribute) {
+                errors.push_back(
+                    fmt::format("Vertex input {} at location {} has no attribute.", input.m_name, input.m_location));
+            }
+        }
+        return errors;
+    }
+}
@@ -0,0 +1,147 @@
+/**
+ * @file   SpecializationConstants.cpp
+ * @author Sebastian Maisch <sebastian.maisch@googlemail.com>
+ * @date   2026.10.16
+ *
+ * @brief  Implementation of the specialization constant values.
+ */
+
+#include "gfx/vk/pipeline/SpecializationConstants.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace vkfw_core::gfx {
+
+    namespace {
+        std::uint64_t HashFNV1a64(std::span<const std::byte> data, std::uint64_t hash)
+        {
+            for (auto b : data) { hash = (hash ^ static_cast<std::uint64_t>(b)) * 1099511628211ULL; }
+            return hash;
+        }
+    }
+
+    SpecializationConstants& SpecializationConstants::Merge(const SpecializationConstants& other)
+    {
+        for (const auto& entry : other.m_entries) {
+            SetData(entry.constantID, std::span{other.m_data}.subspan(entry.offset, entry.size));
+        }
+        return *this;
+    }
+
+    vk::SpecializationInfo SpecializationConstants::GetInfo() const
+    {
+        return vk::SpecializationInfo{static_cast<std::uint32_t>(m_entries.size()), m_entries.data(), m_data.size(),
+                                      m_data.data()};
+    }
+
+    std::uint64_t SpecializationConstants::GetHash() const
+    {
+        // the entries are sorted, so the hash does not depend on the order the values were set in.
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const auto& entry : m_entries) {
+            hash = HashFNV1a64(std::as_bytes(std::span{&entry.constantID, 1}), hash);
+            hash = HashFNV1a64(std::span{m_data}.subspan(entry.offset, entry.size), hash);
+        }
+        return hash;
+    }
+
+    std::vector<std::string> SpecializationConstants::Validate(const ShaderReflection& reflection) const
+    {
+        // constants the code does not use are ignored by Vulkan, so only size mismatches are errors.
+        std::vector<std::string> errors;
+        for (const auto& entry : m_entries) {
+            for (const auto& constant : reflection.GetSpecializationConstants()) {
+                if (constant.m_constantId == entry.constantID && constant.m_size != entry.size) {
+                    errors.push_back(fmt::format("Specialization constant {} ({}) has {} bytes but the value has {}.",
+                                                 constant.m_constantId, constant.m_name, constant.m_size,
+                                                 entry.size));
+                }
+            }
+        }
+        return errors;
+    }
+
+    bool SpecializationConstants::operator==(const SpecializationConstants& rhs) const
+    {
+        return std::equal(m_entries.begin(), m_entries.end(), rhs.m_entries.begin(), rhs.m_entries.end(),
+                          [this, &rhs](const auto& lhsEntry, const auto& rhsEntry) {
+                              return lhsEntry.constantID == rhsEntry.constantID && lhsEntry.size == rhsEntry.size
+                                     && std::ranges::equal(std::span{m_data}.subspan(lhsEntry.offset, lhsEntry.size),
+                                                           std::span{rhs.m_data}.subspan(rhsEntry.offset,
+                                                                                         rhsEntry.size));
+                          });
+    }
+
+    void SpecializationConstants::SetData(std::uint32_t constantId, std::span<const std::byte> data)
+    {
+        auto entry = std::lower_bound(m_entries.begin(), m_entries.end(), constantId,
+                                      [](const auto& lhs, std::uint32_t id) { return lhs.constantID < id; });
+        if (entry != m_entries.end() && entry->constantID == constantId) {
+            if (entry->size == data.size()) {
+                std::memcpy(&m_data[entry->offset], data.data(), data.size());
+                return;
+            }
+            // a value of a different type is appended, the old bytes stay unused to keep the other offsets aligned.
+            entry = m_entries.erase(entry);
+        }
+
+        // values are aligned like in a std430 struct of scalars, some drivers read them with their alignment.
+        const auto alignment = data.size();
+        m_data.resize((m_data.size() + alignment - 1) / alignment * alignment);
+        const auto offset = static_cast<std::uint32_t>(m_data.size());
+        m_data.insert(m_data.end(), data.begin(), data.end());
+        m_entries.insert(entry, vk::SpecializationMapEntry{constantId, offset, data.size()});
+    }
+
+    void PipelineSpecializations::Set(vk::ShaderStageFlags stages, const SpecializationConstants& constants)
+    {
+        // replacing keeps setting values every frame from growing the list.
+        auto existing = std::find_if(m_constants.begin(), m_constants.end(),
+                                     [stages](const auto& entry) { return entry.first == stages; });
+        if (existing == m_constants.end()) {
+            m_constants.emplace_back(stages, constants);
+        } else {
+            existing->second = constants;
+        }
+    }
+
+    void PipelineSpecializations::Reset(std::size_t numStages)
+    {
+        // the stage create infos point into these, so they are only resized here.
+        m_stageConstants.assign(numStages, SpecializationConstants{});
+        m_stageInfos.assign(numStages, vk::SpecializationInfo{});
+    }
+
+    void PipelineSpecializations::Apply(std::size_t stageIndex, vk::PipelineShaderStageCreateInfo& stageInfo,
+                                        const SpecializationConstants& shaderDefaults,
+                                        const ShaderReflection& reflection)
+    {
+        auto& constants = m_stageConstants[stageIndex];
+        constants = shaderDefaults;
+        for (const auto& [stages, pipelineConstants] : m_constants) {
+            if (stages & stageInfo.stage) { constants.Merge(pipelineConstants); }
+        }
+
+        auto errors = constants.Validate(reflection);
+        if (!errors.empty()) {
+            for (const auto& error : errors) { spdlog::error("{}", error); }
+            throw std::runtime_error("Specialization constant values do not match the shader code.");
+        }
+
+        m_stageInfos[stageIndex] = constants.GetInfo();
+        stageInfo.pSpecializationInfo = constants.IsEmpty() ? nullptr : &m_stageInfos[stageIndex];
+    }
+
+    std::uint64_t PipelineSpecializations::GetHash() const
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const auto& constants : m_stageConstants) {
+            const auto stageHash = constants.GetHash();
+            hash = HashFNV1a64(std::as_bytes(std::span{&stageHash, 1}), hash);
+        }
+        return hash;
+    }
+}
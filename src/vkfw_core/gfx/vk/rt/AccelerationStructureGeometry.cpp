@@ -225,8 +225,9 @@ namespace vkfw_core::gfx::rt {
         barrier.Record(cmdBuffer);
 
         m_TLAS.BuildAccelerationStructure(cmdBuffer);
-        auto fence = vkfw_core::gfx::CommandBuffer::endSingleTimeSubmit(m_device->GetQueue(0, 0), cmdBuffer, {}, {});
-        fence->Wait(m_device, defaultFenceTimeout);
+        auto buildPoint =
+            vkfw_core::gfx::CommandBuffer::endSingleTimeSubmit(m_device->GetQueue(0, 0), cmdBuffer, {}, {});
+        buildPoint.Wait(m_device, defaultFenceTimeout);
 
         for (auto& blas : m_BLAS) { blas.FinalizeBuild(); }
         m_TLAS.FinalizeBuild();
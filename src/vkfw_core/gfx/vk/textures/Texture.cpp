@@ -10,6 +10,7 @@
 #include "gfx/vk/LogicalDevice.h"
 #include "gfx/vk/pipeline/DescriptorSetLayout.h"
 #include "gfx/vk/wrappers/CommandBuffer.h"
+#include "core/block_compression.h"
 
 namespace vkfw_core::gfx {
 
@@ -133,8 +134,8 @@ namespace vkfw_core::gfx {
 
         if (initMemory) {
             vk::MemoryRequirements memRequirements = GetMemoryRequirements();
-            m_imageDeviceMemory.InitializeMemory(memRequirements);
-            BindMemory(m_imageDeviceMemory.GetHandle(), 0);
+            m_imageDeviceMemory.InitializeMemory(memRequirements, false, GetAllocationType());
+            BindMemory(m_imageDeviceMemory.GetMemoryHandle(), m_imageDeviceMemory.GetOffset());
             InitializeImageView();
         }
     }
@@ -197,15 +198,15 @@ namespace vkfw_core::gfx {
                                           const glm::u32vec4& size, const Queue& copyQueue,
                                           std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
                                           std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores,
-                                          std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence)
+                                          std::optional<std::reference_wrapper<TimelinePoint>> submitPoint)
     {
         auto transferCmdBuffer = CommandBuffer::beginSingleTimeSubmit(
             m_device, fmt::format("CopyImageAsyncCmdBuffer:{}-{}", GetName(), dstImage.GetName()), "CopyImageAsync",
             copyQueue.GetCommandPool());
         CopyImageAsync(srcMipLevel, srcOffset, dstImage, dstMipLevel, dstOffset, size, transferCmdBuffer);
-        auto submitFence =
+        auto copyPoint =
             CommandBuffer::endSingleTimeSubmit(copyQueue, transferCmdBuffer, waitSemaphores, signalSemaphores);
-        if (fence.has_value()) { fence = submitFence; }
+        if (submitPoint.has_value()) { submitPoint->get() = copyPoint; }
 
         return transferCmdBuffer;
     }
@@ -213,10 +214,10 @@ namespace vkfw_core::gfx {
     CommandBuffer Texture::CopyImageAsync(Texture& dstImage, const Queue& copyQueue,
                                           std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
                                           std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores,
-                                          std::optional<std::reference_wrapper<std::shared_ptr<Fence>>> fence)
+                                          std::optional<std::reference_wrapper<TimelinePoint>> submitPoint)
     {
         return CopyImageAsync(0, glm::u32vec4(0), dstImage, 0, glm::u32vec4(0), m_size, copyQueue, waitSemaphores,
-                              signalSemaphores, fence);
+                              signalSemaphores, submitPoint);
     }
 
     void Texture::CopyImageSync(Texture& dstImage, const Queue& copyQueue)
@@ -225,6 +226,108 @@ namespace vkfw_core::gfx {
         copyQueue.WaitIdle();
     }
 
+    void Texture::CopyFromStagingAsync(vk::Buffer stagingBuffer, std::size_t stagingOffset, std::uint32_t dstMipLevel,
+                                       const glm::u32vec4& dstOffset, const glm::u32vec4& size,
+                                       CommandBuffer& cmdBuffer)
+    {
+        assert(m_desc.m_imageUsage & vk::ImageUsageFlagBits::eTransferDst);
+        assert(dstOffset.x + size.x <= m_size.x);
+        assert(dstOffset.y + size.y <= m_size.y);
+        assert(dstOffset.z + size.z <= m_size.z);
+        assert(dstOffset.w + size.w <= m_size.w);
+        assert(dstMipLevel < m_mipLevels);
+
+        PipelineBarrier barrier{m_device};
+        AccessBarrier(vk::AccessFlagBits2KHR::eTransferWrite, vk::PipelineStageFlagBits2KHR::eTransfer,
+                      vk::ImageLayout::eTransferDstOptimal, barrier);
+        barrier.Record(cmdBuffer);
+
+        const auto bytesPP = static_cast<std::uint32_t>(m_desc.m_bytesPP);
+        vk::Offset3D offset{static_cast<std::int32_t>(dstOffset.x / bytesPP), static_cast<std::int32_t>(dstOffset.y),
+                            static_cast<std::int32_t>(dstOffset.z)};
+        vk::Extent3D extent{size.x / bytesPP, size.y, size.z};
+        if (IsBlockCompressed(m_desc.m_format)) {
+            // the copy is in texels, blocks at the border of a level only cover the remaining texels.
+            offset.x *= static_cast<std::int32_t>(BLOCK_EXTENT);
+            offset.y *= static_cast<std::int32_t>(BLOCK_EXTENT);
+            const auto levelWidth = std::max(m_pixelSize.x >> dstMipLevel, 1U);
+            const auto levelHeight = std::max(m_pixelSize.y >> dstMipLevel, 1U);
+            extent.width = std::min(extent.width * BLOCK_EXTENT, levelWidth - static_cast<std::uint32_t>(offset.x));
+            extent.height = std::min(extent.height * BLOCK_EXTENT, levelHeight - static_cast<std::uint32_t>(offset.y));
+        }
+        vk::ImageSubresourceLayers subresourceLayers{GetValidAspects(), dstMipLevel, dstOffset.w, size.w};
+        vk::BufferImageCopy copyRegion{stagingOffset, 0, 0, subresourceLayers, offset, extent};
+        cmdBuffer.GetHandle().copyBufferToImage(stagingBuffer, m_image, GetImageLayout(), copyRegion);
+    }
+
+    void Texture::GenerateMipmaps(CommandBuffer& cmdBuffer)
+    {
+        assert(m_desc.m_imageUsage & vk::ImageUsageFlagBits::eTransferSrc);
+        assert(m_desc.m_imageUsage & vk::ImageUsageFlagBits::eTransferDst);
+        if (!SupportsMipmapGeneration(m_device, m_desc.m_format)) {
+            spdlog::error("Cannot generate mipmaps for texture {}: format {} does not support linear blits.",
+                          GetName(), vk::to_string(m_desc.m_format));
+            throw std::runtime_error("Format does not support mipmap generation.");
+        }
+
+        PipelineBarrier barrier{m_device};
+        AccessBarrier(vk::AccessFlagBits2KHR::eTransferWrite, vk::PipelineStageFlagBits2KHR::eTransfer,
+                      vk::ImageLayout::eTransferDstOptimal, barrier);
+        barrier.Record(cmdBuffer);
+
+        // the barriers between levels work on single subresources, so they bypass the per image state tracking.
+        auto levelBarrier = [this, &cmdBuffer](std::uint32_t mipLevel) {
+            vk::ImageMemoryBarrier2KHR imageBarrier{vk::PipelineStageFlagBits2KHR::eTransfer,
+                                                    vk::AccessFlagBits2KHR::eTransferWrite,
+                                                    vk::PipelineStageFlagBits2KHR::eTransfer,
+                                                    vk::AccessFlagBits2KHR::eTransferRead,
+                                                    vk::ImageLayout::eTransferDstOptimal,
+                                                    vk::ImageLayout::eTransferSrcOptimal,
+                                                    VK_QUEUE_FAMILY_IGNORED,
+                                                    VK_QUEUE_FAMILY_IGNORED,
+                                                    m_image,
+                                                    {GetValidAspects(), mipLevel, 1, 0, m_size.w}};
+            cmdBuffer.GetHandle().pipelineBarrier2KHR(
+                vk::DependencyInfoKHR{vk::DependencyFlags{}, {}, {}, imageBarrier});
+        };
+
+        auto levelExtent = [this](std::uint32_t mipLevel) {
+            auto levelSize = [mipLevel](std::uint32_t size) {
+                return static_cast<std::int32_t>(std::max(size >> mipLevel, 1U));
+            };
+            return vk::Offset3D{levelSize(m_pixelSize.x), levelSize(m_pixelSize.y), levelSize(m_pixelSize.z)};
+        };
+
+        for (std::uint32_t mipLevel = 1; mipLevel < m_mipLevels; ++mipLevel) {
+            levelBarrier(mipLevel - 1);
+            vk::ImageBlit blit{vk::ImageSubresourceLayers{GetValidAspects(), mipLevel - 1, 0, m_size.w},
+                               {vk::Offset3D{0, 0, 0}, levelExtent(mipLevel - 1)},
+                               vk::ImageSubresourceLayers{GetValidAspects(), mipLevel, 0, m_size.w},
+                               {vk::Offset3D{0, 0, 0}, levelExtent(mipLevel)}};
+            cmdBuffer.GetHandle().blitImage(m_image, vk::ImageLayout::eTransferSrcOptimal, m_image,
+                                            vk::ImageLayout::eTransferDstOptimal, blit, vk::Filter::eLinear);
+        }
+        levelBarrier(m_mipLevels - 1);
+
+        SetImageLayout(vk::ImageLayout::eTransferSrcOptimal);
+        SetAccess(vk::AccessFlagBits2KHR::eTransferRead, vk::PipelineStageFlagBits2KHR::eTransfer,
+                  cmdBuffer.GetQueueFamily());
+    }
+
+    bool Texture::SupportsMipmapGeneration(const LogicalDevice* device, vk::Format format)
+    {
+        constexpr vk::FormatFeatureFlags requiredFeatures = vk::FormatFeatureFlagBits::eBlitSrc
+                                                            | vk::FormatFeatureFlagBits::eBlitDst
+                                                            | vk::FormatFeatureFlagBits::eSampledImageFilterLinear;
+        auto formatProperties = device->GetPhysicalDevice().getFormatProperties(format);
+        return (formatProperties.optimalTilingFeatures & requiredFeatures) == requiredFeatures;
+    }
+
+    bool Texture::IsBlockCompressed(vk::Format format)
+    {
+        return format >= vk::Format::eBc1RgbUnormBlock && format <= vk::Format::eBc7SrgbBlock;
+    }
+
     void Texture::AccessBarrier(vk::AccessFlags2KHR access, vk::PipelineStageFlags2KHR pipelineStages,
                                 vk::ImageLayout imageLayout, PipelineBarrier& barrier)
     {
@@ -274,7 +377,11 @@ namespace vkfw_core::gfx {
         // this->~Texture();
 
         m_pixelSize = size;
-        m_size = glm::u32vec4(size.x * m_desc.m_bytesPP, size.y, size.z, size.w);
+        if (IsBlockCompressed(m_desc.m_format)) {
+            m_size = glm::u32vec4(GetBlockCount(size.x) * m_desc.m_bytesPP, GetBlockCount(size.y), size.z, size.w);
+        } else {
+            m_size = glm::u32vec4(size.x * m_desc.m_bytesPP, size.y, size.z, size.w);
+        }
         m_mipLevels = mipLevels;
         if (size.z == 1 && size.y == 1 && size.w == 1) {
             m_type = vk::ImageType::e1D;
@@ -303,6 +410,12 @@ namespace vkfw_core::gfx {
 
     vk::Image Texture::GetAccessNoBarrier() const { return m_image; }
 
+    RangeAllocationType Texture::GetAllocationType() const
+    {
+        return m_desc.m_imageTiling == vk::ImageTiling::eOptimal ? RangeAllocationType::Optimal
+                                                                  : RangeAllocationType::Linear;
+    }
+
      inline void Texture::BindMemory(vk::DeviceMemory deviceMemory, std::size_t offset)
      {
          m_device->GetHandle().bindImageMemory(GetHandle(), deviceMemory, offset);
@@ -42,38 +42,26 @@ namespace vkfw_core::gfx {
 
     void CommandBuffer::End() const { GetHandle().end(); }
 
-    std::shared_ptr<Semaphore> CommandBuffer::AddWaitSemaphore(vk::PipelineStageFlags2KHR waitStages)
+    void CommandBuffer::AddWait(const TimelinePoint& waitPoint, vk::PipelineStageFlags2KHR waitStages)
     {
-        auto& waitSemaphore = m_waitSemaphores.emplace_back(std::make_shared<Semaphore>(
-            m_device->GetHandle(), fmt::format("{}:WaitSemaphore-{}", GetName(), m_waitSemaphores.size()),
-            m_device->GetHandle().createSemaphoreUnique(vk::SemaphoreCreateInfo{})));
-        // TODO: At this point we only use binary semaphores, so value is ignored. Needs change for timeline semaphores.
-        m_waitSemaphoreSubmitInfos.emplace_back(waitSemaphore->GetHandle(), 0, waitStages);
-        return waitSemaphore;
+        if (waitPoint.m_semaphore == nullptr) { return; }
+        m_waitSemaphoreSubmitInfos.emplace_back(waitPoint.GetWaitInfo(waitStages));
     }
 
-    std::shared_ptr<Fence> CommandBuffer::SubmitToQueue(const Queue& queue,
-                                                        std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
-                                                        std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores)
+    TimelinePoint CommandBuffer::SubmitToQueue(const Queue& queue,
+                                               std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
+                                               std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores)
     {
-        auto submitFence = m_device->GetResourceReleaser().AddFence(fmt::format("{}:DestroyFence", GetName()));
-
-        m_waitSemaphoreSubmitInfos.resize(m_waitSemaphoreSubmitInfos.size() + waitSemaphores.size());
-        for (std::size_t i = 0; i < waitSemaphores.size(); ++i) {
-            m_waitSemaphoreSubmitInfos[i + m_waitSemaphores.size()] = waitSemaphores[i];
-        }
-        for (std::size_t i = 0; i < m_waitSemaphores.size(); ++i) {
-            m_device->GetResourceReleaser().AddResource(submitFence, m_waitSemaphores[i]);
-        }
+        m_waitSemaphoreSubmitInfos.insert(m_waitSemaphoreSubmitInfos.end(), waitSemaphores.begin(),
+                                          waitSemaphores.end());
 
         const vk::CommandBufferSubmitInfoKHR commandBufferSubmitInfo{GetHandle()};
         vk::SubmitInfo2KHR submitInfo{vk::SubmitFlagsKHR{}, m_waitSemaphoreSubmitInfos, commandBufferSubmitInfo,
                                       signalSemaphores};
-        queue.Submit(submitInfo, submitFence.get());
+        auto submitPoint = queue.Submit(submitInfo);
 
-        m_waitSemaphores.clear();
         m_waitSemaphoreSubmitInfos.clear();
-        return submitFence;
+        return submitPoint;
     }
 
     CommandBuffer CommandBuffer::beginSingleTimeSubmit(const LogicalDevice* device, std::string_view cmdBufferName,
@@ -89,9 +77,9 @@ namespace vkfw_core::gfx {
         return cmdBuffer;
     }
 
-    std::shared_ptr<Fence> CommandBuffer::endSingleTimeSubmit(const Queue& queue, CommandBuffer& cmdBuffer,
-                                                              std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
-                                                              std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores)
+    TimelinePoint CommandBuffer::endSingleTimeSubmit(const Queue& queue, CommandBuffer& cmdBuffer,
+                                                     std::span<vk::SemaphoreSubmitInfoKHR> waitSemaphores,
+                                                     std::span<vk::SemaphoreSubmitInfoKHR> signalSemaphores)
     {
         cmdBuffer.EndLabel();
         cmdBuffer.End();
@@ -101,12 +89,8 @@ namespace vkfw_core::gfx {
     void CommandBuffer::endSingleTimeSubmitAndWait(const LogicalDevice* device, const Queue& queue,
                                                    CommandBuffer& cmdBuffer)
     {
-        auto fence = endSingleTimeSubmit(queue, cmdBuffer, {}, {});
-        if (auto r = device->GetHandle().waitForFences(fence->GetHandle(), VK_TRUE, vkfw_core::defaultFenceTimeout);
-            r != vk::Result::eSuccess) {
-            spdlog::error("Error while waiting for fence: {}.", r);
-            throw std::runtime_error("Error while waiting for fence.");
-        }
+        auto submitPoint = endSingleTimeSubmit(queue, cmdBuffer, {}, {});
+        submitPoint.Wait(device, vkfw_core::defaultFenceTimeout);
     }
 
 #ifndef NDEBUG
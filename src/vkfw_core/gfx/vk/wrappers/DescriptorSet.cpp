@@ -168,10 +168,26 @@ namespace vkfw_core::gfx {
             m_skipNextBindBarriers -= 1;
         }
 
+        BindWithoutBarrier(cmdBuffer, bindingPoint, pipelineLayout, firstSet, dynamicOffsets);
+    }
+
+    void DescriptorSet::BindWithoutBarrier(CommandBuffer& cmdBuffer, vk::PipelineBindPoint bindingPoint,
+                                           const PipelineLayout& pipelineLayout, std::uint32_t firstSet,
+                                           const vk::ArrayProxy<const std::uint32_t>& dynamicOffsets) const
+    {
         cmdBuffer.GetHandle().bindDescriptorSets(bindingPoint, pipelineLayout.GetHandle(), firstSet, GetHandle(),
                                                  dynamicOffsets);
     }
 
+    void DescriptorSet::ConsumeBindBarrier()
+    {
+        if (m_skipNextBindBarriers == 0) {
+            spdlog::warn("Descriptor set {} was bound without a barrier recorded before.", GetName());
+            return;
+        }
+        m_skipNextBindBarriers -= 1;
+    }
+
     const vk::DescriptorSetLayoutBinding& DescriptorSet::GetBindingLayout(std::uint32_t binding)
     {
         for (std::size_t i = 0; i < m_layoutBindings.size(); i++) {
@@ -164,14 +164,11 @@ namespace vkfw_core::gfx {
                                                          m_device->GetCommandPool(static_cast<unsigned int>(i))));
                 releaseBarrier->RecordRelease(*releaseCmdBuffer, dstQueueFamily);
                 vk::PipelineStageFlags2KHR releaseStages = releaseBarrier->GetPipelineStageFlags();
-                auto signalSemaphore = cmdBuffer.AddWaitSemaphore(releaseStages);
-                std::array<vk::SemaphoreSubmitInfoKHR, 1> signalSemaphoreArray = {
-                    vk::SemaphoreSubmitInfoKHR{signalSemaphore->GetHandle(), 0, releaseStages}};
-                auto submitFence = CommandBuffer::endSingleTimeSubmit(
-                    m_device->GetQueue(static_cast<unsigned int>(i), 0), *releaseCmdBuffer, {}, signalSemaphoreArray);
-
-                m_device->GetResourceReleaser().AddResource(submitFence, releaseCmdBuffer);
-                m_device->GetResourceReleaser().AddResource(submitFence, signalSemaphore);
+                auto releasePoint = CommandBuffer::endSingleTimeSubmit(
+                    m_device->GetQueue(static_cast<unsigned int>(i), 0), *releaseCmdBuffer, {}, {});
+                cmdBuffer.AddWait(releasePoint, releaseStages);
+
+                m_device->GetResourceReleaser().AddResource(releasePoint, releaseCmdBuffer);
             }
         }
 
@@ -12,7 +12,9 @@
 namespace vkfw_core::gfx {
 
     Queue::Queue(vk::Device device, std::string_view name, vk::Queue queue, const CommandPool& commandPool)
-        : VulkanObjectWrapper{device, name, queue}, m_commandPool{&commandPool}
+        : VulkanObjectWrapper{device, name, queue}
+        , m_commandPool{&commandPool}
+        , m_timeline{std::make_shared<TimelineSemaphore>(device, fmt::format("{}:Timeline", name))}
     {
     }
 
@@ -38,9 +40,18 @@ namespace vkfw_core::gfx {
     void Queue::EndLabel() const {}
 #endif
 
-    void Queue::Submit(const vk::SubmitInfo2KHR& submitInfo, const Fence* fence) const
+    TimelinePoint Queue::Submit(const vk::SubmitInfo2KHR& submitInfo, const Fence* fence) const
     {
-        GetHandle().submit2KHR(submitInfo, fence ? fence->GetHandle() : nullptr);
+        std::vector<vk::SemaphoreSubmitInfoKHR> signalSemaphores{
+            submitInfo.pSignalSemaphoreInfos, submitInfo.pSignalSemaphoreInfos + submitInfo.signalSemaphoreInfoCount};
+        const TimelinePoint submitPoint{m_timeline.get(), m_timeline->GetNextSignalValue()};
+        signalSemaphores.emplace_back(m_timeline->GetHandle(), submitPoint.m_value,
+                                      vk::PipelineStageFlagBits2KHR::eAllCommands);
+
+        auto timelineSubmitInfo = submitInfo;
+        timelineSubmitInfo.setSignalSemaphoreInfos(signalSemaphores);
+        GetHandle().submit2KHR(timelineSubmitInfo, fence ? fence->GetHandle() : nullptr);
+        return submitPoint;
     }
 
     vk::Result Queue::Present(const vk::PresentInfoKHR& presentInfo) const { return GetHandle().presentKHR(presentInfo); }
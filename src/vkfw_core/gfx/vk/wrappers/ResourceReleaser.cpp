@@ -14,42 +14,48 @@ namespace vkfw_core::gfx {
 
     ResourceReleaser::~ResourceReleaser()
     {
-        for (auto& fencedResources : m_releasableResources) {
-            fencedResources.first->Wait(m_device, defaultFenceTimeout);
+        AddSubmittedWorkResources();
+        for (const auto& [semaphore, resources] : m_releasableResources) {
+            if (!resources.empty()) { semaphore->Wait(m_device, resources.rbegin()->first, defaultFenceTimeout); }
         }
     }
 
-    std::shared_ptr<Fence> ResourceReleaser::AddFence(std::string_view name)
+    void ResourceReleaser::AddResource(const TimelinePoint& releasePoint,
+                                       std::shared_ptr<const ReleaseableResource> resource)
     {
-        std::shared_ptr<Fence> fence;
-        if (!m_availableFences.empty()) {
-            fence = m_availableFences.back();
-            fence->Reset(m_device, name);
-            m_availableFences.pop_back();
-        } else {
-            fence = std::make_shared<Fence>(m_device->GetHandle(), name,
-                                                 m_device->GetHandle().createFenceUnique(vk::FenceCreateInfo{}));
-        }
-        m_releasableResources[fence] = std::vector<std::shared_ptr<const ReleaseableResource>>{};
-        return fence;
+        if (releasePoint.m_semaphore == nullptr) { return; }
+        m_releasableResources[releasePoint.m_semaphore].emplace(releasePoint.m_value, std::move(resource));
     }
 
-    void ResourceReleaser::AddResource(const std::shared_ptr<Fence>& fence,
-                                       std::shared_ptr<const ReleaseableResource> resource)
+    void ResourceReleaser::AddResourceAfterSubmittedWork(std::shared_ptr<const ReleaseableResource> resource)
     {
-        m_releasableResources[fence].emplace_back(resource);
+        const std::scoped_lock lock{m_submittedWorkMutex};
+        m_submittedWorkResources.push_back(std::move(resource));
     }
 
     void ResourceReleaser::TryRelease()
     {
-        for (auto it = m_releasableResources.begin(); it != m_releasableResources.end();) {
-            auto& fencedResources = *it;
-            if (fencedResources.first->IsSignaled(m_device)) {
-                if (fencedResources.first.use_count() == 1) { m_availableFences.emplace_back(fencedResources.first); }
-                it = m_releasableResources.erase(it);
-            } else {
-                ++it;
-            }
+        AddSubmittedWorkResources();
+        for (auto& [semaphore, resources] : m_releasableResources) {
+            if (resources.empty()) { continue; }
+            auto completedValue = semaphore->GetCompletedValue(m_device);
+            resources.erase(resources.begin(), resources.upper_bound(completedValue));
+        }
+    }
+
+    void ResourceReleaser::AddSubmittedWorkResources()
+    {
+        std::vector<std::shared_ptr<const ReleaseableResource>> resources;
+        {
+            const std::scoped_lock lock{m_submittedWorkMutex};
+            resources.swap(m_submittedWorkResources);
+        }
+        if (resources.empty()) { return; }
+
+        // each queue holds a reference, the resource is released when the last one is reached.
+        const auto releasePoints = m_device->GetLastSubmits();
+        for (const auto& resource : resources) {
+            for (const auto& releasePoint : releasePoints) { AddResource(releasePoint, resource); }
         }
     }
 
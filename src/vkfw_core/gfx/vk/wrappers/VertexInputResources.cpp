@@ -47,7 +47,21 @@ namespace vkfw_core::gfx {
             m_skipNextBindBarriers -= 1;
         }
 
+        BindWithoutBarrier(cmdBuffer);
+    }
+
+    void VertexInputResources::BindWithoutBarrier(CommandBuffer& cmdBuffer) const
+    {
         cmdBuffer.GetHandle().bindVertexBuffers(m_firstVertexBinding, m_vertexBuffers, m_vertexBufferOffsets);
         cmdBuffer.GetHandle().bindIndexBuffer(m_indexBuffer, m_indexBufferOffset, m_indexType);
     }
+
+    void VertexInputResources::ConsumeBindBarrier()
+    {
+        if (m_skipNextBindBarriers == 0) {
+            spdlog::warn("Vertex input was bound without a barrier recorded before.");
+            return;
+        }
+        m_skipNextBindBarriers -= 1;
+    }
 }
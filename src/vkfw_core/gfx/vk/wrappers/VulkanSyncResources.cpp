@@ -35,4 +35,26 @@ namespace vkfw_core::gfx {
         }
     }
 
+    TimelineSemaphore::TimelineSemaphore(vk::Device device, std::string_view name)
+        : VulkanObjectWrapper{nullptr, name, vk::UniqueSemaphore{}}
+    {
+        vk::SemaphoreTypeCreateInfo typeInfo{vk::SemaphoreType::eTimeline, m_lastSignalValue};
+        SetHandle(device, device.createSemaphoreUnique(vk::SemaphoreCreateInfo{}.setPNext(&typeInfo)));
+    }
+
+    std::uint64_t TimelineSemaphore::GetCompletedValue(const LogicalDevice* device) const
+    {
+        return device->GetHandle().getSemaphoreCounterValue(GetHandle());
+    }
+
+    void TimelineSemaphore::Wait(const LogicalDevice* device, std::uint64_t value, std::uint64_t timeout) const
+    {
+        const auto semaphore = GetHandle();
+        const vk::SemaphoreWaitInfo waitInfo{vk::SemaphoreWaitFlags{}, 1, &semaphore, &value};
+        if (auto r = device->GetHandle().waitSemaphores(waitInfo, timeout); r != vk::Result::eSuccess) {
+            spdlog::error("Error while waiting for timeline semaphore: {}.", r);
+            throw std::runtime_error("Error while waiting for timeline semaphore.");
+        }
+    }
+
 }
@@ -17,13 +17,17 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <stdexcept>
+#include <thread>
 
 constexpr const char* program_usage = R"(Vulkan framework GLSL shader preprocessor.
 Usage:
-    vkfw_glsl_preprocessor <input_files> ... [-i <include_directory>]... -o <output_file>
+    vkfw_glsl_preprocessor <input_files> ... [-i <include_directory>]... (-o <output_file>)... [-d <dep_file>] [-j <num_threads>]
     vkfw_glsl_preprocessor (-h | --help)
     vkfw_glsl_preprocessor --version
 
@@ -34,10 +38,11 @@ Options:
     -h --help               show this
     --version               show version
     -i <include_directory>  (base) directories to search for include files
-    -o <output_file>        the output file
+    -o <output_file>        the output file for each input file (in the same order)
+    -d <dep_file>           writes the included files of each output file as Makefile dependencies
+    -j <num_threads>        the number of threads processing the input files (0 uses one per core) [default: 0]
 )";
 
-
 int main(int argc, const char** argv)
 {
     try {
@@ -81,12 +86,13 @@ int main(int argc, const char** argv)
             docopt::docopt(program_usage, {argv + 1, argv + argc}, true, "VKFW GLSL Preprocessor 0.1"); // NOLINT
 
         std::vector<std::string> input_filenames = args["<input_files>"].asStringList();
-        std::string output_filename = args["-o"].asString();
+        std::vector<std::string> output_filenames = args["-o"].asStringList();
         std::vector<std::string> include_directory_names = args["-i"].asStringList();
-
-        std::vector<std::filesystem::path> input_files;
-        input_files.reserve(input_filenames.size());
-        for (const auto& input_filename : input_filenames) { input_files.emplace_back(input_filename); }
+        if (input_filenames.size() != output_filenames.size()) {
+            spdlog::critical("Each input file needs an output file ({} input and {} output files given).",
+                             input_filenames.size(), output_filenames.size());
+            return 1;
+        }
 
         std::vector<std::filesystem::path> include_directories;
         include_directories.reserve(include_directory_names.size());
@@ -94,14 +100,48 @@ int main(int argc, const char** argv)
             include_directories.emplace_back(include_directory_name);
         }
 
+        // the processor caches included files for all input files.
         vkfw_glsl::shader_processor processor{include_directories};
-
-        for (const auto& input_file : input_files) {
-            spdlog::info("Processing {}.", input_file.string());
-            auto output_file_content = processor.process_shader(input_file);
-            std::ofstream output_file(output_filename);
-            output_file << output_file_content;
-            spdlog::info("Written {}.", output_filename);
+        std::vector<std::string> dependency_rules(input_filenames.size());
+        std::atomic_size_t next_input = 0;
+        std::atomic_bool has_failed = false;
+        auto process_inputs = [&]() {
+            for (auto i = next_input++; i < input_filenames.size(); i = next_input++) {
+                try {
+                    const std::filesystem::path input_file{input_filenames[i]};
+                    spdlog::info("Processing {}.", input_file.string());
+                    std::vector<std::filesystem::path> dependencies;
+                    auto output_file_content = processor.process_shader(input_file, dependencies);
+                    std::ofstream output_file(output_filenames[i]);
+                    output_file << output_file_content;
+                    if (!output_file) { throw std::runtime_error(fmt::format("Cannot write {}.", output_filenames[i])); }
+                    dependency_rules[i] =
+                        vkfw_glsl::make_dependency_rule(output_filenames[i], input_file, dependencies);
+                    spdlog::info("Written {}.", output_filenames[i]);
+                } catch (const std::exception& e) {
+                    spdlog::critical("Could not process {}: {}", input_filenames[i], e.what());
+                    has_failed = true;
+                }
+            }
+        };
+
+        auto num_threads = static_cast<std::size_t>(args["-j"].asLong());
+        if (num_threads == 0) { num_threads = std::thread::hardware_concurrency(); }
+        num_threads = std::clamp<std::size_t>(num_threads, 1, input_filenames.size());
+        {
+            std::vector<std::jthread> workers;
+            for (std::size_t i = 1; i < num_threads; ++i) { workers.emplace_back(process_inputs); }
+            process_inputs();
+        }
+        if (has_failed) { return 1; }
+
+        if (args["-d"]) {
+            std::ofstream dependency_file(args["-d"].asString());
+            for (const auto& rule : dependency_rules) { dependency_file << rule; }
+            if (!dependency_file) {
+                spdlog::critical("Cannot write dependency file {}.", args["-d"].asString());
+                return 1;
+            }
         }
     } catch (...) {
         spdlog::critical("Could not process given files. Unknown exception.");
@@ -12,7 +12,8 @@
 #include <spdlog/spdlog.h>
 #include <filesystem>
 #include <fstream>
-#include <regex>
+#include <optional>
+#include <string_view>
 #include <algorithm>
 
 namespace vkfw_glsl {
@@ -49,30 +50,97 @@ namespace vkfw_glsl {
     {
     }
 
+    // this is checked for every line, so it does not use regular expressions.
+    std::optional<std::string> parse_include(std::string_view line)
+    {
+        auto skip_spaces = [&line]() {
+            while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) { line.remove_prefix(1); }
+        };
+
+        skip_spaces();
+        if (!line.starts_with('#')) { return std::nullopt; }
+        line.remove_prefix(1);
+        skip_spaces();
+        constexpr std::string_view include_directive = "include";
+        if (!line.starts_with(include_directive)) { return std::nullopt; }
+        line.remove_prefix(include_directive.size());
+        if (line.empty() || (line.front() != ' ' && line.front() != '\t')) { return std::nullopt; }
+        skip_spaces();
+        if (line.empty() || (line.front() != '"' && line.front() != '<')) { return std::nullopt; }
+
+        const auto closing = line.find(line.front() == '"' ? '"' : '>', 1);
+        if (closing == std::string_view::npos) { return std::nullopt; }
+        return std::string{line.substr(1, closing - 1)};
+    }
+
+    std::string escape_dependency_path(const std::filesystem::path& path)
+    {
+        std::string escaped;
+        for (auto c : path.generic_string()) {
+            if (c == ' ' || c == '#') { escaped.push_back('\\'); }
+            if (c == '$') { escaped.push_back('$'); }
+            escaped.push_back(c);
+        }
+        return escaped;
+    }
+
+    std::string make_dependency_rule(const std::string& output_filename, const std::filesystem::path& input_file,
+                                     const std::vector<std::filesystem::path>& dependencies)
+    {
+        auto rule = fmt::format("{}: {}", escape_dependency_path(output_filename),
+                                escape_dependency_path(std::filesystem::absolute(input_file)));
+        for (const auto& dependency : dependencies) {
+            rule.append(" \\\n  ").append(escape_dependency_path(std::filesystem::absolute(dependency)));
+        }
+        return rule.append("\n");
+    }
+
     std::string shader_processor::process_shader(const std::filesystem::path& shader_file)
     {
-        std::size_t file_id = 0;
-        return process_shader_recursive(shader_file, file_id, 0);
+        return process_shader_recursive(shader_file, 0)->content;
+    }
+
+    std::string shader_processor::process_shader(const std::filesystem::path& shader_file,
+                                                 std::vector<std::filesystem::path>& dependencies)
+    {
+        auto processed = process_shader_recursive(shader_file, 0);
+        dependencies = processed->includes;
+        return processed->content;
     }
 
     std::filesystem::path shader_processor::find_file_location(const std::filesystem::path& parent_path,
                                                                const std::filesystem::path& relative_path)
     {
+        // headers are included by many files, so each one is searched only once.
+        auto key = parent_path.generic_string() + '\n' + relative_path.generic_string();
+        {
+            const std::scoped_lock lock{m_cache_mutex};
+            if (auto location = m_file_locations.find(key); location != m_file_locations.end()) {
+                return location->second;
+            }
+        }
+
         for (const auto& dir : m_file_paths) {
             auto filename = relative_path;
             if (!dir.empty()) { filename = dir / relative_path; }
-            if (std::filesystem::exists(filename)) { return filename; }
+            if (std::filesystem::exists(filename)) {
+                const std::scoped_lock lock{m_cache_mutex};
+                return m_file_locations.emplace(std::move(key), filename).first->second;
+            }
             filename = parent_path / relative_path;
             if (!dir.empty()) { filename = dir / parent_path / relative_path; }
-            if (std::filesystem::exists(filename)) { return filename; }
+            if (std::filesystem::exists(filename)) {
+                const std::scoped_lock lock{m_cache_mutex};
+                return m_file_locations.emplace(std::move(key), filename).first->second;
+            }
         }
 
         spdlog::critical("Cannot find local resource file \"{}\".", relative_path.string());
         throw std::runtime_error(fmt::format("Cannot find local resource file ({}).", relative_path.string()));
     }
 
-    std::string shader_processor::process_shader_recursive(const std::filesystem::path& shader_file,
-                                                           std::size_t& file_id, std::size_t recursion_depth)
+    std::shared_ptr<const shader_processor::processed_file>
+    shader_processor::process_shader_recursive(const std::filesystem::path& shader_file, std::size_t recursion_depth)
     {
         if (recursion_depth > max_shader_recursion_depth) {
             spdlog::critical("Header inclusion depth limit reached! Cyclic header inclusion? File: {}",
@@ -80,13 +148,30 @@ namespace vkfw_glsl {
             throw std::runtime_error(fmt::format(
                 "Header inclusion depth limit reached! Cyclic header inclusion? File: {}", shader_file.string()));
         }
-        namespace filesystem = std::filesystem;
+
+        // files included several times are only processed once, a cyclic inclusion never gets into the cache.
+        const auto key = shader_file.generic_string();
+        {
+            const std::scoped_lock lock{m_cache_mutex};
+            if (auto processed = m_processed_files.find(key); processed != m_processed_files.end()) {
+                return processed->second;
+            }
+        }
 
         std::ifstream file(shader_file, std::ifstream::in);
+        if (!file) {
+            spdlog::critical("Cannot open shader file \"{}\".", shader_file.string());
+            throw std::runtime_error(fmt::format("Cannot open shader file ({}).", shader_file.string()));
+        }
         std::string line;
-        std::string content;
+        auto result = std::make_shared<processed_file>();
+        auto& content = result->content;
+        auto add_include = [&result](const std::filesystem::path& include_file) {
+            if (std::find(result->includes.begin(), result->includes.end(), include_file) == result->includes.end()) {
+                result->includes.push_back(include_file);
+            }
+        };
         std::size_t lineCount = 1;
-        auto next_file_id = file_id + 1;
 
         bool inCppCode = false;
         bool inCppIfdef = false;
@@ -125,19 +210,15 @@ namespace vkfw_glsl {
             }
 
 
-            static const std::regex include_regex(R"(^[ ]*#[ ]*include[ ]+["<](.*)[">].*)");
-            std::smatch include_matches;
-            if (!inCppCode && std::regex_search(line, include_matches, include_regex)) {
-                // filesystem::path relative_filename{shader_file.parent_path() / include_matches[1].str()};
-                auto include_file = find_file_location(shader_file.parent_path(), include_matches[1].str());
-                if (!filesystem::exists(include_file)) {
-                    spdlog::critical("{}({}): fatal error: cannot open include file \"{}\".", shader_file.string(),
-                                     lineCount, include_file.string());
-                    throw std::runtime_error(fmt::format("{}({}): fatal error: cannot open include file \"{}\".",
-                                                         shader_file.string(), lineCount, include_file.string()));
-                }
+            auto include_name = inCppCode ? std::nullopt : parse_include(line);
+            if (include_name) {
+                auto include_file = find_file_location(shader_file.parent_path(), *include_name);
+                auto included = process_shader_recursive(include_file, recursion_depth + 1);
+                add_include(include_file);
+                for (const auto& nested_include : included->includes) { add_include(nested_include); }
+
                 content.append(fmt::format("#line {} \"{}\"\n", 1, include_file.string()));
-                content.append(process_shader_recursive(include_file, next_file_id, recursion_depth + 1));
+                content.append(included->content);
                 content.append(
                     fmt::format("#line {} \"{}\"\n", lineCount + 1, shader_file.string()));
             } else {
@@ -157,7 +238,7 @@ namespace vkfw_glsl {
         }
 
         file.close();
-        file_id = next_file_id;
-        return content;
+        const std::scoped_lock lock{m_cache_mutex};
+        return m_processed_files.try_emplace(key, std::move(result)).first->second;
     }
 }
@@ -0,0 +1,140 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/meshes/AnimationSampler.h"
+
+#include <random>
+
+using vkfw_core::gfx::Animation;
+using vkfw_core::gfx::AnimationCursor;
+using vkfw_core::gfx::AnimationSampler;
+using vkfw_core::gfx::Channel;
+
+namespace {
+
+  Animation CreateAnimation(std::size_t numChannels, std::size_t numKeys, float duration)
+  {
+    std::mt19937 rng{1234};
+    std::uniform_real_distribution<float> value{-1.0f, 1.0f};
+    std::uniform_real_distribution<float> scale{0.5f, 2.0f};
+
+    std::vector<Channel> channels(numChannels);
+    for (auto& channel : channels) {
+      for (std::size_t k = 0; k < numKeys; ++k) {
+        auto time = duration * static_cast<float>(k) / static_cast<float>(numKeys - 1);
+        // irregular key times to make sure keys are not found by their index.
+        if (k != 0 && k + 1 != numKeys) { time += 0.3f * value(rng) * duration / static_cast<float>(numKeys); }
+        channel.m_positionFrames.emplace_back(time, glm::vec3{value(rng), value(rng), value(rng)});
+        channel.m_rotationFrames.emplace_back(
+            time, glm::normalize(glm::quat{value(rng), value(rng), value(rng), value(rng)}));
+        channel.m_scalingFrames.emplace_back(time, glm::vec3{scale(rng), scale(rng), scale(rng)});
+      }
+    }
+    return Animation{"test", std::move(channels), 24.0f, duration};
+  }
+
+  bool PosesEqual(const glm::mat4& lhs, const glm::mat4& rhs, float epsilon)
+  {
+    for (glm::length_t c = 0; c < 4; ++c) {
+      for (glm::length_t r = 0; r < 4; ++r) {
+        if (std::abs(lhs[c][r] - rhs[c][r]) > epsilon) { return false; }
+      }
+    }
+    return true;
+  }
+}
+
+TEST_CASE("Key search finds the last key not after the time", "[animation]")
+{
+  const std::array<float, 5> times{0.0f, 1.0f, 2.0f, 4.0f, 8.0f};
+  for (std::uint32_t cursor = 0; cursor < 6; ++cursor) {
+    REQUIRE(AnimationSampler::FindKey(times, 0.0f, cursor) == 0);
+    REQUIRE(AnimationSampler::FindKey(times, 1.5f, cursor) == 1);
+    REQUIRE(AnimationSampler::FindKey(times, 2.0f, cursor) == 2);
+    REQUIRE(AnimationSampler::FindKey(times, 7.9f, cursor) == 3);
+    REQUIRE(AnimationSampler::FindKey(times, 9.0f, cursor) == 4);
+    REQUIRE(AnimationSampler::FindKey(times, -1.0f, cursor) == 0);
+  }
+}
+
+TEST_CASE("Sampled poses match Animation::ComputePoseAtTime", "[animation]")
+{
+  constexpr float duration = 100.0f;
+  auto animation = CreateAnimation(16, 50, duration);
+  AnimationSampler sampler{animation};
+  std::vector<AnimationCursor> cursors(16);
+
+  // monotonic playback with wrap around uses the cursors, random times use the binary search.
+  std::mt19937 rng{42};
+  std::uniform_real_distribution<float> randomTime{-1.0f, duration + 1.0f};
+  for (std::size_t frame = 0; frame < 500; ++frame) {
+    auto playTime = std::fmod(static_cast<float>(frame) * 0.37f, duration);
+    auto time = frame % 7 == 0 ? randomTime(rng) : playTime;
+    for (std::size_t i = 0; i < 16; ++i) {
+      glm::mat4 expected;
+      glm::mat4 sampled;
+      REQUIRE(animation.ComputePoseAtTime(i, time, expected));
+      REQUIRE(sampler.SamplePose(i, time, cursors[i], sampled));
+      REQUIRE(PosesEqual(expected, sampled, 1e-6f));
+    }
+  }
+}
+
+TEST_CASE("Resampled tracks match the key frames at the samples", "[animation]")
+{
+  constexpr float duration = 10.0f;
+  auto animation = CreateAnimation(4, 20, duration);
+  AnimationSampler sampler{animation, 8.0f};
+  REQUIRE(sampler.IsResampled());
+
+  for (std::size_t sample = 0; sample <= 80; ++sample) {
+    auto time = static_cast<float>(sample) / 8.0f;
+    for (std::size_t i = 0; i < 4; ++i) {
+      glm::mat4 expected;
+      glm::mat4 sampled;
+      REQUIRE(animation.ComputePoseAtTime(i, time, expected));
+      REQUIRE(sampler.SamplePose(i, time, sampled));
+      REQUIRE(PosesEqual(expected, sampled, 1e-4f));
+    }
+  }
+}
+
+TEST_CASE("Animation sampling benchmark", "[.][animation][benchmark]")
+{
+  constexpr std::size_t numBones = 2000;
+  constexpr float duration = 1000.0f;
+  auto animation = CreateAnimation(numBones, 1000, duration);
+  AnimationSampler sampler{animation};
+  AnimationSampler resampledSampler{animation, 1.0f};
+  std::vector<AnimationCursor> cursors(numBones);
+  std::vector<glm::mat4> poses(numBones);
+  float time = 0.0f;
+  auto nextTime = [&time]() { return time = std::fmod(time + 0.4f, duration); };
+
+  BENCHMARK("Animation::ComputePoseAtTime")
+  {
+    auto t = nextTime();
+    for (std::size_t i = 0; i < numBones; ++i) { animation.ComputePoseAtTime(i, t, poses[i]); }
+    return poses[0][3][0];
+  };
+
+  BENCHMARK("AnimationSampler (binary search)")
+  {
+    auto t = nextTime();
+    for (std::size_t i = 0; i < numBones; ++i) { sampler.SamplePose(i, t, poses[i]); }
+    return poses[0][3][0];
+  };
+
+  BENCHMARK("AnimationSampler (cursors)")
+  {
+    auto t = nextTime();
+    for (std::size_t i = 0; i < numBones; ++i) { sampler.SamplePose(i, t, cursors[i], poses[i]); }
+    return poses[0][3][0];
+  };
+
+  BENCHMARK("AnimationSampler (resampled)")
+  {
+    auto t = nextTime();
+    for (std::size_t i = 0; i < numBones; ++i) { resampledSampler.SamplePose(i, t, poses[i]); }
+    return poses[0][3][0];
+  };
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/meshes/AssImpScene.h"
+#include "gfx/meshes/MeshBinaryFile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+using vkfw_core::gfx::AssImpScene;
+using vkfw_core::gfx::MeshBinaryFile;
+using vkfw_core::gfx::MeshCreateFlagBits;
+using vkfw_core::gfx::MeshCreateFlags;
+
+namespace {
+
+  std::vector<char> ReadFile(const std::filesystem::path& filename)
+  {
+    std::ifstream file{filename, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  /** Imports a mesh and returns the contents of the binary file written for it. */
+  std::vector<char> ImportToBinary(const std::filesystem::path& filename, MeshCreateFlags flags)
+  {
+    AssImpScene scene{filename, flags};
+    MeshBinaryFile::Write(scene, filename);
+    auto binaryFilename = MeshBinaryFile::GetBinaryFilename(filename);
+    auto result = ReadFile(binaryFilename);
+    std::filesystem::remove(binaryFilename);
+    return result;
+  }
+}
+
+TEST_CASE("Parallel mesh import is identical to the serial import", "[mesh][import]")
+{
+  auto source = std::filesystem::path{VKFW_TEST_RESOURCES} / "meshes" / "mesh_all.obj";
+  auto filename = std::filesystem::temp_directory_path() / "vkfw_parallel_import.obj";
+  std::filesystem::copy_file(source, filename, std::filesystem::copy_options::overwrite_existing);
+
+  MeshCreateFlags flags = MeshCreateFlagBits::CREATE_TANGENTSPACE;
+  auto serial = ImportToBinary(filename, flags);
+  auto parallel = ImportToBinary(filename, flags | MeshCreateFlagBits::PARALLEL_IMPORT);
+  std::filesystem::remove(filename);
+
+  REQUIRE(!serial.empty());
+  REQUIRE(serial == parallel);
+}
+
+TEST_CASE("Parallel import of skinned meshes keeps bone indices and weights", "[mesh][import]")
+{
+  // two primitives with different materials are imported as two meshes sharing a skin of three bones.
+  auto source = std::filesystem::path{VKFW_TEST_RESOURCES} / "meshes" / "mesh_skinned.gltf";
+  auto filename = std::filesystem::temp_directory_path() / "vkfw_parallel_import_skinned.gltf";
+  std::filesystem::copy_file(source, filename, std::filesystem::copy_options::overwrite_existing);
+
+  MeshCreateFlags flags = MeshCreateFlagBits::CREATE_TANGENTSPACE;
+  AssImpScene serial{filename, flags};
+  AssImpScene parallel{filename, flags | MeshCreateFlagBits::PARALLEL_IMPORT};
+  auto serialBinary = ImportToBinary(filename, flags);
+  auto parallelBinary = ImportToBinary(filename, flags | MeshCreateFlagBits::PARALLEL_IMPORT);
+  std::filesystem::remove(filename);
+
+  REQUIRE(serial.GetSubMeshes().size() == 2);
+  REQUIRE(serial.GetInverseBindPoseMatrices().size() == 3);
+  REQUIRE(parallel.GetInverseBindPoseMatrices().size() == 3);
+
+  const auto serialBones = serial.GetBoneOffsetMatrixIndices();
+  const auto parallelBones = parallel.GetBoneOffsetMatrixIndices();
+  const auto serialWeights = serial.GetBoneWeights();
+  const auto parallelWeights = parallel.GetBoneWeights();
+  REQUIRE(serialBones.size() == serial.GetVertices().size());
+  REQUIRE(std::equal(serialBones.begin(), serialBones.end(), parallelBones.begin(), parallelBones.end()));
+  REQUIRE(std::equal(serialWeights.begin(), serialWeights.end(), parallelWeights.begin(), parallelWeights.end()));
+  // every vertex is skinned, so the normalized weights sum to one and the strongest bone comes first.
+  for (const auto& weights : serialWeights) {
+    REQUIRE(weights.x + weights.y + weights.z + weights.w == Approx(1.0f));
+    REQUIRE(weights.x >= weights.y);
+  }
+  REQUIRE(std::any_of(serialBones.begin(), serialBones.end(), [](const auto& bones) { return bones.x == 2; }));
+
+  REQUIRE(!serialBinary.empty());
+  REQUIRE(serialBinary == parallelBinary);
+}
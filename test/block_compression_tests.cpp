@@ -0,0 +1,256 @@
+#include <catch2/catch.hpp>
+
+#include "core/block_compression.h"
+
+#include <array>
+#include <cmath>
+
+using vkfw_core::BlockFormat;
+using vkfw_core::CompressBlocks;
+using vkfw_core::ComputeCompressionError;
+using vkfw_core::DecompressBlocks;
+using vkfw_core::GetBlockChannels;
+using vkfw_core::GetCompressedSize;
+
+namespace {
+
+  /** Smooth gradients with some noise, alpha falls off towards the borders. */
+  std::vector<std::uint8_t> CreateTestImage(std::uint32_t width, std::uint32_t height, std::uint32_t channels)
+  {
+    std::vector<std::uint8_t> texels(std::size_t{width} * height * channels);
+    std::uint32_t noise = 12345;
+    for (std::uint32_t y = 0; y < height; ++y) {
+      for (std::uint32_t x = 0; x < width; ++x) {
+        noise = noise * 1103515245U + 12345U;
+        const auto fx = static_cast<float>(x) / static_cast<float>(width);
+        const auto fy = static_cast<float>(y) / static_cast<float>(height);
+        const std::array<float, 4> values{255.0f * fx, 255.0f * fy, 127.5f + 127.5f * std::sin(6.0f * (fx + fy)),
+                                          255.0f * (1.0f - std::abs(2.0f * fx - 1.0f))};
+        for (std::uint32_t c = 0; c < channels; ++c) {
+          const auto value = values[c] + static_cast<float>((noise >> 16) % 7) - 3.0f;
+          texels[(std::size_t{y} * width + x) * channels + c] =
+              static_cast<std::uint8_t>(std::clamp(value, 0.0f, 255.0f));
+        }
+      }
+    }
+    return texels;
+  }
+
+  std::vector<std::uint8_t> ExtractChannels(const std::vector<std::uint8_t>& texels, std::size_t channels,
+                                            std::size_t usedChannels)
+  {
+    std::vector<std::uint8_t> result;
+    for (std::size_t i = 0; i < texels.size(); i += channels) {
+      result.insert(result.end(), texels.begin() + static_cast<std::ptrdiff_t>(i),
+                    texels.begin() + static_cast<std::ptrdiff_t>(i + usedChannels));
+    }
+    return result;
+  }
+
+  /** Writes bits starting with the least significant bit of the first byte, like the BC7 block layout. */
+  class BitWriter
+  {
+  public:
+    explicit BitWriter(std::array<std::uint8_t, 16>& block) : m_block{block} { m_block.fill(0); }
+
+    BitWriter& Write(std::uint32_t value, std::uint32_t numBits)
+    {
+      for (std::uint32_t i = 0; i < numBits; ++i, ++m_position) {
+        if (((value >> i) & 1U) != 0) { m_block[m_position / 8] |= static_cast<std::uint8_t>(1U << (m_position % 8)); }
+      }
+      return *this;
+    }
+
+  private:
+    std::array<std::uint8_t, 16>& m_block;
+    std::uint32_t m_position = 0;
+  };
+}
+
+TEST_CASE("Compressed sizes are rounded up to whole blocks", "[bc]")
+{
+  REQUIRE(GetCompressedSize(BlockFormat::BC1, 4, 4) == 8);
+  REQUIRE(GetCompressedSize(BlockFormat::BC1, 5, 5) == 32);
+  REQUIRE(GetCompressedSize(BlockFormat::BC4, 1, 1) == 8);
+  REQUIRE(GetCompressedSize(BlockFormat::BC3, 16, 8) == 128);
+  REQUIRE(GetCompressedSize(BlockFormat::BC7, 256, 256) == 65536);
+  REQUIRE(GetBlockChannels(BlockFormat::BC4) == 1);
+  REQUIRE(GetBlockChannels(BlockFormat::BC5) == 2);
+  REQUIRE(GetBlockChannels(BlockFormat::BC7) == 4);
+}
+
+TEST_CASE("BC1 blocks interpolate between the endpoints", "[bc]")
+{
+  // red and blue endpoints, the rows use the indices 0, 1, 2 and 3.
+  const std::array<std::uint8_t, 8> block{0x00, 0xf8, 0x1f, 0x00, 0x00, 0x55, 0xaa, 0xff};
+  auto texels = DecompressBlocks(BlockFormat::BC1, block, 4, 4);
+  REQUIRE(texels.size() == 64);
+
+  auto texel = [&texels](std::size_t x, std::size_t y) {
+    const auto* t = &texels[(y * 4 + x) * 4];
+    return std::array<std::uint8_t, 4>{t[0], t[1], t[2], t[3]};
+  };
+  REQUIRE(texel(3, 0) == std::array<std::uint8_t, 4>{255, 0, 0, 255});
+  REQUIRE(texel(0, 1) == std::array<std::uint8_t, 4>{0, 0, 255, 255});
+  REQUIRE(texel(1, 2) == std::array<std::uint8_t, 4>{170, 0, 85, 255});
+  REQUIRE(texel(2, 3) == std::array<std::uint8_t, 4>{85, 0, 170, 255});
+}
+
+TEST_CASE("BC1 punch through alpha is only decoded for BC1A", "[bc]")
+{
+  // c0 <= c1 selects the three color mode, index 3 is transparent black.
+  const std::array<std::uint8_t, 8> block{0x1f, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff};
+  auto opaque = DecompressBlocks(BlockFormat::BC1, block, 4, 4);
+  auto transparent = DecompressBlocks(BlockFormat::BC1A, block, 4, 4);
+  for (std::size_t i = 0; i < 16; ++i) {
+    REQUIRE(opaque[4 * i + 3] == 255);
+    REQUIRE(transparent[4 * i + 3] == 0);
+    REQUIRE(transparent[4 * i] == 0);
+  }
+
+  std::vector<std::uint8_t> image(16 * 4, 200);
+  for (std::size_t i = 0; i < 16; i += 3) { image[4 * i + 3] = 10; }
+  auto decoded = DecompressBlocks(BlockFormat::BC1A, CompressBlocks(BlockFormat::BC1A, image, 4, 4), 4, 4);
+  for (std::size_t i = 0; i < 16; ++i) {
+    REQUIRE(decoded[4 * i + 3] == (i % 3 == 0 ? 0 : 255));
+    if (i % 3 != 0) { REQUIRE(decoded[4 * i] == Approx(200).margin(4)); }
+  }
+}
+
+TEST_CASE("BC4 blocks use eight or six interpolated values", "[bc]")
+{
+  std::array<std::uint8_t, 8> block{200, 100, 0, 0, 0, 0, 0, 0};
+  // texel 0 uses index 2, texel 1 index 7.
+  block[2] = 0x3a;
+  auto texels = DecompressBlocks(BlockFormat::BC4, block, 4, 4);
+  REQUIRE(texels[0] == 186);
+  REQUIRE(texels[1] == 114);
+  REQUIRE(texels[2] == 200);
+
+  // a0 <= a1 selects four interpolated values and explicit 0 and 255 (index 6 and 7).
+  block = {100, 200, 0x3e, 0, 0, 0, 0, 0};
+  texels = DecompressBlocks(BlockFormat::BC4, block, 4, 4);
+  REQUIRE(texels[0] == 0);
+  REQUIRE(texels[1] == 255);
+}
+
+TEST_CASE("BC7 mode 5 blocks decode with rotation and separate alpha indices", "[bc]")
+{
+  std::array<std::uint8_t, 16> block{};
+  auto writeBlock = [&block](std::uint32_t rotation) {
+    BitWriter bits{block};
+    bits.Write(1U << 5, 6).Write(rotation, 2);
+    // red endpoints 127 and 0, green and blue 0, alpha 255 and 0.
+    bits.Write(127, 7).Write(0, 7).Write(0, 7).Write(0, 7).Write(0, 7).Write(0, 7).Write(255, 8).Write(0, 8);
+    // color indices: texel 1 uses the second endpoint.
+    bits.Write(0, 1).Write(3, 2);
+    for (int i = 2; i < 16; ++i) { bits.Write(0, 2); }
+    // alpha indices: texel 2 uses weight 21.
+    bits.Write(0, 1).Write(0, 2).Write(1, 2);
+    for (int i = 3; i < 16; ++i) { bits.Write(0, 2); }
+  };
+
+  writeBlock(0);
+  auto texels = DecompressBlocks(BlockFormat::BC7, block, 4, 4);
+  REQUIRE(std::vector<std::uint8_t>(texels.begin(), texels.begin() + 12)
+          == std::vector<std::uint8_t>{255, 0, 0, 255, 0, 0, 0, 255, 255, 0, 0, 171});
+
+  // rotation 1 swaps red and alpha.
+  writeBlock(1);
+  texels = DecompressBlocks(BlockFormat::BC7, block, 4, 4);
+  REQUIRE(std::vector<std::uint8_t>(texels.begin(), texels.begin() + 12)
+          == std::vector<std::uint8_t>{255, 0, 0, 255, 255, 0, 0, 0, 171, 0, 0, 255});
+}
+
+TEST_CASE("BC7 reserved mode decodes to transparent black", "[bc]")
+{
+  const std::array<std::uint8_t, 16> block{};
+  auto texels = DecompressBlocks(BlockFormat::BC7, block, 4, 4);
+  for (auto value : texels) { REQUIRE(value == 0); }
+}
+
+TEST_CASE("Constant blocks round trip almost exactly", "[bc]")
+{
+  const std::array<std::uint8_t, 4> color{37, 180, 91, 222};
+  for (auto format : {BlockFormat::BC1, BlockFormat::BC2, BlockFormat::BC3, BlockFormat::BC4, BlockFormat::BC5,
+                      BlockFormat::BC7}) {
+    const auto channels = GetBlockChannels(format);
+    std::vector<std::uint8_t> image;
+    for (int i = 0; i < 5 * 3; ++i) { image.insert(image.end(), color.begin(), color.begin() + channels); }
+
+    auto blocks = CompressBlocks(format, image, 5, 3);
+    REQUIRE(blocks.size() == GetCompressedSize(format, 5, 3));
+    auto decoded = DecompressBlocks(format, blocks, 5, 3);
+    REQUIRE(decoded.size() == image.size());
+
+    // BC1 has no alpha, its colors are quantized to 5:6:5 bits.
+    const auto usedChannels = format == BlockFormat::BC1 ? 3U : channels;
+    const auto error = ComputeCompressionError(ExtractChannels(image, channels, usedChannels),
+                                               ExtractChannels(decoded, channels, usedChannels));
+    const std::uint32_t maxError = format == BlockFormat::BC1 || format == BlockFormat::BC2 || format == BlockFormat::BC3
+                                       ? 4
+                                       : 1;
+    REQUIRE(error.m_maxError <= maxError);
+  }
+}
+
+TEST_CASE("Compression error stays within format limits", "[bc]")
+{
+  constexpr std::uint32_t width = 64;
+  constexpr std::uint32_t height = 48;
+
+  struct Expectation
+  {
+    BlockFormat m_format;
+    std::size_t m_comparedChannels;
+    double m_minPsnr;
+  };
+  // the noise of the test image limits the PSNR to about 42dB, BC7 only uses a single subset.
+  for (const auto& expectation : {Expectation{BlockFormat::BC1, 3, 33.0}, Expectation{BlockFormat::BC2, 4, 33.0},
+                                  Expectation{BlockFormat::BC3, 4, 34.0}, Expectation{BlockFormat::BC4, 1, 45.0},
+                                  Expectation{BlockFormat::BC5, 2, 45.0}, Expectation{BlockFormat::BC7, 4, 34.0}}) {
+    const std::size_t channels = GetBlockChannels(expectation.m_format);
+    const auto image = CreateTestImage(width, height, static_cast<std::uint32_t>(channels));
+    const auto decoded =
+        DecompressBlocks(expectation.m_format, CompressBlocks(expectation.m_format, image, width, height), width,
+                         height);
+
+    const auto error = ComputeCompressionError(ExtractChannels(image, channels, expectation.m_comparedChannels),
+                                               ExtractChannels(decoded, channels, expectation.m_comparedChannels));
+    INFO("format " << static_cast<int>(expectation.m_format) << " PSNR " << error.m_psnr);
+    REQUIRE(error.m_psnr > expectation.m_minPsnr);
+  }
+}
+
+TEST_CASE("Compression error metrics", "[bc]")
+{
+  const std::vector<std::uint8_t> reference{10, 20, 30, 40};
+  auto identical = ComputeCompressionError(reference, reference);
+  REQUIRE(identical.m_rmse == 0.0);
+  REQUIRE(std::isinf(identical.m_psnr));
+  REQUIRE(identical.m_maxError == 0);
+
+  const std::vector<std::uint8_t> decoded{12, 20, 26, 40};
+  auto error = ComputeCompressionError(reference, decoded);
+  REQUIRE(error.m_rmse == Approx(std::sqrt(20.0 / 4.0)));
+  REQUIRE(error.m_psnr == Approx(20.0 * std::log10(255.0 / std::sqrt(5.0))));
+  REQUIRE(error.m_maxError == 4);
+}
+
+TEST_CASE("BC6H blocks are not handled on the CPU", "[bc]")
+{
+  const std::array<std::uint8_t, 16> block{};
+  REQUIRE_THROWS_AS(DecompressBlocks(BlockFormat::BC6H, block, 4, 4), std::runtime_error);
+  REQUIRE_THROWS_AS(CompressBlocks(BlockFormat::BC6H, block, 2, 2), std::runtime_error);
+  REQUIRE_THROWS_AS(DecompressBlocks(BlockFormat::BC7, block, 8, 4), std::runtime_error);
+}
+
+TEST_CASE("Block compression benchmark", "[.][bc][benchmark]")
+{
+  const auto image = CreateTestImage(256, 256, 4);
+  const auto bc7Blocks = CompressBlocks(BlockFormat::BC7, image, 256, 256);
+
+  BENCHMARK("BC1 encode 256x256") { return CompressBlocks(BlockFormat::BC1, image, 256, 256); };
+  BENCHMARK("BC7 encode 256x256") { return CompressBlocks(BlockFormat::BC7, image, 256, 256); };
+  BENCHMARK("BC7 decode 256x256") { return DecompressBlocks(BlockFormat::BC7, bc7Blocks, 256, 256); };
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+
+#include "headless_application.h"
+#include "core/resources/ShaderManager.h"
+#include "gfx/vk/Shader.h"
+#include "gfx/vk/buffers/HostBuffer.h"
+#include "gfx/vk/pipeline/ComputePipeline.h"
+#include "gfx/vk/pipeline/DescriptorSetLayout.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+#include "gfx/vk/wrappers/DescriptorPool.h"
+#include "gfx/vk/wrappers/DescriptorSet.h"
+#include "gfx/vk/wrappers/PipelineLayout.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+  /** A compute kernel using storage buffers in set 0 and the number of values as push constant. */
+  class ComputeKernel
+  {
+  public:
+    ComputeKernel(vkfw_core::gfx::LogicalDevice& device, const std::string& shaderName,
+                  const vkfw_core::gfx::SpecializationConstants& constants)
+        : m_device{&device}
+        , m_shader{device.GetShaderManager()->GetResource(shaderName)}
+        , m_setLayout{shaderName}
+        , m_pipelineLayout{device.GetHandle(), shaderName, vk::UniquePipelineLayout{}}
+        , m_descriptorSet{&device, shaderName, vk::DescriptorSet{}}
+        , m_pipeline{&device, shaderName, m_shader}
+    {
+      const auto& reflection = m_shader->GetReflection();
+      m_setLayout.AddBindings(reflection, 0);
+      auto setLayout = m_setLayout.CreateDescriptorLayout(&device);
+      const auto& pushConstantRanges = reflection.GetPushConstantRanges();
+      vk::PipelineLayoutCreateInfo pipelineLayoutInfo{vk::PipelineLayoutCreateFlags{}, 1, &setLayout,
+                                                      static_cast<std::uint32_t>(pushConstantRanges.size()),
+                                                      pushConstantRanges.data()};
+      m_pipelineLayout.SetHandle(device.GetHandle(), device.GetHandle().createPipelineLayoutUnique(pipelineLayoutInfo));
+
+      m_pipeline.SetSpecializationConstants(constants);
+      m_pipeline.CreatePipeline(m_pipelineLayout);
+
+      m_descriptorPool = m_setLayout.CreateDescriptorPool(&device, shaderName);
+      vk::DescriptorSetAllocateInfo setAllocInfo{m_descriptorPool.GetHandle(), 1, &setLayout};
+      m_descriptorSet.SetHandle(device.GetHandle(), shaderName,
+                                std::move(device.GetHandle().allocateDescriptorSets(setAllocInfo)[0]));
+    }
+
+    void WriteBuffers(std::span<vkfw_core::gfx::Buffer*> buffers)
+    {
+      m_descriptorSet.InitializeWrites(m_device, m_setLayout);
+      for (std::uint32_t binding = 0; binding < buffers.size(); ++binding) {
+        std::array bufferRange{vkfw_core::gfx::BufferRange{buffers[binding], 0, buffers[binding]->GetSize()}};
+        m_descriptorSet.WriteBufferDescriptor(binding, 0, bufferRange,
+                                              vk::AccessFlagBits2KHR::eShaderRead
+                                                  | vk::AccessFlagBits2KHR::eShaderWrite);
+      }
+      m_descriptorSet.FinalizeWrite(m_device);
+    }
+
+    void Bind(vkfw_core::gfx::CommandBuffer& cmdBuffer, std::uint32_t count)
+    {
+      m_pipeline.BindPipeline(cmdBuffer);
+      m_descriptorSet.Bind(cmdBuffer, vk::PipelineBindPoint::eCompute, m_pipelineLayout, 0);
+      cmdBuffer.GetHandle().pushConstants(m_pipelineLayout.GetHandle(), vk::ShaderStageFlagBits::eCompute, 0,
+                                          sizeof(count), &count);
+    }
+
+    [[nodiscard]] vkfw_core::gfx::ComputePipeline& GetPipeline() { return m_pipeline; }
+
+  private:
+    const vkfw_core::gfx::LogicalDevice* m_device;
+    std::shared_ptr<vkfw_core::gfx::Shader> m_shader;
+    vkfw_core::gfx::DescriptorSetLayout m_setLayout;
+    vkfw_core::gfx::PipelineLayout m_pipelineLayout;
+    vkfw_core::gfx::DescriptorPool m_descriptorPool;
+    vkfw_core::gfx::DescriptorSet m_descriptorSet;
+    vkfw_core::gfx::ComputePipeline m_pipeline;
+  };
+
+  std::vector<std::uint32_t> CreateValues(std::size_t count)
+  {
+    std::vector<std::uint32_t> values(count);
+    for (std::size_t i = 0; i < count; ++i) { values[i] = static_cast<std::uint32_t>((i * 7919) % 13 + 1); }
+    return values;
+  }
+
+  /** Makes the values written by the shaders visible to the host after the submit finished. */
+  void RecordReadback(vkfw_core::gfx::LogicalDevice& device, vkfw_core::gfx::CommandBuffer& cmdBuffer,
+                      std::span<vkfw_core::gfx::Buffer*> buffers)
+  {
+    vkfw_core::gfx::PipelineBarrier barrier{&device};
+    for (auto* buffer : buffers) {
+      buffer->AccessBarrier(false, vk::AccessFlagBits2KHR::eHostRead, vk::PipelineStageFlagBits2KHR::eHost, barrier);
+    }
+    barrier.Record(cmdBuffer);
+  }
+}
+
+TEST_CASE("Compute dispatches cover all invocations", "[compute]")
+{
+  using vkfw_core::gfx::ComputePipeline;
+
+  CHECK(ComputePipeline::GetGroupCount(glm::uvec3{1000, 1, 1}, glm::uvec3{64, 1, 1}) == glm::uvec3{16, 1, 1});
+  CHECK(ComputePipeline::GetGroupCount(glm::uvec3{1024, 1, 1}, glm::uvec3{64, 1, 1}) == glm::uvec3{16, 1, 1});
+  CHECK(ComputePipeline::GetGroupCount(glm::uvec3{1920, 1080, 1}, glm::uvec3{16, 16, 1}) == glm::uvec3{120, 68, 1});
+  CHECK(ComputePipeline::GetGroupCount(glm::uvec3{0, 7, 3}, glm::uvec3{8, 8, 1}) == glm::uvec3{0, 1, 3});
+}
+
+TEST_CASE("Prefix sums computed by a dispatch match the CPU", "[compute][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  // the specialized workgroup size does not divide the number of values.
+  constexpr std::uint32_t count = 1000;
+  constexpr std::uint32_t localSize = 64;
+  ComputeKernel kernel{device, "shader/compute/prefix_sum.comp",
+                       vkfw_core::gfx::SpecializationConstants{}.Set(0U, localSize)};
+  auto& pipeline = kernel.GetPipeline();
+  REQUIRE(pipeline.GetLocalSize() == glm::uvec3{localSize, 1, 1});
+  const auto numGroups = pipeline.GetGroupCount(glm::uvec3{count, 1, 1}).x;
+
+  const auto values = CreateValues(count);
+  vkfw_core::gfx::HostBuffer valueBuffer{&device, "PrefixSumValues", vk::BufferUsageFlagBits::eStorageBuffer};
+  valueBuffer.InitializeData(values);
+  vkfw_core::gfx::HostBuffer groupSumBuffer{&device, "PrefixSumGroupSums", vk::BufferUsageFlagBits::eStorageBuffer};
+  groupSumBuffer.InitializeData(std::vector<std::uint32_t>(numGroups, 0));
+  std::array<vkfw_core::gfx::Buffer*, 2> buffers{&valueBuffer, &groupSumBuffer};
+  kernel.WriteBuffers(buffers);
+
+  auto cmdBuffer = vkfw_core::gfx::CommandBuffer::beginSingleTimeSubmit(&device, "PrefixSumCmdBuffer", "PrefixSum",
+                                                                        device.GetCommandPool(0));
+  kernel.Bind(cmdBuffer, count);
+  pipeline.Dispatch(cmdBuffer, glm::uvec3{count, 1, 1});
+  RecordReadback(device, cmdBuffer, buffers);
+  vkfw_core::gfx::CommandBuffer::endSingleTimeSubmitAndWait(&device, device.GetQueue(0, 0), cmdBuffer);
+
+  std::vector<std::uint32_t> prefixSums(count);
+  valueBuffer.DownloadData(prefixSums);
+  std::vector<std::uint32_t> groupSums(numGroups);
+  groupSumBuffer.DownloadData(groupSums);
+  for (std::uint32_t group = 0; group < numGroups; ++group) {
+    const auto first = values.begin() + group * localSize;
+    const auto last = values.begin() + std::min(count, (group + 1) * localSize);
+    std::vector<std::uint32_t> expected(static_cast<std::size_t>(last - first));
+    std::inclusive_scan(first, last, expected.begin());
+    REQUIRE(std::equal(expected.begin(), expected.end(), prefixSums.begin() + group * localSize));
+    REQUIRE(groupSums[group] == expected.back());
+  }
+}
+
+TEST_CASE("Reductions computed by an indirect dispatch match the CPU", "[compute][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  constexpr std::uint32_t count = 5000;
+  ComputeKernel kernel{device, "shader/compute/reduction.comp", vkfw_core::gfx::SpecializationConstants{}};
+  auto& pipeline = kernel.GetPipeline();
+  REQUIRE(pipeline.GetLocalSize() == glm::uvec3{256, 1, 1});
+
+  const auto values = CreateValues(count);
+  vkfw_core::gfx::HostBuffer valueBuffer{&device, "ReductionValues", vk::BufferUsageFlagBits::eStorageBuffer};
+  valueBuffer.InitializeData(values);
+  vkfw_core::gfx::HostBuffer sumBuffer{&device, "ReductionSum", vk::BufferUsageFlagBits::eStorageBuffer};
+  sumBuffer.InitializeData(std::array<std::uint32_t, 1>{0});
+  std::array<vkfw_core::gfx::Buffer*, 2> buffers{&valueBuffer, &sumBuffer};
+  kernel.WriteBuffers(buffers);
+
+  const auto groupCount = pipeline.GetGroupCount(glm::uvec3{count, 1, 1});
+  vkfw_core::gfx::HostBuffer indirectBuffer{&device, "ReductionIndirect", vk::BufferUsageFlagBits::eIndirectBuffer};
+  const std::array indirectCommand{vk::DispatchIndirectCommand{groupCount.x, groupCount.y, groupCount.z}};
+  indirectBuffer.InitializeData(indirectCommand);
+
+  auto cmdBuffer = vkfw_core::gfx::CommandBuffer::beginSingleTimeSubmit(&device, "ReductionCmdBuffer", "Reduction",
+                                                                        device.GetCommandPool(0));
+  kernel.Bind(cmdBuffer, count);
+  pipeline.DispatchIndirect(cmdBuffer, indirectBuffer, 0);
+  std::array<vkfw_core::gfx::Buffer*, 1> readbackBuffers{&sumBuffer};
+  RecordReadback(device, cmdBuffer, readbackBuffers);
+  vkfw_core::gfx::CommandBuffer::endSingleTimeSubmitAndWait(&device, device.GetQueue(0, 0), cmdBuffer);
+
+  std::array<std::uint32_t, 1> sum{};
+  sumBuffer.DownloadData(sum);
+  REQUIRE(sum[0] == std::accumulate(values.begin(), values.end(), std::uint32_t{0}));
+}
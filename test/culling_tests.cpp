@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+
+#include "core/math/culling.h"
+#include "core/math/math.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+using vkfw_core::math::AABB3;
+using vkfw_core::math::CullingBoxes;
+using vkfw_core::math::Frustum;
+
+namespace {
+
+  struct CullingScene
+  {
+    Frustum<float> m_frustum{glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f)
+                             * glm::lookAt(glm::vec3{0.0f, 2.0f, 10.0f}, glm::vec3{0.0f}, glm::vec3{0.0f, 1.0f, 0.0f})};
+    std::vector<AABB3<float>> m_boxes;
+    std::vector<glm::mat4> m_matrices;
+    CullingBoxes m_cullingBoxes;
+  };
+
+  CullingScene CreateScene(std::size_t boxCount)
+  {
+    std::mt19937 rng{1234};
+    std::uniform_real_distribution<float> position{-40.0f, 40.0f};
+    std::uniform_real_distribution<float> size{0.05f, 5.0f};
+    std::uniform_real_distribution<float> angle{0.0f, 6.28f};
+
+    CullingScene scene;
+    for (std::size_t i = 0; i < boxCount; ++i) {
+      glm::vec3 boxMin{position(rng), position(rng), position(rng)};
+      scene.m_boxes.emplace_back(boxMin, boxMin + glm::vec3{size(rng), size(rng), size(rng)});
+      scene.m_cullingBoxes.Add(scene.m_boxes.back());
+
+      auto matrix = glm::translate(glm::mat4{1.0f}, glm::vec3{position(rng), position(rng), position(rng)} * 0.25f);
+      matrix = glm::rotate(matrix, angle(rng), glm::vec3{position(rng), position(rng), 1.0f});
+      scene.m_matrices.push_back(glm::scale(matrix, glm::vec3{size(rng), size(rng), size(rng)}));
+    }
+    return scene;
+  }
+
+  /** Returns the smallest distance of the positive vertex to a frustum plane (the box is culled if negative). */
+  float PlaneMargin(const Frustum<float>& frustum, const AABB3<float>& box)
+  {
+    auto margin = std::numeric_limits<float>::max();
+    for (const auto& plane : frustum.m_planes) {
+      glm::vec3 p{box.m_minmax[0]};
+      if (plane.x >= 0) { p.x = box.m_minmax[1].x; }
+      if (plane.y >= 0) { p.y = box.m_minmax[1].y; }
+      if (plane.z >= 0) { p.z = box.m_minmax[1].z; }
+      margin = std::min(margin, glm::dot(glm::vec3{plane}, p) + plane.w);
+    }
+    return margin;
+  }
+}
+
+TEST_CASE("Batch culling matches transforming the box and testing it", "[culling]")
+{
+  auto scene = CreateScene(4096);
+  std::vector<std::uint64_t> visibility(vkfw_core::math::CullingMaskSize(scene.m_boxes.size()));
+  vkfw_core::math::CullAABBs(scene.m_frustum, scene.m_cullingBoxes, scene.m_matrices, visibility);
+
+  std::size_t visibleCount = 0;
+  for (std::size_t i = 0; i < scene.m_boxes.size(); ++i) {
+    auto worldBox = scene.m_boxes[i].NewFromTransform(scene.m_matrices[i]);
+    auto expected = vkfw_core::math::AABBInFrustumTest(scene.m_frustum, worldBox);
+    // boxes touching a plane may go either way because of rounding.
+    if (std::abs(PlaneMargin(scene.m_frustum, worldBox)) < 1e-3f) { continue; }
+    REQUIRE(vkfw_core::math::IsVisible(visibility, i) == expected);
+    if (expected) { visibleCount += 1; }
+  }
+  // make sure both outcomes are covered.
+  REQUIRE(visibleCount > 0);
+  REQUIRE(visibleCount < scene.m_boxes.size());
+}
+
+TEST_CASE("Batch culling uses a single matrix for all boxes", "[culling]")
+{
+  auto scene = CreateScene(100);
+  const std::array<glm::mat4, 1> sharedMatrix{scene.m_matrices.front()};
+  std::vector<std::uint64_t> visibility(vkfw_core::math::CullingMaskSize(scene.m_boxes.size()), ~std::uint64_t{0});
+  vkfw_core::math::CullAABBs(scene.m_frustum, scene.m_cullingBoxes, sharedMatrix, visibility);
+
+  for (std::size_t i = 0; i < scene.m_boxes.size(); ++i) {
+    auto worldBox = scene.m_boxes[i].NewFromTransform(sharedMatrix[0]);
+    if (std::abs(PlaneMargin(scene.m_frustum, worldBox)) < 1e-3f) { continue; }
+    REQUIRE(vkfw_core::math::IsVisible(visibility, i)
+            == vkfw_core::math::AABBInFrustumTest(scene.m_frustum, worldBox));
+  }
+  // bits behind the last box are cleared.
+  REQUIRE((visibility.back() >> (scene.m_boxes.size() % 64)) == 0);
+}
+
+TEST_CASE("Batch culling always culls empty boxes", "[culling]")
+{
+  auto scene = CreateScene(0);
+  scene.m_cullingBoxes.Add(AABB3<float>{});
+  std::array<std::uint64_t, 1> visibility = {};
+  const std::array<glm::mat4, 1> identity{glm::mat4{1.0f}};
+  vkfw_core::math::CullAABBs(scene.m_frustum, scene.m_cullingBoxes, identity, visibility);
+  REQUIRE(!vkfw_core::math::IsVisible(visibility, 0));
+}
+
+TEST_CASE("Batch culling benchmark", "[.][culling][benchmark]")
+{
+  auto scene = CreateScene(4096);
+  std::vector<std::uint64_t> visibility(vkfw_core::math::CullingMaskSize(scene.m_boxes.size()));
+
+  BENCHMARK("AABB::NewFromTransform + AABBInFrustumTest")
+  {
+    std::size_t visibleCount = 0;
+    for (std::size_t i = 0; i < scene.m_boxes.size(); ++i) {
+      auto worldBox = scene.m_boxes[i].NewFromTransform(scene.m_matrices[i]);
+      if (vkfw_core::math::AABBInFrustumTest(scene.m_frustum, worldBox)) { visibleCount += 1; }
+    }
+    return visibleCount;
+  };
+
+  BENCHMARK("CullAABBs")
+  {
+    vkfw_core::math::CullAABBs(scene.m_frustum, scene.m_cullingBoxes, scene.m_matrices, visibility);
+    return visibility.front();
+  };
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch.hpp>
+
+#include "core/file_watcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+  struct TemporaryDirectory
+  {
+    TemporaryDirectory()
+        : m_path{std::filesystem::temp_directory_path()
+                 / ("vkfw_file_watcher_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))}
+    {
+      std::filesystem::create_directories(m_path / "shader");
+    }
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+    TemporaryDirectory(TemporaryDirectory&&) = delete;
+    TemporaryDirectory& operator=(TemporaryDirectory&&) = delete;
+    ~TemporaryDirectory() { std::filesystem::remove_all(m_path); }
+
+    std::filesystem::path m_path;
+  };
+
+  void WriteFile(const std::filesystem::path& filename, const std::string& content)
+  {
+    std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+    file << content;
+  }
+
+  std::vector<std::filesystem::path> WaitForChanges(vkfw_core::FileWatcher& watcher)
+  {
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (std::chrono::steady_clock::now() < timeout) {
+      auto changes = watcher.GetChangedFiles();
+      if (!changes.empty()) { return changes; }
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return {};
+  }
+}
+
+TEST_CASE("File watcher reports changed files once after the debounce interval", "[file_watcher]")
+{
+  const auto forcePolling = GENERATE(false, true);
+  TemporaryDirectory directory;
+  const auto shaderFile = directory.m_path / "shader" / "test.frag";
+  WriteFile(shaderFile, "void main() {}");
+
+  vkfw_core::FileWatcher watcher{{directory.m_path}, std::chrono::milliseconds{50}, forcePolling,
+                                 std::chrono::milliseconds{20}};
+  REQUIRE(watcher.GetChangedFiles().empty());
+
+  // several writes in a row are reported as one change.
+  for (int i = 0; i < 3; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{15});
+    WriteFile(shaderFile, "void main() { /* " + std::to_string(i) + " */ }");
+  }
+  const auto changes = WaitForChanges(watcher);
+  REQUIRE(changes.size() == 1);
+  REQUIRE(std::filesystem::equivalent(changes[0], shaderFile));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{100});
+  REQUIRE(watcher.GetChangedFiles().empty());
+}
+
+TEST_CASE("File watcher reports files in new sub directories", "[file_watcher]")
+{
+  const auto forcePolling = GENERATE(false, true);
+  TemporaryDirectory directory;
+  vkfw_core::FileWatcher watcher{{directory.m_path}, std::chrono::milliseconds{0}, forcePolling,
+                                 std::chrono::milliseconds{20}};
+
+  std::filesystem::create_directories(directory.m_path / "textures");
+  // the watcher adds the new directory when it reads its creation.
+  static_cast<void>(watcher.GetChangedFiles());
+  const auto textureFile = directory.m_path / "textures" / "test.png";
+  WriteFile(textureFile, "png");
+
+  const auto changes = WaitForChanges(watcher);
+  REQUIRE(std::any_of(changes.begin(), changes.end(), [&textureFile](const auto& change) {
+    return std::filesystem::equivalent(change, textureFile);
+  }));
+}
+
+TEST_CASE("File watcher reports deleted files", "[file_watcher]")
+{
+  const auto forcePolling = GENERATE(false, true);
+  TemporaryDirectory directory;
+  const auto textureFile = directory.m_path / "test.png";
+  WriteFile(textureFile, "png");
+  vkfw_core::FileWatcher watcher{{directory.m_path}, std::chrono::milliseconds{0}, forcePolling,
+                                 std::chrono::milliseconds{20}};
+
+  std::filesystem::remove(textureFile);
+  const auto changes = WaitForChanges(watcher);
+  REQUIRE(changes.size() == 1);
+  REQUIRE(changes[0] == textureFile);
+}
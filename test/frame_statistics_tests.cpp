@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include "core/frame_statistics.h"
+
+using vkfw_core::FrameStatistics;
+using vkfw_core::FrameTiming;
+
+TEST_CASE("Frame statistics average and maximum over the window", "[frame_statistics]")
+{
+  FrameStatistics statistics{4};
+  REQUIRE(statistics.GetNumFrames() == 0);
+  REQUIRE(statistics.GetFramesPerSecond() == 0.0);
+
+  statistics.AddFrame(FrameTiming{10.0, 1.0, 20.0});
+  statistics.AddFrame(FrameTiming{20.0, 3.0, 40.0});
+  REQUIRE(statistics.GetNumFrames() == 2);
+
+  auto average = statistics.GetAverage();
+  REQUIRE(average.m_frameTime == Approx(15.0));
+  REQUIRE(average.m_waitTime == Approx(2.0));
+  REQUIRE(average.m_latency == Approx(30.0));
+
+  auto maximum = statistics.GetMaximum();
+  REQUIRE(maximum.m_frameTime == Approx(20.0));
+  REQUIRE(maximum.m_waitTime == Approx(3.0));
+  REQUIRE(maximum.m_latency == Approx(40.0));
+
+  REQUIRE(statistics.GetFramesPerSecond() == Approx(1000.0 / 15.0));
+}
+
+TEST_CASE("Frame statistics only keep the most recent frames", "[frame_statistics]")
+{
+  FrameStatistics statistics{3};
+  statistics.AddFrame(FrameTiming{100.0, 0.0, 0.0});
+  for (int i = 0; i < 3; ++i) { statistics.AddFrame(FrameTiming{10.0, 0.0, 0.0}); }
+
+  REQUIRE(statistics.GetNumFrames() == 3);
+  REQUIRE(statistics.GetAverage().m_frameTime == Approx(10.0));
+  REQUIRE(statistics.GetMaximum().m_frameTime == Approx(10.0));
+
+  statistics.Clear();
+  REQUIRE(statistics.GetNumFrames() == 0);
+  REQUIRE(statistics.GetAverage().m_frameTime == 0.0);
+}
+
+TEST_CASE("Frame time percentiles find stutter", "[frame_statistics]")
+{
+  FrameStatistics statistics{100};
+  for (int i = 0; i < 99; ++i) { statistics.AddFrame(FrameTiming{16.0, 0.0, 0.0}); }
+  statistics.AddFrame(FrameTiming{50.0, 0.0, 0.0});
+
+  REQUIRE(statistics.GetFrameTimePercentile(0.5) == Approx(16.0));
+  REQUIRE(statistics.GetFrameTimePercentile(0.99) == Approx(16.0));
+  REQUIRE(statistics.GetFrameTimePercentile(1.0) == Approx(50.0));
+  REQUIRE(statistics.GetFrameTimePercentile(0.0) == Approx(16.0));
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include "vkfw_glsl_preprocessor/shader_preprocess.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  struct TemporaryDirectory
+  {
+    TemporaryDirectory()
+        : m_path{std::filesystem::temp_directory_path()
+                 / ("vkfw_glsl_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))}
+    {
+      std::filesystem::create_directories(m_path);
+    }
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+    TemporaryDirectory(TemporaryDirectory&&) = delete;
+    TemporaryDirectory& operator=(TemporaryDirectory&&) = delete;
+    ~TemporaryDirectory() { std::filesystem::remove_all(m_path); }
+
+    [[nodiscard]] std::filesystem::path Write(const std::string& filename, const std::string& content) const
+    {
+      auto path = m_path / filename;
+      std::ofstream{path} << content;
+      return path;
+    }
+
+    std::filesystem::path m_path;
+  };
+
+  /** Returns the part of the processed shader between the n-th occurrence of begin and the following end. */
+  std::string Extract(const std::string& shader, const std::string& begin, const std::string& end, std::size_t n)
+  {
+    std::size_t position = 0;
+    for (std::size_t i = 0; i <= n; ++i) {
+      position = shader.find(begin, i == 0 ? 0 : position + 1);
+      if (position == std::string::npos) { return {}; }
+    }
+    const auto endPosition = shader.find(end, position);
+    if (endPosition == std::string::npos) { return {}; }
+    return shader.substr(position, endPosition - position);
+  }
+}
+
+TEST_CASE("Include directives are parsed with whitespace and both delimiters", "[glsl_preprocess]")
+{
+  using vkfw_glsl::parse_include;
+  REQUIRE(parse_include("#include \"common.glsl\"") == "common.glsl");
+  REQUIRE(parse_include("#include <common.glsl>") == "common.glsl");
+  REQUIRE(parse_include("\t#include\t\"dir/common.glsl\"") == "dir/common.glsl");
+  REQUIRE(parse_include("#  include <common.glsl>") == "common.glsl");
+  REQUIRE(parse_include("  # \t include \"common.glsl\"") == "common.glsl");
+  REQUIRE(parse_include("#include \"common.glsl\" // shared definitions") == "common.glsl");
+  REQUIRE(parse_include("#include <common.glsl> /* shared definitions */") == "common.glsl");
+  REQUIRE(parse_include("#include \"a>b.glsl\"") == "a>b.glsl");
+  REQUIRE(parse_include("#include <a\"b.glsl>") == "a\"b.glsl");
+}
+
+TEST_CASE("Lines without include directives are not parsed as includes", "[glsl_preprocess]")
+{
+  using vkfw_glsl::parse_include;
+  REQUIRE_FALSE(parse_include(""));
+  REQUIRE_FALSE(parse_include("#version 460"));
+  REQUIRE_FALSE(parse_include("#define INCLUDE_LIGHTS 1"));
+  REQUIRE_FALSE(parse_include("#extension GL_GOOGLE_include_directive : require"));
+  REQUIRE_FALSE(parse_include("#included \"common.glsl\""));
+  REQUIRE_FALSE(parse_include("#include\"common.glsl\""));
+  REQUIRE_FALSE(parse_include("#include common.glsl"));
+  REQUIRE_FALSE(parse_include("#include \"common.glsl"));
+  REQUIRE_FALSE(parse_include("#include <common.glsl"));
+  REQUIRE_FALSE(parse_include("// #include \"common.glsl\""));
+  REQUIRE_FALSE(parse_include("include \"common.glsl\""));
+}
+
+TEST_CASE("Headers included twice produce identical output", "[glsl_preprocess]")
+{
+  TemporaryDirectory directory;
+  const auto header = directory.Write("header.glsl", "float header_value = 1.0;\n");
+  const auto shader = directory.Write("shader.comp", "#version 460\n#include \"header.glsl\"\n"
+                                                     "#include <header.glsl>\nvoid main() {}\n");
+
+  vkfw_glsl::shader_processor processor{{directory.m_path}};
+  const auto processed = processor.process_shader(shader);
+
+  const auto headerLine = "#line 1 \"" + header.string() + "\"\n";
+  const auto first = Extract(processed, headerLine, "#line 3", 0);
+  const auto second = Extract(processed, headerLine, "#line 4", 1);
+  REQUIRE_FALSE(first.empty());
+  REQUIRE(first.find("float header_value = 1.0;") != std::string::npos);
+  REQUIRE(first == second);
+  REQUIRE(processed == vkfw_glsl::shader_processor{{directory.m_path}}.process_shader(shader));
+  REQUIRE(processed == processor.process_shader(shader));
+}
+
+TEST_CASE("Nested includes are listed once in the dependencies", "[glsl_preprocess]")
+{
+  TemporaryDirectory directory;
+  const auto common = directory.Write("common.glsl", "const float pi = 3.14159;\n");
+  const auto lighting = directory.Write("lighting.glsl", "#include \"common.glsl\"\nfloat light() { return pi; }\n");
+  const auto shading = directory.Write("shading.glsl", "#include \"common.glsl\"\n#include \"lighting.glsl\"\n");
+  const auto shader = directory.Write("shader.frag", "#version 460\n#include \"lighting.glsl\"\n"
+                                                     "#include \"shading.glsl\"\n#include \"common.glsl\"\n"
+                                                     "void main() {}\n");
+
+  vkfw_glsl::shader_processor processor{{directory.m_path}};
+  std::vector<std::filesystem::path> dependencies;
+  static_cast<void>(processor.process_shader(shader, dependencies));
+  REQUIRE(dependencies == std::vector<std::filesystem::path>{lighting, common, shading});
+
+  std::vector<std::filesystem::path> headerDependencies;
+  static_cast<void>(processor.process_shader(shading, headerDependencies));
+  REQUIRE(headerDependencies == std::vector<std::filesystem::path>{common, lighting});
+}
+
+TEST_CASE("Dependency rules escape paths for Makefiles and Ninja", "[glsl_preprocess]")
+{
+  REQUIRE(vkfw_glsl::escape_dependency_path("dir/file.glsl") == "dir/file.glsl");
+  REQUIRE(vkfw_glsl::escape_dependency_path("my shaders/file.glsl") == "my\\ shaders/file.glsl");
+  REQUIRE(vkfw_glsl::escape_dependency_path("shaders#1/$file.glsl") == "shaders\\#1/$$file.glsl");
+
+  const auto root = std::filesystem::temp_directory_path() / "vkfw";
+  const auto input = root / "my shaders" / "shader.frag";
+  const auto header = root / "lib#1" / "$common.glsl";
+  const auto rootName = vkfw_glsl::escape_dependency_path(root);
+  const auto rule = vkfw_glsl::make_dependency_rule("out dir/shader.frag", input, {header});
+  REQUIRE(rule
+          == "out\\ dir/shader.frag: " + rootName + "/my\\ shaders/shader.frag \\\n  " + rootName
+                 + "/lib\\#1/$$common.glsl\n");
+  REQUIRE(vkfw_glsl::make_dependency_rule("shader.frag", input, {}).ends_with("shader.frag\n"));
+}
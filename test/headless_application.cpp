@@ -0,0 +1,78 @@
+#undef VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL
+// NOLINTNEXTLINE
+#define VULKAN_HPP_ENABLE_DYNAMIC_LOADER_TOOL 1
+
+#include "headless_application.h"
+
+#include <catch2/catch.hpp>
+#include <cereal/archives/xml.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace vkfw_test {
+
+  std::string FindVulkanDeviceProblem()
+  {
+    try {
+      vk::DynamicLoader loader;
+      VULKAN_HPP_DEFAULT_DISPATCHER.init(loader.getProcAddress<PFN_vkGetInstanceProcAddr>("vkGetInstanceProcAddr"));
+#ifndef NDEBUG
+      // debug builds always enable the validation layers.
+      const auto layers = vk::enumerateInstanceLayerProperties();
+      if (std::none_of(layers.begin(), layers.end(), [](const vk::LayerProperties& layer) {
+            return std::strcmp(&layer.layerName[0], "VK_LAYER_KHRONOS_validation") == 0;
+          })) {
+        return "the validation layers are not installed";
+      }
+#endif
+      vk::ApplicationInfo appInfo{"vkfw_tests", 1, "vkfw_tests", 1, VK_API_VERSION_1_2};
+      auto instance = vk::createInstanceUnique(vk::InstanceCreateInfo{vk::InstanceCreateFlags{}, &appInfo});
+      VULKAN_HPP_DEFAULT_DISPATCHER.init(*instance);
+      if (instance->enumeratePhysicalDevices().empty()) { return "no Vulkan ICD is installed"; }
+    } catch (const std::exception& e) {
+      return e.what();
+    }
+    return {};
+  }
+
+  HeadlessApplication::HeadlessApplication(const std::string& configFileName)
+      : ApplicationBase{"vkfw_tests", 1, configFileName}
+  {
+  }
+
+  std::unique_ptr<HeadlessApplication>
+  HeadlessApplication::Create(const std::function<void(vkfw_core::cfg::Configuration&)>& configure)
+  {
+    if (const auto problem = FindVulkanDeviceProblem(); !problem.empty()) {
+      WARN("Skipped, no Vulkan device can be used: " << problem);
+      return nullptr;
+    }
+
+    const auto tempDirectory = std::filesystem::temp_directory_path() / "vkfw_tests";
+    std::filesystem::create_directories(tempDirectory);
+
+    vkfw_core::cfg::Configuration config;
+    auto& windowConfig = config.m_windows[0];
+    windowConfig.m_windowTitle = "vkfw_tests";
+    windowConfig.m_headless = true;
+    windowConfig.m_windowWidth = 64;
+    windowConfig.m_windowHeight = 64;
+    windowConfig.m_queues[0].m_compute = true;
+    config.m_useValidationLayers = false;
+    config.m_resourceBase = VKFW_TEST_RESOURCES;
+    config.m_evalDirectory = tempDirectory.string();
+    config.m_shaderCacheDirectory.clear();
+    if (configure) { configure(config); }
+
+    const auto configFileName = (tempDirectory / "headless_application.xml").string();
+    {
+      std::ofstream configFile{configFileName};
+      cereal::XMLOutputArchive oa{configFile};
+      oa(cereal::make_nvp("configuration", config));
+    }
+    return std::make_unique<HeadlessApplication>(configFileName);
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "app/ApplicationBase.h"
+#include "app/Configuration.h"
+#include "app/VKWindow.h"
+#include "gfx/vk/LogicalDevice.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace vkfw_test {
+
+  /** Returns why no Vulkan device (e.g., lavapipe) can be used by the tests or an empty string if one can. */
+  std::string FindVulkanDeviceProblem();
+
+  /** Application with a single headless window, so tests can use its device and frames without a display. */
+  class HeadlessApplication final : public vkfw_core::ApplicationBase
+  {
+  public:
+    explicit HeadlessApplication(const std::string& configFileName);
+
+    /**
+     *  Creates the application with a 64x64 headless window whose queue has graphics, compute and transfer support.
+     *  Warns and returns nullptr if there is no Vulkan device, so the calling test can skip.
+     *  @param configure changes the configuration before the application is created.
+     */
+    [[nodiscard]] static std::unique_ptr<HeadlessApplication>
+    Create(const std::function<void(vkfw_core::cfg::Configuration&)>& configure = {});
+
+    [[nodiscard]] vkfw_core::VKWindow& GetHeadlessWindow() { return *GetWindow(0); }
+    [[nodiscard]] vkfw_core::gfx::LogicalDevice& GetDevice() { return GetWindow(0)->GetDevice(); }
+
+    bool HandleMouseApp(int, int, int, float, vkfw_core::VKWindow*) override { return false; }
+
+  protected:
+    void FrameMove(float, float, vkfw_core::VKWindow*) override {}
+    void RenderScene(vkfw_core::VKWindow*) override {}
+    void RenderGUI(vkfw_core::VKWindow*) override {}
+  };
+}
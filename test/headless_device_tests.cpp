@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+
+#include "headless_application.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+
+#include <algorithm>
+
+TEST_CASE("Headless devices submit command buffers without a display", "[headless][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& window = app->GetHeadlessWindow();
+  REQUIRE(window.IsHeadless());
+  REQUIRE_FALSE(window.IsClosing());
+
+  auto& device = app->GetDevice();
+  auto cmdBuffer = vkfw_core::gfx::CommandBuffer::beginSingleTimeSubmit(&device, "EmptyCmdBuffer", "Empty",
+                                                                        device.GetCommandPool(0));
+  auto submitPoint = vkfw_core::gfx::CommandBuffer::endSingleTimeSubmit(device.GetQueue(0, 0), cmdBuffer);
+  submitPoint.Wait(&device, vkfw_core::defaultFenceTimeout);
+  REQUIRE(submitPoint.IsReached(&device));
+}
+
+TEST_CASE("Headless frames are cleared and read back", "[headless][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& window = app->GetHeadlessWindow();
+  app->StartRun();
+  for (std::size_t frame = 0; frame < window.GetFramesInFlight() + 1; ++frame) { app->Step(); }
+
+  const auto pixels = window.ReadbackImage(window.GetCurrentlyRenderedImageIndex());
+  REQUIRE(pixels.size() == std::size_t{64} * 64 * 4);
+  // the frame is only cleared to opaque black.
+  for (std::size_t i = 0; i < pixels.size(); i += 4) {
+    REQUIRE(std::all_of(&pixels[i], &pixels[i + 3], [](std::uint8_t channel) { return channel == 0; }));
+    REQUIRE(pixels[i + 3] == 255);
+  }
+}
+
+TEST_CASE("Headless windows have an image for every frame in flight", "[headless][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create([](vkfw_core::cfg::Configuration& config) {
+    config.m_windows[0].m_framesInFlight = 5;
+  });
+  if (!app) { return; }
+
+  auto& window = app->GetHeadlessWindow();
+  REQUIRE(window.GetFramesInFlight() == 5);
+  REQUIRE(window.GetFramebuffers().size() >= window.GetFramesInFlight());
+
+  app->StartRun();
+  for (std::size_t frame = 0; frame < 2 * window.GetFramesInFlight(); ++frame) {
+    app->Step();
+    REQUIRE(window.GetCurrentlyRenderedImageIndex() < window.GetFramebuffers().size());
+  }
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+
+#include "core/job_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+using vkfw_core::JobPool;
+
+TEST_CASE("Job pool runs each job once and returns its result", "[job_pool]")
+{
+  JobPool pool{4};
+  REQUIRE(pool.GetNumThreads() == 4);
+
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.Submit([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) { REQUIRE(results[static_cast<std::size_t>(i)].get() == i * i); }
+}
+
+TEST_CASE("Job pool runs jobs off the calling thread", "[job_pool]")
+{
+  JobPool pool{0};
+  REQUIRE(pool.GetNumThreads() == 1);
+
+  auto jobThread = pool.Submit([]() { return std::this_thread::get_id(); }).get();
+  REQUIRE(jobThread != std::this_thread::get_id());
+}
+
+TEST_CASE("Job pool stores exceptions in the future", "[job_pool]")
+{
+  JobPool pool{2};
+  auto failed = pool.Submit([]() -> std::string { throw std::runtime_error("job failed"); });
+  REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+
+  // the pool is still usable after a failed job.
+  REQUIRE(pool.Submit([]() { return std::string{"done"}; }).get() == "done");
+}
+
+TEST_CASE("Job pool waits until all jobs finished", "[job_pool]")
+{
+  JobPool pool{3};
+  std::atomic_int finished = 0;
+  for (int i = 0; i < 20; ++i) {
+    static_cast<void>(pool.Submit([&finished]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      finished += 1;
+    }));
+  }
+  pool.WaitIdle();
+  REQUIRE(finished == 20);
+  REQUIRE(pool.GetNumQueuedJobs() == 0);
+}
+
+TEST_CASE("Job pool drops jobs that did not start on destruction", "[job_pool]")
+{
+  std::future<void> blocker;
+  std::future<void> dropped;
+  std::promise<void> release;
+  std::thread releaser;
+  {
+    JobPool pool{1};
+    blocker = pool.Submit([future = release.get_future()]() mutable { future.wait(); });
+    dropped = pool.Submit([]() {});
+    while (pool.GetNumQueuedJobs() != 1) { std::this_thread::yield(); }
+    // the destructor drops the queued job first, then joins the running one.
+    releaser = std::thread{[&release]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      release.set_value();
+    }};
+  }
+  releaser.join();
+  REQUIRE_NOTHROW(blocker.get());
+  REQUIRE_THROWS_AS(dropped.get(), std::future_error);
+}
+
+TEST_CASE("Job pool starts jobs by priority and in submission order", "[job_pool]")
+{
+  JobPool pool{1};
+  std::promise<void> release;
+  auto blocker = pool.Submit([future = release.get_future()]() mutable { future.wait(); });
+  while (pool.GetNumQueuedJobs() != 0) { std::this_thread::yield(); }
+
+  std::mutex orderMutex;
+  std::vector<std::string> order;
+  auto record = [&orderMutex, &order](std::string name) {
+    return [&orderMutex, &order, name = std::move(name)]() {
+      const std::scoped_lock lock{orderMutex};
+      order.push_back(name);
+    };
+  };
+  static_cast<void>(pool.Submit(record("low"), vkfw_core::JobPriority::LOW));
+  static_cast<void>(pool.Submit(record("normal0")));
+  static_cast<void>(pool.Submit(record("high"), vkfw_core::JobPriority::HIGH));
+  static_cast<void>(pool.Submit(record("normal1")));
+  release.set_value();
+  pool.WaitIdle();
+
+  REQUIRE(order == std::vector<std::string>{"high", "normal0", "normal1", "low"});
+}
+
+TEST_CASE("Job pool drops jobs stopped before they start", "[job_pool]")
+{
+  JobPool pool{1};
+  std::promise<void> release;
+  auto blocker = pool.Submit([future = release.get_future()]() mutable { future.wait(); });
+
+  std::stop_source stop;
+  std::atomic_bool ran = false;
+  auto stopped = pool.Submit([&ran]() { ran = true; }, vkfw_core::JobPriority::NORMAL, stop.get_token());
+  auto kept = pool.Submit([]() { return 42; });
+  stop.request_stop();
+  release.set_value();
+
+  REQUIRE_THROWS_AS(stopped.get(), std::future_error);
+  REQUIRE(kept.get() == 42);
+  pool.WaitIdle();
+  REQUIRE(!ran);
+}
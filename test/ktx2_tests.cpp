@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+
+#include "core/block_compression.h"
+#include "core/ktx2.h"
+#include "core/mipmap.h"
+
+#include <array>
+
+using vkfw_core::BlockFormat;
+using vkfw_core::Ktx2Header;
+
+namespace {
+
+  constexpr std::uint32_t VK_FORMAT_R8G8B8A8_UNORM = 37;
+  constexpr std::uint32_t VK_FORMAT_BC7_SRGB_BLOCK = 146;
+
+  std::uint32_t ReadUInt32(const std::vector<std::byte>& file, std::size_t offset)
+  {
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < 4; ++i) { value |= static_cast<std::uint32_t>(file[offset + i]) << (8 * i); }
+    return value;
+  }
+}
+
+TEST_CASE("KTX2 files round trip a compressed mip chain", "[ktx2]")
+{
+  constexpr std::uint32_t size = 32;
+  std::vector<std::uint8_t> baseLevel(size * size * 4);
+  for (std::size_t i = 0; i < baseLevel.size(); ++i) { baseLevel[i] = static_cast<std::uint8_t>(i * 7); }
+
+  std::vector<std::vector<std::uint8_t>> levels;
+  levels.push_back(vkfw_core::CompressBlocks(BlockFormat::BC7, baseLevel, size, size));
+  for (const auto& level : vkfw_core::GenerateMipmaps(baseLevel, size, size, 4, vkfw_core::MipmapOptions{})) {
+    levels.push_back(vkfw_core::CompressBlocks(BlockFormat::BC7, level.m_data, level.m_width, level.m_height));
+  }
+  REQUIRE(levels.size() == 6);
+
+  std::vector<std::span<const std::byte>> levelData;
+  for (const auto& level : levels) { levelData.push_back(std::as_bytes(std::span{level})); }
+
+  Ktx2Header header;
+  header.m_vkFormat = VK_FORMAT_BC7_SRGB_BLOCK;
+  header.m_pixelWidth = size;
+  header.m_pixelHeight = size;
+  const auto file = vkfw_core::WriteKtx2(header, levelData);
+  REQUIRE(vkfw_core::IsKtx2(file));
+
+  const auto image = vkfw_core::ParseKtx2(file);
+  REQUIRE(image.m_header.m_vkFormat == VK_FORMAT_BC7_SRGB_BLOCK);
+  REQUIRE(image.m_header.m_pixelWidth == size);
+  REQUIRE(image.m_header.m_pixelHeight == size);
+  REQUIRE(image.m_header.m_levelCount == levels.size());
+  REQUIRE(image.m_levels.size() == levels.size());
+  for (std::size_t level = 0; level < levels.size(); ++level) {
+    const auto levelSize = vkfw_core::GetMipLevelSize(size, static_cast<std::uint32_t>(level));
+    REQUIRE(image.m_levels[level].size() == vkfw_core::GetCompressedSize(BlockFormat::BC7, levelSize, levelSize));
+    REQUIRE(std::equal(image.m_levels[level].begin(), image.m_levels[level].end(), levelData[level].begin()));
+    // levels are aligned to the block size and stored from the smallest to the largest.
+    const auto offset = static_cast<std::size_t>(image.m_levels[level].data() - file.data());
+    REQUIRE(offset % 16 == 0);
+    if (level > 0) { REQUIRE(offset < static_cast<std::size_t>(image.m_levels[level - 1].data() - file.data())); }
+  }
+}
+
+TEST_CASE("KTX2 data format descriptors describe the format", "[ktx2]")
+{
+  const std::array<std::uint8_t, 16> texels{};
+  const std::array<std::span<const std::byte>, 1> levels{std::as_bytes(std::span{texels})};
+  Ktx2Header header;
+  header.m_vkFormat = VK_FORMAT_R8G8B8A8_UNORM;
+  header.m_pixelWidth = 2;
+  header.m_pixelHeight = 2;
+  const auto file = vkfw_core::WriteKtx2(header, levels);
+
+  const auto dfdOffset = ReadUInt32(file, 48);
+  const auto dfdLength = ReadUInt32(file, 52);
+  // total size, the basic block header and four samples.
+  REQUIRE(dfdLength == 4 + 24 + 4 * 16);
+  REQUIRE(ReadUInt32(file, dfdOffset) == dfdLength);
+  // RGBSDA color model, BT709 primaries and linear transfer.
+  REQUIRE(ReadUInt32(file, dfdOffset + 12) == 0x00010101U);
+  // 4 bytes per texel in plane 0.
+  REQUIRE(ReadUInt32(file, dfdOffset + 20) == 4);
+  // the alpha sample is channel 15 at bit 24.
+  REQUIRE(ReadUInt32(file, dfdOffset + 28 + 3 * 16) == ((15U << 24) | (7U << 16) | 24U));
+
+  header.m_vkFormat = 1000;
+  REQUIRE_THROWS_AS(vkfw_core::WriteKtx2(header, levels), std::runtime_error);
+}
+
+TEST_CASE("Invalid KTX2 files are rejected", "[ktx2]")
+{
+  const std::array<std::uint8_t, 16> texels{};
+  const std::array<std::span<const std::byte>, 1> levels{std::as_bytes(std::span{texels})};
+  Ktx2Header header;
+  header.m_vkFormat = VK_FORMAT_R8G8B8A8_UNORM;
+  header.m_pixelWidth = 2;
+  header.m_pixelHeight = 2;
+  const auto file = vkfw_core::WriteKtx2(header, levels);
+
+  auto corrupted = file;
+  corrupted[1] = std::byte{0};
+  REQUIRE_FALSE(vkfw_core::IsKtx2(corrupted));
+  REQUIRE_THROWS_AS(vkfw_core::ParseKtx2(corrupted), std::runtime_error);
+
+  REQUIRE_THROWS_AS(vkfw_core::ParseKtx2(std::span{file}.first(60)), std::runtime_error);
+
+  auto supercompressed = file;
+  supercompressed[44] = std::byte{2};
+  REQUIRE_THROWS_AS(vkfw_core::ParseKtx2(supercompressed), std::runtime_error);
+
+  // the level data points behind the end of the file.
+  auto truncated = std::vector<std::byte>(file.begin(), file.end() - 1);
+  REQUIRE_THROWS_AS(vkfw_core::ParseKtx2(truncated), std::runtime_error);
+}
@@ -0,0 +1,166 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/meshes/MeshBinaryFile.h"
+#include "gfx/meshes/MeshInfo.h"
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+#include <fstream>
+#include <random>
+
+using vkfw_core::gfx::MeshBinaryFile;
+using vkfw_core::gfx::MeshInfo;
+
+namespace {
+
+  class TestMeshInfo : public MeshInfo
+  {
+  public:
+    explicit TestMeshInfo(unsigned int numVertices)
+    {
+      std::mt19937 rng{42};
+      std::uniform_real_distribution<float> value{-1.0f, 1.0f};
+
+      const auto numIndices = numVertices * 3;
+      ReserveMesh<vkfw_core::gfx::PhongBumpMaterialInfo>(2, 1, true, numVertices, numIndices, 2);
+      for (std::size_t i = 0; i < numVertices; ++i) {
+        GetVertices()[i] = glm::vec3{value(rng), value(rng), value(rng)};
+        GetNormals()[i] = glm::vec3{value(rng), value(rng), value(rng)};
+        GetTangents()[i] = glm::vec3{value(rng), value(rng), value(rng)};
+        GetBinormals()[i] = glm::vec3{value(rng), value(rng), value(rng)};
+        GetTexCoords()[0][i] = glm::vec3{value(rng), value(rng), 0.0f};
+        GetTexCoords()[1][i] = glm::vec3{value(rng), value(rng), 0.0f};
+        GetColors()[0][i] = glm::vec4{value(rng), value(rng), value(rng), 1.0f};
+      }
+      for (std::size_t i = 0; i < numIndices; ++i) { GetIndices()[i] = static_cast<std::uint32_t>(i % numVertices); }
+      AddSubMesh("first", 0, numIndices / 2, 0);
+      AddSubMesh("second", numIndices / 2, numIndices - numIndices / 2, 1);
+    }
+  };
+
+  struct TempSourceFile
+  {
+    explicit TempSourceFile(const std::string& name)
+        : m_filename{std::filesystem::temp_directory_path() / name}
+    {
+      std::ofstream{m_filename} << "mesh source " << name;
+    }
+    ~TempSourceFile()
+    {
+      std::filesystem::remove(m_filename);
+      std::filesystem::remove(MeshBinaryFile::GetBinaryFilename(m_filename));
+    }
+    TempSourceFile(const TempSourceFile&) = delete;
+    TempSourceFile& operator=(const TempSourceFile&) = delete;
+
+    std::filesystem::path m_filename;
+  };
+
+  template<typename T> bool Equal(std::span<const T> lhs, std::span<const T> rhs)
+  {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+}
+
+TEST_CASE("Mesh binary files are mapped and round trip", "[mesh][vkbin]")
+{
+  TempSourceFile source{"vkfw_mesh_binary_roundtrip.obj"};
+  TestMeshInfo mesh{1000};
+  MeshBinaryFile::Write(mesh, source.m_filename);
+
+  MeshInfo loaded;
+  REQUIRE(MeshBinaryFile::Read(loaded, source.m_filename));
+
+  REQUIRE(Equal(loaded.GetVertices(), mesh.GetVertices()));
+  REQUIRE(Equal(loaded.GetNormals(), mesh.GetNormals()));
+  REQUIRE(Equal(loaded.GetTangents(), mesh.GetTangents()));
+  REQUIRE(Equal(loaded.GetBinormals(), mesh.GetBinormals()));
+  REQUIRE(Equal(loaded.GetIndices(), mesh.GetIndices()));
+  REQUIRE(loaded.GetTexCoords().size() == 2);
+  REQUIRE(Equal(loaded.GetTexCoords()[1].View(), mesh.GetTexCoords()[1].View()));
+  REQUIRE(loaded.GetColors().size() == 1);
+  REQUIRE(Equal(loaded.GetColors()[0].View(), mesh.GetColors()[0].View()));
+  REQUIRE(loaded.GetMaterials().size() == 2);
+  REQUIRE(loaded.GetSubMeshes().size() == 2);
+  REQUIRE(loaded.GetSubMeshes()[1].GetNumberOfIndices() == mesh.GetSubMeshes()[1].GetNumberOfIndices());
+
+  // the data is a view into the file, not a copy.
+  REQUIRE(loaded.GetTexCoords()[0].IsMapped());
+  REQUIRE(reinterpret_cast<std::uintptr_t>(loaded.GetVertices().data()) % MeshBinaryFile::SECTION_ALIGNMENT == 0);
+}
+
+TEST_CASE("Mesh binary files are invalidated by source changes", "[mesh][vkbin]")
+{
+  TempSourceFile source{"vkfw_mesh_binary_invalidate.obj"};
+  TestMeshInfo mesh{10};
+  MeshBinaryFile::Write(mesh, source.m_filename);
+
+  SECTION("touching the source keeps the file valid")
+  {
+    std::filesystem::last_write_time(source.m_filename,
+                                     std::filesystem::last_write_time(source.m_filename) + std::chrono::hours{1});
+    MeshInfo loaded;
+    REQUIRE(MeshBinaryFile::Read(loaded, source.m_filename));
+
+    // the new timestamp is stored, so a same sized change keeping it is not hashed again.
+    auto touchedTime = std::filesystem::last_write_time(source.m_filename);
+    std::ofstream{source.m_filename} << "MESH SOURCE vkfw_mesh_binary_invalidate.obj";
+    std::filesystem::last_write_time(source.m_filename, touchedTime);
+    MeshInfo reloaded;
+    REQUIRE(MeshBinaryFile::Read(reloaded, source.m_filename));
+  }
+
+  SECTION("changing the source content invalidates the file")
+  {
+    std::ofstream{source.m_filename} << "changed mesh source!";
+    MeshInfo loaded;
+    REQUIRE(!MeshBinaryFile::Read(loaded, source.m_filename));
+  }
+
+  SECTION("corrupted files are rejected")
+  {
+    {
+      std::fstream binary{MeshBinaryFile::GetBinaryFilename(source.m_filename),
+                          std::ios::binary | std::ios::in | std::ios::out};
+      binary.seekp(20);
+      binary.put('x');
+    }
+    MeshInfo loaded;
+    REQUIRE(!MeshBinaryFile::Read(loaded, source.m_filename));
+    REQUIRE(loaded.GetVertices().empty());
+  }
+}
+
+TEST_CASE("Mesh binary file benchmark", "[.][mesh][vkbin][benchmark]")
+{
+  TempSourceFile source{"vkfw_mesh_binary_benchmark.obj"};
+  TestMeshInfo mesh{1'000'000};
+  MeshBinaryFile::Write(mesh, source.m_filename);
+
+  auto cerealFilename = std::filesystem::temp_directory_path() / "vkfw_mesh_binary_benchmark.cereal";
+  {
+    std::ofstream out{cerealFilename, std::ios::binary};
+    cereal::BinaryOutputArchive oa{out};
+    oa(static_cast<const MeshInfo&>(mesh));
+  }
+
+  BENCHMARK("cereal BinaryInputArchive")
+  {
+    MeshInfo loaded;
+    std::ifstream in{cerealFilename, std::ios::binary};
+    cereal::BinaryInputArchive ia{in};
+    ia(loaded);
+    return loaded.GetVertices().size();
+  };
+
+  BENCHMARK("MeshBinaryFile (mapped)")
+  {
+    MeshInfo loaded;
+    MeshBinaryFile::Read(loaded, source.m_filename);
+    return loaded.GetVertices().size();
+  };
+
+  std::filesystem::remove(cerealFilename);
+}
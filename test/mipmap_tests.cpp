@@ -0,0 +1,154 @@
+#include <catch2/catch.hpp>
+
+#include "core/mipmap.h"
+
+#include <algorithm>
+#include <cmath>
+
+using vkfw_core::GenerateMipmaps;
+using vkfw_core::GetMipLevelCount;
+using vkfw_core::GetMipLevelSize;
+using vkfw_core::MipmapContent;
+using vkfw_core::MipmapFilter;
+using vkfw_core::MipmapOptions;
+
+TEST_CASE("Mip level count and sizes follow the Vulkan rules", "[mipmap]")
+{
+  REQUIRE(GetMipLevelCount(1, 1) == 1);
+  REQUIRE(GetMipLevelCount(256, 256) == 9);
+  REQUIRE(GetMipLevelCount(300, 17) == 9);
+  REQUIRE(GetMipLevelCount(1, 1024) == 11);
+
+  REQUIRE(GetMipLevelSize(300, 0) == 300);
+  REQUIRE(GetMipLevelSize(300, 3) == 37);
+  REQUIRE(GetMipLevelSize(17, 8) == 1);
+  REQUIRE(GetMipLevelSize(17, 40) == 1);
+}
+
+TEST_CASE("Box filter averages texels", "[mipmap]")
+{
+  const std::vector<float> base = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+  auto levels = GenerateMipmaps(base, 4, 2, 1, MipmapOptions{});
+  REQUIRE(levels.size() == 2);
+
+  REQUIRE(levels[0].m_width == 2);
+  REQUIRE(levels[0].m_height == 1);
+  REQUIRE(levels[0].m_data[0] == Approx(2.5f));
+  REQUIRE(levels[0].m_data[1] == Approx(4.5f));
+
+  REQUIRE(levels[1].m_width == 1);
+  REQUIRE(levels[1].m_height == 1);
+  REQUIRE(levels[1].m_data[0] == Approx(3.5f));
+}
+
+TEST_CASE("Box filter covers all texels of odd sized levels", "[mipmap]")
+{
+  const std::vector<float> base = {3.0f, 6.0f, 9.0f};
+  auto levels = GenerateMipmaps(base, 3, 1, 1, MipmapOptions{});
+  REQUIRE(levels.size() == 1);
+  REQUIRE(levels[0].m_data[0] == Approx(6.0f));
+}
+
+TEST_CASE("sRGB content is filtered in linear space", "[mipmap]")
+{
+  const std::vector<std::uint8_t> base = {0, 0, 0, 0, 255, 255, 255, 255};
+  MipmapOptions options;
+
+  auto naive = GenerateMipmaps(base, 2, 1, 4, options);
+  REQUIRE(naive[0].m_data[0] == 128);
+
+  options.m_content = MipmapContent::SRGB;
+  auto srgb = GenerateMipmaps(base, 2, 1, 4, options);
+  REQUIRE(srgb.size() == 1);
+  // half the linear intensity is 188 in sRGB, alpha stays linear.
+  REQUIRE(srgb[0].m_data[0] == 188);
+  REQUIRE(srgb[0].m_data[1] == 188);
+  REQUIRE(srgb[0].m_data[2] == 188);
+  REQUIRE(srgb[0].m_data[3] == 128);
+}
+
+TEST_CASE("Normal maps are renormalized after filtering", "[mipmap]")
+{
+  // (1, 0, 0) and (0, 0, 1) encoded to [0, 1].
+  const std::vector<float> base = {1.0f, 0.5f, 0.5f, 0.5f, 0.5f, 1.0f};
+  MipmapOptions options;
+  options.m_content = MipmapContent::NORMAL_MAP;
+
+  auto levels = GenerateMipmaps(base, 2, 1, 3, options);
+  REQUIRE(levels.size() == 1);
+  const auto& texel = levels[0].m_data;
+  const float x = texel[0] * 2.0f - 1.0f;
+  const float y = texel[1] * 2.0f - 1.0f;
+  const float z = texel[2] * 2.0f - 1.0f;
+  REQUIRE(std::sqrt(x * x + y * y + z * z) == Approx(1.0f));
+  REQUIRE(x == Approx(std::sqrt(0.5f)));
+  REQUIRE(y == Approx(0.0f).margin(1e-6));
+  REQUIRE(z == Approx(std::sqrt(0.5f)));
+
+  std::vector<std::uint8_t> base8(base.size());
+  std::transform(base.begin(), base.end(), base8.begin(),
+                 [](float value) { return static_cast<std::uint8_t>(value * 255.0f + 0.5f); });
+  auto levels8 = GenerateMipmaps(base8, 2, 1, 3, options);
+  REQUIRE(levels8[0].m_data[0] == 218);
+  REQUIRE(levels8[0].m_data[2] == 218);
+}
+
+TEST_CASE("Kaiser filter preserves constant images", "[mipmap]")
+{
+  constexpr std::uint32_t size = 16;
+  const std::vector<float> base(size * size * 2, 0.25f);
+  MipmapOptions options;
+  options.m_filter = MipmapFilter::KAISER;
+
+  for (bool wrap : {false, true}) {
+    options.m_wrap = wrap;
+    auto levels = GenerateMipmaps(base, size, size, 2, options);
+    REQUIRE(levels.size() == 4);
+    for (const auto& level : levels) {
+      REQUIRE(level.m_data.size() == std::size_t{level.m_width} * level.m_height * 2);
+      for (auto value : level.m_data) { REQUIRE(value == Approx(0.25f)); }
+    }
+  }
+}
+
+TEST_CASE("Kaiser filter keeps more detail than the box filter", "[mipmap]")
+{
+  // a cosine with a period of 8 texels is still representable in the next level.
+  constexpr std::uint32_t size = 64;
+  std::vector<float> base(size);
+  for (std::uint32_t i = 0; i < size; ++i) {
+    base[i] = std::cos(2.0f * 3.14159265f * (static_cast<float>(i) + 0.5f) / 8.0f);
+  }
+
+  MipmapOptions options;
+  options.m_wrap = true;
+  auto box = GenerateMipmaps(base, size, 1, 1, options);
+  options.m_filter = MipmapFilter::KAISER;
+  auto kaiser = GenerateMipmaps(base, size, 1, 1, options);
+  REQUIRE(box.size() == kaiser.size());
+
+  auto amplitude = [](const std::vector<float>& level) {
+    return *std::max_element(level.begin(), level.end(), [](float a, float b) { return std::abs(a) < std::abs(b); });
+  };
+  const auto boxAmplitude = std::abs(amplitude(box[0].m_data));
+  const auto kaiserAmplitude = std::abs(amplitude(kaiser[0].m_data));
+  // the next level samples the cosine at +-45 degrees, the box filter attenuates it by cos(22.5 degrees).
+  REQUIRE(boxAmplitude == Approx(std::cos(3.14159265f / 8.0f) * std::cos(3.14159265f / 4.0f)));
+  REQUIRE(kaiserAmplitude > boxAmplitude);
+  REQUIRE(kaiserAmplitude <= Approx(1.0f));
+}
+
+TEST_CASE("Wrapping uses the texels of the opposite border", "[mipmap]")
+{
+  const std::vector<float> base = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  MipmapOptions options;
+  options.m_filter = MipmapFilter::KAISER;
+
+  options.m_wrap = false;
+  auto clamped = GenerateMipmaps(base, 8, 1, 1, options);
+  options.m_wrap = true;
+  auto wrapped = GenerateMipmaps(base, 8, 1, 1, options);
+
+  // the last texel only sees the first one when wrapping.
+  REQUIRE(std::abs(clamped[0].m_data[3]) < std::abs(wrapped[0].m_data[3]));
+}
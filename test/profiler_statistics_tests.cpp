@@ -0,0 +1,122 @@
+#include <catch2/catch.hpp>
+
+#include "core/profiler_statistics.h"
+#include "gfx/vk/GPUProfiler.h"
+#include "gfx/vk/wrappers/CommandBuffer.h"
+#include "headless_application.h"
+
+#include <array>
+#include <sstream>
+
+using vkfw_core::ProfilerStatistics;
+
+TEST_CASE("Profiler statistics aggregate min, average and max per region", "[profiler]")
+{
+  ProfilerStatistics statistics;
+  statistics.AddSample("Frame", 0, 4.0);
+  statistics.AddSample("Frame/Shadows", 1, 1.0);
+  statistics.AddSample("Frame", 0, 2.0);
+  statistics.AddSample("Frame/Shadows", 1, 3.0);
+  statistics.AddSample("Frame", 0, 6.0);
+
+  REQUIRE(statistics.GetRegions().size() == 2);
+  // regions are kept in the order they were sampled first.
+  REQUIRE(statistics.GetRegions()[0].m_name == "Frame");
+  REQUIRE(statistics.GetRegions()[1].m_name == "Frame/Shadows");
+
+  const auto* frame = statistics.FindRegion("Frame");
+  REQUIRE(frame != nullptr);
+  REQUIRE(frame->m_depth == 0);
+  REQUIRE(frame->m_samples == 3);
+  REQUIRE(frame->m_minTime == Approx(2.0));
+  REQUIRE(frame->GetAverageTime() == Approx(4.0));
+  REQUIRE(frame->m_maxTime == Approx(6.0));
+
+  const auto* shadows = statistics.FindRegion("Frame/Shadows");
+  REQUIRE(shadows != nullptr);
+  REQUIRE(shadows->m_depth == 1);
+  REQUIRE(shadows->GetAverageTime() == Approx(2.0));
+
+  REQUIRE(statistics.FindRegion("Shadows") == nullptr);
+
+  statistics.Clear();
+  REQUIRE(statistics.GetRegions().empty());
+  REQUIRE(statistics.FindRegion("Frame") == nullptr);
+}
+
+TEST_CASE("Profiler statistics average counters of samples that have them", "[profiler]")
+{
+  ProfilerStatistics statistics{{"vertices", "fragments"}};
+  const std::array<std::uint64_t, 2> counters0{100, 1000};
+  const std::array<std::uint64_t, 2> counters1{300, 3000};
+  statistics.AddSample("Pass", 0, 1.0, counters0);
+  statistics.AddSample("Pass", 0, 1.0, counters1);
+  // samples without counters (e.g., nested regions) do not change the counter averages.
+  statistics.AddSample("Pass", 0, 1.0);
+
+  const auto* pass = statistics.FindRegion("Pass");
+  REQUIRE(pass != nullptr);
+  REQUIRE(pass->m_samples == 3);
+  REQUIRE(pass->m_counterSamples == 2);
+  REQUIRE(pass->GetAverageCounter(0) == Approx(200.0));
+  REQUIRE(pass->GetAverageCounter(1) == Approx(2000.0));
+}
+
+TEST_CASE("Profiler statistics are written as CSV", "[profiler]")
+{
+  ProfilerStatistics statistics{{"vertices"}};
+  const std::array<std::uint64_t, 1> counters{42};
+  statistics.AddSample("Frame", 0, 1.5, counters);
+  statistics.AddSample("Frame/Blur", 1, 0.5);
+
+  std::stringstream csv;
+  statistics.WriteCSV(csv);
+
+  std::string line;
+  REQUIRE(std::getline(csv, line));
+  REQUIRE(line == "region,depth,samples,min_ms,avg_ms,max_ms,vertices");
+  REQUIRE(std::getline(csv, line));
+  REQUIRE(line == "\"Frame\",0,1,1.5,1.5,1.5,42");
+  REQUIRE(std::getline(csv, line));
+  REQUIRE(line == "\"Frame/Blur\",1,1,0.5,0.5,0.5,0");
+  REQUIRE_FALSE(std::getline(csv, line));
+}
+
+TEST_CASE("GPU profiler reads back timestamps of a frame slot without waiting", "[profiler][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  vkfw_core::gfx::GPUProfiler profiler{&device, "TestProfiler", 2, device.GetQueueInfo(0).m_familyIndex, 8};
+  if (!profiler.HasTimestamps()) {
+    WARN("Skipped, the queue family does not support timestamps.");
+    return;
+  }
+  REQUIRE_FALSE(profiler.Resolve(0));
+
+  profiler.BeginRecording(0);
+  auto cmdBuffer = vkfw_core::gfx::CommandBuffer::beginSingleTimeSubmit(&device, "ProfilerCmdBuffer", "Profiler",
+                                                                        device.GetCommandPool(0));
+  {
+    GPU_PROFILER_REGION(profiler, cmdBuffer, "Frame");
+    GPU_PROFILER_REGION(profiler, cmdBuffer, "Inner");
+  }
+  // the queries are reset but not written before the command buffer is executed.
+  REQUIRE_FALSE(profiler.Resolve(0));
+
+  vkfw_core::gfx::CommandBuffer::endSingleTimeSubmitAndWait(&device, device.GetQueue(0, 0), cmdBuffer);
+  REQUIRE(profiler.Resolve(0));
+  const auto* frame = profiler.GetStatistics().FindRegion("Frame");
+  const auto* inner = profiler.GetStatistics().FindRegion("Frame/Inner");
+  REQUIRE(frame != nullptr);
+  REQUIRE(inner != nullptr);
+  REQUIRE(frame->m_samples == 1);
+  REQUIRE(inner->m_depth == 1);
+  REQUIRE(frame->m_minTime >= inner->m_minTime);
+
+  // the slot is reset after resolving and the other slot was never recorded.
+  REQUIRE_FALSE(profiler.Resolve(0));
+  REQUIRE_FALSE(profiler.Resolve(1));
+  REQUIRE(profiler.GetStatistics().FindRegion("Frame")->m_samples == 1);
+}
@@ -0,0 +1,37 @@
+#include <catch2/catch.hpp>
+
+#include "core/radix_sort.h"
+
+#include <algorithm>
+#include <random>
+
+TEST_CASE("Radix sort orders keys and permutes values", "[sort]")
+{
+  std::mt19937_64 rng{42};
+  std::vector<std::uint64_t> keys(1000);
+  std::vector<std::uint32_t> values(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = rng();
+    values[i] = static_cast<std::uint32_t>(i);
+  }
+  auto original = keys;
+
+  std::vector<std::uint64_t> keysScratch;
+  std::vector<std::uint32_t> valuesScratch;
+  vkfw_core::RadixSort(keys, values, keysScratch, valuesScratch);
+
+  REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+  for (std::size_t i = 0; i < keys.size(); ++i) { REQUIRE(original[values[i]] == keys[i]); }
+}
+
+TEST_CASE("Radix sort is stable", "[sort]")
+{
+  std::vector<std::uint64_t> keys{3, 1ULL << 40, 3, 1, 1ULL << 40, 1};
+  std::vector<std::uint32_t> values{0, 1, 2, 3, 4, 5};
+  std::vector<std::uint64_t> keysScratch;
+  std::vector<std::uint32_t> valuesScratch;
+  vkfw_core::RadixSort(keys, values, keysScratch, valuesScratch);
+
+  REQUIRE(keys == std::vector<std::uint64_t>{1, 1, 3, 3, 1ULL << 40, 1ULL << 40});
+  REQUIRE(values == std::vector<std::uint32_t>{3, 5, 0, 2, 1, 4});
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/vk/memory/RangeAllocator.h"
+
+using vkfw_core::gfx::RangeAllocationType;
+using vkfw_core::gfx::RangeAllocator;
+
+TEST_CASE("Range allocator honors alignment", "[memory]")
+{
+  RangeAllocator allocator{1024, 1};
+  auto first = allocator.Allocate(10, 1, RangeAllocationType::Linear);
+  auto second = allocator.Allocate(16, 64, RangeAllocationType::Linear);
+  REQUIRE(first.has_value());
+  REQUIRE(second.has_value());
+  REQUIRE(*first == 0);
+  REQUIRE(*second == 64);
+  REQUIRE(allocator.GetUsedBytes() == 26);
+  REQUIRE(allocator.CheckConsistency());
+}
+
+TEST_CASE("Range allocator uses the best fitting free range", "[memory]")
+{
+  RangeAllocator allocator{1024, 1};
+  auto a = allocator.Allocate(256, 1, RangeAllocationType::Linear);
+  auto b = allocator.Allocate(64, 1, RangeAllocationType::Linear);
+  auto c = allocator.Allocate(128, 1, RangeAllocationType::Linear);
+  auto d = allocator.Allocate(64, 1, RangeAllocationType::Linear);
+  REQUIRE((a && b && c && d));
+  allocator.Free(*a);
+  allocator.Free(*c);
+
+  auto e = allocator.Allocate(100, 1, RangeAllocationType::Linear);
+  REQUIRE(e.has_value());
+  REQUIRE(*e == *c);
+  REQUIRE(allocator.CheckConsistency());
+}
+
+TEST_CASE("Range allocator coalesces freed ranges", "[memory]")
+{
+  RangeAllocator allocator{1024, 1};
+  auto a = allocator.Allocate(256, 1, RangeAllocationType::Linear);
+  auto b = allocator.Allocate(256, 1, RangeAllocationType::Linear);
+  auto c = allocator.Allocate(256, 1, RangeAllocationType::Linear);
+  REQUIRE((a && b && c));
+  REQUIRE(allocator.GetLargestFreeRange() == 256);
+
+  allocator.Free(*a);
+  allocator.Free(*c);
+  REQUIRE(allocator.GetStatistics().m_freeRangeCount == 2);
+  allocator.Free(*b);
+
+  auto stats = allocator.GetStatistics();
+  REQUIRE(allocator.IsEmpty());
+  REQUIRE(stats.m_freeRangeCount == 1);
+  REQUIRE(stats.m_largestFreeRange == 1024);
+  REQUIRE(allocator.CheckConsistency());
+  REQUIRE_FALSE(allocator.Allocate(2048, 1, RangeAllocationType::Linear).has_value());
+}
+
+TEST_CASE("Range allocator separates linear and optimal resources by granularity", "[memory]")
+{
+  RangeAllocator allocator{4096, 1024};
+  auto buffer = allocator.Allocate(100, 16, RangeAllocationType::Linear);
+  auto image = allocator.Allocate(100, 16, RangeAllocationType::Optimal);
+  auto sameTypeBuffer = allocator.Allocate(100, 16, RangeAllocationType::Linear);
+  auto sameTypeImage = allocator.Allocate(100, 16, RangeAllocationType::Optimal);
+  auto largeBuffer = allocator.Allocate(900, 16, RangeAllocationType::Linear);
+  REQUIRE((buffer && image && sameTypeBuffer && sameTypeImage && largeBuffer));
+  REQUIRE(*buffer == 0);
+  REQUIRE(*image == 1024);
+  REQUIRE(*sameTypeBuffer == 112);
+  REQUIRE(*sameTypeImage == 1136);
+  REQUIRE(*largeBuffer == 2048);
+  REQUIRE(allocator.CheckConsistency());
+
+  auto stats = allocator.GetStatistics();
+  REQUIRE(stats.m_allocationCount == 5);
+  REQUIRE(stats.m_usedBytes == 1300);
+  REQUIRE(stats.m_freeBytes == 4096 - 1300);
+}
+
+TEST_CASE("Range allocator starts mixed ranges on their own pages", "[memory]")
+{
+  RangeAllocator allocator{8192, 1024};
+  auto buffer = allocator.Allocate(1000, 16, RangeAllocationType::Linear);
+  auto image = allocator.Allocate(100, 16, RangeAllocationType::Optimal);
+  REQUIRE((buffer && image));
+  REQUIRE(*image == 1024);
+  allocator.Free(*buffer);
+
+  // a group of a 600 byte buffer and an image padded to the next page relative to the start of the group.
+  auto group = allocator.Allocate(1024 + 300, 16, RangeAllocationType::Unknown);
+  REQUIRE(group.has_value());
+  REQUIRE(*group == 2048);
+  REQUIRE(*group % 1024 == 0);
+  REQUIRE((*group + 1024) % 1024 == 0);
+
+  auto nextBuffer = allocator.Allocate(100, 16, RangeAllocationType::Linear);
+  auto nextGroup = allocator.Allocate(100, 16, RangeAllocationType::Unknown);
+  REQUIRE((nextBuffer && nextGroup));
+  REQUIRE(*nextBuffer == 0);
+  REQUIRE(*nextGroup == 4096);
+  REQUIRE(allocator.CheckConsistency());
+}
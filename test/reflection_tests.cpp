@@ -0,0 +1,251 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/vk/pipeline/ShaderReflection.h"
+#include "gfx/vk/pipeline/SpecializationConstants.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+// The SPIR-V files in resources/spirv were assembled by hand to match the following GLSL code, they were not
+// generated by a compiler and contain no debug information (generator 0). reflection_glslang.comp.spv is also
+// assembled by hand but follows the output of glslangValidator -V -g (generator id, OpString, OpSource with the
+// source text, OpModuleProcessed, OpLine and BufferBlock storage buffers of SPIR-V 1.0).
+//
+// reflection.vert:
+//   layout(location = 0) in vec3 inPosition;
+//   layout(location = 1) in vec2 inTexCoord;
+//   layout(location = 2) in mat2 inTransform;
+//   layout(location = 4) in ivec4 inIndices;
+//   layout(set = 0, binding = 0) uniform CameraUBO { mat4 viewProjection; } camera;
+//   layout(push_constant) uniform PushConstants { mat4 model; vec4 color; } pushConstants;
+//   (also uses gl_VertexIndex)
+//
+// reflection.frag:
+//   layout(set = 0, binding = 0) uniform CameraUBO { mat4 viewProjection; } camera;
+//   layout(set = 0, binding = 2, rgba8) uniform image2D outputImage;
+//   layout(set = 1, binding = 0) uniform sampler2D textures[4];
+//   layout(set = 1, binding = 1) buffer Materials { vec4 color; } materials[];
+//   layout(constant_id = 3) const bool useTextures = true;
+//   layout(constant_id = 4) const float scale = 1.5;
+//   layout(push_constant) uniform PushConstants { layout(offset = 64) vec4 color; } pushConstants;
+//
+// reflection.comp:
+//   layout(local_size_x_id = 0, local_size_y = 4) in; // local_size_x defaults to 64
+//   layout(set = 0, binding = 0) buffer Data { uint values[]; } data;
+//   layout(set = 0, binding = 1) uniform samplerBuffer inputTexels;
+//   layout(set = 0, binding = 2, r32ui) uniform uimageBuffer outputTexels;
+//
+// reflection_spec_array.comp:
+//   layout(constant_id = 1) const uint numTextures = 2;
+//   layout(set = 0, binding = 0) uniform sampler2D textures[numTextures * 2];
+//   layout(set = 0, binding = 1) uniform sampler2D shadowMaps[numTextures];
+//   layout(set = 0, binding = 2) uniform sampler2D noiseTextures[2];
+//
+// reflection_glslang.comp:
+//   layout(local_size_x = 32) in;
+//   layout(set = 0, binding = 0, std430) buffer Values { uint values[]; } data;
+//   layout(set = 0, binding = 1) uniform Params { uint count; uint offset; } params;
+//   layout(set = 1, binding = 0) uniform sampler2D lut;
+//
+// reflection.mesh (GL_EXT_mesh_shader):
+//   layout(set = 0, binding = 0) buffer Meshlets { uint indices[]; } meshlets;
+
+namespace {
+
+  std::vector<std::uint32_t> LoadSpirv(const std::string& filename)
+  {
+    const auto path = std::filesystem::path{VKFW_TEST_RESOURCES} / "spirv" / filename;
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    REQUIRE(file.is_open());
+    std::vector<std::uint32_t> code(static_cast<std::size_t>(file.tellg()) / sizeof(std::uint32_t));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(code.data()), // NOLINT
+              static_cast<std::streamsize>(code.size() * sizeof(std::uint32_t)));
+    return code;
+  }
+}
+
+TEST_CASE("Reflection finds vertex inputs, uniform buffers and push constants", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.vert.spv")};
+
+  CHECK(reflection.GetStages() == vk::ShaderStageFlags{vk::ShaderStageFlagBits::eVertex});
+  CHECK(reflection.GetEntryPoint() == "main");
+
+  const auto& inputs = reflection.GetVertexInputs();
+  REQUIRE(inputs.size() == 5);
+  CHECK(inputs[0].m_location == 0);
+  CHECK(inputs[0].m_format == vk::Format::eR32G32B32Sfloat);
+  CHECK(inputs[0].m_name == "inPosition");
+  CHECK(inputs[1].m_format == vk::Format::eR32G32Sfloat);
+  CHECK(inputs[2].m_location == 2);
+  CHECK(inputs[3].m_location == 3);
+  CHECK(inputs[3].m_format == vk::Format::eR32G32Sfloat);
+  CHECK(inputs[4].m_location == 4);
+  CHECK(inputs[4].m_format == vk::Format::eR32G32B32A32Sint);
+
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 1);
+  CHECK(bindings[0].m_type == vk::DescriptorType::eUniformBuffer);
+  CHECK(bindings[0].m_name == "camera");
+  CHECK(reflection.GetNumDescriptorSets() == 1);
+
+  const auto& ranges = reflection.GetPushConstantRanges();
+  REQUIRE(ranges.size() == 1);
+  CHECK(ranges[0].offset == 0);
+  CHECK(ranges[0].size == 80);
+
+  std::array attributes{vk::VertexInputAttributeDescription{0, 0, vk::Format::eR32G32B32Sfloat, 0},
+                        vk::VertexInputAttributeDescription{1, 0, vk::Format::eR32G32Sfloat, 12}};
+  CHECK(reflection.ValidateVertexInput(attributes).size() == 3);
+}
+
+TEST_CASE("Reflection finds images, descriptor arrays and specialization constants", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.frag.spv")};
+
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 4);
+  CHECK(bindings[1].m_set == 0);
+  CHECK(bindings[1].m_binding == 2);
+  CHECK(bindings[1].m_type == vk::DescriptorType::eStorageImage);
+  CHECK(bindings[2].m_set == 1);
+  CHECK(bindings[2].m_type == vk::DescriptorType::eCombinedImageSampler);
+  CHECK(bindings[2].m_count == 4);
+  CHECK(bindings[3].m_type == vk::DescriptorType::eStorageBuffer);
+  CHECK(bindings[3].m_count == 0);
+  CHECK(reflection.GetNumDescriptorSets() == 2);
+  CHECK(reflection.GetVertexInputs().empty());
+
+  const auto& constants = reflection.GetSpecializationConstants();
+  REQUIRE(constants.size() == 2);
+  CHECK(constants[0].m_constantId == 3);
+  CHECK(constants[0].m_size == 4);
+  CHECK(constants[0].m_defaultValue == 1);
+  CHECK(constants[1].m_name == "scale");
+  CHECK(constants[1].m_defaultValue == 0x3FC00000U);
+
+  const auto& ranges = reflection.GetPushConstantRanges();
+  REQUIRE(ranges.size() == 1);
+  CHECK(ranges[0].offset == 64);
+  CHECK(ranges[0].size == 16);
+
+  const auto layoutBindings = reflection.GetLayoutBindings(1, 16);
+  REQUIRE(layoutBindings.size() == 2);
+  CHECK(layoutBindings[0].descriptorCount == 4);
+  CHECK(layoutBindings[1].descriptorCount == 16);
+  CHECK(reflection.ValidateLayoutBindings(1, layoutBindings).empty());
+}
+
+TEST_CASE("Reflection finds the workgroup size and texel buffers of compute shaders", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.comp.spv")};
+
+  CHECK(reflection.GetLocalSize() == std::array<std::uint32_t, 3>{64, 4, 1});
+  CHECK(reflection.GetLocalSizeSpecializationIds()[0] == 0U);
+  CHECK_FALSE(reflection.GetLocalSizeSpecializationIds()[1].has_value());
+
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 3);
+  CHECK(bindings[0].m_type == vk::DescriptorType::eStorageBuffer);
+  CHECK(bindings[0].m_name == "data");
+  CHECK(bindings[1].m_type == vk::DescriptorType::eUniformTexelBuffer);
+  CHECK(bindings[2].m_type == vk::DescriptorType::eStorageTexelBuffer);
+
+  std::array layoutBindings{
+      vk::DescriptorSetLayoutBinding{0, vk::DescriptorType::eStorageBufferDynamic, 1,
+                                     vk::ShaderStageFlagBits::eCompute},
+      vk::DescriptorSetLayoutBinding{1, vk::DescriptorType::eSampledImage, 1, vk::ShaderStageFlagBits::eCompute},
+      vk::DescriptorSetLayoutBinding{3, vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eCompute}};
+  CHECK(reflection.ValidateLayoutBindings(0, layoutBindings).size() == 2);
+  CHECK(reflection.FindUnusedBindings(0, layoutBindings) == std::vector<std::uint32_t>{3});
+}
+
+TEST_CASE("Reflection applies specialization constants to the workgroup size", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.comp.spv")};
+
+  vkfw_core::gfx::SpecializationConstants constants;
+  CHECK(reflection.GetLocalSize(constants) == std::array<std::uint32_t, 3>{64, 4, 1});
+  constants.Set(0U, 256U).Set(1U, 8U);
+  CHECK(reflection.GetLocalSize(constants) == std::array<std::uint32_t, 3>{256, 4, 1});
+}
+
+TEST_CASE("Reflections of pipeline stages are merged", "[reflection]")
+{
+  vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.vert.spv")};
+  reflection.Merge(vkfw_core::gfx::ShaderReflection{LoadSpirv("reflection.frag.spv")});
+
+  CHECK(reflection.GetStages() == (vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment));
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 4);
+  CHECK(bindings[0].m_stages == (vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment));
+  CHECK(bindings[1].m_stages == vk::ShaderStageFlags{vk::ShaderStageFlagBits::eFragment});
+  CHECK(reflection.GetPushConstantRanges().size() == 2);
+  CHECK(reflection.GetVertexInputs().size() == 5);
+
+  vkfw_core::gfx::ShaderReflection compute{LoadSpirv("reflection.comp.spv")};
+  CHECK_THROWS_AS(compute.Merge(vkfw_core::gfx::ShaderReflection{LoadSpirv("reflection.frag.spv")}),
+                  std::runtime_error);
+  CHECK_THROWS_AS(vkfw_core::gfx::ShaderReflection{std::vector<std::uint32_t>(8, 0)}, std::runtime_error);
+}
+
+TEST_CASE("Reflection reports arrays sized by specialization constants as unknown", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection_spec_array.comp.spv")};
+
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 3);
+  CHECK(bindings[0].m_count == 0);
+  CHECK(bindings[0].m_specializationDependentCount);
+  CHECK(bindings[1].m_count == 0);
+  CHECK(bindings[1].m_specializationDependentCount);
+  CHECK(bindings[2].m_count == 2);
+  CHECK_FALSE(bindings[2].m_specializationDependentCount);
+  REQUIRE(reflection.GetSpecializationConstants().size() == 1);
+  CHECK(reflection.GetSpecializationConstants()[0].m_name == "numTextures");
+  CHECK(reflection.GetLayoutBindings(0, 8)[0].descriptorCount == 8);
+}
+
+TEST_CASE("Reflection maps EXT mesh shaders and rejects unknown execution models", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection.mesh.spv")};
+  CHECK(reflection.GetStages() == vk::ShaderStageFlags{vk::ShaderStageFlagBits::eMeshNV});
+  REQUIRE(reflection.GetDescriptorBindings().size() == 1);
+  CHECK(reflection.GetDescriptorBindings()[0].m_name == "meshlets");
+
+  // replaces the execution model of the only entry point with one that does not exist.
+  auto code = LoadSpirv("reflection.comp.spv");
+  constexpr std::uint32_t opEntryPoint = 15;
+  std::size_t offset = 5;
+  while (offset < code.size() && (code[offset] & 0xFFFFU) != opEntryPoint) { offset += code[offset] >> 16U; }
+  REQUIRE(offset < code.size());
+  code[offset + 1] = 0xFFFFU;
+  CHECK_THROWS_AS(vkfw_core::gfx::ShaderReflection{code}, std::runtime_error);
+}
+
+TEST_CASE("Reflection skips the debug information of compiler generated code", "[reflection]")
+{
+  const vkfw_core::gfx::ShaderReflection reflection{LoadSpirv("reflection_glslang.comp.spv")};
+  CHECK(reflection.GetStages() == vk::ShaderStageFlags{vk::ShaderStageFlagBits::eCompute});
+  CHECK(reflection.GetEntryPoint() == "main");
+  CHECK(reflection.GetLocalSize() == std::array<std::uint32_t, 3>{32, 1, 1});
+  CHECK(reflection.GetNumDescriptorSets() == 2);
+
+  const auto& bindings = reflection.GetDescriptorBindings();
+  REQUIRE(bindings.size() == 3);
+  CHECK(bindings[0].m_set == 0);
+  CHECK(bindings[0].m_binding == 0);
+  CHECK(bindings[0].m_type == vk::DescriptorType::eStorageBuffer);
+  CHECK(bindings[0].m_name == "data");
+  CHECK(bindings[1].m_binding == 1);
+  CHECK(bindings[1].m_type == vk::DescriptorType::eUniformBuffer);
+  CHECK(bindings[1].m_name == "params");
+  CHECK(bindings[2].m_set == 1);
+  CHECK(bindings[2].m_type == vk::DescriptorType::eCombinedImageSampler);
+  CHECK(bindings[2].m_name == "lut");
+}
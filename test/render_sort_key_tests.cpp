@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/renderer/RenderSortKey.h"
+
+#include <algorithm>
+#include <vector>
+
+using vkfw_core::gfx::RenderSortKey;
+
+namespace {
+
+  // view space z coordinates, the camera looks along -z.
+  constexpr float nearDistance = -1.0f;
+  constexpr float farDistance = -100.0f;
+}
+
+TEST_CASE("Opaque sort keys order by pipeline, then material, then depth", "[sort]")
+{
+  const auto opaque = [](std::uint64_t pipeline, std::uint64_t material, float distance) {
+    return RenderSortKey::MakeOpaqueKey(RenderSortKey::MakeStateKey(pipeline, 0, material), distance);
+  };
+
+  REQUIRE(opaque(0, 5, farDistance) < opaque(1, 0, nearDistance));
+  REQUIRE(opaque(0, 0, farDistance) < opaque(0, 1, nearDistance));
+  REQUIRE(opaque(3, 2, nearDistance) < opaque(3, 2, farDistance));
+  REQUIRE(RenderSortKey::MakeStateKey(0, 1, 0) > RenderSortKey::MakeStateKey(0, 0, 0xFFFF));
+  REQUIRE(RenderSortKey::MakeStateKey(1, 0, 0) > RenderSortKey::MakeStateKey(0, 0xFFF, 0xFFFF));
+  REQUIRE(opaque(0x3FF, 0xFFFF, farDistance) >> 63 == 0);
+}
+
+TEST_CASE("Opaque elements sort front to back and transparent elements back to front", "[sort]")
+{
+  const auto state = RenderSortKey::MakeStateKey(2, 1, 7);
+  const std::vector<float> distances{-5.0f, -0.5f, -50.0f, 2.0f, -0.0f, -5.5f};
+
+  std::vector<std::uint64_t> opaqueKeys;
+  std::vector<std::uint64_t> transparentKeys;
+  for (auto distance : distances) {
+    opaqueKeys.push_back(RenderSortKey::MakeOpaqueKey(state, distance));
+    transparentKeys.push_back(RenderSortKey::MakeTransparentKey(state, distance));
+  }
+
+  auto byKey = [&distances](const std::vector<std::uint64_t>& keys) {
+    std::vector<float> sorted(distances.size());
+    std::vector<std::size_t> order(distances.size());
+    for (std::size_t i = 0; i < order.size(); ++i) { order[i] = i; }
+    std::sort(order.begin(), order.end(), [&keys](auto l, auto r) { return keys[l] < keys[r]; });
+    for (std::size_t i = 0; i < order.size(); ++i) { sorted[i] = distances[order[i]]; }
+    return sorted;
+  };
+  REQUIRE(byKey(opaqueKeys) == std::vector<float>{2.0f, -0.0f, -0.5f, -5.0f, -5.5f, -50.0f});
+  REQUIRE(byKey(transparentKeys) == std::vector<float>{-50.0f, -5.5f, -5.0f, -0.5f, -0.0f, 2.0f});
+
+  // transparent elements are drawn after all opaque ones and their depth comes before their state.
+  REQUIRE(*std::max_element(opaqueKeys.begin(), opaqueKeys.end())
+          < *std::min_element(transparentKeys.begin(), transparentKeys.end()));
+  REQUIRE(RenderSortKey::MakeTransparentKey(RenderSortKey::MakeStateKey(9, 0, 0), farDistance)
+          < RenderSortKey::MakeTransparentKey(RenderSortKey::MakeStateKey(0, 0, 0), nearDistance));
+}
+
+TEST_CASE("Sort key state ids wrap around to their bit range", "[sort]")
+{
+  REQUIRE(RenderSortKey::MakeStateKey(1024, 4096, 65536) == RenderSortKey::MakeStateKey(0, 0, 0));
+  REQUIRE(RenderSortKey::MakeStateKey(1025, 4097, 65537) == RenderSortKey::MakeStateKey(1, 1, 1));
+  REQUIRE(RenderSortKey::QuantizeDepth(-1.0f) < RenderSortKey::QuantizeDepth(1.0f));
+  REQUIRE(RenderSortKey::QuantizeDepth(1.0f) < (std::uint64_t{1} << RenderSortKey::DEPTH_BITS));
+}
@@ -0,0 +1,298 @@
+#include <catch2/catch.hpp>
+
+#include "core/resources/ResourceManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  std::atomic_int g_numLoads = 0;
+
+  struct TestResource
+  {
+    TestResource(const std::string& resId, const vkfw_core::gfx::LogicalDevice*, int value) : m_value{value}
+    {
+      if (resId == "broken") { throw std::runtime_error("Could not load resource."); }
+      g_numLoads += 1;
+    }
+
+    int m_value;
+  };
+
+  using TestManager = vkfw_core::ResourceManager<TestResource>;
+
+  vkfw_core::ResourceLoadDesc LoadDesc(vkfw_core::JobPriority priority, std::stop_token stopToken = {})
+  {
+    return vkfw_core::ResourceLoadDesc{priority, std::move(stopToken)};
+  }
+
+  /** Blocks the single thread of a job pool until released. */
+  struct PoolBlocker
+  {
+    explicit PoolBlocker(vkfw_core::JobPool& pool)
+    {
+      m_blocker = pool.Submit([future = m_release.get_future()]() mutable { future.wait(); });
+      while (pool.GetNumQueuedJobs() != 0) { std::this_thread::yield(); }
+    }
+    PoolBlocker(const PoolBlocker&) = delete;
+    PoolBlocker& operator=(const PoolBlocker&) = delete;
+    PoolBlocker(PoolBlocker&&) = delete;
+    PoolBlocker& operator=(PoolBlocker&&) = delete;
+    ~PoolBlocker() { Release(); }
+
+    void Release()
+    {
+      if (m_blocker.valid()) {
+        m_release.set_value();
+        m_blocker.get();
+      }
+    }
+
+    std::promise<void> m_release;
+    std::future<void> m_blocker;
+  };
+}
+
+TEST_CASE("Asynchronous requests for the same resource share one load", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{4};
+  TestManager manager{nullptr, &pool};
+  g_numLoads = 0;
+
+  std::vector<TestManager::ResourceFuture> futures;
+  std::vector<std::thread> requesters;
+  std::mutex futuresMutex;
+  for (int i = 0; i < 8; ++i) {
+    requesters.emplace_back([&manager, &futures, &futuresMutex]() {
+      auto future = manager.GetResourceAsync("shared", vkfw_core::ResourceLoadDesc{}, 7);
+      const std::scoped_lock lock{futuresMutex};
+      futures.push_back(std::move(future));
+    });
+  }
+  for (auto& requester : requesters) { requester.join(); }
+
+  const auto resource = futures[0].get();
+  REQUIRE(resource->m_value == 7);
+  for (const auto& future : futures) { REQUIRE(future.get() == resource); }
+  REQUIRE(g_numLoads == 1);
+  REQUIRE(manager.HasResource("shared"));
+  REQUIRE(manager.GetResource("shared", 7) == resource);
+  REQUIRE(manager.GetResourceAsync("shared", vkfw_core::ResourceLoadDesc{}, 7).get() == resource);
+  REQUIRE(g_numLoads == 1);
+}
+
+TEST_CASE("Blocking requests load queued resources on the calling thread", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{1};
+  TestManager manager{nullptr, &pool};
+  PoolBlocker blocker{pool};
+
+  auto future = manager.GetResourceAsync("queued", vkfw_core::ResourceLoadDesc{}, 3);
+  REQUIRE(manager.IsLoading("queued"));
+  // the only worker is blocked, so the resource is loaded by GetResource.
+  const auto resource = manager.GetResource("queued", 3);
+  REQUIRE(resource->m_value == 3);
+  REQUIRE(future.get() == resource);
+  REQUIRE(!manager.IsLoading("queued"));
+}
+
+TEST_CASE("Asynchronous loads are cancelled if all requests are stopped", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{1};
+  TestManager manager{nullptr, &pool};
+  PoolBlocker blocker{pool};
+
+  std::stop_source stop;
+  auto cancelled = manager.GetResourceAsync("cancelled", LoadDesc(vkfw_core::JobPriority::LOW, stop.get_token()), 1);
+  std::stop_source otherStop;
+  auto shared = manager.GetResourceAsync("shared", LoadDesc(vkfw_core::JobPriority::LOW, otherStop.get_token()), 2);
+  auto keeping = manager.GetResourceAsync("shared", vkfw_core::ResourceLoadDesc{}, 2);
+  stop.request_stop();
+  otherStop.request_stop();
+  blocker.Release();
+
+  REQUIRE_THROWS_AS(cancelled.get(), std::future_error);
+  REQUIRE(!manager.IsLoading("cancelled"));
+  REQUIRE(!manager.HasResource("cancelled"));
+  // the second request for the shared resource was not stopped.
+  REQUIRE(keeping.get()->m_value == 2);
+  REQUIRE(shared.get() == keeping.get());
+
+  // a new request loads a cancelled resource again.
+  REQUIRE(manager.GetResourceAsync("cancelled", vkfw_core::ResourceLoadDesc{}, 1).get()->m_value == 1);
+}
+
+TEST_CASE("Requests with a higher priority move queued loads forward", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{1};
+  TestManager manager{nullptr, &pool};
+  PoolBlocker blocker{pool};
+
+  auto prefetch = manager.GetResourceAsync("prefetch", LoadDesc(vkfw_core::JobPriority::LOW), 1);
+  auto other = pool.Submit([&prefetch]() {
+    return prefetch.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+  });
+  auto needed = manager.GetResourceAsync("prefetch", LoadDesc(vkfw_core::JobPriority::HIGH), 1);
+  blocker.Release();
+
+  REQUIRE(needed.get()->m_value == 1);
+  REQUIRE(other.get());
+  REQUIRE(prefetch.get() == needed.get());
+}
+
+TEST_CASE("Failed loads report their error and are not registered", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{2};
+  TestManager manager{nullptr, &pool};
+
+  auto broken = manager.GetResourceAsync("broken", vkfw_core::ResourceLoadDesc{}, 0);
+  REQUIRE_THROWS_AS(broken.get(), std::runtime_error);
+  REQUIRE(!manager.HasResource("broken"));
+  REQUIRE(!manager.IsLoading("broken"));
+  REQUIRE_THROWS_AS(manager.GetResource("broken", 0), std::runtime_error);
+}
+
+TEST_CASE("Destroying a resource manager cancels its queued loads", "[resource_manager]")
+{
+  vkfw_core::JobPool pool{1};
+  TestManager::ResourceFuture queued;
+  {
+    PoolBlocker blocker{pool};
+    TestManager manager{nullptr, &pool};
+    queued = manager.GetResourceAsync("queued", vkfw_core::ResourceLoadDesc{}, 1);
+  }
+  REQUIRE_THROWS_AS(queued.get(), std::runtime_error);
+}
+
+TEST_CASE("Resource managers without a job pool create their own", "[resource_manager]")
+{
+  TestManager manager{nullptr};
+  REQUIRE(manager.GetResourceAsync("owned", vkfw_core::ResourceLoadDesc{}, 5).get()->m_value == 5);
+}
+
+namespace {
+
+  struct SizedResource
+  {
+    SizedResource(const std::string&, const vkfw_core::gfx::LogicalDevice*, std::size_t deviceBytes)
+        : m_deviceBytes{deviceBytes}
+    {
+    }
+
+    [[nodiscard]] vkfw_core::ResourceFootprint GetFootprint() const { return {10, m_deviceBytes}; }
+
+    std::size_t m_deviceBytes;
+  };
+
+  using SizedManager = vkfw_core::ResourceManager<SizedResource>;
+}
+
+TEST_CASE("Resources are released with their last user without a retention budget", "[resource_manager]")
+{
+  SizedManager manager{nullptr};
+  static_cast<void>(manager.GetResource("a", std::size_t{90}));
+  REQUIRE(!manager.HasResource("a"));
+
+  static_cast<void>(manager.GetResource("a", std::size_t{90}));
+  const auto statistics = manager.GetCacheStatistics();
+  REQUIRE(statistics.m_misses == 2);
+  REQUIRE(statistics.m_hits == 0);
+  REQUIRE(statistics.m_numRetained == 0);
+}
+
+TEST_CASE("The retention cache keeps recently used resources within its budget", "[resource_manager]")
+{
+  SizedManager manager{nullptr};
+  std::vector<std::string> evicted;
+  manager.SetEvictionCallback([&evicted](const std::string& resId, std::shared_ptr<SizedResource> resource) {
+    REQUIRE(resource != nullptr);
+    evicted.push_back(resId);
+  });
+  manager.SetRetentionBudget(250);
+
+  static_cast<void>(manager.GetResource("a", std::size_t{90}));
+  static_cast<void>(manager.GetResource("b", std::size_t{90}));
+  REQUIRE(manager.HasResource("a"));
+  REQUIRE(manager.HasResource("b"));
+  REQUIRE(manager.GetCacheStatistics().m_retainedFootprint.GetTotalBytes() == 200);
+
+  // a becomes the most recently used, so loading c evicts b.
+  static_cast<void>(manager.GetResource("a", std::size_t{90}));
+  static_cast<void>(manager.GetResource("c", std::size_t{90}));
+  REQUIRE(evicted == std::vector<std::string>{"b"});
+  REQUIRE(manager.HasResource("a"));
+  REQUIRE(!manager.HasResource("b"));
+  REQUIRE(manager.HasResource("c"));
+
+  const auto statistics = manager.GetCacheStatistics();
+  REQUIRE(statistics.m_misses == 3);
+  REQUIRE(statistics.m_hits == 1);
+  REQUIRE(statistics.m_retainedHits == 1);
+  REQUIRE(statistics.m_evictions == 1);
+  REQUIRE(statistics.m_numRetained == 2);
+  REQUIRE(statistics.m_retainedFootprint.m_cpuBytes == 20);
+  REQUIRE(statistics.m_retainedFootprint.m_deviceBytes == 180);
+
+  manager.ResetCacheStatistics();
+  REQUIRE(manager.GetCacheStatistics().m_hits == 0);
+  REQUIRE(manager.GetCacheStatistics().m_numRetained == 2);
+}
+
+TEST_CASE("Evicted resources live as long as the eviction callback keeps them", "[resource_manager]")
+{
+  SizedManager manager{nullptr};
+  std::vector<std::shared_ptr<SizedResource>> released;
+  manager.SetEvictionCallback([&released](const std::string&, std::shared_ptr<SizedResource> resource) {
+    released.push_back(std::move(resource));
+  });
+  manager.SetRetentionBudget(1000);
+
+  auto user = manager.GetResource("kept", std::size_t{500});
+  static_cast<void>(manager.GetResourceAsync("other", vkfw_core::ResourceLoadDesc{}, std::size_t{200}).get());
+  manager.SetRetentionBudget(300);
+  REQUIRE(released.size() == 1);
+  REQUIRE(released[0] == user);
+
+  // a resource larger than the budget is not retained, but its users keep it alive.
+  user.reset();
+  REQUIRE(manager.HasResource("kept"));
+  released.clear();
+  REQUIRE(!manager.HasResource("kept"));
+
+  manager.ClearRetained();
+  REQUIRE(released.size() == 1);
+  REQUIRE(manager.GetCacheStatistics().m_numRetained == 0);
+}
+
+TEST_CASE("Invalidated resources are loaded again while users keep the old one", "[resource_manager]")
+{
+  SizedManager manager{nullptr};
+  std::vector<std::string> evicted;
+  manager.SetEvictionCallback(
+      [&evicted](const std::string& resId, std::shared_ptr<SizedResource>) { evicted.push_back(resId); });
+  manager.SetRetentionBudget(1000);
+
+  auto user = manager.GetResource("changed", std::size_t{100});
+  static_cast<void>(manager.GetResource("other", std::size_t{100}));
+  REQUIRE(manager.GetLoadedResources().size() == 2);
+
+  manager.InvalidateResource("changed");
+  REQUIRE(evicted == std::vector<std::string>{"changed"});
+  REQUIRE(!manager.HasResource("changed"));
+  const auto loaded = manager.GetLoadedResources();
+  REQUIRE(loaded.size() == 1);
+  REQUIRE(loaded[0].first == "other");
+
+  auto reloaded = manager.GetResource("changed", std::size_t{200});
+  REQUIRE(reloaded != user);
+  REQUIRE(user->m_deviceBytes == 100);
+  REQUIRE(reloaded->m_deviceBytes == 200);
+}
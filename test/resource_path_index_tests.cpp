@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include "core/resources/ResourcePathIndex.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+  struct TemporaryDirectory
+  {
+    TemporaryDirectory()
+        : m_path{std::filesystem::temp_directory_path()
+                 / ("vkfw_path_index_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))}
+    {
+      std::filesystem::create_directories(m_path / "base" / "textures");
+      std::filesystem::create_directories(m_path / "extra" / "textures");
+    }
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+    TemporaryDirectory(TemporaryDirectory&&) = delete;
+    TemporaryDirectory& operator=(TemporaryDirectory&&) = delete;
+    ~TemporaryDirectory() { std::filesystem::remove_all(m_path); }
+
+    [[nodiscard]] std::string Get(const std::string& localName) const { return (m_path / localName).generic_string(); }
+
+    std::filesystem::path m_path;
+  };
+
+  void WriteFile(const std::string& filename) { std::ofstream{filename} << "data"; }
+}
+
+TEST_CASE("Resource path index resolves files in search order", "[resource_path_index]")
+{
+  TemporaryDirectory directory;
+  WriteFile(directory.Get("base/textures/both.png"));
+  WriteFile(directory.Get("extra/textures/both.png"));
+  WriteFile(directory.Get("extra/textures/extra.png"));
+
+  vkfw_core::ResourcePathIndex index{{directory.Get("base"), directory.Get("extra")}};
+  REQUIRE(index.FindLocation("textures/both.png") == directory.Get("base") + "/textures/both.png");
+  REQUIRE(index.FindLocation("textures/extra.png") == directory.Get("extra") + "/textures/extra.png");
+  REQUIRE(index.FindLocation("./textures/../textures/extra.png")
+          == directory.Get("extra") + "/./textures/../textures/extra.png");
+  REQUIRE(index.FindLocation("textures") == directory.Get("base") + "/textures");
+  REQUIRE(!index.FindLocation("textures/missing.png"));
+  REQUIRE(index.GetNumIndexedEntries() == 3);
+}
+
+TEST_CASE("Resource path index finds new files and forgets deleted ones after invalidation", "[resource_path_index]")
+{
+  TemporaryDirectory directory;
+  WriteFile(directory.Get("extra/textures/moved.png"));
+  vkfw_core::ResourcePathIndex index{{directory.Get("base"), directory.Get("extra")}};
+  REQUIRE(index.FindLocation("textures/moved.png") == directory.Get("extra") + "/textures/moved.png");
+
+  // a file missing from the index is searched again.
+  WriteFile(directory.Get("extra/textures/new.png"));
+  REQUIRE(index.FindLocation("textures/new.png") == directory.Get("extra") + "/textures/new.png");
+
+  WriteFile(directory.Get("base/textures/moved.png"));
+  std::filesystem::remove(directory.Get("extra/textures/moved.png"));
+  REQUIRE(index.FindLocation("textures/moved.png") == directory.Get("extra") + "/textures/moved.png");
+  index.Invalidate();
+  REQUIRE(index.FindLocation("textures/moved.png") == directory.Get("base") + "/textures/moved.png");
+}
+
+TEST_CASE("Resource path index checks the working directory for empty search directories", "[resource_path_index]")
+{
+  TemporaryDirectory directory;
+  WriteFile(directory.Get("extra/textures/both.png"));
+  vkfw_core::ResourcePathIndex index{{directory.Get("base"), "", directory.Get("extra")}};
+
+  const auto absoluteFile = directory.Get("base/absolute.png");
+  WriteFile(absoluteFile);
+  REQUIRE(index.FindLocation(absoluteFile) == absoluteFile);
+  REQUIRE(index.FindLocation("textures/both.png") == directory.Get("extra") + "/textures/both.png");
+}
+
+TEST_CASE("Resource path index follows directory symlinks and only rebuilds on request", "[resource_path_index]")
+{
+  TemporaryDirectory directory;
+  std::filesystem::create_directories(directory.Get("shared"));
+  WriteFile(directory.Get("shared/linked.png"));
+  std::error_code ec;
+  std::filesystem::create_directory_symlink(directory.Get("shared"), directory.Get("base/linked"), ec);
+  if (ec) {
+    WARN("Skipped, symbolic links cannot be created: " << ec.message());
+    return;
+  }
+
+  vkfw_core::ResourcePathIndex index{{directory.Get("base"), directory.Get("extra")}};
+  REQUIRE(index.GetNumIndexedEntries() == 3);
+  REQUIRE(index.FindLocation("linked/linked.png") == directory.Get("base") + "/linked/linked.png");
+
+  // a missing file is checked in the directories but does not rebuild the index.
+  WriteFile(directory.Get("extra/textures/new.png"));
+  REQUIRE(index.FindLocation("textures/new.png") == directory.Get("extra") + "/textures/new.png");
+  REQUIRE(index.GetNumIndexedEntries() == 3);
+  index.Rebuild();
+  REQUIRE(index.GetNumIndexedEntries() == 4);
+}
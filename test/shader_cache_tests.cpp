@@ -0,0 +1,122 @@
+#include <catch2/catch.hpp>
+
+#include "core/resources/ShaderCache.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  struct TemporaryDirectory
+  {
+    TemporaryDirectory()
+        : m_path{std::filesystem::temp_directory_path()
+                 / ("vkfw_shader_cache_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))}
+    {
+    }
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+    TemporaryDirectory(TemporaryDirectory&&) = delete;
+    TemporaryDirectory& operator=(TemporaryDirectory&&) = delete;
+    ~TemporaryDirectory() { std::filesystem::remove_all(m_path); }
+
+    std::filesystem::path m_path;
+  };
+
+  /** Creates code with the SPIR-V magic number of the given size in bytes. */
+  std::vector<std::uint32_t> MakeCode(std::size_t size, std::uint32_t value)
+  {
+    std::vector<std::uint32_t> code(size / sizeof(std::uint32_t), value);
+    code[0] = 0x07230203U;
+    return code;
+  }
+}
+
+TEST_CASE("Shader cache keys depend on source and compile options", "[shader_cache]")
+{
+  const auto key = vkfw_core::ShaderCache::ComputeKey("void main() {}", "vertex vulkan1.2");
+  REQUIRE(key.size() == 32);
+  REQUIRE(key == vkfw_core::ShaderCache::ComputeKey("void main() {}", "vertex vulkan1.2"));
+  REQUIRE(key != vkfw_core::ShaderCache::ComputeKey("void main() { }", "vertex vulkan1.2"));
+  REQUIRE(key != vkfw_core::ShaderCache::ComputeKey("void main() {}", "fragment vulkan1.2"));
+  REQUIRE(vkfw_core::ShaderCache::ComputeKey("ab", "c") != vkfw_core::ShaderCache::ComputeKey("b", "ca"));
+}
+
+TEST_CASE("Shader cache stores code across instances", "[shader_cache]")
+{
+  TemporaryDirectory directory;
+  const auto code = MakeCode(64, 42);
+  {
+    vkfw_core::ShaderCache cache{directory.m_path, 1024};
+    REQUIRE(!cache.Load("a"));
+    cache.Store("a", code);
+    REQUIRE(cache.Load("a") == code);
+    REQUIRE(cache.GetNumHits() == 1);
+    REQUIRE(cache.GetNumMisses() == 1);
+  }
+
+  vkfw_core::ShaderCache cache{directory.m_path, 1024};
+  REQUIRE(cache.GetNumEntries() == 1);
+  REQUIRE(cache.GetSize() == 64);
+  REQUIRE(cache.Load("a") == code);
+}
+
+TEST_CASE("Shader cache evicts the least recently used entries", "[shader_cache]")
+{
+  TemporaryDirectory directory;
+  vkfw_core::ShaderCache cache{directory.m_path, 1000};
+  cache.Store("a", MakeCode(400, 1));
+  cache.Store("b", MakeCode(400, 2));
+  REQUIRE(cache.Load("a"));
+
+  cache.Store("c", MakeCode(400, 3));
+  REQUIRE(cache.GetNumEntries() == 2);
+  REQUIRE(cache.GetSize() == 800);
+  REQUIRE(!cache.Load("b"));
+  REQUIRE(!std::filesystem::exists(directory.m_path / "b.spv"));
+  REQUIRE(cache.Load("a") == MakeCode(400, 1));
+  REQUIRE(cache.Load("c") == MakeCode(400, 3));
+
+  // storing a key again replaces its entry.
+  cache.Store("c", MakeCode(200, 4));
+  REQUIRE(cache.GetSize() == 600);
+
+  cache.SetBudget(300);
+  REQUIRE(cache.GetNumEntries() == 1);
+  REQUIRE(cache.Load("c") == MakeCode(200, 4));
+}
+
+TEST_CASE("Shader cache removes invalid entries", "[shader_cache]")
+{
+  TemporaryDirectory directory;
+  std::filesystem::create_directories(directory.m_path);
+  std::ofstream{directory.m_path / "broken.spv"} << "no SPIR-V";
+
+  vkfw_core::ShaderCache cache{directory.m_path, 1024};
+  REQUIRE(cache.GetNumEntries() == 1);
+  REQUIRE(!cache.Load("broken"));
+  REQUIRE(cache.GetNumEntries() == 0);
+  REQUIRE(cache.GetSize() == 0);
+  REQUIRE(!std::filesystem::exists(directory.m_path / "broken.spv"));
+}
+
+TEST_CASE("Shader cache removes temporary files of stores that did not finish", "[shader_cache]")
+{
+  TemporaryDirectory directory;
+  std::filesystem::create_directories(directory.m_path);
+  const auto staleFile = directory.m_path / "stale.spv.tmp";
+  const auto writtenFile = directory.m_path / "written.spv.tmp";
+  std::ofstream{staleFile} << "data";
+  std::ofstream{writtenFile} << "data";
+  std::filesystem::last_write_time(staleFile, std::filesystem::file_time_type::clock::now() - std::chrono::hours{1});
+
+  // temporary files that are not old may still be written by another process.
+  vkfw_core::ShaderCache cache{directory.m_path, 1024};
+  REQUIRE(cache.GetNumEntries() == 0);
+  REQUIRE(!std::filesystem::exists(staleFile));
+  REQUIRE(std::filesystem::exists(writtenFile));
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch.hpp>
+
+#include "gfx/vk/pipeline/SpecializationConstants.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+  /** Loads reflection.frag.spv with the specialization constants useTextures (bool, id 3) and scale (float, id 4). */
+  vkfw_core::gfx::ShaderReflection LoadFragmentReflection()
+  {
+    const auto path = std::filesystem::path{VKFW_TEST_RESOURCES} / "spirv" / "reflection.frag.spv";
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    REQUIRE(file.is_open());
+    std::vector<std::uint32_t> code(static_cast<std::size_t>(file.tellg()) / sizeof(std::uint32_t));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(code.data()), // NOLINT
+              static_cast<std::streamsize>(code.size() * sizeof(std::uint32_t)));
+    return vkfw_core::gfx::ShaderReflection{code};
+  }
+
+  template<typename T> T ReadValue(const vk::SpecializationInfo& info, std::uint32_t constantId)
+  {
+    for (std::uint32_t i = 0; i < info.mapEntryCount; ++i) {
+      const auto& entry = info.pMapEntries[i]; // NOLINT
+      if (entry.constantID != constantId) { continue; }
+      REQUIRE(entry.size == sizeof(T));
+      REQUIRE(entry.offset % sizeof(T) == 0);
+      T value{};
+      std::memcpy(&value, static_cast<const std::byte*>(info.pData) + entry.offset, sizeof(T)); // NOLINT
+      return value;
+    }
+    FAIL("constant not found");
+    return T{};
+  }
+}
+
+TEST_CASE("Specialization constants store typed values", "[specialization]")
+{
+  vkfw_core::gfx::SpecializationConstants constants;
+  CHECK(constants.IsEmpty());
+  constants.Set(2U, true).Set(0U, 1.5f).Set(1U, -3).Set(7U, 2.0);
+
+  const auto info = constants.GetInfo();
+  REQUIRE(info.mapEntryCount == 4);
+  CHECK(info.pMapEntries[0].constantID == 0); // NOLINT
+  CHECK(info.pMapEntries[3].constantID == 7); // NOLINT
+  CHECK(ReadValue<vk::Bool32>(info, 2) == VK_TRUE);
+  CHECK(ReadValue<float>(info, 0) == 1.5f);
+  CHECK(ReadValue<std::int32_t>(info, 1) == -3);
+  CHECK(ReadValue<double>(info, 7) == 2.0);
+
+  constants.Set(1U, 5).Set(2U, 4.0);
+  const auto updatedInfo = constants.GetInfo();
+  REQUIRE(updatedInfo.mapEntryCount == 4);
+  CHECK(ReadValue<std::int32_t>(updatedInfo, 1) == 5);
+  CHECK(ReadValue<double>(updatedInfo, 2) == 4.0);
+}
+
+TEST_CASE("Specialization constants are set by name", "[specialization]")
+{
+  const auto reflection = LoadFragmentReflection();
+  vkfw_core::gfx::SpecializationConstants constants;
+  constants.Set(reflection, "useTextures", false).Set(reflection, "scale", 0.5f);
+
+  const auto info = constants.GetInfo();
+  CHECK(ReadValue<vk::Bool32>(info, 3) == VK_FALSE);
+  CHECK(ReadValue<float>(info, 4) == 0.5f);
+  CHECK(constants.Validate(reflection).empty());
+
+  CHECK_THROWS_AS(constants.Set(reflection, "scale", 0.5), std::runtime_error);
+  CHECK_THROWS_AS(constants.Set(reflection, "unknown", 1), std::runtime_error);
+
+  constants.Set(4U, 1.0);
+  CHECK(constants.Validate(reflection).size() == 1);
+}
+
+TEST_CASE("Specialization constant hashes depend on values but not on order", "[specialization]")
+{
+  vkfw_core::gfx::SpecializationConstants first;
+  first.Set(0U, 16U).Set(1U, true);
+  vkfw_core::gfx::SpecializationConstants second;
+  second.Set(1U, true).Set(0U, 16U);
+  CHECK(first.GetHash() == second.GetHash());
+  CHECK(first == second);
+
+  second.Set(0U, 32U);
+  CHECK(first.GetHash() != second.GetHash());
+  CHECK_FALSE(first == second);
+
+  first.Merge(second);
+  CHECK(first == second);
+  CHECK(vkfw_core::gfx::SpecializationConstants{}.GetHash() != first.GetHash());
+}
+
+TEST_CASE("Pipeline specializations override the defaults of shaders per stage", "[specialization]")
+{
+  const auto reflection = LoadFragmentReflection();
+  vkfw_core::gfx::SpecializationConstants shaderDefaults;
+  shaderDefaults.Set(reflection, "scale", 2.0f).Set(reflection, "useTextures", true);
+
+  vkfw_core::gfx::PipelineSpecializations specializations;
+  specializations.Set(vk::ShaderStageFlagBits::eFragment, vkfw_core::gfx::SpecializationConstants{}.Set(4U, 3.0f));
+  specializations.Set(vk::ShaderStageFlagBits::eVertex, vkfw_core::gfx::SpecializationConstants{}.Set(3U, false));
+
+  std::vector<vk::PipelineShaderStageCreateInfo> stageInfos(2);
+  stageInfos[0].stage = vk::ShaderStageFlagBits::eVertex;
+  stageInfos[1].stage = vk::ShaderStageFlagBits::eFragment;
+  specializations.Reset(stageInfos.size());
+  specializations.Apply(0, stageInfos[0], vkfw_core::gfx::SpecializationConstants{}, reflection);
+  specializations.Apply(1, stageInfos[1], shaderDefaults, reflection);
+
+  REQUIRE(stageInfos[0].pSpecializationInfo != nullptr);
+  CHECK(ReadValue<vk::Bool32>(*stageInfos[0].pSpecializationInfo, 3) == VK_FALSE);
+  REQUIRE(stageInfos[1].pSpecializationInfo != nullptr);
+  CHECK(ReadValue<float>(*stageInfos[1].pSpecializationInfo, 4) == 3.0f);
+  CHECK(ReadValue<vk::Bool32>(*stageInfos[1].pSpecializationInfo, 3) == VK_TRUE);
+
+  const auto hash = specializations.GetHash();
+  specializations.Set(vk::ShaderStageFlagBits::eFragment, vkfw_core::gfx::SpecializationConstants{}.Set(4U, 1.0));
+  CHECK_THROWS_AS(specializations.Apply(1, stageInfos[1], shaderDefaults, reflection), std::runtime_error);
+  specializations.Reset(stageInfos.size());
+  CHECK(specializations.GetHash() != hash);
+}
+
+TEST_CASE("Pipeline specializations replace values set for the same stages", "[specialization]")
+{
+  const auto reflection = LoadFragmentReflection();
+  vkfw_core::gfx::PipelineSpecializations specializations;
+  std::vector<vk::PipelineShaderStageCreateInfo> stageInfos(1);
+  stageInfos[0].stage = vk::ShaderStageFlagBits::eFragment;
+
+  specializations.Set(vk::ShaderStageFlagBits::eFragment, vkfw_core::gfx::SpecializationConstants{}.Set(4U, 3.0f));
+  specializations.Set(vk::ShaderStageFlagBits::eFragment, vkfw_core::gfx::SpecializationConstants{}.Set(3U, false));
+  specializations.Reset(stageInfos.size());
+  specializations.Apply(0, stageInfos[0], vkfw_core::gfx::SpecializationConstants{}, reflection);
+  REQUIRE(stageInfos[0].pSpecializationInfo != nullptr);
+  CHECK(stageInfos[0].pSpecializationInfo->mapEntryCount == 1);
+  CHECK(ReadValue<vk::Bool32>(*stageInfos[0].pSpecializationInfo, 3) == VK_FALSE);
+
+  specializations.Clear();
+  specializations.Reset(stageInfos.size());
+  specializations.Apply(0, stageInfos[0], vkfw_core::gfx::SpecializationConstants{}, reflection);
+  CHECK(stageInfos[0].pSpecializationInfo == nullptr);
+}
@@ -0,0 +1,159 @@
+#include <catch2/catch.hpp>
+
+#include "core/job_pool.h"
+#include "core/resources/TextureManager.h"
+#include "headless_application.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <stop_token>
+#include <string>
+
+namespace {
+
+  struct DecodedImage
+  {
+    std::unique_ptr<stbi_uc, decltype(&stbi_image_free)> m_data{nullptr, stbi_image_free};
+    int m_width = 0;
+    int m_height = 0;
+  };
+
+  DecodedImage Decode(const std::filesystem::path& filename, bool flip)
+  {
+    stbi_set_flip_vertically_on_load_thread(flip ? 1 : 0);
+    DecodedImage image;
+    int channels = 0;
+    image.m_data.reset(stbi_load(filename.string().c_str(), &image.m_width, &image.m_height, &channels, 4));
+    return image;
+  }
+
+  std::vector<std::filesystem::path> FindImages(const std::filesystem::path& directory)
+  {
+    std::vector<std::filesystem::path> images;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{directory}) {
+      const auto extension = entry.path().extension();
+      if (entry.is_regular_file() && (extension == ".png" || extension == ".jpg" || extension == ".tga")) {
+        images.push_back(entry.path());
+      }
+    }
+    return images;
+  }
+}
+
+TEST_CASE("Flipping on load is set per decoding thread", "[texture_decode]")
+{
+  const auto filename = std::filesystem::path{VKFW_TEST_RESOURCES} / "dummy.png";
+  vkfw_core::JobPool pool{2};
+  auto flipped = pool.Submit([&filename]() { return Decode(filename, true); });
+  auto upright = pool.Submit([&filename]() { return Decode(filename, false); });
+  const auto flippedImage = flipped.get();
+  const auto uprightImage = upright.get();
+  REQUIRE(flippedImage.m_data != nullptr);
+  REQUIRE(uprightImage.m_data != nullptr);
+
+  const auto lineSize = static_cast<std::size_t>(uprightImage.m_width) * 4;
+  const auto height = static_cast<std::size_t>(uprightImage.m_height);
+  for (std::size_t y = 0; y < height; ++y) {
+    const auto* flippedLine = flippedImage.m_data.get() + y * lineSize;
+    const auto* uprightLine = uprightImage.m_data.get() + (height - 1 - y) * lineSize;
+    REQUIRE(std::equal(flippedLine, flippedLine + lineSize, uprightLine));
+  }
+}
+
+TEST_CASE("Texture handles resolve to the dummy texture until the upload is finished", "[texture_decode][gpu]")
+{
+  // the dummy texture is loaded with the device, so the requested texture needs another id.
+  const auto textureDirectory = std::filesystem::temp_directory_path() / "vkfw_tests" / "textures";
+  std::filesystem::create_directories(textureDirectory);
+  std::filesystem::copy_file(std::filesystem::path{VKFW_TEST_RESOURCES} / "dummy.png", textureDirectory / "async.png",
+                             std::filesystem::copy_options::overwrite_existing);
+  auto app = vkfw_test::HeadlessApplication::Create([&textureDirectory](vkfw_core::cfg::Configuration& config) {
+    config.m_resourceDirs.push_back(textureDirectory.string());
+  });
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  auto* textureManager = device.GetTextureManager();
+  const auto handle = textureManager->GetResourceAsync("async.png", false, false);
+  REQUIRE_FALSE(handle.IsReady());
+  REQUIRE(handle.Get() == device.GetDummyTexture());
+  REQUIRE(handle.GetResource() == nullptr);
+  REQUIRE(textureManager->GetNumPendingLoads() == 1);
+
+  textureManager->WaitForLoads(device.GetQueue(0, 0));
+  REQUIRE(handle.IsReady());
+  REQUIRE_FALSE(handle.HasFailed());
+  REQUIRE(handle.Get() != device.GetDummyTexture());
+  REQUIRE(handle.Get() == handle.GetResource().get());
+  REQUIRE(textureManager->GetNumPendingLoads() == 0);
+  // later requests find the uploaded texture.
+  REQUIRE(textureManager->GetResourceAsync("async.png", false, false).Get() == handle.Get());
+}
+
+TEST_CASE("Shared texture loads are only cancelled when all requests stopped", "[texture_decode][gpu]")
+{
+  const auto textureDirectory = std::filesystem::temp_directory_path() / "vkfw_tests" / "textures";
+  std::filesystem::create_directories(textureDirectory);
+  std::filesystem::copy_file(std::filesystem::path{VKFW_TEST_RESOURCES} / "dummy.png", textureDirectory / "shared.png",
+                             std::filesystem::copy_options::overwrite_existing);
+  auto app = vkfw_test::HeadlessApplication::Create([&textureDirectory](vkfw_core::cfg::Configuration& config) {
+    config.m_resourceDirs.push_back(textureDirectory.string());
+  });
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  auto* textureManager = device.GetTextureManager();
+  std::stop_source firstStop;
+  std::stop_source secondStop;
+  vkfw_core::ResourceLoadDesc firstDesc;
+  firstDesc.m_stopToken = firstStop.get_token();
+  vkfw_core::ResourceLoadDesc secondDesc;
+  secondDesc.m_stopToken = secondStop.get_token();
+  const auto first = textureManager->GetResourceAsync("shared.png", false, false, {}, {}, firstDesc);
+  const auto second = textureManager->GetResourceAsync("shared.png", false, false, {}, {}, secondDesc);
+  REQUIRE(textureManager->GetNumPendingLoads() == 1);
+
+  firstStop.request_stop();
+  textureManager->WaitForLoads(device.GetQueue(0, 0));
+  REQUIRE(second.IsReady());
+  REQUIRE(first.Get() == second.Get());
+}
+
+// decodes all images of VKFW_TEXTURE_BENCHMARK_DIR (or the test resources), e.g., tests_core "[texture_decode]".
+TEST_CASE("Texture decode throughput", "[.][texture_decode][benchmark]")
+{
+  const auto* benchmarkDir = std::getenv("VKFW_TEXTURE_BENCHMARK_DIR"); // NOLINT(concurrency-mt-unsafe)
+  const auto images = FindImages(benchmarkDir != nullptr ? benchmarkDir : VKFW_TEST_RESOURCES);
+  REQUIRE(!images.empty());
+
+  BENCHMARK("serial")
+  {
+    std::size_t texels = 0;
+    for (const auto& image : images) {
+      const auto decoded = Decode(image, true);
+      texels += static_cast<std::size_t>(decoded.m_width) * static_cast<std::size_t>(decoded.m_height);
+    }
+    return texels;
+  };
+
+  vkfw_core::JobPool pool{vkfw_core::JobPool::GetDefaultNumThreads()};
+  BENCHMARK("job pool")
+  {
+    std::vector<std::future<DecodedImage>> decoded;
+    decoded.reserve(images.size());
+    for (const auto& image : images) {
+      decoded.push_back(pool.Submit([&image]() { return Decode(image, true); }));
+    }
+    std::size_t texels = 0;
+    for (auto& result : decoded) {
+      const auto image = result.get();
+      texels += static_cast<std::size_t>(image.m_width) * static_cast<std::size_t>(image.m_height);
+    }
+    return texels;
+  };
+}
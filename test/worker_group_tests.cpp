@@ -0,0 +1,102 @@
+#include <catch2/catch.hpp>
+
+#include "core/worker_group.h"
+#include "gfx/vk/ParallelCommandRecorder.h"
+#include "headless_application.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+using vkfw_core::WorkerGroup;
+
+TEST_CASE("Worker group runs the task once per thread", "[worker_group]")
+{
+  WorkerGroup workers{4};
+  REQUIRE(workers.GetNumThreads() == 4);
+
+  for (int run = 0; run < 100; ++run) {
+    std::vector<int> calls(workers.GetNumThreads(), 0);
+    workers.Run([&calls](std::size_t threadIndex) { calls[threadIndex] += 1; });
+    REQUIRE(std::all_of(calls.begin(), calls.end(), [](int count) { return count == 1; }));
+  }
+}
+
+TEST_CASE("Worker group with a single thread runs on the caller", "[worker_group]")
+{
+  WorkerGroup workers{0};
+  REQUIRE(workers.GetNumThreads() == 1);
+
+  auto callerId = std::this_thread::get_id();
+  std::thread::id runId;
+  workers.Run([&runId](std::size_t) { runId = std::this_thread::get_id(); });
+  REQUIRE(runId == callerId);
+}
+
+TEST_CASE("Worker group rethrows exceptions after all threads finished", "[worker_group]")
+{
+  WorkerGroup workers{3};
+  std::atomic_int finished = 0;
+  REQUIRE_THROWS_AS(workers.Run([&finished](std::size_t threadIndex) {
+    if (threadIndex == 2) { throw std::runtime_error("worker failed"); }
+    finished += 1;
+  }),
+                    std::runtime_error);
+  REQUIRE(finished == 2);
+
+  // the group is still usable after a failed run.
+  workers.Run([&finished](std::size_t) { finished += 1; });
+  REQUIRE(finished == 5);
+}
+
+TEST_CASE("Worker group scaling", "[.][benchmark][worker_group]")
+{
+  constexpr std::size_t numItems = 1 << 20;
+  std::vector<std::uint32_t> items(numItems);
+  std::iota(items.begin(), items.end(), 0U);
+
+  for (std::size_t numThreads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{8}}) {
+    WorkerGroup workers{numThreads};
+    std::vector<std::uint64_t> sums(numThreads);
+    BENCHMARK("sum " + std::to_string(numThreads) + " threads")
+    {
+      workers.Run([&items, &sums, numThreads](std::size_t threadIndex) {
+        auto begin = items.begin() + static_cast<std::ptrdiff_t>(numItems * threadIndex / numThreads);
+        auto end = items.begin() + static_cast<std::ptrdiff_t>(numItems * (threadIndex + 1) / numThreads);
+        sums[threadIndex] = std::accumulate(begin, end, std::uint64_t{0});
+      });
+      return std::accumulate(sums.begin(), sums.end(), std::uint64_t{0});
+    };
+  }
+}
+
+TEST_CASE("Parallel secondary command buffer recording scaling", "[.][benchmark][worker_group][gpu]")
+{
+  auto app = vkfw_test::HeadlessApplication::Create();
+  if (!app) { return; }
+
+  auto& device = app->GetDevice();
+  constexpr std::size_t numCommands = 1 << 14;
+  const vk::Viewport viewport{0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+  const vk::Rect2D scissor{vk::Offset2D{0, 0}, vk::Extent2D{64, 64}};
+
+  for (std::size_t numThreads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{8}}) {
+    vkfw_core::gfx::ParallelCommandRecorder recorder{&device, "BenchmarkRecorder", 0, numThreads, 1};
+    BENCHMARK("record " + std::to_string(numThreads) + " threads")
+    {
+      auto cmdBuffer = vkfw_core::gfx::CommandBuffer::beginSingleTimeSubmit(&device, "BenchmarkCmdBuffer",
+                                                                            "Benchmark", device.GetCommandPool(0));
+      recorder.Record(0, cmdBuffer, vk::CommandBufferInheritanceInfo{},
+                      [&viewport, &scissor, numThreads](vkfw_core::gfx::CommandBuffer& secondary, std::size_t) {
+                        // dynamic state commands need no pipeline, so only the recording cost is measured.
+                        for (std::size_t i = 0; i < numCommands / numThreads; ++i) {
+                          secondary.GetHandle().setViewport(0, viewport);
+                          secondary.GetHandle().setScissor(0, scissor);
+                        }
+                      });
+      vkfw_core::gfx::CommandBuffer::endSingleTimeSubmitAndWait(&device, device.GetQueue(0, 0), cmdBuffer);
+    };
+  }
+}